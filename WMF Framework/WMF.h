@@ -10,6 +10,8 @@ FOUNDATION_EXPORT const unsigned char WMFVersionString[];
 #import <WMF/NSURL+WMFLinkParsing.h>
 #import <WMF/NSCharacterSet+WMFLinkParsing.h>
 #import <WMF/NSURLComponents+WMFLinkParsing.h>
+#import <WMF/WMFWikiURL.h>
+#import <WMF/WMFImageSourceURL.h>
 #import <WMF/WMFBlockDefinitions.h>
 #import <WMF/WMFComparison.h>
 #import <WMF/WMFHashing.h>
@@ -61,7 +63,12 @@ FOUNDATION_EXPORT const unsigned char WMFVersionString[];
 #import <WMF/WikipediaAppUtils.h>
 #import <WMF/NSRegularExpression+HTML.h>
 #import <WMF/NSString+WMFHTMLParsing.h>
-#import <WMF/WMFHTMLElement.h>
+#import <WMF/WMFHTMLElementTree.h>
+#import <WMF/WMFTextScanning.h>
+#import <WMF/WMFTextBuffer.h>
+#import <WMF/WMFHTMLTokenizer.h>
+#import <WMF/WMFTextCleanup.h>
+#import <WMF/WMFHTMLRenderCache.h>
 #import <WMF/WMFImageURLParsing.h>
 #import <WMF/MWKLanguageLink.h>
 
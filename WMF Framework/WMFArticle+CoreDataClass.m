@@ -1,13 +1,45 @@
 #import "WMFArticle+CoreDataClass.h"
 #import <WMF/WMF-Swift.h>
+#import <WMF/WMFArticle+Extensions.h>
+#import <WMF/NSURL+WMFLinkParsing.h>
 
 @interface WMFArticle () {
     NSArray<ReadingList *> * _Nullable _sortedNonDefaultReadingLists;
+    WMFInMemoryURLKey * _Nullable _inMemoryKey;
 }
 @end
 
 @implementation WMFArticle
 
+- (nullable WMFInMemoryURLKey *)inMemoryKey {
+    // Declared in WMFArticle+Extensions.h. Kept here with the other cached value, and cleared when key or variant are set.
+    @synchronized (self) {
+        if (_inMemoryKey != nil) {
+            return _inMemoryKey;
+        }
+        _inMemoryKey = self.URL.wmf_inMemoryKey;
+        return _inMemoryKey;
+    }
+}
+
+- (void)setKey:(nullable NSString *)key {
+    [self willChangeValueForKey:@"key"];
+    [self setPrimitiveValue:[key copy] forKey:@"key"];
+    [self didChangeValueForKey:@"key"];
+    @synchronized (self) {
+        _inMemoryKey = nil;
+    }
+}
+
+- (void)setVariant:(nullable NSString *)variant {
+    [self willChangeValueForKey:@"variant"];
+    [self setPrimitiveValue:[variant copy] forKey:@"variant"];
+    [self didChangeValueForKey:@"variant"];
+    @synchronized (self) {
+        _inMemoryKey = nil;
+    }
+}
+
 - (NSArray<ReadingList *> *)sortedNonDefaultReadingLists {
     @synchronized (self) {
         if (_sortedNonDefaultReadingLists != nil) {
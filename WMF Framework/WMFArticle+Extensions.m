@@ -23,10 +23,6 @@
     return value;
 }
 
-- (nullable WMFInMemoryURLKey *)inMemoryKey {
-    return self.URL.wmf_inMemoryKey;
-}
-
 - (BOOL)isAnyVariantSaved {
     NSUInteger savedCount = [self.managedObjectContext countOfSavedArticleVariantsWithKey:self.key error:nil];
     NSAssert(savedCount < 2, @"More than one article variant marked as saved for key '%@'", self.key);
@@ -80,6 +80,8 @@ final class WMFSourceEditorTextFrameworkMediator: NSObject {
     
     private let textKit1Storage: WMFSourceEditorTextStorage?
     private let textKit2Storage: NSTextContentStorage?
+    // Whether TextKit 2 paragraphs start inside a comment. TextKit 1 storage keeps its own.
+    private let textKit2LexerCheckpoints = WMFSourceEditorLexerCheckpoints()
     
     let textView: UITextView
     private(set) var formatters: [WMFSourceEditorFormatter] = []
@@ -149,8 +151,10 @@ final class WMFSourceEditorTextFrameworkMediator: NSObject {
         
         if needsTextKit2 {
             textKit2Storage?.delegate = self
+            textKit2Storage?.textStorage?.delegate = self
         } else {
             textKit1Storage?.storageDelegate = self
+            textKit1Storage?.delegate = self
         }
     }
 
@@ -213,10 +217,7 @@ final class WMFSourceEditorTextFrameworkMediator: NSObject {
                     let colors = self.colors
                     let fonts = self.fonts
                     let range = NSRange(location: 0, length: attributedString.length)
-                    for formatter in formatters {
-                        formatter.update(colors, in: attributedString, in: range)
-                        formatter.update(fonts, in: attributedString, in: range)
-                    }
+                    WMFSourceEditorFormatter.update(colors, fonts: fonts, in: attributedString, in: range, formatters: formatters)
                 })
             }
         } else {
@@ -229,6 +230,15 @@ final class WMFSourceEditorTextFrameworkMediator: NSObject {
         }
     }
     
+    // TextKit 2 highlights each paragraph as it's laid out, so only TextKit 1 needs to be told what's visible
+    var needsVisibleRange: Bool {
+        return !needsTextKit2
+    }
+    
+    func visibleRangeDidChange(_ visibleRange: NSRange) {
+        textKit1Storage?.visibleRange = visibleRange
+    }
+    
     func selectionState(selectedDocumentRange: NSRange) -> WMFSourceEditorSelectionState {
         
         if needsTextKit2 {
@@ -444,24 +454,20 @@ final class WMFSourceEditorTextFrameworkMediator: NSObject {
             return nil
         }
         
-        // Pulling the paragraph element that contains the selection will have an attributed string with the populated attributes
-        if #available(iOS 16.0, *) {
-            guard let textKit2Storage,
-                  let layoutManager = textView.textLayoutManager,
-                  let selectedDocumentTextRange = textKit2Storage.textRangeForDocumentNSRange(selectedDocumentRange),
-                  let paragraphElement = layoutManager.textLayoutFragment(for: selectedDocumentTextRange.location)?.textElement as? NSTextParagraph,
-                  let paragraphRange = paragraphElement.elementRange else {
-                return nil
-            }
-            
-            guard let selectedParagraphRange = textKit2Storage.offsetDocumentNSRangeWithParagraphRange(documentNSRange: selectedDocumentRange, paragraphRange: paragraphRange) else {
-                return nil
-            }
-            
-            return (NSMutableAttributedString(attributedString: paragraphElement.attributedString), selectedParagraphRange)
+        // Highlight the paragraph that contains the start of the selection, the same way it's highlighted for layout. Its range comes from the text, so it doesn't depend on layout or walking text locations.
+        guard let textKit2Storage,
+              let textStorage = textKit2Storage.textStorage,
+              selectedDocumentRange.location <= textStorage.length else {
+            return nil
         }
         
-        return nil
+        let paragraphRange = (textStorage.string as NSString).paragraphRange(for: NSRange(location: selectedDocumentRange.location, length: 0))
+        guard let paragraph = textContentStorage(textKit2Storage, textParagraphWith: paragraphRange) else {
+            return nil
+        }
+        
+        let selectedParagraphRange = NSRange(location: selectedDocumentRange.location - paragraphRange.location, length: selectedDocumentRange.length)
+        return (NSMutableAttributedString(attributedString: paragraph.attributedString), selectedParagraphRange)
     }
     
     private var fullAttributedString: NSMutableAttributedString? {
@@ -517,51 +523,58 @@ extension WMFSourceEditorTextFrameworkMediator: WMFSourceEditorStorageDelegate {
     }
 }
 
-// MARK: NSTextContentStorageDelegate
-
- extension WMFSourceEditorTextFrameworkMediator: NSTextContentStorageDelegate {
+// MARK: NSTextStorageDelegate
 
-    func textContentStorage(_ textContentStorage: NSTextContentStorage, textParagraphWith range: NSRange) -> NSTextParagraph? {
+extension WMFSourceEditorTextFrameworkMediator: NSTextStorageDelegate {
+    
+    func textStorage(_ textStorage: NSTextStorage, willProcessEditing editedMask: NSTextStorage.EditActions, range editedRange: NSRange, changeInLength delta: Int) {
         
-        guard needsTextKit2 else {
-            return nil
+        guard needsTextKit2,
+              editedMask.contains(.editedCharacters) else {
+            return
         }
         
-        guard let originalText = textContentStorage.textStorage?.attributedSubstring(from: range),
-              originalText.length > 0 else {
-            return nil
+        // TextKit 2 only asks for the edited paragraphs again, so the ones after an edit that opened or closed a comment are marked as edited too
+        let rangeToHighlightAgain = textKit2LexerCheckpoints.rangeToHighlightAgain(inFullAttributedString: textStorage, afterEditingRange: editedRange, changeInLength: delta)
+        if rangeToHighlightAgain.location != NSNotFound {
+            textStorage.edited(.editedAttributes, range: rangeToHighlightAgain, changeInLength: 0)
         }
-        let attributedString = NSMutableAttributedString(attributedString: originalText)
-        let paragraphRange = NSRange(location: 0, length: originalText.length)
+    }
+    
+    func textStorage(_ textStorage: NSTextStorage, didProcessEditing editedMask: NSTextStorage.EditActions, range editedRange: NSRange, changeInLength delta: Int) {
         
-        for formatter in formatters {
-            formatter.addSyntaxHighlighting(to: attributedString, in: paragraphRange)
+        guard editedMask.contains(.editedCharacters) else {
+            return
         }
         
-        return NSTextParagraph(attributedString: attributedString)
+        // Keeps find matches up to date while typing with the find bar open
+        findAndReplaceFormatter?.updateMatches(inFullAttributedString: textStorage, afterEditingRange: editedRange, changeInLength: delta)
     }
 }
 
-// MARK: NSTextContentStorage Extensions
+// MARK: NSTextContentStorageDelegate
+
+ extension WMFSourceEditorTextFrameworkMediator: NSTextContentStorageDelegate {
 
-fileprivate extension NSTextContentStorage {
-    func textRangeForDocumentNSRange(_ documentNSRange: NSRange) -> NSTextRange? {
-        guard let start = location(documentRange.location, offsetBy: documentNSRange.location),
-                let end = location(start, offsetBy: documentNSRange.length) else {
+    func textContentStorage(_ textContentStorage: NSTextContentStorage, textParagraphWith range: NSRange) -> NSTextParagraph? {
+        
+        guard needsTextKit2 else {
             return nil
         }
         
-        return NSTextRange(location: start, end: end)
-    }
-    
-    func offsetDocumentNSRangeWithParagraphRange(documentNSRange: NSRange, paragraphRange: NSTextRange) -> NSRange? {
-        let startOffset = offset(from: documentRange.location, to: paragraphRange.location)
-        let newNSRange = NSRange(location: documentNSRange.location - startOffset, length: documentNSRange.length)
+        guard let textStorage = textContentStorage.textStorage else {
+            return nil
+        }
         
-        guard newNSRange.location >= 0 else {
+        let originalText = textStorage.attributedSubstring(from: range)
+        guard originalText.length > 0 else {
             return nil
         }
+        let attributedString = NSMutableAttributedString(attributedString: originalText)
         
-        return newNSRange
+        textKit2LexerCheckpoints.addSyntaxHighlighting(toParagraphAttributedString: attributedString, documentRange: range, fullAttributedString: textStorage, formatters: formatters)
+        findAndReplaceFormatter?.addSyntaxHighlighting(toParagraphAttributedString: attributedString, documentRange: range)
+        
+        return NSTextParagraph(attributedString: attributedString)
     }
 }
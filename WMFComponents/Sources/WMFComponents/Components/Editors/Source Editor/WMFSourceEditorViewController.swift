@@ -477,6 +477,16 @@ extension WMFSourceEditorViewController: UITextViewDelegate {
         
         delegate?.sourceEditorDidChangeText(self, didChangeText: textView.attributedText.string != viewModel.initialText)
     }
+    
+    public func scrollViewDidScroll(_ scrollView: UIScrollView) {
+        guard textFrameworkMediator.needsVisibleRange else {
+            return
+        }
+        
+        if let visibleRange = textView.visibleRange {
+            textFrameworkMediator.visibleRangeDidChange(visibleRange)
+        }
+    }
 }
 
 // MARK: - WMFEditorToolbarExpandingViewDelegate
@@ -739,8 +749,9 @@ extension WMFSourceEditorViewController: WMFSourceEditorFindAndReplaceScrollDele
 fileprivate extension UITextView {
 
     var visibleRange: NSRange? {
-        if let start = closestPosition(to: contentOffset) {
-            if let end = characterRange(at: CGPoint(x: contentOffset.x + bounds.maxX, y: contentOffset.y + bounds.maxY))?.end {
+        // A scroll view's bounds origin is its content offset
+        if let start = closestPosition(to: bounds.origin) {
+            if let end = characterRange(at: CGPoint(x: bounds.maxX, y: bounds.maxY))?.end {
                 return NSRange(location: offset(from: beginningOfDocument, to: start), length: offset(from: start, to: end))
             }
         }
@@ -11,9 +11,15 @@ extern NSString *const WMFSourceEditorCustomKeyColorGreen;
 - (instancetype)initWithColors:(nonnull WMFSourceEditorColors *)colors fonts:(nonnull WMFSourceEditorFonts *)fonts;
 - (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range;
 
+/// Highlights @c range with each of @c formatters in order, lexing the wikitext in it once for all of them.
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters;
+
 - (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range;
 - (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range;
 
+/// Updates each of @c formatters to @c colors and @c fonts and restyles @c range for all of them at once, without highlighting it again.
++ (void)updateColors:(WMFSourceEditorColors *)colors fonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters;
+
 - (BOOL)canEvaluateAttributedString: (NSAttributedString *)attributedString againstRange: (NSRange)range;
 @end
 
@@ -1,7 +1,20 @@
 #import "WMFSourceEditorFormatter.h"
+#import "WMFSourceEditorFormatter_Private.h"
+#import "WMFSourceEditorLexingSnapshot.h"
 #import "WMFSourceEditorColors.h"
 #import "WMFSourceEditorFonts.h"
 
+@implementation WMFSourceEditorStyleRole
+
++ (instancetype)roleWithKey:(NSString *)key attributes:(NSDictionary<NSAttributedStringKey, id> *)attributes {
+    WMFSourceEditorStyleRole *role = [[WMFSourceEditorStyleRole alloc] init];
+    role->_key = [key copy];
+    role->_attributes = [attributes copy];
+    return role;
+}
+
+@end
+
 @implementation WMFSourceEditorFormatter
 
 #pragma mark - Common Custom Attributed String Keys
@@ -14,16 +27,132 @@ NSString * const WMFSourceEditorCustomKeyColorGreen = @"WMFSourceEditorKeyColorG
     self = [super init];
     return self;
 }
+
 - (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    NSAssert(false, @"Formatters must override this method.");
+    if (self.tokenKinds == 0) {
+        NSAssert(false, @"Formatters must override this method or highlight tokens.");
+        return;
+    }
+    [WMFSourceEditorFormatter addSyntaxHighlightingToAttributedString:attributedString inRange:range formatters:@[self]];
+}
+
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return 0;
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
+    NSAssert(false, @"Formatters with token kinds must override this method.");
+}
+
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters {
+    [self addSyntaxHighlightingToAttributedString:attributedString inRange:range formatters:formatters lexerState:(WMFSourceEditorLexerState){0}];
+}
+
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters lexerState:(WMFSourceEditorLexerState)lexerState {
+    
+    WMFSourceEditorTokenKindSet kinds = [self tokenKindsOfFormatters:formatters];
+    if (kinds == 0 || ![formatters.firstObject canEvaluateAttributedString:attributedString againstRange:range]) {
+        [self addSyntaxHighlightingToAttributedString:attributedString inRange:range formatters:formatters tokens:NULL];
+        return;
+    }
+    
+    WMFSourceEditorLexingSnapshot *snapshot = [[WMFSourceEditorLexingSnapshot alloc] initWithString:attributedString.string range:range lexerState:lexerState kinds:kinds];
+    [snapshot lex];
+    [self addSyntaxHighlightingToAttributedString:attributedString inRange:range formatters:formatters tokens:snapshot.tokens];
+}
+
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters tokens:(const WMFSourceEditorTokenList *)tokens {
+    for (WMFSourceEditorFormatter *formatter in formatters) {
+        if (formatter.tokenKinds == 0) {
+            [formatter addSyntaxHighlightingToAttributedString:attributedString inRange:range];
+        } else if (tokens) {
+            [formatter addSyntaxHighlightingToAttributedString:attributedString inRange:range tokens:tokens];
+        }
+    }
+}
+
++ (WMFSourceEditorTokenKindSet)tokenKindsOfFormatters:(NSArray<WMFSourceEditorFormatter *> *)formatters {
+    WMFSourceEditorTokenKindSet kinds = 0;
+    for (WMFSourceEditorFormatter *formatter in formatters) {
+        kinds |= formatter.tokenKinds;
+    }
+    return kinds;
 }
 
 - (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    NSAssert(false, @"Formatters must override this method.");
+    [self updateColorAttributesWithColors:colors];
+    [WMFSourceEditorFormatter restyleAttributedString:attributedString inRange:range formatters:@[self]];
 }
 
 - (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    NSAssert(false, @"Formatters must override this method.");
+    [self updateFontAttributesWithFonts:fonts];
+    [WMFSourceEditorFormatter restyleAttributedString:attributedString inRange:range formatters:@[self]];
+}
+
++ (void)updateColors:(WMFSourceEditorColors *)colors fonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters {
+    for (WMFSourceEditorFormatter *formatter in formatters) {
+        [formatter updateColorAttributesWithColors:colors];
+        [formatter updateFontAttributesWithFonts:fonts];
+    }
+    [self restyleAttributedString:attributedString inRange:range formatters:formatters];
+}
+
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
+}
+
+- (void)updateFontAttributesWithFonts:(WMFSourceEditorFonts *)fonts {
+}
+
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[];
+}
+
++ (void)restyleAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters {
+    
+    if (![formatters.firstObject canEvaluateAttributedString:attributedString againstRange:range]) {
+        return;
+    }
+    
+    NSMutableArray<WMFSourceEditorStyleRole *> *roles = [[NSMutableArray alloc] init];
+    for (WMFSourceEditorFormatter *formatter in formatters) {
+        [roles addObjectsFromArray:formatter.styleRoles];
+    }
+    NSAssert(roles.count <= 64, @"Each role needs a bit of a run's role set.");
+    NSUInteger roleCount = MIN(roles.count, 64);
+    
+    // Runs with the same roles get the same attributes, which are merged once for each set of roles
+    NSMutableDictionary<NSNumber *, NSDictionary *> *attributesByRoleSet = [[NSMutableDictionary alloc] init];
+    [attributedString enumerateAttributesInRange:range options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired usingBlock:^(NSDictionary<NSAttributedStringKey,id> * _Nonnull attrs, NSRange runRange, BOOL * _Nonnull stop) {
+        uint64_t roleSet = 0;
+        for (NSUInteger i = 0; i < roleCount; i++) {
+            NSString *key = roles[i].key;
+            if (key == nil) {
+                roleSet |= (uint64_t)1 << i;
+                continue;
+            }
+            id value = attrs[key];
+            if ([value isKindOfClass:[NSNumber class]] && [(NSNumber *)value boolValue]) {
+                roleSet |= (uint64_t)1 << i;
+            }
+        }
+        if (roleSet == 0) {
+            return;
+        }
+        
+        NSNumber *roleSetKey = @(roleSet);
+        NSDictionary *attributes = attributesByRoleSet[roleSetKey];
+        if (!attributes) {
+            NSMutableDictionary *mergedAttributes = [[NSMutableDictionary alloc] init];
+            for (NSUInteger i = 0; i < roleCount; i++) {
+                if (roleSet & ((uint64_t)1 << i)) {
+                    [mergedAttributes addEntriesFromDictionary:roles[i].attributes];
+                }
+            }
+            attributes = [mergedAttributes copy];
+            attributesByRoleSet[roleSetKey] = attributes;
+        }
+        [attributedString addAttributes:attributes range:runRange];
+    }];
 }
 
 - (BOOL)canEvaluateAttributedString: (NSAttributedString *)attributedString againstRange: (NSRange)range {
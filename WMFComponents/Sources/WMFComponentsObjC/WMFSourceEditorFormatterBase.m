@@ -1,4 +1,5 @@
 #import "WMFSourceEditorFormatterBase.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 #import "WMFSourceEditorFonts.h"
 
@@ -46,30 +47,21 @@
     [attributedString addAttributes:self.attributes range:range];
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
-    
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.attributes];
     [mutAttributes setObject:colors.baseForegroundColor forKey:NSForegroundColorAttributeName];
     self.attributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-
-    [attributedString addAttributes:self.attributes range:range];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
-    
+- (void)updateFontAttributesWithFonts:(WMFSourceEditorFonts *)fonts {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.attributes];
     [mutAttributes setObject:fonts.baseFont forKey:NSFontAttributeName];
     self.attributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
+}
 
-    [attributedString addAttributes:self.attributes range:range];
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    // Every character starts out with the base attributes, which other formatters' roles then override
+    return @[[WMFSourceEditorStyleRole roleWithKey:nil attributes:self.attributes]];
 }
 
 @end
@@ -1,4 +1,5 @@
 #import "WMFSourceEditorFormatterBoldItalics.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 #import "WMFSourceEditorFonts.h"
 
@@ -9,10 +10,6 @@
 @property (nonatomic, strong) NSDictionary *italicsAttributes;
 @property (nonatomic, strong) NSDictionary *orangeAttributes;
 
-@property (nonatomic, strong) NSRegularExpression *boldItalicsRegex;
-@property (nonatomic, strong) NSRegularExpression *boldRegex;
-@property (nonatomic, strong) NSRegularExpression *italicsRegex;
-
 @end
 
 @implementation WMFSourceEditorFormatterBoldItalics
@@ -46,21 +43,17 @@ NSString * const WMFSourceEditorCustomKeyFontItalics = @"WMFSourceEditorKeyFontI
             NSFontAttributeName: fonts.italicsFont,
             WMFSourceEditorCustomKeyFontItalics: [NSNumber numberWithBool:YES]
         };
-        
-        _boldItalicsRegex = [[NSRegularExpression alloc] initWithPattern:@"('{5})(.*?)('{5})" options:0 error:nil];
-        _boldRegex = [[NSRegularExpression alloc] initWithPattern:@"('{3})(.*?)('{3})" options:0 error:nil];
-        _italicsRegex = [[NSRegularExpression alloc] initWithPattern:@"((?<!')'{2}(?!'))(.*?)((?<!')'{2}(?!'))" options:0 error:nil];
     }
     return self;
 }
 
 #pragma mark - Overrides
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindBoldItalics) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindBold) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindItalics);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     // Reset
     [attributedString removeAttribute:WMFSourceEditorCustomKeyFontBoldItalics range:range];
@@ -70,169 +63,103 @@ NSString * const WMFSourceEditorCustomKeyFontItalics = @"WMFSourceEditorKeyFontI
     NSMutableArray *boldItalicsRanges = [[NSMutableArray alloc] init];
     NSMutableArray *boldOnlyRanges = [[NSMutableArray alloc] init];
     
-    [self.boldItalicsRegex enumerateMatchesInString:attributedString.string
-                                       options:0
-                                         range:range
-                                    usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                        NSRange fullMatch = [result rangeAtIndex:0];
-                                        NSRange openingRange = [result rangeAtIndex:1];
-                                        NSRange textRange = [result rangeAtIndex:2];
-                                        NSRange closingRange = [result rangeAtIndex:3];
-
-                                        if (fullMatch.location != NSNotFound) {
-                                            [boldItalicsRanges addObject:[NSValue valueWithRange:fullMatch]];
-                                        }
-        
-                                        if (openingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:openingRange];
-                                        }
-
-                                        if (textRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.boldItalicsAttributes range:textRange];
-                                        }
-
-                                        if (closingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:closingRange];
-                                        }
-                                    }];
-    
-    [self.boldRegex enumerateMatchesInString:attributedString.string
-                                       options:0
-                                         range:range
-                                    usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                        NSRange fullMatch = [result rangeAtIndex:0];
-                                        NSRange openingRange = [result rangeAtIndex:1];
-                                        NSRange textRange = [result rangeAtIndex:2];
-                                        NSRange closingRange = [result rangeAtIndex:3];
+    size_t count = 0;
+    const WMFSourceEditorToken *boldItalicsTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindBoldItalics, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &boldItalicsTokens[i];
+        [boldItalicsRanges addObject:[NSValue valueWithRange:WMFSourceEditorTokenRange(token)]];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.boldItalicsAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
     
-                                        BOOL alreadyBoldAndItalic = NO;
-                                        for (NSValue *value in boldItalicsRanges) {
-                                            NSRange boldItalicRange = value.rangeValue;
-                                            if (NSIntersectionRange(boldItalicRange, fullMatch).length != 0) {
-                                                alreadyBoldAndItalic = YES;
-                                            }
-                                        }
-
-                                        if (alreadyBoldAndItalic) {
-                                            return;
-                                        }
+    const WMFSourceEditorToken *boldTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindBold, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &boldTokens[i];
+        NSRange fullMatch = WMFSourceEditorTokenRange(token);
         
-                                        if (fullMatch.location != NSNotFound) {
-                                            [boldOnlyRanges addObject:[NSValue valueWithRange:fullMatch]];
-                                        }
+        BOOL alreadyBoldAndItalic = NO;
+        for (NSValue *value in boldItalicsRanges) {
+            NSRange boldItalicRange = value.rangeValue;
+            if (NSIntersectionRange(boldItalicRange, fullMatch).length != 0) {
+                alreadyBoldAndItalic = YES;
+            }
+        }
         
-                                        if (openingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:openingRange];
-                                        }
-
-                                        if (textRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.boldAttributes range:textRange];
-                                        }
-
-                                        if (closingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:closingRange];
-                                        }
-                                    }];
+        if (alreadyBoldAndItalic) {
+            continue;
+        }
+        
+        [boldOnlyRanges addObject:[NSValue valueWithRange:fullMatch]];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.boldAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
     
-    [self.italicsRegex enumerateMatchesInString:attributedString.string
-                                       options:0
-                                         range:range
-                                    usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                        NSRange fullMatch = [result rangeAtIndex:0];
-                                        NSRange openingRange = [result rangeAtIndex:1];
-                                        NSRange textRange = [result rangeAtIndex:2];
-                                        NSRange closingRange = [result rangeAtIndex:3];
+    const WMFSourceEditorToken *italicsTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindItalics, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &italicsTokens[i];
+        NSRange fullMatch = WMFSourceEditorTokenRange(token);
+        NSRange textRange = WMFSourceEditorTokenContentRange(token);
         
-                                        BOOL alreadyBoldAndItalic = NO;
-                                        for (NSValue *value in boldItalicsRanges) {
-                                            NSRange boldItalicRange = value.rangeValue;
-                                            if (NSIntersectionRange(boldItalicRange, fullMatch).length != 0) {
-                                                alreadyBoldAndItalic = YES;
-                                            }
-                                        }
+        BOOL alreadyBoldAndItalic = NO;
+        for (NSValue *value in boldItalicsRanges) {
+            NSRange boldItalicRange = value.rangeValue;
+            if (NSIntersectionRange(boldItalicRange, fullMatch).length != 0) {
+                alreadyBoldAndItalic = YES;
+            }
+        }
+        
+        if (alreadyBoldAndItalic) {
+            continue;
+        }
         
-                                        if (alreadyBoldAndItalic) {
-                                            return;
-                                        }
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
         
-                                        if (openingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:openingRange];
-                                        }
-
-                                        if (textRange.location != NSNotFound) {
-                                            
-                                            // Italicize match
-                                            [attributedString addAttributes:self.italicsAttributes range:textRange];
-                                            
-                                            // Dig deeper to see if some areas need bold italic font instead. In this case previous line effects will be undone.
-                                            for (NSValue *value in boldOnlyRanges) {
-                                                NSRange boldRange = value.rangeValue;
-                                                
-                                                NSRange intersectionRange = NSIntersectionRange(boldRange, fullMatch);
-                                                BOOL boldSurroundsItalic = intersectionRange.length > 0 && boldRange.location < fullMatch.location && boldRange.length > fullMatch.length;
-                                                BOOL italicSurroundsBold = intersectionRange.length > 0 && fullMatch.location < boldRange.location && fullMatch.length > boldRange.length;
-                                                
-                                                if (boldSurroundsItalic) {
-                                                    
-                                                    // Reset range styling to prep for bold italic
-                                                    [attributedString removeAttribute:NSFontAttributeName range:textRange];
-                                                    [attributedString removeAttribute:WMFSourceEditorCustomKeyFontItalics range:textRange];
-                                                    [attributedString removeAttribute:WMFSourceEditorCustomKeyFontBold range:intersectionRange];
-                                                    
-                                                    // Bold italicize instead
-                                                    [attributedString addAttributes:self.boldItalicsAttributes range:textRange];
-                                                    
-                                                } else if (italicSurroundsBold) {
-                                                    
-                                                    // Reset range styling to prep for bold italic
-                                                    [attributedString removeAttribute:NSFontAttributeName range:intersectionRange];
-                                                    [attributedString removeAttribute:WMFSourceEditorCustomKeyFontItalics range:intersectionRange];
-                                                    [attributedString removeAttribute:WMFSourceEditorCustomKeyFontBold range:intersectionRange];
-                                                    
-                                                    // Bold italicize instead
-                                                    [attributedString addAttributes:self.boldItalicsAttributes range:intersectionRange];
-                                                }
-                                            }
-                                        }
-
-                                        if (closingRange.location != NSNotFound) {
-                                            [attributedString addAttributes:self.orangeAttributes range:closingRange];
-                                        }
-                                    }];
+        // Italicize match
+        [attributedString addAttributes:self.italicsAttributes range:textRange];
+        
+        // Dig deeper to see if some areas need bold italic font instead. In this case previous line effects will be undone.
+        for (NSValue *value in boldOnlyRanges) {
+            NSRange boldRange = value.rangeValue;
+            
+            NSRange intersectionRange = NSIntersectionRange(boldRange, fullMatch);
+            BOOL boldSurroundsItalic = intersectionRange.length > 0 && boldRange.location < fullMatch.location && boldRange.length > fullMatch.length;
+            BOOL italicSurroundsBold = intersectionRange.length > 0 && fullMatch.location < boldRange.location && fullMatch.length > boldRange.length;
+            
+            if (boldSurroundsItalic) {
+                
+                // Reset range styling to prep for bold italic
+                [attributedString removeAttribute:NSFontAttributeName range:textRange];
+                [attributedString removeAttribute:WMFSourceEditorCustomKeyFontItalics range:textRange];
+                [attributedString removeAttribute:WMFSourceEditorCustomKeyFontBold range:intersectionRange];
+                
+                // Bold italicize instead
+                [attributedString addAttributes:self.boldItalicsAttributes range:textRange];
+                
+            } else if (italicSurroundsBold) {
+                
+                // Reset range styling to prep for bold italic
+                [attributedString removeAttribute:NSFontAttributeName range:intersectionRange];
+                [attributedString removeAttribute:WMFSourceEditorCustomKeyFontItalics range:intersectionRange];
+                [attributedString removeAttribute:WMFSourceEditorCustomKeyFontBold range:intersectionRange];
+                
+                // Bold italicize instead
+                [attributedString addAttributes:self.boldItalicsAttributes range:intersectionRange];
+            }
+        }
+        
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
-    
-    // First update orangeAttributes property so that addSyntaxHighlighting has the correct color the next time it is called
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.orangeAttributes];
     [mutAttributes setObject:colors.orangeForegroundColor forKey:NSForegroundColorAttributeName];
     self.orangeAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    // Then update entire attributed string orange color
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorOrange
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.orangeAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
-    
-    // First update font attributes properties so that addSyntaxHighlighting has the correct fonts the next time it is called
+- (void)updateFontAttributesWithFonts:(WMFSourceEditorFonts *)fonts {
     NSMutableDictionary *mutBoldItalicsAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.boldItalicsAttributes];
     [mutBoldItalicsAttributes setObject:fonts.boldItalicsFont forKey:NSFontAttributeName];
     self.boldItalicsAttributes = [[NSDictionary alloc] initWithDictionary:mutBoldItalicsAttributes];
@@ -244,43 +171,15 @@ NSString * const WMFSourceEditorCustomKeyFontItalics = @"WMFSourceEditorKeyFontI
     NSMutableDictionary *mutItalicsAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.italicsAttributes];
     [mutItalicsAttributes setObject:fonts.italicsFont forKey:NSFontAttributeName];
     self.italicsAttributes = [[NSDictionary alloc] initWithDictionary:mutItalicsAttributes];
-    
-    // Then update entire attributed string fonts
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontBoldItalics
-                     inRange:range
-                     options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.boldItalicsAttributes range:localRange];
-            }
-        }
-    }];
+}
 
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontBold
-                     inRange:range
-                     options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.boldAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontItalics
-                     inRange:range
-                     options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.italicsAttributes range:localRange];
-            }
-        }
-    }];
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorOrange attributes:self.orangeAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontBoldItalics attributes:self.boldItalicsAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontBold attributes:self.boldAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontItalics attributes:self.italicsAttributes]
+    ];
 }
 
 #pragma mark - Public
@@ -1,11 +1,11 @@
 #import "WMFSourceEditorFormatterComment.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterComment ()
 
 @property (nonatomic, strong) NSDictionary *commentMarkupAttributes;
 @property (nonatomic, strong) NSDictionary *commentContentAttributes;
-@property (nonatomic, strong) NSRegularExpression *commentRegex;
 
 @end
 
@@ -28,46 +28,31 @@ NSString * const WMFSourceEditorCustomKeyCommentContent = @"WMFSourceEditorCusto
             NSForegroundColorAttributeName: colors.grayForegroundColor,
             WMFSourceEditorCustomKeyCommentContent: [NSNumber numberWithBool:YES]
         };
-
-        _commentRegex = [[NSRegularExpression alloc] initWithPattern:@"(<!--)(.*?)(-->)" options:0 error:nil];
     }
 
     return self;
 }
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindComment);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     [attributedString removeAttribute:WMFSourceEditorCustomKeyCommentMarkup range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyCommentContent range:range];
     
-    [self.commentRegex enumerateMatchesInString:attributedString.string
-                                        options:0
-                                          range:range
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange fullMatch = [result rangeAtIndex:0];
-            NSRange openingRange = [result rangeAtIndex:1];
-            NSRange contentRange = [result rangeAtIndex:2];
-            NSRange closingRange = [result rangeAtIndex:3];
-
-            if (openingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.commentMarkupAttributes range:openingRange];
-            }
-        
-            if (contentRange.location != NSNotFound) {
-                [attributedString addAttributes:self.commentContentAttributes range:contentRange];
-            }
-
-            if (closingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.commentMarkupAttributes range:closingRange];
-            }
-        }];
+    size_t count = 0;
+    const WMFSourceEditorToken *commentTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindComment, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &commentTokens[i];
+        [attributedString addAttributes:self.commentMarkupAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.commentContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.commentMarkupAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
 
     NSMutableDictionary *mutMarkupAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.commentMarkupAttributes];
     [mutMarkupAttributes setObject:colors.grayForegroundColor forKey:NSForegroundColorAttributeName];
@@ -76,38 +61,13 @@ NSString * const WMFSourceEditorCustomKeyCommentContent = @"WMFSourceEditorCusto
     NSMutableDictionary *mutContentAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.commentContentAttributes];
     [mutContentAttributes setObject:colors.grayForegroundColor forKey:NSForegroundColorAttributeName];
     self.commentContentAttributes = [[NSDictionary alloc] initWithDictionary:mutContentAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyCommentMarkup
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.commentMarkupAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyCommentContent
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.commentContentAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    // No special font handling needed
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyCommentMarkup attributes:self.commentMarkupAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyCommentContent attributes:self.commentContentAttributes]
+    ];
 }
 
 #pragma mark - Public
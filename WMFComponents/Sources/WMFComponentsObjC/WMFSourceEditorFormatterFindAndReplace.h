@@ -11,10 +11,14 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, assign, readonly) NSRange lastReplacedRange;
 
 - (void)startMatchSessionWithFullAttributedString: (NSMutableAttributedString *)fullAttributedString searchText:(NSString *)searchText;
+/// Highlights the matches and replaced text in a TextKit 2 paragraph, which is at @c documentRange in the full attributed string. Found with a binary search, so it stays fast with many paragraphs and matches.
+- (void)addSyntaxHighlightingToParagraphAttributedString:(NSMutableAttributedString *)attributedString documentRange:(NSRange)documentRange;
 - (void)highlightNextMatchInFullAttributedString:(NSMutableAttributedString *)fullAttributedString afterRangeValue:(nullable NSValue *)afterRangeValue;
 - (void)highlightPreviousMatchInFullAttributedString: (NSMutableAttributedString *)fullAttributedString;
 - (void)replaceSingleMatchInFullAttributedString:(NSMutableAttributedString *)fullAttributedString withReplaceText:(NSString *)replaceText textView: (UITextView *)textView;
 - (void)replaceAllMatchesInFullAttributedString:(NSMutableAttributedString *)fullAttributedString withReplaceText:(NSString *)replaceText textView: (UITextView *)textView;
+/// Updates the matches of an open match session after the text changed, by moving the ones after the edit and searching again only around it. Call after every character edit while a session is open.
+- (void)updateMatchesInFullAttributedString:(NSMutableAttributedString *)fullAttributedString afterEditingRange:(NSRange)editedRange changeInLength:(NSInteger)delta;
 - (void)endMatchSessionWithFullAttributedString: (NSMutableAttributedString *)fullAttributedString;
 
 @end
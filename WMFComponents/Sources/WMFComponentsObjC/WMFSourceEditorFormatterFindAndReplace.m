@@ -1,4 +1,5 @@
 #import "WMFSourceEditorFormatterFindAndReplace.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 #import "WMFSourceEditorFonts.h"
 
@@ -7,9 +8,9 @@
 @property (nonatomic, assign, readwrite) NSInteger selectedMatchIndex;
 
 @property (nonatomic, copy, nullable) NSString *searchText;
+// Set for search text with regular expression syntax, and for plain text that needs full case folding, which is matched as a literal regular expression. Other search text is matched with WMFSourceEditorLiteralMatches.
 @property (nonatomic, strong, nullable) NSRegularExpression *searchRegex;
 
-@property (nonatomic, copy) NSAttributedString *fullAttributedString;
 @property (nonatomic, strong) NSMutableArray<NSValue *> *matchesAgainstFullAttributedString;
 @property (nonatomic, strong) NSMutableArray<NSValue *> *replacesAgainstFullAttributedString;
 
@@ -17,8 +18,117 @@
 @property (nonatomic, copy) NSDictionary *selectedMatchAttributes;
 @property (nonatomic, copy) NSDictionary *replacedMatchAttributes;
 
+// Set while this formatter replaces text itself, so it doesn't also update matches for the edit as if someone else made it
+@property (nonatomic, assign) BOOL isReplacing;
+
 @end
 
+/// Folds @c character for comparing to ASCII text ignoring case, the same as a case insensitive regular expression. Characters that fold to something other than ASCII are returned as they are, so they never compare equal. Characters that fold to more than one character, like ß to "ss", can't be compared one at a time, so text with them is searched with a regular expression instead.
+static inline unichar WMFSourceEditorFoldCharacter(unichar character) {
+    if (character < 128) {
+        return (character >= 'A' && character <= 'Z') ? character + ('a' - 'A') : character;
+    }
+    switch (character) {
+        case 0x017F: // LATIN SMALL LETTER LONG S
+            return 's';
+        case 0x212A: // KELVIN SIGN
+            return 'k';
+        default:
+            return character;
+    }
+}
+
+/// @return The characters whose full case folding in Unicode's CaseFolding.txt is more than one character, like ß to "ss" and ﬁ to "fi".
+static NSCharacterSet *WMFSourceEditorMultipleCharacterFoldSet(void) {
+    static NSCharacterSet *characterSet;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        static const NSRange ranges[] = {
+            {0x00DF, 1}, {0x0130, 1}, {0x0149, 1}, {0x01F0, 1}, {0x0390, 1}, {0x03B0, 1}, {0x0587, 1},
+            {0x1E96, 5}, {0x1E9E, 1}, {0x1F50, 1}, {0x1F52, 1}, {0x1F54, 1}, {0x1F56, 1}, {0x1F80, 48},
+            {0x1FB2, 3}, {0x1FB6, 2}, {0x1FBC, 1}, {0x1FC2, 3}, {0x1FC6, 2}, {0x1FCC, 1}, {0x1FD2, 2},
+            {0x1FD6, 2}, {0x1FE2, 3}, {0x1FE6, 2}, {0x1FF2, 3}, {0x1FF6, 2}, {0x1FFC, 1}, {0xFB00, 7},
+            {0xFB13, 5}};
+        NSMutableCharacterSet *mutableCharacterSet = [[NSMutableCharacterSet alloc] init];
+        for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); i++) {
+            [mutableCharacterSet addCharactersInRange:ranges[i]];
+        }
+        characterSet = [mutableCharacterSet copy];
+    });
+    return characterSet;
+}
+
+/// @return Whether @c range of @c string has a character that folds to more than one character when ignoring case.
+static BOOL WMFSourceEditorHasMultipleCharacterFold(NSString *string, NSRange range) {
+    return [string rangeOfCharacterFromSet:WMFSourceEditorMultipleCharacterFoldSet() options:NSLiteralSearch range:range].location != NSNotFound;
+}
+
+/// @return A case insensitive regular expression that matches @c searchText literally, with full case folding.
+static NSRegularExpression *WMFSourceEditorLiteralRegex(NSString *searchText) {
+    return [[NSRegularExpression alloc] initWithPattern:searchText options:NSRegularExpressionCaseInsensitive | NSRegularExpressionIgnoreMetacharacters error:nil];
+}
+
+/// Finds the non-overlapping occurrences of the ASCII @c searchText in @c range of @c string ignoring case, from the start of the range, with Boyer-Moore-Horspool.
+static NSArray<NSValue *> *WMFSourceEditorLiteralMatches(NSString *string, NSString *searchText, NSRange range) {
+    NSMutableArray<NSValue *> *matches = [[NSMutableArray alloc] init];
+    NSUInteger length = range.length;
+    NSUInteger searchLength = searchText.length;
+    if (searchLength == 0 || searchLength > length) {
+        return matches;
+    }
+    
+    unichar *characters = malloc(length * sizeof(unichar));
+    unichar *pattern = malloc(searchLength * sizeof(unichar));
+    [string getCharacters:characters range:range];
+    [searchText getCharacters:pattern range:NSMakeRange(0, searchLength)];
+    
+    // How far the search text can move when the character under its last one doesn't match
+    NSUInteger shifts[128];
+    for (NSUInteger i = 0; i < 128; i++) {
+        shifts[i] = searchLength;
+    }
+    for (NSUInteger i = 0; i < searchLength; i++) {
+        pattern[i] = WMFSourceEditorFoldCharacter(pattern[i]);
+        if (i < searchLength - 1) {
+            shifts[pattern[i]] = searchLength - 1 - i;
+        }
+    }
+    
+    NSUInteger location = 0;
+    while (location <= length - searchLength) {
+        NSUInteger i = searchLength;
+        while (i > 0 && WMFSourceEditorFoldCharacter(characters[location + i - 1]) == pattern[i - 1]) {
+            i--;
+        }
+        if (i == 0) {
+            [matches addObject:[NSValue valueWithRange:NSMakeRange(range.location + location, searchLength)]];
+            location += searchLength;
+        } else {
+            unichar last = WMFSourceEditorFoldCharacter(characters[location + searchLength - 1]);
+            location += last < 128 ? shifts[last] : searchLength;
+        }
+    }
+    
+    free(pattern);
+    free(characters);
+    return matches;
+}
+
+/// @return The index of the first of @c matches, sorted by location, that @c predicate is true for, when it's false for all of the ones before it, or the count of @c matches if there isn't one.
+static NSUInteger WMFSourceEditorFirstMatchIndex(NSArray<NSValue *> *matches, BOOL (NS_NOESCAPE ^predicate)(NSRange match)) {
+    NSUInteger low = 0;
+    NSUInteger high = matches.count;
+    while (low < high) {
+        NSUInteger middle = low + (high - low) / 2;
+        if (predicate(matches[middle].rangeValue)) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    return low;
+}
+
 @implementation WMFSourceEditorFormatterFindAndReplace
 
 #pragma mark - Custom Attributed String Keys
@@ -37,7 +147,6 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
        _searchText = nil;
        _searchRegex = nil;
 
-       _fullAttributedString = nil;
        _matchesAgainstFullAttributedString = [[NSMutableArray alloc] init];
         _replacesAgainstFullAttributedString = [[NSMutableArray alloc] init];
 
@@ -65,58 +174,10 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
 
 - (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
 
-    // This override is only needed for TextKit 2. The attributed string passed in here is regenerated fresh via the textContentStorage(_ textContentStorage: NSTextContentStorage, textParagraphWith range: NSRange) delegate method, so we need to reapply attributes.
-
-    // TextKit 2 only passes in the paragraph attributed string here, as opposed to the full document attributed string with TextKit 1. This conditional singles out TextKit 2.
-    
-    // Note: test this for a one line document, I think it breaks
-    if (range.location == 0 && range.length < self.fullAttributedString.length) {
-        
-        NSRange paragraphRange = [self.fullAttributedString.string rangeOfString:attributedString.string];
-        
-        [self.matchesAgainstFullAttributedString enumerateObjectsUsingBlock:^(NSValue * _Nonnull obj, NSUInteger idx, BOOL * _Nonnull stop) {
-            NSRange fullStringMatchRange = obj.rangeValue;
-            
-            // Find matches that only lie in paragraph range
-            if (NSIntersectionRange(paragraphRange, fullStringMatchRange).length > 0) {
-
-                NSDictionary *attributes = idx == self.selectedMatchIndex ? self.selectedMatchAttributes : self.matchAttributes;
-
-                // Translate full string match back to paragraph match range
-                NSRange paragraphMatchRange = NSMakeRange(fullStringMatchRange.location - paragraphRange.location, fullStringMatchRange.length);
-
-                //Then reapply attributes to paragraph match range.
-                if ([self canEvaluateAttributedString:attributedString againstRange:paragraphMatchRange]) {
-                    [self resetKeysForAttributedString:attributedString range:paragraphMatchRange];
-                    [attributedString addAttributes:attributes range:paragraphMatchRange];
-                }
-            }
-        }];
-        
-        [self.replacesAgainstFullAttributedString enumerateObjectsUsingBlock:^(NSValue * _Nonnull obj, NSUInteger idx, BOOL * _Nonnull stop) {
-            NSRange fullStringMatchRange = obj.rangeValue;
-            
-            // Find matches that only lie in paragraph range
-            if (NSIntersectionRange(paragraphRange, fullStringMatchRange).length > 0) {
-
-                // Translate full string match back to paragraph match range
-                NSRange paragraphMatchRange = NSMakeRange(fullStringMatchRange.location - paragraphRange.location, fullStringMatchRange.length);
-
-                //Then reapply attributes to paragraph match range.
-                if ([self canEvaluateAttributedString:attributedString againstRange:paragraphMatchRange]) {
-                    [self resetKeysForAttributedString:attributedString range:paragraphMatchRange];
-                    [attributedString addAttributes:self.replacedMatchAttributes range:paragraphMatchRange];
-                }
-            }
-        }];
-    }
+    // Matches are highlighted in the full document when they're found and updated. TextKit 2 regenerates paragraphs without them, so it highlights them again with -addSyntaxHighlightingToParagraphAttributedString:documentRange:.
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-        return;
-    }
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     
     NSMutableDictionary *mutMatchAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.matchAttributes];
     [mutMatchAttributes setObject:colors.matchBackgroundColor forKey:NSBackgroundColorAttributeName];
@@ -129,46 +190,14 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
     NSMutableDictionary *mutReplacedMatchAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.replacedMatchAttributes];
     [mutReplacedMatchAttributes setObject:colors.replacedMatchBackgroundColor forKey:NSBackgroundColorAttributeName];
     self.replacedMatchAttributes = [[NSDictionary alloc] initWithDictionary:mutReplacedMatchAttributes];
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyMatch
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.matchAttributes range:localRange];
-            }
-        }
-    }];
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeySelectedMatch
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.selectedMatchAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyReplacedMatch
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.replacedMatchAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyMatch attributes:self.matchAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeySelectedMatch attributes:self.selectedMatchAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyReplacedMatch attributes:self.replacedMatchAttributes]
+    ];
 }
 
 #pragma mark - Getters and Setters
@@ -197,10 +226,42 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
 
 #pragma mark - Public
 
+- (void)addSyntaxHighlightingToParagraphAttributedString:(NSMutableAttributedString *)attributedString documentRange:(NSRange)documentRange {
+    
+    // Find matches that lie in paragraph range
+    NSUInteger firstIndex = WMFSourceEditorFirstMatchIndex(self.matchesAgainstFullAttributedString, ^BOOL(NSRange match) {
+        return NSMaxRange(match) > documentRange.location;
+    });
+    for (NSUInteger i = firstIndex; i < self.matchesAgainstFullAttributedString.count; i++) {
+        NSRange fullStringMatchRange = self.matchesAgainstFullAttributedString[i].rangeValue;
+        if (fullStringMatchRange.location >= NSMaxRange(documentRange)) {
+            break;
+        }
+        
+        NSDictionary *attributes = (NSInteger)i == self.selectedMatchIndex ? self.selectedMatchAttributes : self.matchAttributes;
+        [self addAttributes:attributes toParagraphAttributedString:attributedString documentRange:documentRange fullStringRange:fullStringMatchRange];
+    }
+    
+    // Replaced ranges are in the order they were replaced
+    for (NSValue *replacedRangeValue in self.replacesAgainstFullAttributedString) {
+        [self addAttributes:self.replacedMatchAttributes toParagraphAttributedString:attributedString documentRange:documentRange fullStringRange:replacedRangeValue.rangeValue];
+    }
+}
+
 - (void)startMatchSessionWithFullAttributedString: (NSMutableAttributedString *)fullAttributedString searchText:(NSString *)searchText {
     
     self.searchText = searchText;
-    self.searchRegex = [[NSRegularExpression alloc] initWithPattern:searchText options:NSRegularExpressionCaseInsensitive error:nil];
+    
+    // Plain ASCII text, like most searches, doesn't need a regular expression, unless the document has characters that fold to more than one, like ß to "ss". Other plain text can have them itself.
+    BOOL isLiteral = [[NSRegularExpression escapedPatternForString:searchText] isEqualToString:searchText];
+    if (!isLiteral) {
+        // Search text that isn't a valid regular expression, like "(a", is matched as it is
+        self.searchRegex = [[NSRegularExpression alloc] initWithPattern:searchText options:NSRegularExpressionCaseInsensitive error:nil] ?: WMFSourceEditorLiteralRegex(searchText);
+    } else if (searchText.length > 0 && (![searchText canBeConvertedToEncoding:NSASCIIStringEncoding] || WMFSourceEditorHasMultipleCharacterFold(fullAttributedString.string, NSMakeRange(0, fullAttributedString.length)))) {
+        self.searchRegex = WMFSourceEditorLiteralRegex(searchText);
+    } else {
+        self.searchRegex = nil;
+    }
     
     [self calculateMatchesInFullAttributedString:fullAttributedString];
 }
@@ -215,21 +276,12 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
     
     if (self.selectedMatchIndex == NSNotFound && afterRangeValue && afterRangeValue.rangeValue.location != NSNotFound) {
         // find the first index AFTER the afterRangeValue param. This allows us to start selection highlights in the middle of the matches.
-        int i = 0;
-        for (NSValue *matchValue in self.matchesAgainstFullAttributedString) {
-            NSRange matchRange = matchValue.rangeValue;
-            
-            if (matchRange.location >= afterRangeValue.rangeValue.location) {
-                self.selectedMatchIndex = i;
-                break;
-            }
-            
-            i++;
-        }
+        NSUInteger afterLocation = afterRangeValue.rangeValue.location;
+        NSUInteger index = WMFSourceEditorFirstMatchIndex(self.matchesAgainstFullAttributedString, ^BOOL(NSRange match) {
+            return match.location >= afterLocation;
+        });
         
-        if (self.selectedMatchIndex == NSNotFound) {
-            self.selectedMatchIndex = 0;
-        }
+        self.selectedMatchIndex = index < self.matchesAgainstFullAttributedString.count ? index : 0;
     } else if ((self.selectedMatchIndex == NSNotFound) || (self.selectedMatchIndex == self.matchesAgainstFullAttributedString.count - 1)) {
         self.selectedMatchIndex = 0;
     } else {
@@ -259,20 +311,28 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
 
 - (void)replaceSingleMatchInFullAttributedString:(NSMutableAttributedString *)fullAttributedString withReplaceText:(NSString *)replaceText textView: (UITextView *)textView {
     
-    // add replace range to array
-    NSRange newReplaceRange = NSMakeRange(self.selectedMatchRange.location, replaceText.length);
-    NSValue *newReplaceRangeValue = [NSValue valueWithRange:newReplaceRange];
-    [self.replacesAgainstFullAttributedString addObject:newReplaceRangeValue];
-
     // get currently selected match text range
-    NSInteger selectedMatchIndex = self.selectedMatchIndex;
     NSRange selectedMatchRange = self.selectedMatchRange;
+    if (selectedMatchRange.location == NSNotFound) {
+        return;
+    }
     UITextPosition *startPos = [textView positionFromPosition:textView.beginningOfDocument offset:selectedMatchRange.location];
     UITextPosition *endPos = [textView positionFromPosition:startPos offset:selectedMatchRange.length];
     UITextRange *selectedMatchTextRange = [textView textRangeFromPosition:startPos toPosition:endPos];
 
     // replace text in textview
+    self.isReplacing = YES;
     [textView replaceRange:selectedMatchTextRange withText:replaceText];
+    self.isReplacing = NO;
+    
+    // update matches around the replaced match, without selecting one
+    NSRange newReplaceRange = NSMakeRange(selectedMatchRange.location, replaceText.length);
+    self.selectedMatchIndex = NSNotFound;
+    [self updateMatchesInFullAttributedString:fullAttributedString afterEditingRange:newReplaceRange changeInLength:(NSInteger)replaceText.length - (NSInteger)selectedMatchRange.length];
+    
+    // add replace range to array
+    NSValue *newReplaceRangeValue = [NSValue valueWithRange:newReplaceRange];
+    [self.replacesAgainstFullAttributedString addObject:newReplaceRangeValue];
     
     // update replace range with new attributes
     if ([self canEvaluateAttributedString:fullAttributedString againstRange:newReplaceRange]) {
@@ -282,65 +342,187 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
         [fullAttributedString endEditing];
     }
     
-    // copy new text view text to keep it in sync
-    self.fullAttributedString = textView.attributedText;
-    
-    // reset matches
-    [self.matchesAgainstFullAttributedString removeAllObjects];
-    self.selectedMatchIndex = NSNotFound;
-    
-    // recalculate matches and select the first one
-    [self calculateMatchesInFullAttributedString:fullAttributedString];
+    // select the first match after the replaced one
     [self highlightNextMatchInFullAttributedString:fullAttributedString afterRangeValue:newReplaceRangeValue];
 }
 
 - (void)replaceAllMatchesInFullAttributedString:(NSMutableAttributedString *)fullAttributedString withReplaceText:(NSString *)replaceText textView: (UITextView *)textView {
     
-    NSInteger lengthDelta = replaceText.length - self.searchText.length;
+    if (self.matchesAgainstFullAttributedString.count == 0) {
+        return;
+    }
     
-    int i = 0;
+    // build the text from the start of the first match to the end of the last one with every match replaced, in one pass
+    NSRange firstMatchRange = self.matchesAgainstFullAttributedString.firstObject.rangeValue;
+    NSRange lastMatchRange = self.matchesAgainstFullAttributedString.lastObject.rangeValue;
+    NSRange replacedRange = NSMakeRange(firstMatchRange.location, NSMaxRange(lastMatchRange) - firstMatchRange.location);
     
-    // copy so we aren't removing objects while enumerating an array
-    NSArray *matchesCopy = [NSArray arrayWithArray:self.matchesAgainstFullAttributedString];
-    for (NSValue *matchValue in matchesCopy) {
+    NSMutableAttributedString *replacement = [[NSMutableAttributedString alloc] init];
+    NSMutableArray<NSValue *> *newReplaceRanges = [[NSMutableArray alloc] init];
+    NSUInteger location = replacedRange.location;
+    [replacement beginEditing];
+    for (NSValue *matchValue in self.matchesAgainstFullAttributedString) {
         NSRange matchRange = matchValue.rangeValue;
+        [replacement appendAttributedString:[fullAttributedString attributedSubstringFromRange:NSMakeRange(location, matchRange.location - location)]];
         
-        // both match and replace ranges need to be adjusted for the text length differences for each iteration. Otherwise ranges are thrown off.
-        NSRange offsetMatchRange = NSMakeRange(matchRange.location + (lengthDelta * i), self.searchText.length);
-        NSRange newReplaceRange = NSMakeRange(matchRange.location + (lengthDelta * i), replaceText.length);
-        
-        // add replace range to array
-        [self.replacesAgainstFullAttributedString addObject:[NSValue valueWithRange:newReplaceRange]];
-        
-        // get currently selected match text range
-        UITextPosition *startPos = [textView positionFromPosition:textView.beginningOfDocument offset:offsetMatchRange.location];
-        UITextPosition *endPos = [textView positionFromPosition:startPos offset:offsetMatchRange.length];
-        UITextRange *matchTextRange = [textView textRangeFromPosition:startPos toPosition:endPos];
-        
-        // replace text in textview
-        [textView replaceRange:matchTextRange withText:replaceText];
-        
-        // remove first match to keep in sync with remaining matches in text view.
-        [self.matchesAgainstFullAttributedString removeObjectAtIndex:0];
-        
-        // update replace range with new attributes
-        if ([self canEvaluateAttributedString:fullAttributedString againstRange:newReplaceRange]) {
-            [fullAttributedString beginEditing];
-            [self resetKeysForAttributedString:fullAttributedString range:newReplaceRange];
-            [fullAttributedString addAttributes:self.replacedMatchAttributes range:newReplaceRange];
-            [fullAttributedString endEditing];
+        // replaced text keeps the match's other attributes, like its font
+        NSMutableDictionary *attributes = [[NSMutableDictionary alloc] init];
+        if (matchRange.location < fullAttributedString.length) {
+            [attributes addEntriesFromDictionary:[fullAttributedString attributesAtIndex:matchRange.location effectiveRange:nil]];
         }
+        [attributes removeObjectsForKeys:@[NSForegroundColorAttributeName, NSBackgroundColorAttributeName, WMFSourceEditorCustomKeyMatch, WMFSourceEditorCustomKeySelectedMatch, WMFSourceEditorCustomKeyReplacedMatch]];
+        [attributes addEntriesFromDictionary:self.replacedMatchAttributes];
         
-        // copy new text view text to keep it in sync
-        self.fullAttributedString = textView.attributedText;
+        NSRange newReplaceRange = NSMakeRange(replacedRange.location + replacement.length, replaceText.length);
+        [newReplaceRanges addObject:[NSValue valueWithRange:newReplaceRange]];
+        [replacement appendAttributedString:[[NSAttributedString alloc] initWithString:replaceText attributes:attributes]];
         
-        i++;
+        location = NSMaxRange(matchRange);
     }
+    [replacement endEditing];
+    
+    // replace text in textview all at once, so it's undone all at once
+    UITextPosition *startPos = [textView positionFromPosition:textView.beginningOfDocument offset:replacedRange.location];
+    UITextPosition *endPos = [textView positionFromPosition:startPos offset:replacedRange.length];
+    UITextRange *replacedTextRange = [textView textRangeFromPosition:startPos toPosition:endPos];
+    self.isReplacing = YES;
+    [textView replaceRange:replacedTextRange withText:replacement.string];
+    self.isReplacing = NO;
+    
+    // the text view gives new text its typing attributes, so put back the ones the text had, with the replace attributes
+    NSRange newRange = NSMakeRange(replacedRange.location, replacement.length);
+    if ([self canEvaluateAttributedString:fullAttributedString againstRange:newRange]) {
+        [fullAttributedString beginEditing];
+        [replacement enumerateAttributesInRange:NSMakeRange(0, replacement.length) options:0 usingBlock:^(NSDictionary<NSAttributedStringKey, id> *attributes, NSRange range, BOOL *stop) {
+            [fullAttributedString setAttributes:attributes range:NSMakeRange(newRange.location + range.location, range.length)];
+        }];
+        [fullAttributedString endEditing];
+    }
+    
+    // earlier replaced ranges after the replaced text moved with it
+    [self updateReplacedRangesAfterEditingRange:newRange changeInLength:(NSInteger)replacement.length - (NSInteger)replacedRange.length];
+    [self.replacesAgainstFullAttributedString addObjectsFromArray:newReplaceRanges];
+    [self.matchesAgainstFullAttributedString removeAllObjects];
     
     // reset selected match index
     self.selectedMatchIndex = NSNotFound;
 }
 
+- (void)updateMatchesInFullAttributedString:(NSMutableAttributedString *)fullAttributedString afterEditingRange:(NSRange)editedRange changeInLength:(NSInteger)delta {
+    
+    if (self.searchText.length == 0 || self.isReplacing) {
+        return;
+    }
+    
+    [self updateReplacedRangesAfterEditingRange:editedRange changeInLength:delta];
+    
+    // Text that folds to more than one character can only be matched by a regular expression from now on
+    if (!self.searchRegex && WMFSourceEditorHasMultipleCharacterFold(fullAttributedString.string, editedRange)) {
+        self.searchRegex = WMFSourceEditorLiteralRegex(self.searchText);
+    }
+    
+    // Regular expression matches can be any length, so they're all found again
+    if (self.searchRegex) {
+        self.selectedMatchIndex = NSNotFound;
+        [self calculateMatchesInFullAttributedString:fullAttributedString];
+        return;
+    }
+    
+    NSMutableArray<NSValue *> *matches = self.matchesAgainstFullAttributedString;
+    NSString *string = fullAttributedString.string;
+    NSUInteger length = string.length;
+    NSUInteger searchLength = self.searchText.length;
+    NSUInteger location = editedRange.location;
+    NSUInteger newEditEnd = NSMaxRange(editedRange);
+    NSUInteger oldEditEnd = newEditEnd - delta;
+    
+    // Matches that end before the edit stay the same, and the ones that start after it move with it. Matches are found again from the end of the last one before the edit, or as far before it as a match could start and reach it.
+    NSUInteger firstChangedIndex = WMFSourceEditorFirstMatchIndex(matches, ^BOOL(NSRange match) {
+        return NSMaxRange(match) > location;
+    });
+    NSUInteger firstMovedIndex = WMFSourceEditorFirstMatchIndex(matches, ^BOOL(NSRange match) {
+        return match.location >= oldEditEnd;
+    });
+    NSUInteger searchStart = MAX(firstChangedIndex > 0 ? NSMaxRange(matches[firstChangedIndex - 1].rangeValue) : 0, location >= searchLength - 1 ? location - (searchLength - 1) : 0);
+    NSUInteger searchEnd = MIN(length, newEditEnd + searchLength - 1);
+    
+    // Matches are picked left to right without overlapping, so when the search text can overlap itself, like "aa", a different match in the edit can change the ones after it. Search past the edit until the new matches and the old ones pick up from the same place.
+    NSMutableArray<NSValue *> *foundMatches = [[NSMutableArray alloc] init];
+    NSUInteger keptIndex = firstMovedIndex;
+    NSUInteger searchedEnd;
+    while (YES) {
+        [foundMatches addObjectsFromArray:WMFSourceEditorLiteralMatches(string, self.searchText, NSMakeRange(searchStart, searchEnd - searchStart))];
+        if (searchEnd == length) {
+            keptIndex = matches.count;
+            searchedEnd = length;
+            break;
+        }
+        
+        // Where the next match can start, for the new matches and then for the old ones
+        searchedEnd = MAX(searchEnd - (searchLength - 1), foundMatches.count > 0 ? NSMaxRange(foundMatches.lastObject.rangeValue) : searchStart);
+        while (keptIndex < matches.count && matches[keptIndex].rangeValue.location + delta < searchedEnd) {
+            keptIndex++;
+        }
+        NSUInteger oldSearchedEnd = searchedEnd;
+        if (keptIndex > firstChangedIndex) {
+            NSUInteger oldEnd = NSMaxRange(matches[keptIndex - 1].rangeValue);
+            if (oldEnd > oldEditEnd) {
+                oldSearchedEnd = MAX(searchedEnd, oldEnd + delta);
+            }
+        }
+        if (oldSearchedEnd == searchedEnd) {
+            break;
+        }
+        
+        searchStart = searchedEnd;
+        searchEnd = MIN(length, searchEnd + searchLength);
+    }
+    
+    // New text takes the attributes of the text it replaced or follows, and old matches that aren't matches anymore keep theirs, so they lose their match attributes
+    [fullAttributedString beginEditing];
+    [fullAttributedString removeAttribute:NSBackgroundColorAttributeName range:editedRange];
+    [fullAttributedString removeAttribute:WMFSourceEditorCustomKeyMatch range:editedRange];
+    [fullAttributedString removeAttribute:WMFSourceEditorCustomKeySelectedMatch range:editedRange];
+    [fullAttributedString removeAttribute:WMFSourceEditorCustomKeyReplacedMatch range:editedRange];
+    for (NSUInteger i = firstChangedIndex; i < keptIndex; i++) {
+        NSRange match = matches[i].rangeValue;
+        NSUInteger start = match.location < location ? match.location : MAX(match.location + delta, newEditEnd);
+        NSUInteger end = NSMaxRange(match) <= oldEditEnd ? MIN(NSMaxRange(match), location) : NSMaxRange(match) + delta;
+        if (end > start && end <= length) {
+            NSRange range = NSMakeRange(start, end - start);
+            [fullAttributedString removeAttribute:NSBackgroundColorAttributeName range:range];
+            [fullAttributedString removeAttribute:WMFSourceEditorCustomKeyMatch range:range];
+            [fullAttributedString removeAttribute:WMFSourceEditorCustomKeySelectedMatch range:range];
+        }
+    }
+    
+    // Patch the matches in place
+    NSInteger selectedMatchIndex = self.selectedMatchIndex;
+    if (selectedMatchIndex != NSNotFound && selectedMatchIndex >= (NSInteger)keptIndex) {
+        self.selectedMatchIndex = selectedMatchIndex - keptIndex + firstChangedIndex + foundMatches.count;
+    } else if (selectedMatchIndex != NSNotFound && selectedMatchIndex >= (NSInteger)firstChangedIndex) {
+        self.selectedMatchIndex = NSNotFound;
+    }
+    if (delta != 0) {
+        for (NSUInteger i = keptIndex; i < matches.count; i++) {
+            NSRange match = matches[i].rangeValue;
+            matches[i] = [NSValue valueWithRange:NSMakeRange(match.location + delta, match.length)];
+        }
+    }
+    [matches replaceObjectsInRange:NSMakeRange(firstChangedIndex, keptIndex - firstChangedIndex) withObjectsFromArray:foundMatches];
+    
+    // Highlighting the edited lines again can clear the other matches on them, so they're highlighted again along with the new ones
+    NSRange highlightedRange = NSUnionRange([string paragraphRangeForRange:editedRange], NSMakeRange(searchStart, searchedEnd - searchStart));
+    NSUInteger firstIndex = WMFSourceEditorFirstMatchIndex(matches, ^BOOL(NSRange match) {
+        return NSMaxRange(match) > highlightedRange.location;
+    });
+    for (NSUInteger i = firstIndex; i < matches.count && matches[i].rangeValue.location < NSMaxRange(highlightedRange); i++) {
+        NSRange match = matches[i].rangeValue;
+        [self resetKeysForAttributedString:fullAttributedString range:match];
+        [fullAttributedString addAttributes:(NSInteger)i == self.selectedMatchIndex ? self.selectedMatchAttributes : self.matchAttributes range:match];
+    }
+    [fullAttributedString endEditing];
+}
 
 - (void)endMatchSessionWithFullAttributedString:(NSMutableAttributedString *)fullAttributedString {
     self.selectedMatchIndex = NSNotFound;
@@ -348,8 +530,6 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
     self.searchText = nil;
     self.searchRegex = nil;
 
-    self.fullAttributedString = nil;
-    
     [self.matchesAgainstFullAttributedString removeAllObjects];
     [self.replacesAgainstFullAttributedString removeAllObjects];
 
@@ -362,27 +542,47 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
 #pragma mark - Private
 
 - (void)calculateMatchesInFullAttributedString: (NSMutableAttributedString *)fullAttributedString {
-    self.fullAttributedString = fullAttributedString;
+    NSMutableArray *matchValues = [[NSMutableArray alloc] init];
+    if (self.searchRegex) {
+        [self.searchRegex enumerateMatchesInString:fullAttributedString.string
+                                            options:0
+                                              range:NSMakeRange(0, fullAttributedString.length)
+                                         usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
+                NSRange match = [result rangeAtIndex:0];
+
+                if (match.location != NSNotFound) {
+                    [matchValues addObject:[NSValue valueWithRange:match]];
+                }
+            }];
+    } else {
+        [matchValues addObjectsFromArray:WMFSourceEditorLiteralMatches(fullAttributedString.string, self.searchText, NSMakeRange(0, fullAttributedString.length))];
+    }
 
     [fullAttributedString beginEditing];
-    NSMutableArray *matchValues = [[NSMutableArray alloc] init];
-    [self.searchRegex enumerateMatchesInString:fullAttributedString.string
-                                        options:0
-                                          range:NSMakeRange(0, fullAttributedString.length)
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange match = [result rangeAtIndex:0];
-
-            if (match.location != NSNotFound) {
-                [self resetKeysForAttributedString:fullAttributedString range:match];
-                [fullAttributedString addAttributes:self.matchAttributes range:match];
-                [matchValues addObject:[NSValue valueWithRange:match]];
-            }
-        }];
+    for (NSValue *matchValue in matchValues) {
+        NSRange match = matchValue.rangeValue;
+        [self resetKeysForAttributedString:fullAttributedString range:match];
+        [fullAttributedString addAttributes:self.matchAttributes range:match];
+    }
     [fullAttributedString endEditing];
 
     self.matchesAgainstFullAttributedString = matchValues;
 }
 
+- (void)updateReplacedRangesAfterEditingRange:(NSRange)editedRange changeInLength:(NSInteger)delta {
+    NSUInteger oldEditEnd = NSMaxRange(editedRange) - delta;
+    NSMutableArray<NSValue *> *replacedRanges = [[NSMutableArray alloc] init];
+    for (NSValue *replacedRangeValue in self.replacesAgainstFullAttributedString) {
+        NSRange replacedRange = replacedRangeValue.rangeValue;
+        if (NSMaxRange(replacedRange) <= editedRange.location) {
+            [replacedRanges addObject:replacedRangeValue];
+        } else if (replacedRange.location >= oldEditEnd) {
+            [replacedRanges addObject:[NSValue valueWithRange:NSMakeRange(replacedRange.location + delta, replacedRange.length)]];
+        }
+    }
+    self.replacesAgainstFullAttributedString = replacedRanges;
+}
+
 - (void)updateMatchHighlightsInFullAttributedString: (NSMutableAttributedString *)fullAttributedString lastSelectedMatchIndex: (NSInteger)lastSelectedMatchIndex {
     
     [fullAttributedString beginEditing];
@@ -410,6 +610,20 @@ NSString * const WMFSourceEditorCustomKeyReplacedMatch = @"WMFSourceEditorCustom
     [fullAttributedString endEditing];
 }
 
+- (void)addAttributes:(NSDictionary *)attributes toParagraphAttributedString:(NSMutableAttributedString *)attributedString documentRange:(NSRange)documentRange fullStringRange:(NSRange)fullStringRange {
+    NSRange intersection = NSIntersectionRange(documentRange, fullStringRange);
+    if (intersection.length == 0) {
+        return;
+    }
+    
+    // Translate full string range back to paragraph range
+    NSRange paragraphRange = NSMakeRange(intersection.location - documentRange.location, intersection.length);
+    if ([self canEvaluateAttributedString:attributedString againstRange:paragraphRange]) {
+        [self resetKeysForAttributedString:attributedString range:paragraphRange];
+        [attributedString addAttributes:attributes range:paragraphRange];
+    }
+}
+
 - (void)resetKeysForAttributedString: (NSMutableAttributedString *)attributedString range: (NSRange) range {
     
     if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
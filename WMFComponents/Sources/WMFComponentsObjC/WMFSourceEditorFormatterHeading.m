@@ -1,4 +1,5 @@
 #import "WMFSourceEditorFormatterHeading.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 #import "WMFSourceEditorFonts.h"
 
@@ -15,12 +16,6 @@
 @property (nonatomic, strong) NSDictionary *subheading2ContentAttributes;
 @property (nonatomic, strong) NSDictionary *subheading3ContentAttributes;
 @property (nonatomic, strong) NSDictionary *subheading4ContentAttributes;
-
-@property (nonatomic, strong) NSRegularExpression *headingRegex;
-@property (nonatomic, strong) NSRegularExpression *subheading1Regex;
-@property (nonatomic, strong) NSRegularExpression *subheading2Regex;
-@property (nonatomic, strong) NSRegularExpression *subheading3Regex;
-@property (nonatomic, strong) NSRegularExpression *subheading4Regex;
 @end
 
 @implementation WMFSourceEditorFormatterHeading
@@ -95,23 +90,17 @@ NSString * const WMFSourceEditorCustomKeyContentSubheading4 = @"WMFSourceEditorC
         _subheading4ContentAttributes = @{
             WMFSourceEditorCustomKeyContentSubheading4: [NSNumber numberWithBool:YES]
         };
-        
-        _headingRegex = [[NSRegularExpression alloc] initWithPattern:@"^(={2})([^=]*)(={2})(?!=)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _subheading1Regex = [[NSRegularExpression alloc] initWithPattern:@"^(={3})([^=]*)(={3})(?!=)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _subheading2Regex = [[NSRegularExpression alloc] initWithPattern:@"^(={4})([^=]*)(={4})(?!=)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _subheading3Regex = [[NSRegularExpression alloc] initWithPattern:@"^(={5})([^=]*)(={5})(?!=)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _subheading4Regex = [[NSRegularExpression alloc] initWithPattern:@"^(={6})([^=]*)(={6})(?!=)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
     }
     return self;
 }
 
 #pragma mark - Overrides
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindHeading) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSubheading1) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSubheading2) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSubheading3) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSubheading4);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     // Reset
     [attributedString removeAttribute:WMFSourceEditorCustomKeyFontHeading range:range];
@@ -125,23 +114,22 @@ NSString * const WMFSourceEditorCustomKeyContentSubheading4 = @"WMFSourceEditorC
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSubheading3 range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSubheading4 range:range];
     
-    [self enumerateAndHighlightAttributedString:attributedString range:range regex:self.headingRegex fontAttributes:self.headingFontAttributes contentAttributes:self.headingContentAttributes];
-    [self enumerateAndHighlightAttributedString:attributedString range:range regex:self.subheading1Regex fontAttributes:self.subheading1FontAttributes contentAttributes:self.subheading1ContentAttributes];
-    [self enumerateAndHighlightAttributedString:attributedString range:range regex:self.subheading2Regex fontAttributes:self.subheading2FontAttributes contentAttributes:self.subheading2ContentAttributes];
-    [self enumerateAndHighlightAttributedString:attributedString range:range regex:self.subheading3Regex fontAttributes:self.subheading3FontAttributes contentAttributes:self.subheading3ContentAttributes];
-    [self enumerateAndHighlightAttributedString:attributedString range:range regex:self.subheading4Regex fontAttributes:self.subheading4FontAttributes contentAttributes:self.subheading4ContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens kind:WMFSourceEditorTokenKindHeading fontAttributes:self.headingFontAttributes contentAttributes:self.headingContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens kind:WMFSourceEditorTokenKindSubheading1 fontAttributes:self.subheading1FontAttributes contentAttributes:self.subheading1ContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens kind:WMFSourceEditorTokenKindSubheading2 fontAttributes:self.subheading2FontAttributes contentAttributes:self.subheading2ContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens kind:WMFSourceEditorTokenKindSubheading3 fontAttributes:self.subheading3FontAttributes contentAttributes:self.subheading3ContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens kind:WMFSourceEditorTokenKindSubheading4 fontAttributes:self.subheading4FontAttributes contentAttributes:self.subheading4ContentAttributes];
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    [self updateColorAttributesWithColors:colors];
-    [self enumerateAndUpdateColorsInAttributedString:attributedString range:range];
-}
-
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    [self updateFontAttributesWithFonts:fonts];
-    [self enumerateAndUpdateFontsInAttributedString:attributedString range:range];
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorOrange attributes:self.orangeAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontHeading attributes:self.headingFontAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontSubheading1 attributes:self.subheading1FontAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontSubheading2 attributes:self.subheading2FontAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontSubheading3 attributes:self.subheading3FontAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyFontSubheading4 attributes:self.subheading4FontAttributes]
+    ];
 }
 
 #pragma mark - Public
@@ -213,37 +201,17 @@ NSString * const WMFSourceEditorCustomKeyContentSubheading4 = @"WMFSourceEditorC
     return isContentKey;
 }
 
-- (void)enumerateAndHighlightAttributedString: (nonnull NSMutableAttributedString *)attributedString range:(NSRange)range regex:(NSRegularExpression *)regex fontAttributes:(NSDictionary<NSAttributedStringKey, id> *)fontAttributes contentAttributes:(NSDictionary<NSAttributedStringKey, id> *)contentAttributes {
+- (void)highlightAttributedString:(NSMutableAttributedString *)attributedString tokens:(const WMFSourceEditorTokenList *)tokens kind:(WMFSourceEditorTokenKind)kind fontAttributes:(NSDictionary<NSAttributedStringKey, id> *)fontAttributes contentAttributes:(NSDictionary<NSAttributedStringKey, id> *)contentAttributes {
     
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
+    size_t count = 0;
+    const WMFSourceEditorToken *headingTokens = WMFSourceEditorTokensOfKind(tokens, kind, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &headingTokens[i];
+        [attributedString addAttributes:fontAttributes range:WMFSourceEditorTokenRange(token)];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:contentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenClosingRange(token)];
     }
-    
-    [regex enumerateMatchesInString:attributedString.string
-                            options:0
-                              range:range
-                         usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        NSRange openingRange = [result rangeAtIndex:1];
-        NSRange textRange = [result rangeAtIndex:2];
-        NSRange closingRange = [result rangeAtIndex:3];
-        
-        if (fullMatch.location != NSNotFound) {
-            [attributedString addAttributes:fontAttributes range:fullMatch];
-        }
-        
-        if (openingRange.location != NSNotFound) {
-            [attributedString addAttributes:self.orangeAttributes range:openingRange];
-        }
-        
-        if (textRange.location != NSNotFound) {
-            [attributedString addAttributes:contentAttributes range:textRange];
-        }
-        
-        if (closingRange.location != NSNotFound) {
-            [attributedString addAttributes:self.orangeAttributes range:closingRange];
-        }
-    }];
 }
 
 - (void)updateColorAttributesWithColors: (WMFSourceEditorColors *)colors {
@@ -252,25 +220,6 @@ NSString * const WMFSourceEditorCustomKeyContentSubheading4 = @"WMFSourceEditorC
     self.orangeAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
 }
 
-- (void)enumerateAndUpdateColorsInAttributedString: (NSMutableAttributedString *)attributedString range: (NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorOrange
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.orangeAttributes range:localRange];
-            }
-        }
-    }];
-}
-
 - (void)updateFontAttributesWithFonts: (WMFSourceEditorFonts *)fonts {
     NSMutableDictionary *mutHeadingAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.headingFontAttributes];
     [mutHeadingAttributes setObject:fonts.headingFont forKey:NSFontAttributeName];
@@ -293,71 +242,4 @@ NSString * const WMFSourceEditorCustomKeyContentSubheading4 = @"WMFSourceEditorC
     self.subheading4FontAttributes = [[NSDictionary alloc] initWithDictionary:mutSubheading4Attributes];
 }
 
-- (void)enumerateAndUpdateFontsInAttributedString: (NSMutableAttributedString *)attributedString range: (NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontHeading
-                                 inRange:range
-                                 options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.headingFontAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontSubheading1
-                                 inRange:range
-                                 options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.subheading1FontAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontSubheading2
-                                 inRange:range
-                                 options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.subheading2FontAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontSubheading3
-                                 inRange:range
-                                 options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.subheading3FontAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyFontSubheading4
-                                 inRange:range
-                                 options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.subheading4FontAttributes range:localRange];
-            }
-        }
-    }];
-}
-
 @end
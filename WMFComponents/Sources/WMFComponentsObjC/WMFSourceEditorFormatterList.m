@@ -1,4 +1,5 @@
 #import "WMFSourceEditorFormatterList.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterList ()
@@ -10,11 +11,6 @@
 @property (nonatomic, strong) NSDictionary *numberSingleContentAttributes;
 @property (nonatomic, strong) NSDictionary *numberMultipleContentAttributes;
 
-@property (nonatomic, strong) NSRegularExpression *bulletSingleRegex;
-@property (nonatomic, strong) NSRegularExpression *bulletMultipleRegex;
-@property (nonatomic, strong) NSRegularExpression *numberSingleRegex;
-@property (nonatomic, strong) NSRegularExpression *numberMultipleRegex;
-
 @end
 
 @implementation WMFSourceEditorFormatterList
@@ -51,57 +47,33 @@ NSString * const WMFSourceEditorCustomKeyContentNumberMultiple = @"WMFSourceEdit
         _numberMultipleContentAttributes = @{
             WMFSourceEditorCustomKeyContentNumberMultiple: [NSNumber numberWithBool:YES]
         };
-        
-        _bulletSingleRegex = [[NSRegularExpression alloc] initWithPattern:@"^(\\*{1})(.*)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _bulletMultipleRegex = [[NSRegularExpression alloc] initWithPattern:@"^(\\*{2,})(.*)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _numberSingleRegex = [[NSRegularExpression alloc] initWithPattern:@"^(#{1})(.*)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _numberMultipleRegex = [[NSRegularExpression alloc] initWithPattern:@"^(#{2,})(.*)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
     }
     return self;
 }
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindBulletSingle) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindBulletMultiple) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindNumberSingle) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindNumberMultiple);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentBulletSingle range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentBulletMultiple range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentNumberSingle range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentNumberMultiple range:range];
    
-    [self enumerateAndHighlightAttributedString:attributedString range:range singleRegex:self.bulletSingleRegex multipleRegex:self.bulletMultipleRegex singleContentAttributes:self.bulletSingleContentAttributes singleContentAttributes:self.bulletMultipleContentAttributes];
-    [self enumerateAndHighlightAttributedString:attributedString range:range singleRegex:self.numberSingleRegex multipleRegex:self.numberMultipleRegex singleContentAttributes:self.numberSingleContentAttributes singleContentAttributes:self.numberMultipleContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens singleKind:WMFSourceEditorTokenKindBulletSingle multipleKind:WMFSourceEditorTokenKindBulletMultiple singleContentAttributes:self.bulletSingleContentAttributes multipleContentAttributes:self.bulletMultipleContentAttributes];
+    [self highlightAttributedString:attributedString tokens:tokens singleKind:WMFSourceEditorTokenKindNumberSingle multipleKind:WMFSourceEditorTokenKindNumberMultiple singleContentAttributes:self.numberSingleContentAttributes multipleContentAttributes:self.numberMultipleContentAttributes];
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    // First update orangeAttributes property so that addSyntaxHighlighting has the correct color the next time it is called
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.orangeAttributes];
     [mutAttributes setObject:colors.orangeForegroundColor forKey:NSForegroundColorAttributeName];
     self.orangeAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-    
-    // Then update entire attributed string orange color
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorOrange
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.orangeAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    // No special font handling needed for lists
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorOrange attributes:self.orangeAttributes]];
 }
 
 #pragma mark - Public
@@ -124,42 +96,23 @@ NSString * const WMFSourceEditorCustomKeyContentNumberMultiple = @"WMFSourceEdit
 
 #pragma mark - Private
 
-- (void)enumerateAndHighlightAttributedString: (nonnull NSMutableAttributedString *)attributedString range:(NSRange)range singleRegex:(NSRegularExpression *)singleRegex multipleRegex:(NSRegularExpression *)multipleRegex singleContentAttributes:(NSDictionary<NSAttributedStringKey, id> *)singleContentAttributes singleContentAttributes:(NSDictionary<NSAttributedStringKey, id> *)multipleContentAttributes {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (void)highlightAttributedString:(NSMutableAttributedString *)attributedString tokens:(const WMFSourceEditorTokenList *)tokens singleKind:(WMFSourceEditorTokenKind)singleKind multipleKind:(WMFSourceEditorTokenKind)multipleKind singleContentAttributes:(NSDictionary<NSAttributedStringKey, id> *)singleContentAttributes multipleContentAttributes:(NSDictionary<NSAttributedStringKey, id> *)multipleContentAttributes {
     
     NSMutableArray *multipleRanges = [[NSMutableArray alloc] init];
     
-    [multipleRegex enumerateMatchesInString:attributedString.string
-                                             options:0
-                                               range:range
-                                          usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        NSRange orangeRange = [result rangeAtIndex:1];
-        NSRange contentRange = [result rangeAtIndex:2];
-        
-        if (fullMatch.location != NSNotFound) {
-            [multipleRanges addObject:[NSValue valueWithRange:fullMatch]];
-        }
-        
-        if (orangeRange.location != NSNotFound) {
-            [attributedString addAttributes:self.orangeAttributes range:orangeRange];
-        }
-        
-        if (contentRange.location != NSNotFound) {
-            [attributedString addAttributes:multipleContentAttributes range:contentRange];
-        }
-    }];
+    size_t count = 0;
+    const WMFSourceEditorToken *multipleTokens = WMFSourceEditorTokensOfKind(tokens, multipleKind, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &multipleTokens[i];
+        [multipleRanges addObject:[NSValue valueWithRange:WMFSourceEditorTokenRange(token)]];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:multipleContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+    }
     
-    [singleRegex enumerateMatchesInString:attributedString.string
-                                             options:0
-                                               range:range
-                                          usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        NSRange orangeRange = [result rangeAtIndex:1];
-        NSRange contentRange = [result rangeAtIndex:2];
+    const WMFSourceEditorToken *singleTokens = WMFSourceEditorTokensOfKind(tokens, singleKind, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &singleTokens[i];
+        NSRange fullMatch = WMFSourceEditorTokenRange(token);
         
         BOOL alreadyMultiple = NO;
         for (NSValue *value in multipleRanges) {
@@ -170,18 +123,12 @@ NSString * const WMFSourceEditorCustomKeyContentNumberMultiple = @"WMFSourceEdit
         }
 
         if (alreadyMultiple) {
-            return;
+            continue;
         }
-
         
-        if (orangeRange.location != NSNotFound) {
-            [attributedString addAttributes:self.orangeAttributes range:orangeRange];
-        }
-        
-        if (contentRange.location != NSNotFound) {
-            [attributedString addAttributes:singleContentAttributes range:contentRange];
-        }
-    }];
+        [attributedString addAttributes:self.orangeAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:singleContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+    }
 }
 
 - (BOOL)attributedString:(NSMutableAttributedString *)attributedString isContentKey:(NSString *)contentKey inRange:(NSRange)range {
@@ -1,15 +1,11 @@
 #import "WMFSourceEditorFormatterReference.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterReference ()
 @property (nonatomic, strong) NSDictionary *refAttributes;
 @property (nonatomic, strong) NSDictionary *refEmptyAttributes;
 @property (nonatomic, strong) NSDictionary *refContentAttributes;
-
-@property (nonatomic, strong) NSRegularExpression *refHorizontalRegex;
-@property (nonatomic, strong) NSRegularExpression *refOpenRegex;
-@property (nonatomic, strong) NSRegularExpression *refCloseRegex;
-@property (nonatomic, strong) NSRegularExpression *refEmptyRegex;
 @end
 
 @implementation WMFSourceEditorFormatterReference
@@ -36,108 +32,47 @@ NSString * const WMFSourceEditorCustomKeyContentReference = @"WMFSourceEditorCus
         _refContentAttributes = @{
             WMFSourceEditorCustomKeyContentReference: [NSNumber numberWithBool:YES]
         };
-        
-        _refHorizontalRegex = [[NSRegularExpression alloc] initWithPattern:@"(<ref(?:[^\\/>]+?)?>)(.*?)(<\\/ref>)" options:0 error:nil];
-        _refOpenRegex = [[NSRegularExpression alloc] initWithPattern:@"<ref(?:[^\\/>]+?)?>" options:0 error:nil];
-        _refCloseRegex = [[NSRegularExpression alloc] initWithPattern:@"<\\/ref>" options:0 error:nil];
-        _refEmptyRegex = [[NSRegularExpression alloc] initWithPattern:@"<ref[^>]+?\\/>" options:0 error:nil];
     }
     
     return self;
 }
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindReferenceHorizontal) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindReferenceEmpty) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindReferenceOpen) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindReferenceClose);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     // Reset
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentReference range:range];
     
-    [self.refHorizontalRegex enumerateMatchesInString:attributedString.string
-                                    options:0
-                                      range:range
-                                 usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        NSRange openingRange = [result rangeAtIndex:1];
-        NSRange contentRange = [result rangeAtIndex:2];
-        NSRange closingRange = [result rangeAtIndex:3];
-        
-        if (openingRange.location != NSNotFound) {
-            [attributedString addAttributes:self.refAttributes range:openingRange];
-        }
-        
-        if (contentRange.location != NSNotFound) {
-            [attributedString addAttributes:self.refContentAttributes range:contentRange];
-        }
-        
-        if (closingRange.location != NSNotFound) {
-            [attributedString addAttributes:self.refAttributes range:closingRange];
-        }
-    }];
-    
-    [self.refEmptyRegex enumerateMatchesInString:attributedString.string
-                                         options:0
-                                           range:range
-                                      usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        
-        if (fullMatch.location != NSNotFound) {
-            [attributedString addAttributes:self.refAttributes range:fullMatch];
-        }
-    }];
-    
-    // refOpenAndClose regex doesn't match everything. This scoops up extra open and closing ref tags that do not have a matching tag on the same line
-    
-    [self.refOpenRegex enumerateMatchesInString:attributedString.string
-                                         options:0
-                                           range:range
-                                      usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        
-        if (fullMatch.location != NSNotFound) {
-            [attributedString addAttributes:self.refAttributes range:fullMatch];
-        }
-    }];
+    size_t count = 0;
+    const WMFSourceEditorToken *horizontalTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindReferenceHorizontal, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &horizontalTokens[i];
+        [attributedString addAttributes:self.refAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.refContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.refAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
     
-    [self.refCloseRegex enumerateMatchesInString:attributedString.string
-                                         options:0
-                                           range:range
-                                      usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        NSRange fullMatch = [result rangeAtIndex:0];
-        
-        if (fullMatch.location != NSNotFound) {
-            [attributedString addAttributes:self.refAttributes range:fullMatch];
+    // Horizontal references don't match everything. This scoops up empty references, and extra open and closing ref tags that do not have a matching tag on the same line
+    WMFSourceEditorTokenKind tagKinds[] = {WMFSourceEditorTokenKindReferenceEmpty, WMFSourceEditorTokenKindReferenceOpen, WMFSourceEditorTokenKindReferenceClose};
+    for (size_t kindIndex = 0; kindIndex < sizeof(tagKinds) / sizeof(tagKinds[0]); kindIndex++) {
+        const WMFSourceEditorToken *tagTokens = WMFSourceEditorTokensOfKind(tokens, tagKinds[kindIndex], &count);
+        for (size_t i = 0; i < count; i++) {
+            [attributedString addAttributes:self.refAttributes range:WMFSourceEditorTokenRange(&tagTokens[i])];
         }
-    }];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.refAttributes];
     [mutAttributes setObject:colors.greenForegroundColor forKey:NSForegroundColorAttributeName];
     self.refAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorGreen
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.refAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    // No special font handling needed for references
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorGreen attributes:self.refAttributes]];
 }
 
 #pragma mark - Public
@@ -1,11 +1,11 @@
 #import "WMFSourceEditorFormatterStrikethrough.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterStrikethrough ()
 
 @property (nonatomic, strong) NSDictionary *strikethroughAttributes;
 @property (nonatomic, strong) NSDictionary *strikethroughContentAttributes;
-@property (nonatomic, strong) NSRegularExpression *strikethroughRegex;
 
 @end
 
@@ -26,70 +26,38 @@ NSString * const WMFSourceEditorCustomKeyContentStrikethrough = @"WMFSourceEdito
         _strikethroughContentAttributes = @{
             WMFSourceEditorCustomKeyContentStrikethrough: [NSNumber numberWithBool:YES]
         };
-        
-        _strikethroughRegex = [[NSRegularExpression alloc] initWithPattern:@"(<s>)(\\s*.*?)(<\\/s>)" options:0 error:nil];
     }
     
     return self;
 }
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindStrikethrough);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     // Reset
     [attributedString removeAttribute:WMFSourceEditorCustomKeyContentStrikethrough range:range];
     
-    [self.strikethroughRegex enumerateMatchesInString:attributedString.string
-                                        options:0
-                                          range:range
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange fullMatch = [result rangeAtIndex:0];
-            NSRange openingRange = [result rangeAtIndex:1];
-            NSRange contentRange = [result rangeAtIndex:2];
-            NSRange closingRange = [result rangeAtIndex:3];
-
-            if (openingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.strikethroughAttributes range:openingRange];
-            }
-        
-            if (contentRange.location != NSNotFound) {
-                [attributedString addAttributes:self.strikethroughContentAttributes range:contentRange];
-            }
-
-            if (closingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.strikethroughAttributes range:closingRange];
-            }
-        }];
+    size_t count = 0;
+    const WMFSourceEditorToken *strikethroughTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindStrikethrough, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &strikethroughTokens[i];
+        [attributedString addAttributes:self.strikethroughAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.strikethroughContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.strikethroughAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.strikethroughAttributes];
     [mutAttributes setObject:colors.greenForegroundColor forKey:NSForegroundColorAttributeName];
     self.strikethroughAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorGreen
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.strikethroughAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    // No special font handling needed
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorGreen attributes:self.strikethroughAttributes]];
 }
 
 #pragma mark - Public
@@ -1,11 +1,11 @@
 #import "WMFSourceEditorFormatterSubscript.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterSubscript ()
 
 @property (nonatomic, strong) NSDictionary *subscriptAttributes;
 @property (nonatomic, strong) NSDictionary *subscriptContentAttributes;
-@property (nonatomic, strong) NSRegularExpression *subscriptRegex;
 
 @end
 
@@ -25,69 +25,36 @@ NSString * const WMFSourceEditorCustomKeyContentSubscript = @"WMFSourceEditorCus
         _subscriptContentAttributes = @{
             WMFSourceEditorCustomKeyContentSubscript: [NSNumber numberWithBool:YES]
         };
-
-        _subscriptRegex = [[NSRegularExpression alloc] initWithPattern:@"(<sub>)(.*?)(<\\/sub>)" options:0 error:nil];
-
     }
 
     return self;
 }
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSubscript range:range];
-
-    [self.subscriptRegex enumerateMatchesInString:attributedString.string
-                                        options:0
-                                          range:range
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange fullMatch = [result rangeAtIndex:0];
-            NSRange openingRange = [result rangeAtIndex:1];
-            NSRange contentRange = [result rangeAtIndex:2];
-            NSRange closingRange = [result rangeAtIndex:3];
-
-            if (openingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.subscriptAttributes range:openingRange];
-            }
-
-            if (contentRange.location != NSNotFound) {
-                [attributedString addAttributes:self.subscriptContentAttributes range:contentRange];
-            }
-
-            if (closingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.subscriptAttributes range:closingRange];
-            }
-        }];
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSubscript);
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
+    
+    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSubscript range:range];
+    
+    size_t count = 0;
+    const WMFSourceEditorToken *subscriptTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindSubscript, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &subscriptTokens[i];
+        [attributedString addAttributes:self.subscriptAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.subscriptContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.subscriptAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.subscriptAttributes];
     [mutAttributes setObject:colors.greenForegroundColor forKey:NSForegroundColorAttributeName];
     self.subscriptAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorGreen
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.subscriptAttributes range:localRange];
-            }
-        }
-    }];
+}
 
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorGreen attributes:self.subscriptAttributes]];
 }
 
 #pragma mark - Public
@@ -1,11 +1,11 @@
 #import "WMFSourceEditorFormatterSuperscript.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterSuperscript ()
 
 @property (nonatomic, strong) NSDictionary *superscriptAttributes;
 @property (nonatomic, strong) NSDictionary *superscriptContentAttributes;
-@property (nonatomic, strong) NSRegularExpression *superscriptRegex;
 
 @end
 
@@ -25,68 +25,36 @@ NSString * const WMFSourceEditorCustomKeyContentSuperscript = @"WMFSourceEditorC
         _superscriptContentAttributes = @{
             WMFSourceEditorCustomKeyContentSuperscript: [NSNumber numberWithBool:YES]
         };
-
-        _superscriptRegex = [[NSRegularExpression alloc] initWithPattern:@"(<sup>)(.*?)(<\\/sup>)" options:0 error:nil];
     }
 
     return self;
 }
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSuperscript range:range];
-
-    [self.superscriptRegex enumerateMatchesInString:attributedString.string
-                                        options:0
-                                          range:range
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange fullMatch = [result rangeAtIndex:0];
-            NSRange openingRange = [result rangeAtIndex:1];
-            NSRange contentRange = [result rangeAtIndex:2];
-            NSRange closingRange = [result rangeAtIndex:3];
-
-            if (openingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.superscriptAttributes range:openingRange];
-            }
-
-            if (contentRange.location != NSNotFound) {
-                [attributedString addAttributes:self.superscriptContentAttributes range:contentRange];
-            }
-
-            if (closingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.superscriptAttributes range:closingRange];
-            }
-        }];
-}
-
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindSuperscript);
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
+    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentSuperscript range:range];
+    
+    size_t count = 0;
+    const WMFSourceEditorToken *superscriptTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindSuperscript, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &superscriptTokens[i];
+        [attributedString addAttributes:self.superscriptAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.superscriptContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.superscriptAttributes range:WMFSourceEditorTokenClosingRange(token)];
     }
+}
 
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.superscriptAttributes];
     [mutAttributes setObject:colors.greenForegroundColor forKey:NSForegroundColorAttributeName];
     self.superscriptAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
+}
 
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorGreen
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.superscriptAttributes range:localRange];
-            }
-        }
-    }];
-
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorGreen attributes:self.superscriptAttributes]];
 }
 
 #pragma mark - Public
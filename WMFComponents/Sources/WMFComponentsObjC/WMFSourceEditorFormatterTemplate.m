@@ -1,14 +1,11 @@
 #import "WMFSourceEditorFormatterTemplate.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterTemplate ()
 
 @property (nonatomic, strong) NSDictionary *horizontalTemplateAttributes;
 @property (nonatomic, strong) NSDictionary *verticalTemplateAttributes;
-@property (nonatomic, strong) NSRegularExpression *horizontalTemplateRegex;
-@property (nonatomic, strong) NSRegularExpression *verticalStartTemplateRegex;
-@property (nonatomic, strong) NSRegularExpression *verticalParameterTemplateRegex;
-@property (nonatomic, strong) NSRegularExpression *verticalEndTemplateRegex;
 
 @end
 
@@ -32,77 +29,38 @@ NSString * const WMFSourceEditorCustomKeyVerticalTemplate = @"WMFSourceEditorCus
             NSForegroundColorAttributeName: colors.purpleForegroundColor,
             WMFSourceEditorCustomKeyVerticalTemplate: [NSNumber numberWithBool:YES]
         };
-        
-        _horizontalTemplateRegex = [[NSRegularExpression alloc] initWithPattern:@"\\{{2}[^\\{\\}\\n]*(?:\\{{2}[^\\{\\}\\n]*\\}{2})*[^\\{\\}\\n]*\\}{2}" options:0 error:nil];
-        _verticalStartTemplateRegex = [[NSRegularExpression alloc] initWithPattern:@"^(?:.*)(\\{{2}[^\\{\\}\\n]*)$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _verticalParameterTemplateRegex = [[NSRegularExpression alloc] initWithPattern:@"^\\s*\\|.*$" options:NSRegularExpressionAnchorsMatchLines error:nil];
-        _verticalEndTemplateRegex = [[NSRegularExpression alloc] initWithPattern:@"^([^\\{\\}\n]*\\}{2})(?:.)*$" options:NSRegularExpressionAnchorsMatchLines error:nil];
     }
     return self;
 }
 
 #pragma mark - Overrides
 
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindHorizontalTemplate) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindVerticalTemplateStart) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindVerticalTemplateParameter) | WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindVerticalTemplateEnd);
+}
+
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
     
     // Reset
     [attributedString removeAttribute:WMFSourceEditorCustomKeyHorizontalTemplate range:range];
     [attributedString removeAttribute:WMFSourceEditorCustomKeyVerticalTemplate range:range];
     
-    [self.horizontalTemplateRegex enumerateMatchesInString:attributedString.string
-                                                 options:0
-                                                   range:range
-                                              usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                                  NSRange matchRange = [result rangeAtIndex:0];
-
-                                                  if (matchRange.location != NSNotFound) {
-                                                      [attributedString addAttributes:self.horizontalTemplateAttributes range:matchRange];
-                                                  }
-                                              }];
-    
-    [self.verticalStartTemplateRegex enumerateMatchesInString:attributedString.string
-                                                 options:0
-                                                   range:range
-                                              usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                                    NSRange fullMatch = [result rangeAtIndex:0];
-                                                    NSRange openingTemplateRange = [result rangeAtIndex:1];
-
-                                                    if (fullMatch.location != NSNotFound && openingTemplateRange.location != NSNotFound) {
-                                                      [attributedString addAttributes:self.verticalTemplateAttributes range:openingTemplateRange];
-                                                    }
-                                              }];
-    
-    [self.verticalParameterTemplateRegex enumerateMatchesInString:attributedString.string
-                                                 options:0
-                                                   range:range
-                                              usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                                  NSRange matchRange = [result rangeAtIndex:0];
-
-                                                  if (matchRange.location != NSNotFound) {
-                                                      [attributedString addAttributes:self.verticalTemplateAttributes range:matchRange];
-                                                  }
-                                              }];
+    size_t count = 0;
+    const WMFSourceEditorToken *horizontalTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindHorizontalTemplate, &count);
+    for (size_t i = 0; i < count; i++) {
+        [attributedString addAttributes:self.horizontalTemplateAttributes range:WMFSourceEditorTokenRange(&horizontalTokens[i])];
+    }
     
-    [self.verticalEndTemplateRegex enumerateMatchesInString:attributedString.string
-                                                 options:0
-                                                   range:range
-                                              usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-        
-                                                NSRange fullMatch = [result rangeAtIndex:0];
-                                                NSRange closingTemplateRange = [result rangeAtIndex:1];
-
-                                                if (fullMatch.location != NSNotFound && closingTemplateRange.location != NSNotFound) {
-                                                  [attributedString addAttributes:self.verticalTemplateAttributes range:closingTemplateRange];
-                                                }
-        
-                                              }];
+    WMFSourceEditorTokenKind verticalKinds[] = {WMFSourceEditorTokenKindVerticalTemplateStart, WMFSourceEditorTokenKindVerticalTemplateParameter, WMFSourceEditorTokenKindVerticalTemplateEnd};
+    for (size_t kindIndex = 0; kindIndex < sizeof(verticalKinds) / sizeof(verticalKinds[0]); kindIndex++) {
+        const WMFSourceEditorToken *verticalTokens = WMFSourceEditorTokensOfKind(tokens, verticalKinds[kindIndex], &count);
+        for (size_t i = 0; i < count; i++) {
+            [attributedString addAttributes:self.verticalTemplateAttributes range:WMFSourceEditorTokenRange(&verticalTokens[i])];
+        }
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     
     NSMutableDictionary *mutHorizontalAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.horizontalTemplateAttributes];
     [mutHorizontalAttributes setObject:colors.purpleForegroundColor forKey:NSForegroundColorAttributeName];
@@ -111,38 +69,13 @@ NSString * const WMFSourceEditorCustomKeyVerticalTemplate = @"WMFSourceEditorCus
     NSMutableDictionary *mutVerticalAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.verticalTemplateAttributes];
     [mutVerticalAttributes setObject:colors.purpleForegroundColor forKey:NSForegroundColorAttributeName];
     self.verticalTemplateAttributes = [[NSDictionary alloc] initWithDictionary:mutVerticalAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyHorizontalTemplate
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.horizontalTemplateAttributes range:localRange];
-            }
-        }
-    }];
-    
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyVerticalTemplate
-                     inRange:range
-                     options:nil
-                  usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.verticalTemplateAttributes range:localRange];
-            }
-        }
-    }];
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    // No special font handling needed for templates
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyHorizontalTemplate attributes:self.horizontalTemplateAttributes],
+        [WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyVerticalTemplate attributes:self.verticalTemplateAttributes]
+    ];
 }
 
 #pragma mark - Public
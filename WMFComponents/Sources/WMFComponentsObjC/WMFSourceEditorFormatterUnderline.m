@@ -1,11 +1,11 @@
 #import "WMFSourceEditorFormatterUnderline.h"
+#import "WMFSourceEditorFormatter_Private.h"
 #import "WMFSourceEditorColors.h"
 
 @interface WMFSourceEditorFormatterUnderline ()
 
 @property (nonatomic, strong) NSDictionary *underlineAttributes;
 @property (nonatomic, strong) NSDictionary *underlineContentAttributes;
-@property (nonatomic, strong) NSRegularExpression *underlineRegex;
 
 @end
 
@@ -25,68 +25,36 @@ NSString * const WMFSourceEditorCustomKeyContentUnderline = @"WMFSourceEditorCus
         _underlineContentAttributes = @{
             WMFSourceEditorCustomKeyContentUnderline: [NSNumber numberWithBool:YES]
         };
-
-        _underlineRegex = [[NSRegularExpression alloc] initWithPattern:@"(<u>)(.*?)(<\\/u>)" options:0 error:nil];
     }
 
     return self;
 }
-- (void)addSyntaxHighlightingToAttributedString:(nonnull NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentUnderline range:range];
-
-    [self.underlineRegex enumerateMatchesInString:attributedString.string
-                                        options:0
-                                          range:range
-                                     usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-            NSRange fullMatch = [result rangeAtIndex:0];
-            NSRange openingRange = [result rangeAtIndex:1];
-            NSRange contentRange = [result rangeAtIndex:2];
-            NSRange closingRange = [result rangeAtIndex:3];
-
-            if (openingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.underlineAttributes range:openingRange];
-            }
-
-            if (contentRange.location != NSNotFound) {
-                [attributedString addAttributes:self.underlineContentAttributes range:contentRange];
-            }
-
-            if (closingRange.location != NSNotFound) {
-                [attributedString addAttributes:self.underlineAttributes range:closingRange];
-            }
-        }];
+- (WMFSourceEditorTokenKindSet)tokenKinds {
+    return WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindUnderline);
 }
 
-- (void)updateFonts:(WMFSourceEditorFonts *)fonts inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens {
+    
+    [attributedString removeAttribute:WMFSourceEditorCustomKeyContentUnderline range:range];
+    
+    size_t count = 0;
+    const WMFSourceEditorToken *underlineTokens = WMFSourceEditorTokensOfKind(tokens, WMFSourceEditorTokenKindUnderline, &count);
+    for (size_t i = 0; i < count; i++) {
+        const WMFSourceEditorToken *token = &underlineTokens[i];
+        [attributedString addAttributes:self.underlineAttributes range:WMFSourceEditorTokenOpeningRange(token)];
+        [attributedString addAttributes:self.underlineContentAttributes range:WMFSourceEditorTokenContentRange(token)];
+        [attributedString addAttributes:self.underlineAttributes range:WMFSourceEditorTokenClosingRange(token)];
+    }
 }
 
-- (void)updateColors:(WMFSourceEditorColors *)colors inAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range {
-
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors {
     NSMutableDictionary *mutAttributes = [[NSMutableDictionary alloc] initWithDictionary:self.underlineAttributes];
     [mutAttributes setObject:colors.greenForegroundColor forKey:NSForegroundColorAttributeName];
     self.underlineAttributes = [[NSDictionary alloc] initWithDictionary:mutAttributes];
-    
-    if (![self canEvaluateAttributedString:attributedString againstRange:range]) {
-       return;
-    }
-
-    [attributedString enumerateAttribute:WMFSourceEditorCustomKeyColorGreen
-                                 inRange:range
-                                 options:nil
-                              usingBlock:^(id value, NSRange localRange, BOOL *stop) {
-        if ([value isKindOfClass: [NSNumber class]]) {
-            NSNumber *numValue = (NSNumber *)value;
-            if ([numValue boolValue] == YES) {
-                [attributedString addAttributes:self.underlineAttributes range:localRange];
-            }
-        }
-    }];
+}
 
+- (NSArray<WMFSourceEditorStyleRole *> *)styleRoles {
+    return @[[WMFSourceEditorStyleRole roleWithKey:WMFSourceEditorCustomKeyColorGreen attributes:self.underlineAttributes]];
 }
 
 #pragma mark - Public
@@ -0,0 +1,63 @@
+#import "WMFSourceEditorFormatter.h"
+#import "WMFSourceEditorLexer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The attributes a formatter gives characters marked with one of its custom keys.
+@interface WMFSourceEditorStyleRole : NSObject
+
+/// The custom key, or @c nil for every character.
+@property (nonatomic, copy, readonly, nullable) NSString *key;
+@property (nonatomic, copy, readonly) NSDictionary<NSAttributedStringKey, id> *attributes;
+
++ (instancetype)roleWithKey:(nullable NSString *)key attributes:(NSDictionary<NSAttributedStringKey, id> *)attributes;
+
+@end
+
+@interface WMFSourceEditorFormatter ()
+
+/// The kinds of tokens this formatter highlights, or 0 if it overrides -addSyntaxHighlightingToAttributedString:inRange: instead.
+@property (nonatomic, readonly) WMFSourceEditorTokenKindSet tokenKinds;
+
+/// Highlights the tokens of @c tokenKinds that were found in @c range. Only called with a range that can be evaluated.
+- (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range tokens:(const WMFSourceEditorTokenList *)tokens;
+
+/// Like +addSyntaxHighlightingToAttributedString:inRange:formatters:, for a range starting at the start of a line with @c lexerState, so it can start inside a comment.
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters lexerState:(WMFSourceEditorLexerState)lexerState;
+
+/// Highlights @c range with each of @c formatters in order, using @c tokens already lexed from it. Formatters with token kinds are skipped when @c tokens is @c NULL because the range can't be evaluated.
++ (void)addSyntaxHighlightingToAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters tokens:(nullable const WMFSourceEditorTokenList *)tokens;
+
++ (WMFSourceEditorTokenKindSet)tokenKindsOfFormatters:(NSArray<WMFSourceEditorFormatter *> *)formatters;
+
+/// Updates the attributes this formatter highlights and restyles with to @c colors, without changing any text.
+- (void)updateColorAttributesWithColors:(WMFSourceEditorColors *)colors;
+
+/// Updates the attributes this formatter highlights and restyles with to @c fonts, without changing any text.
+- (void)updateFontAttributesWithFonts:(WMFSourceEditorFonts *)fonts;
+
+/// The attributes for each custom key this formatter marks characters with, in the order it applies them. Later roles win, including other formatters' later roles.
+@property (nonatomic, readonly) NSArray<WMFSourceEditorStyleRole *> *styleRoles;
+
+/// Gives the characters in @c range the current attributes of each of @c formatters' style roles, in one walk over the attribute runs.
++ (void)restyleAttributedString:(NSMutableAttributedString *)attributedString inRange:(NSRange)range formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters;
+
+@end
+
+static inline NSRange WMFSourceEditorTokenRange(const WMFSourceEditorToken *token) {
+    return NSMakeRange(token->location, token->length);
+}
+
+static inline NSRange WMFSourceEditorTokenOpeningRange(const WMFSourceEditorToken *token) {
+    return NSMakeRange(token->location, token->openingLength);
+}
+
+static inline NSRange WMFSourceEditorTokenContentRange(const WMFSourceEditorToken *token) {
+    return NSMakeRange(token->location + token->openingLength, token->length - token->openingLength - token->closingLength);
+}
+
+static inline NSRange WMFSourceEditorTokenClosingRange(const WMFSourceEditorToken *token) {
+    return NSMakeRange(token->location + token->length - token->closingLength, token->closingLength);
+}
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,884 @@
+#include "WMFSourceEditorLexer.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Each rule below stands in for one of the regular expressions the formatters used to run, and finds the same
+// matches: the leftmost match, then the next one starting where it ended, with the same backtracking outcome. The
+// expressions were simple enough that each outcome can be decided by scanning forward, so the rules are small
+// matchers driven by one table of the characters that can start them, all advanced together in a single pass.
+//
+// The regular expressions were enumerated over a range with the default NSRegularExpression bounds, so:
+// - lookahead doesn't see past the end of the range, but lookbehind sees before its start
+// - ^ matches at the start of the range and $ at its end
+// - . stops at any line terminator, not only \n
+//
+// Comments are the exception. They can span lines, so they're matched up to their closing wherever it is, and a range
+// can start inside one that opened on an earlier line.
+
+#pragma mark - Token Lists
+
+void WMFSourceEditorTokenListInit(WMFSourceEditorTokenList *list) {
+    memset(list, 0, sizeof(*list));
+}
+
+void WMFSourceEditorTokenListFree(WMFSourceEditorTokenList *list) {
+    free(list->tokens);
+    WMFSourceEditorTokenListInit(list);
+}
+
+const WMFSourceEditorToken *WMFSourceEditorTokensOfKind(const WMFSourceEditorTokenList *list, WMFSourceEditorTokenKind kind, size_t *count) {
+    *count = list->kindStarts[kind + 1] - list->kindStarts[kind];
+    return list->tokens + list->kindStarts[kind];
+}
+
+static void WMFSourceEditorTokenListAppend(WMFSourceEditorTokenList *list, WMFSourceEditorTokenKind kind, size_t location, size_t length, size_t openingLength, size_t closingLength) {
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity > 0 ? list->capacity * 2 : 64;
+        WMFSourceEditorToken *tokens = realloc(list->tokens, capacity * sizeof(WMFSourceEditorToken));
+        if (!tokens) {
+            return;
+        }
+        list->tokens = tokens;
+        list->capacity = capacity;
+    }
+    list->tokens[list->count++] = (WMFSourceEditorToken){kind, location, length, openingLength, closingLength};
+}
+
+/// Groups tokens by kind, keeping the order they were found in within each kind.
+static void WMFSourceEditorTokenListSortByKind(WMFSourceEditorTokenList *list) {
+    size_t counts[WMFSourceEditorTokenKindCount] = {0};
+    for (size_t i = 0; i < list->count; i++) {
+        counts[list->tokens[i].kind]++;
+    }
+    size_t start = 0;
+    for (size_t kind = 0; kind < WMFSourceEditorTokenKindCount; kind++) {
+        list->kindStarts[kind] = start;
+        start += counts[kind];
+    }
+    list->kindStarts[WMFSourceEditorTokenKindCount] = start;
+    if (list->count < 2) {
+        return;
+    }
+    WMFSourceEditorToken *sorted = malloc(list->count * sizeof(WMFSourceEditorToken));
+    if (!sorted) {
+        return;
+    }
+    size_t next[WMFSourceEditorTokenKindCount];
+    memcpy(next, list->kindStarts, sizeof(next));
+    for (size_t i = 0; i < list->count; i++) {
+        sorted[next[list->tokens[i].kind]++] = list->tokens[i];
+    }
+    free(list->tokens);
+    list->tokens = sorted;
+    list->capacity = list->count;
+}
+
+#pragma mark - Characters
+
+static inline bool WMFSourceEditorIsLineTerminator(uint16_t c) {
+    return (c >= 0x0A && c <= 0x0D) || c == 0x85 || c == 0x2028 || c == 0x2029;
+}
+
+/// Unicode White_Space, which is what \s matches
+static inline bool WMFSourceEditorIsWhitespace(uint16_t c) {
+    if (c <= 0x20) {
+        return c == 0x20 || (c >= 0x09 && c <= 0x0D);
+    }
+    if (c < 0x85) {
+        return false;
+    }
+    return c == 0x85 || c == 0xA0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000;
+}
+
+/// @return The location of the first @c --> at or after @c location and before @c end, or @c end if there isn't one.
+static size_t WMFSourceEditorCommentClosingLocation(const uint16_t *characters, size_t location, size_t end) {
+    for (; location + 3 <= end; location++) {
+        if (characters[location] == '-' && characters[location + 1] == '-' && characters[location + 2] == '>') {
+            return location;
+        }
+    }
+    return end;
+}
+
+/// @return The location of the first @c <!-- at or after @c location and before @c end, or @c end if there isn't one.
+static size_t WMFSourceEditorCommentOpeningLocation(const uint16_t *characters, size_t location, size_t end) {
+    for (; location + 4 <= end; location++) {
+        if (characters[location] == '<' && characters[location + 1] == '!' && characters[location + 2] == '-' && characters[location + 3] == '-') {
+            return location;
+        }
+    }
+    return end;
+}
+
+#pragma mark - Lexer State
+
+bool WMFSourceEditorLexerStateEqualToState(WMFSourceEditorLexerState state, WMFSourceEditorLexerState otherState) {
+    return state.isInComment == otherState.isInComment;
+}
+
+WMFSourceEditorLexerState WMFSourceEditorLexerStateAfterCharacters(const uint16_t *characters, size_t length, WMFSourceEditorLexerState state) {
+    size_t location = 0;
+    while (location < length) {
+        if (state.isInComment) {
+            size_t closingLocation = WMFSourceEditorCommentClosingLocation(characters, location, length);
+            if (closingLocation == length) {
+                break;
+            }
+            location = closingLocation + 3;
+        } else {
+            size_t openingLocation = WMFSourceEditorCommentOpeningLocation(characters, location, length);
+            if (openingLocation == length) {
+                break;
+            }
+            location = openingLocation + 4;
+        }
+        state.isInComment = !state.isInComment;
+    }
+    return state;
+}
+
+size_t WMFSourceEditorLexerStatesConverge(const uint16_t *characters, size_t length, WMFSourceEditorLexerState *state, WMFSourceEditorLexerState *otherState) {
+    size_t lineStart = 0;
+    while (!WMFSourceEditorLexerStateEqualToState(*state, *otherState)) {
+        if (lineStart == length) {
+            return length;
+        }
+        size_t lineEnd = lineStart;
+        while (lineEnd < length && characters[lineEnd++] != '\n') {
+        }
+        *state = WMFSourceEditorLexerStateAfterCharacters(characters + lineStart, lineEnd - lineStart, *state);
+        *otherState = WMFSourceEditorLexerStateAfterCharacters(characters + lineStart, lineEnd - lineStart, *otherState);
+        lineStart = lineEnd;
+    }
+    return lineStart;
+}
+
+#pragma mark - Checkpoints
+
+void WMFSourceEditorCheckpointListInit(WMFSourceEditorCheckpointList *list) {
+    list->checkpoints = malloc(sizeof(WMFSourceEditorCheckpoint));
+    list->capacity = list->checkpoints ? 1 : 0;
+    list->count = 0;
+    WMFSourceEditorCheckpointListInsert(list, 0, (WMFSourceEditorLexerState){0});
+}
+
+void WMFSourceEditorCheckpointListFree(WMFSourceEditorCheckpointList *list) {
+    free(list->checkpoints);
+    memset(list, 0, sizeof(*list));
+}
+
+size_t WMFSourceEditorCheckpointIndexAfterLocation(const WMFSourceEditorCheckpointList *list, size_t location) {
+    size_t low = 0;
+    size_t high = list->count;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (list->checkpoints[middle].location <= location) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+WMFSourceEditorCheckpoint WMFSourceEditorCheckpointBeforeLocation(const WMFSourceEditorCheckpointList *list, size_t location) {
+    size_t index = WMFSourceEditorCheckpointIndexAfterLocation(list, location);
+    if (index == 0) {
+        return (WMFSourceEditorCheckpoint){0, {0}};
+    }
+    return list->checkpoints[index - 1];
+}
+
+void WMFSourceEditorCheckpointListInsert(WMFSourceEditorCheckpointList *list, size_t location, WMFSourceEditorLexerState state) {
+    size_t index = WMFSourceEditorCheckpointIndexAfterLocation(list, location);
+    if (index > 0 && list->checkpoints[index - 1].location == location) {
+        list->checkpoints[index - 1].state = state;
+        return;
+    }
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity > 0 ? list->capacity * 2 : 16;
+        WMFSourceEditorCheckpoint *checkpoints = realloc(list->checkpoints, capacity * sizeof(WMFSourceEditorCheckpoint));
+        if (!checkpoints) {
+            return;
+        }
+        list->checkpoints = checkpoints;
+        list->capacity = capacity;
+    }
+    memmove(list->checkpoints + index + 1, list->checkpoints + index, (list->count - index) * sizeof(WMFSourceEditorCheckpoint));
+    list->checkpoints[index] = (WMFSourceEditorCheckpoint){location, state};
+    list->count++;
+}
+
+void WMFSourceEditorCheckpointListRemove(WMFSourceEditorCheckpointList *list, size_t location, size_t end) {
+    if (end <= location) {
+        return;
+    }
+    size_t from = WMFSourceEditorCheckpointIndexAfterLocation(list, location);
+    size_t to = WMFSourceEditorCheckpointIndexAfterLocation(list, end - 1);
+    if (to <= from) {
+        return;
+    }
+    memmove(list->checkpoints + from, list->checkpoints + to, (list->count - to) * sizeof(WMFSourceEditorCheckpoint));
+    list->count -= to - from;
+}
+
+void WMFSourceEditorCheckpointListReplaceCharacters(WMFSourceEditorCheckpointList *list, size_t location, size_t replacedLength, size_t replacementLength) {
+    size_t replacedEnd = location + replacedLength;
+    WMFSourceEditorCheckpointListRemove(list, location, replacedEnd + 1);
+    for (size_t index = WMFSourceEditorCheckpointIndexAfterLocation(list, replacedEnd); index < list->count; index++) {
+        list->checkpoints[index].location = list->checkpoints[index].location - replacedLength + replacementLength;
+    }
+}
+
+#pragma mark - Lexer
+
+/// Where a rule stopped finding its closing markup, so later openings on the same line don't search for it again.
+typedef struct {
+    size_t from;
+    size_t lineEnd;
+} WMFSourceEditorMissingClosing;
+
+/// A @c [[ or @c ]] on a line with links with nested links
+typedef struct {
+    size_t location;
+    /// The index of the bracket it pairs up with, or @c SIZE_MAX if there isn't one before the end of the line
+    size_t partner;
+    bool isOpening;
+    /// Whether a search for links with nested links already reached it as an outermost link
+    bool isVisited;
+} WMFSourceEditorLinkBracket;
+
+typedef struct {
+    const uint16_t *characters;
+    size_t length;
+    size_t start;
+    size_t end;
+    WMFSourceEditorTokenList *tokens;
+    WMFSourceEditorMissingClosing missingClosings[WMFSourceEditorTokenKindCount];
+    /// The @c [[ and @c ]] paired up from @c linkBracketsStart to the end of its line, for links with nested links
+    WMFSourceEditorLinkBracket *linkBrackets;
+    size_t linkBracketCount;
+    size_t linkBracketCapacity;
+    size_t linkBracketsStart;
+    size_t linkBracketsEnd;
+    /// Scratch space for pairing up link brackets
+    size_t *openLinks;
+    size_t openLinksCapacity;
+} WMFSourceEditorLexer;
+
+/// @return The location of the first line terminator at or after @c location, or the end of the range.
+static size_t WMFSourceEditorLineEnd(const WMFSourceEditorLexer *lexer, size_t location) {
+    const uint16_t *characters = lexer->characters;
+    while (location < lexer->end && !WMFSourceEditorIsLineTerminator(characters[location])) {
+        location++;
+    }
+    return location;
+}
+
+/// @return Whether or not $ matches at @c location. It matches before every line terminator except the \n of a \r\n.
+static bool WMFSourceEditorIsEndOfLine(const WMFSourceEditorLexer *lexer, size_t location) {
+    if (location >= lexer->end) {
+        return true;
+    }
+    uint16_t c = lexer->characters[location];
+    if (!WMFSourceEditorIsLineTerminator(c)) {
+        return false;
+    }
+    return !(c == '\n' && location > lexer->start && lexer->characters[location - 1] == '\r');
+}
+
+static bool WMFSourceEditorHasASCIIString(const WMFSourceEditorLexer *lexer, size_t location, const char *string, size_t stringLength) {
+    if (stringLength > lexer->end - location) {
+        return false;
+    }
+    const uint16_t *characters = lexer->characters + location;
+    for (size_t i = 0; i < stringLength; i++) {
+        if (characters[i] != (uint16_t)string[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @return The end of the run of characters other than @c {, @c } and @c \n starting at @c location.
+static size_t WMFSourceEditorTemplateTextEnd(const WMFSourceEditorLexer *lexer, size_t location) {
+    const uint16_t *characters = lexer->characters;
+    while (location < lexer->end && characters[location] != '{' && characters[location] != '}' && characters[location] != '\n') {
+        location++;
+    }
+    return location;
+}
+
+/// @return The end of the run of characters other than @c [, @c ] and @c \n starting at @c location.
+static size_t WMFSourceEditorLinkTextEnd(const WMFSourceEditorLexer *lexer, size_t location) {
+    const uint16_t *characters = lexer->characters;
+    while (location < lexer->end && characters[location] != '[' && characters[location] != ']' && characters[location] != '\n') {
+        location++;
+    }
+    return location;
+}
+
+static inline bool WMFSourceEditorHasPair(const WMFSourceEditorLexer *lexer, size_t location, uint16_t c) {
+    return location + 1 < lexer->end && lexer->characters[location] == c && lexer->characters[location + 1] == c;
+}
+
+#pragma mark - Rules
+
+typedef enum {
+    /// The markup is exactly two apostrophes, without an apostrophe on either side, like @c (?<!')''(?!')
+    WMFSourceEditorRuleIsolatedMarkup = 1 << 0,
+    /// White space at the start of the content may include line breaks, like @c \s*.*?
+    WMFSourceEditorRuleLeadingWhitespace = 1 << 1,
+    /// The opening is the whole run of its first character, like @c \*{2,}
+    WMFSourceEditorRuleRepeatedOpening = 1 << 2,
+} WMFSourceEditorRuleFlags;
+
+typedef struct WMFSourceEditorRule WMFSourceEditorRule;
+
+/**
+ * Tries to match @c rule at @c location, appending its tokens when it does.
+ *
+ * @return The end of the match, where the rule starts looking for its next one, or @c 0 if it doesn't match.
+ */
+typedef size_t (*WMFSourceEditorRuleMatcher)(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location);
+
+struct WMFSourceEditorRule {
+    WMFSourceEditorTokenKind kind;
+    WMFSourceEditorRuleMatcher match;
+    const char *opening;
+    const char *closing;
+    uint8_t flags;
+};
+
+static bool WMFSourceEditorHasMarkup(const WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location, const char *markup, size_t markupLength) {
+    if (!WMFSourceEditorHasASCIIString(lexer, location, markup, markupLength)) {
+        return false;
+    }
+    if (rule->flags & WMFSourceEditorRuleIsolatedMarkup) {
+        const uint16_t *characters = lexer->characters;
+        if (location > 0 && characters[location - 1] == markup[0]) {
+            return false;
+        }
+        if (location + markupLength < lexer->end && characters[location + markupLength] == markup[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Finds the closing markup of a rule whose content is @c .*?, which is the first closing markup on the same line.
+ *
+ * @return The location of the closing markup, or @c 0 if there isn't one.
+ */
+static size_t WMFSourceEditorFindClosing(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t contentLocation) {
+    // If a closing wasn't found after an earlier opening on this line, it won't be found after this one either
+    WMFSourceEditorMissingClosing *missing = &lexer->missingClosings[rule->kind];
+    if (contentLocation >= missing->from && contentLocation <= missing->lineEnd) {
+        return 0;
+    }
+    size_t closingLength = strlen(rule->closing);
+    size_t lineEnd = WMFSourceEditorLineEnd(lexer, contentLocation);
+    const uint16_t *characters = lexer->characters;
+    for (size_t location = contentLocation; location + closingLength <= lineEnd; location++) {
+        if (characters[location] == (uint16_t)rule->closing[0] && WMFSourceEditorHasMarkup(lexer, rule, location, rule->closing, closingLength)) {
+            return location;
+        }
+    }
+    missing->from = contentLocation;
+    missing->lineEnd = lineEnd;
+    return 0;
+}
+
+/// @c (opening)(.*?)(closing), or @c (opening)(\\s*.*?)(closing) with @c WMFSourceEditorRuleLeadingWhitespace
+static size_t WMFSourceEditorMatchDelimited(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t openingLength = strlen(rule->opening);
+    if (!WMFSourceEditorHasMarkup(lexer, rule, location, rule->opening, openingLength)) {
+        return 0;
+    }
+    size_t contentLocation = location + openingLength;
+    size_t searchLocation = contentLocation;
+    if (rule->flags & WMFSourceEditorRuleLeadingWhitespace) {
+        // \s* takes all of the white space first, and giving some of it back can't reach a closing on another line
+        while (searchLocation < lexer->end && WMFSourceEditorIsWhitespace(lexer->characters[searchLocation])) {
+            searchLocation++;
+        }
+    }
+    size_t closingLocation = WMFSourceEditorFindClosing(lexer, rule, searchLocation);
+    if (closingLocation == 0) {
+        return 0;
+    }
+    size_t closingLength = strlen(rule->closing);
+    size_t end = closingLocation + closingLength;
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, openingLength, closingLength);
+    return end;
+}
+
+/// A literal with nothing around it, like @c <\\/ref>
+static size_t WMFSourceEditorMatchLiteral(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t length = strlen(rule->opening);
+    if (!WMFSourceEditorHasASCIIString(lexer, location, rule->opening, length)) {
+        return 0;
+    }
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, length, length, 0);
+    return location + length;
+}
+
+/// @return The end of @c <ref(?:[^\\/>]+?)?> at @c location, or @c 0 if there isn't one.
+static size_t WMFSourceEditorReferenceOpeningEnd(const WMFSourceEditorLexer *lexer, size_t location) {
+    if (!WMFSourceEditorHasASCIIString(lexer, location, "<ref", 4)) {
+        return 0;
+    }
+    // The attributes can't contain / or >, so the opening ends at the first of them, and only if it's >
+    const uint16_t *characters = lexer->characters;
+    for (size_t i = location + 4; i < lexer->end; i++) {
+        if (characters[i] == '>') {
+            return i + 1;
+        }
+        if (characters[i] == '/') {
+            return 0;
+        }
+    }
+    return 0;
+}
+
+static size_t WMFSourceEditorMatchReferenceOpen(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t end = WMFSourceEditorReferenceOpeningEnd(lexer, location);
+    if (end == 0) {
+        return 0;
+    }
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, end - location, 0);
+    return end;
+}
+
+/// @c (<ref(?:[^\\/>]+?)?>)(.*?)(<\\/ref>)
+static size_t WMFSourceEditorMatchReferenceHorizontal(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t contentLocation = WMFSourceEditorReferenceOpeningEnd(lexer, location);
+    if (contentLocation == 0) {
+        return 0;
+    }
+    size_t closingLocation = WMFSourceEditorFindClosing(lexer, rule, contentLocation);
+    if (closingLocation == 0) {
+        return 0;
+    }
+    size_t closingLength = strlen(rule->closing);
+    size_t end = closingLocation + closingLength;
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, contentLocation - location, closingLength);
+    return end;
+}
+
+/// @c <ref[^>]+?\\/>
+static size_t WMFSourceEditorMatchReferenceEmpty(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    if (!WMFSourceEditorHasASCIIString(lexer, location, "<ref", 4)) {
+        return 0;
+    }
+    // The first > ends it, and it needs at least one character between <ref and />
+    const uint16_t *characters = lexer->characters;
+    for (size_t i = location + 4; i < lexer->end; i++) {
+        if (characters[i] == '>') {
+            if (i < location + 6 || characters[i - 1] != '/') {
+                return 0;
+            }
+            WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, i + 1 - location, 0, 0);
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/// @c (\\[{2})([^\\[\\]\\n]*)(\\]{2})
+static size_t WMFSourceEditorMatchSimpleLink(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    if (!WMFSourceEditorHasPair(lexer, location, '[')) {
+        return 0;
+    }
+    size_t closingLocation = WMFSourceEditorLinkTextEnd(lexer, location + 2);
+    if (!WMFSourceEditorHasPair(lexer, closingLocation, ']')) {
+        return 0;
+    }
+    size_t end = closingLocation + 2;
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, 2, 2);
+    return end;
+}
+
+/**
+ * Pairs up every @c [[ and @c ]] from @c location to the end of its line, which may be past the end of the range.
+ *
+ * Pairing is the same from any later bracket on the line, except that a @c ]] whose @c [[ is before it doesn't
+ * pair up, so the brackets are only indexed once per line.
+ *
+ * @return Whether or not there was enough memory.
+ */
+static bool WMFSourceEditorIndexLinkBrackets(WMFSourceEditorLexer *lexer, size_t location) {
+    // Nothing is indexed until it's done
+    lexer->linkBracketsStart = 0;
+    lexer->linkBracketsEnd = 0;
+    lexer->linkBracketCount = 0;
+    const uint16_t *characters = lexer->characters;
+    size_t count = 0;
+    size_t openCount = 0;
+    size_t i = location;
+    for (; i + 1 < lexer->length && characters[i] != '\n'; i++) {
+        bool isOpening = characters[i] == '[' && characters[i + 1] == '[';
+        if (!isOpening && !(characters[i] == ']' && characters[i + 1] == ']')) {
+            continue;
+        }
+        if (count == lexer->linkBracketCapacity) {
+            size_t capacity = count > 0 ? count * 2 : 16;
+            WMFSourceEditorLinkBracket *brackets = realloc(lexer->linkBrackets, capacity * sizeof(WMFSourceEditorLinkBracket));
+            if (!brackets) {
+                return false;
+            }
+            lexer->linkBrackets = brackets;
+            lexer->linkBracketCapacity = capacity;
+        }
+        WMFSourceEditorLinkBracket *bracket = &lexer->linkBrackets[count];
+        *bracket = (WMFSourceEditorLinkBracket){i, SIZE_MAX, isOpening, false};
+        if (isOpening) {
+            if (openCount == lexer->openLinksCapacity) {
+                size_t capacity = openCount > 0 ? openCount * 2 : 8;
+                size_t *openLinks = realloc(lexer->openLinks, capacity * sizeof(size_t));
+                if (!openLinks) {
+                    return false;
+                }
+                lexer->openLinks = openLinks;
+                lexer->openLinksCapacity = capacity;
+            }
+            lexer->openLinks[openCount++] = count;
+        } else if (openCount > 0) {
+            size_t opening = lexer->openLinks[--openCount];
+            bracket->partner = opening;
+            lexer->linkBrackets[opening].partner = count;
+        }
+        count++;
+    }
+    lexer->linkBracketCount = count;
+    lexer->linkBracketsStart = location;
+    lexer->linkBracketsEnd = i;
+    return true;
+}
+
+/// @return The index of the link bracket at @c location, which is one of them.
+static size_t WMFSourceEditorLinkBracketIndex(const WMFSourceEditorLexer *lexer, size_t location) {
+    size_t lower = 0;
+    size_t upper = lexer->linkBracketCount;
+    while (lower < upper) {
+        size_t middle = lower + (upper - lower) / 2;
+        if (lexer->linkBrackets[middle].location < location) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+    return lower;
+}
+
+/**
+ * Finds links that contain other links, starting at a @c [[ followed by another @c [[ on the same line, which is
+ * what @c \\[{2}[^\\[\\]\\n]*\\[{2} matches.
+ *
+ * Brackets are paired up from there to the end of the line, which may be past the end of the range, and every
+ * outermost link that closes after a nested one is a token. An unmatched @c ]] stops the search.
+ *
+ * The outermost links are the one at @c location and the ones after it at the same depth, so the search hops from
+ * each one's @c ]] to the next one's @c [[ with the line's bracket index. A later @c [[ at the same depth would
+ * find the rest of the same links again, so the search stops at the first one that was already reached.
+ */
+static size_t WMFSourceEditorMatchLinkWithNestedLink(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    if (!WMFSourceEditorHasPair(lexer, location, '[')) {
+        return 0;
+    }
+    size_t nestedLocation = WMFSourceEditorLinkTextEnd(lexer, location + 2);
+    if (!WMFSourceEditorHasPair(lexer, nestedLocation, '[')) {
+        return 0;
+    }
+
+    if (location < lexer->linkBracketsStart || location >= lexer->linkBracketsEnd) {
+        if (!WMFSourceEditorIndexLinkBrackets(lexer, location)) {
+            return nestedLocation + 2;
+        }
+    }
+
+    WMFSourceEditorLinkBracket *brackets = lexer->linkBrackets;
+    size_t index = WMFSourceEditorLinkBracketIndex(lexer, location);
+    while (index < lexer->linkBracketCount && brackets[index].isOpening && !brackets[index].isVisited) {
+        WMFSourceEditorLinkBracket *opening = &brackets[index];
+        opening->isVisited = true;
+        size_t closingIndex = opening->partner;
+        if (closingIndex == SIZE_MAX) {
+            // Everything after it is nested
+            break;
+        }
+        if (closingIndex > index + 1) {
+            size_t end = brackets[closingIndex].location + 2;
+            WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, opening->location, end - opening->location, 0, 0);
+        }
+        // A ]] here closes a link that opened before the search started
+        index = closingIndex + 1;
+    }
+    return nestedLocation + 2;
+}
+
+/// @c \\{{2}[^\\{\\}\\n]*(?:\\{{2}[^\\{\\}\\n]*\\}{2})*[^\\{\\}\\n]*\\}{2}
+static size_t WMFSourceEditorMatchHorizontalTemplate(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    if (!WMFSourceEditorHasPair(lexer, location, '{')) {
+        return 0;
+    }
+    // Each run of text stops at a brace, so the only choice is how many nested templates to take, and taking fewer
+    // than all of them leaves a {{ where the closing }} would have to be. Nested templates follow each other directly,
+    // with text only before the first one and after the last one.
+    size_t closingLocation = WMFSourceEditorTemplateTextEnd(lexer, location + 2);
+    while (WMFSourceEditorHasPair(lexer, closingLocation, '{')) {
+        size_t nestedClosingLocation = WMFSourceEditorTemplateTextEnd(lexer, closingLocation + 2);
+        if (!WMFSourceEditorHasPair(lexer, nestedClosingLocation, '}')) {
+            return 0;
+        }
+        closingLocation = nestedClosingLocation + 2;
+    }
+    closingLocation = WMFSourceEditorTemplateTextEnd(lexer, closingLocation);
+    if (!WMFSourceEditorHasPair(lexer, closingLocation, '}')) {
+        return 0;
+    }
+    size_t end = closingLocation + 2;
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, 2, 2);
+    return end;
+}
+
+/// @c ^(?:.*)(\\{{2}[^\\{\\}\\n]*)$
+static size_t WMFSourceEditorMatchVerticalTemplateStart(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    // .* takes the whole line first, so the last {{ on the line is tried first. Any earlier {{ would need to reach
+    // the end of the line without crossing a brace, so only the last one can match.
+    const uint16_t *characters = lexer->characters;
+    size_t lineEnd = WMFSourceEditorLineEnd(lexer, location);
+    size_t templateLocation = lineEnd;
+    for (size_t i = lineEnd; i >= location + 2; i--) {
+        if (characters[i - 1] == '{' && characters[i - 2] == '{') {
+            templateLocation = i - 2;
+            break;
+        }
+    }
+    if (templateLocation == lineEnd) {
+        return 0;
+    }
+    // The text can continue past line terminators other than \n, and gives back characters until $ matches
+    size_t textEnd = WMFSourceEditorTemplateTextEnd(lexer, templateLocation + 2);
+    for (size_t end = textEnd; end >= templateLocation + 2; end--) {
+        if (WMFSourceEditorIsEndOfLine(lexer, end)) {
+            WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, templateLocation, end - templateLocation, 2, 0);
+            return end;
+        }
+    }
+    return 0;
+}
+
+/// @c ^\\s*\\|.*$
+static size_t WMFSourceEditorMatchVerticalTemplateParameter(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    const uint16_t *characters = lexer->characters;
+    size_t barLocation = location;
+    while (barLocation < lexer->end && WMFSourceEditorIsWhitespace(characters[barLocation])) {
+        barLocation++;
+    }
+    if (barLocation >= lexer->end || characters[barLocation] != '|') {
+        return 0;
+    }
+    size_t end = WMFSourceEditorLineEnd(lexer, barLocation + 1);
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, 0, 0);
+    return end;
+}
+
+/// @c ^([^\\{\\}\\n]*\\}{2})(?:.)*$
+static size_t WMFSourceEditorMatchVerticalTemplateEnd(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t closingLocation = WMFSourceEditorTemplateTextEnd(lexer, location);
+    if (!WMFSourceEditorHasPair(lexer, closingLocation, '}')) {
+        return 0;
+    }
+    size_t closingEnd = closingLocation + 2;
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, closingEnd - location, 0, 2);
+    return WMFSourceEditorLineEnd(lexer, closingEnd);
+}
+
+/// @c ^(={n})([^=]*)(={n})(?!=)$, where the content can span lines
+static size_t WMFSourceEditorMatchHeading(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    size_t markupLength = strlen(rule->opening);
+    if (!WMFSourceEditorHasASCIIString(lexer, location, rule->opening, markupLength)) {
+        return 0;
+    }
+    const uint16_t *characters = lexer->characters;
+    size_t closingLocation = location + markupLength;
+    while (closingLocation < lexer->end && characters[closingLocation] != '=') {
+        closingLocation++;
+    }
+    if (!WMFSourceEditorHasASCIIString(lexer, closingLocation, rule->opening, markupLength)) {
+        return 0;
+    }
+    size_t end = closingLocation + markupLength;
+    if ((end < lexer->end && characters[end] == '=') || !WMFSourceEditorIsEndOfLine(lexer, end)) {
+        return 0;
+    }
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, markupLength, markupLength);
+    return end;
+}
+
+/// @c ^(\\*{1})(.*)$, or @c ^(\\*{2,})(.*)$ with @c WMFSourceEditorRuleRepeatedOpening
+static size_t WMFSourceEditorMatchList(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    const uint16_t *characters = lexer->characters;
+    uint16_t markup = (uint16_t)rule->opening[0];
+    if (characters[location] != markup) {
+        return 0;
+    }
+    size_t openingLength = 1;
+    if (rule->flags & WMFSourceEditorRuleRepeatedOpening) {
+        while (location + openingLength < lexer->end && characters[location + openingLength] == markup) {
+            openingLength++;
+        }
+        if (openingLength < 2) {
+            return 0;
+        }
+    }
+    size_t end = WMFSourceEditorLineEnd(lexer, location + openingLength);
+    WMFSourceEditorTokenListAppend(lexer->tokens, rule->kind, location, end - location, openingLength, 0);
+    return end;
+}
+
+/// Appends a comment starting at @c location that runs to the first @c --> after its opening, or to the end of the range if it isn't closed in it.
+static size_t WMFSourceEditorAppendComment(WMFSourceEditorLexer *lexer, size_t location, size_t openingLength) {
+    size_t closingLocation = WMFSourceEditorCommentClosingLocation(lexer->characters, location + openingLength, lexer->end);
+    size_t closingLength = closingLocation < lexer->end ? 3 : 0;
+    size_t end = closingLocation + closingLength;
+    WMFSourceEditorTokenListAppend(lexer->tokens, WMFSourceEditorTokenKindComment, location, end - location, openingLength, closingLength);
+    return end;
+}
+
+/// Like @c (?s)<!--.*?--> instead of the others' @c .*? that stops at the end of a line.
+static size_t WMFSourceEditorMatchComment(WMFSourceEditorLexer *lexer, const WMFSourceEditorRule *rule, size_t location) {
+    if (!WMFSourceEditorHasASCIIString(lexer, location, rule->opening, 4)) {
+        return 0;
+    }
+    return WMFSourceEditorAppendComment(lexer, location, 4);
+}
+
+static const WMFSourceEditorRule WMFSourceEditorRules[WMFSourceEditorTokenKindCount] = {
+    {WMFSourceEditorTokenKindBoldItalics, WMFSourceEditorMatchDelimited, "'''''", "'''''", 0},
+    {WMFSourceEditorTokenKindBold, WMFSourceEditorMatchDelimited, "'''", "'''", 0},
+    {WMFSourceEditorTokenKindItalics, WMFSourceEditorMatchDelimited, "''", "''", WMFSourceEditorRuleIsolatedMarkup},
+    {WMFSourceEditorTokenKindSimpleLink, WMFSourceEditorMatchSimpleLink, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindLinkWithNestedLink, WMFSourceEditorMatchLinkWithNestedLink, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindHorizontalTemplate, WMFSourceEditorMatchHorizontalTemplate, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindVerticalTemplateStart, WMFSourceEditorMatchVerticalTemplateStart, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindVerticalTemplateParameter, WMFSourceEditorMatchVerticalTemplateParameter, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindVerticalTemplateEnd, WMFSourceEditorMatchVerticalTemplateEnd, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindHeading, WMFSourceEditorMatchHeading, "==", NULL, 0},
+    {WMFSourceEditorTokenKindSubheading1, WMFSourceEditorMatchHeading, "===", NULL, 0},
+    {WMFSourceEditorTokenKindSubheading2, WMFSourceEditorMatchHeading, "====", NULL, 0},
+    {WMFSourceEditorTokenKindSubheading3, WMFSourceEditorMatchHeading, "=====", NULL, 0},
+    {WMFSourceEditorTokenKindSubheading4, WMFSourceEditorMatchHeading, "======", NULL, 0},
+    {WMFSourceEditorTokenKindBulletSingle, WMFSourceEditorMatchList, "*", NULL, 0},
+    {WMFSourceEditorTokenKindBulletMultiple, WMFSourceEditorMatchList, "*", NULL, WMFSourceEditorRuleRepeatedOpening},
+    {WMFSourceEditorTokenKindNumberSingle, WMFSourceEditorMatchList, "#", NULL, 0},
+    {WMFSourceEditorTokenKindNumberMultiple, WMFSourceEditorMatchList, "#", NULL, WMFSourceEditorRuleRepeatedOpening},
+    {WMFSourceEditorTokenKindReferenceHorizontal, WMFSourceEditorMatchReferenceHorizontal, NULL, "</ref>", 0},
+    {WMFSourceEditorTokenKindReferenceEmpty, WMFSourceEditorMatchReferenceEmpty, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindReferenceOpen, WMFSourceEditorMatchReferenceOpen, NULL, NULL, 0},
+    {WMFSourceEditorTokenKindReferenceClose, WMFSourceEditorMatchLiteral, "</ref>", NULL, 0},
+    {WMFSourceEditorTokenKindStrikethrough, WMFSourceEditorMatchDelimited, "<s>", "</s>", WMFSourceEditorRuleLeadingWhitespace},
+    {WMFSourceEditorTokenKindSubscript, WMFSourceEditorMatchDelimited, "<sub>", "</sub>", 0},
+    {WMFSourceEditorTokenKindSuperscript, WMFSourceEditorMatchDelimited, "<sup>", "</sup>", 0},
+    {WMFSourceEditorTokenKindUnderline, WMFSourceEditorMatchDelimited, "<u>", "</u>", 0},
+    {WMFSourceEditorTokenKindComment, WMFSourceEditorMatchComment, "<!--", "-->", 0},
+};
+
+#define WMFSourceEditorKinds(kind) ((WMFSourceEditorTokenKindSet)1 << WMFSourceEditorTokenKind##kind)
+
+/// Kinds that only start at the start of a line
+#define WMFSourceEditorLineStartKinds (WMFSourceEditorKinds(VerticalTemplateStart) | WMFSourceEditorKinds(VerticalTemplateParameter) | WMFSourceEditorKinds(VerticalTemplateEnd) | WMFSourceEditorKinds(Heading) | WMFSourceEditorKinds(Subheading1) | WMFSourceEditorKinds(Subheading2) | WMFSourceEditorKinds(Subheading3) | WMFSourceEditorKinds(Subheading4) | WMFSourceEditorKinds(BulletSingle) | WMFSourceEditorKinds(BulletMultiple) | WMFSourceEditorKinds(NumberSingle) | WMFSourceEditorKinds(NumberMultiple))
+
+/// Line start kinds that can start with any character
+#define WMFSourceEditorAnyCharacterKinds (WMFSourceEditorKinds(VerticalTemplateStart) | WMFSourceEditorKinds(VerticalTemplateEnd))
+
+#define WMFSourceEditorHeadingKinds (WMFSourceEditorKinds(Heading) | WMFSourceEditorKinds(Subheading1) | WMFSourceEditorKinds(Subheading2) | WMFSourceEditorKinds(Subheading3) | WMFSourceEditorKinds(Subheading4))
+
+#define WMFSourceEditorTagKinds (WMFSourceEditorKinds(ReferenceHorizontal) | WMFSourceEditorKinds(ReferenceEmpty) | WMFSourceEditorKinds(ReferenceOpen) | WMFSourceEditorKinds(ReferenceClose) | WMFSourceEditorKinds(Strikethrough) | WMFSourceEditorKinds(Subscript) | WMFSourceEditorKinds(Superscript) | WMFSourceEditorKinds(Underline) | WMFSourceEditorKinds(Comment))
+
+/// The kinds that can start with each ASCII character, in addition to @c WMFSourceEditorAnyCharacterKinds at the start of a line
+static const WMFSourceEditorTokenKindSet WMFSourceEditorKindsByCharacter[128] = {
+    ['\t'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['\n'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['\v'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['\f'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['\r'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    [' '] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['|'] = WMFSourceEditorKinds(VerticalTemplateParameter),
+    ['\''] = WMFSourceEditorKinds(BoldItalics) | WMFSourceEditorKinds(Bold) | WMFSourceEditorKinds(Italics),
+    ['['] = WMFSourceEditorKinds(SimpleLink) | WMFSourceEditorKinds(LinkWithNestedLink),
+    ['{'] = WMFSourceEditorKinds(HorizontalTemplate),
+    ['='] = WMFSourceEditorHeadingKinds,
+    ['*'] = WMFSourceEditorKinds(BulletSingle) | WMFSourceEditorKinds(BulletMultiple),
+    ['#'] = WMFSourceEditorKinds(NumberSingle) | WMFSourceEditorKinds(NumberMultiple),
+    ['<'] = WMFSourceEditorTagKinds,
+};
+
+void WMFSourceEditorLex(const uint16_t *characters, size_t length, size_t location, size_t rangeLength, WMFSourceEditorLexerState state, WMFSourceEditorTokenKindSet kinds, WMFSourceEditorTokenList *list) {
+    list->count = 0;
+    WMFSourceEditorLexer lexer = {
+        .characters = characters,
+        .length = length,
+        .start = location,
+        .end = location + rangeLength,
+        .tokens = list,
+        .linkBrackets = NULL,
+        .linkBracketCount = 0,
+        .linkBracketCapacity = 0,
+        .linkBracketsStart = 0,
+        .linkBracketsEnd = 0,
+        .openLinks = NULL,
+        .openLinksCapacity = 0};
+    for (size_t kind = 0; kind < WMFSourceEditorTokenKindCount; kind++) {
+        lexer.missingClosings[kind] = (WMFSourceEditorMissingClosing){SIZE_MAX, 0};
+    }
+
+    // Where each kind looks for its next match, which is the end of its last one
+    size_t resumeLocations[WMFSourceEditorTokenKindCount];
+    for (size_t kind = 0; kind < WMFSourceEditorTokenKindCount; kind++) {
+        resumeLocations[kind] = location;
+    }
+
+    // A comment that opened before the range continues into it
+    if (state.isInComment && (kinds & WMFSourceEditorKinds(Comment)) && rangeLength > 0) {
+        resumeLocations[WMFSourceEditorTokenKindComment] = WMFSourceEditorAppendComment(&lexer, location, 0);
+    }
+
+    for (size_t i = lexer.start; i < lexer.end; i++) {
+        uint16_t c = characters[i];
+        WMFSourceEditorTokenKindSet candidates;
+        if (c < 128) {
+            candidates = WMFSourceEditorKindsByCharacter[c];
+        } else {
+            candidates = WMFSourceEditorIsWhitespace(c) ? WMFSourceEditorKinds(VerticalTemplateParameter) : 0;
+        }
+
+        // Line start rules are tried after each line terminator, except between the \r and \n of a \r\n
+        bool isLineStart = i == lexer.start || (WMFSourceEditorIsLineTerminator(characters[i - 1]) && !(characters[i - 1] == '\r' && c == '\n'));
+        if (isLineStart) {
+            candidates |= WMFSourceEditorAnyCharacterKinds;
+        } else {
+            candidates &= ~WMFSourceEditorLineStartKinds;
+        }
+
+        candidates &= kinds;
+        while (candidates != 0) {
+            WMFSourceEditorTokenKind kind = (WMFSourceEditorTokenKind)__builtin_ctz(candidates);
+            candidates &= candidates - 1;
+            if (resumeLocations[kind] > i) {
+                continue;
+            }
+            const WMFSourceEditorRule *rule = &WMFSourceEditorRules[kind];
+            size_t end = rule->match(&lexer, rule, i);
+            if (end != 0) {
+                resumeLocations[kind] = end;
+            }
+        }
+    }
+
+    free(lexer.linkBrackets);
+    free(lexer.openLinks);
+    WMFSourceEditorTokenListSortByKind(list);
+}
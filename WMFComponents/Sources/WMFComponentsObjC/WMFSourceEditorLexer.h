@@ -0,0 +1,209 @@
+#ifndef WMFSourceEditorLexer_h
+#define WMFSourceEditorLexer_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The wikitext constructs the source editor highlights. Each kind is the role of a token and replaces one regular
+ * expression that a formatter used to run, so a formatter highlights the tokens of its kinds the same way it used to
+ * highlight that expression's matches.
+ */
+typedef enum {
+    /// @c '''''text'''''
+    WMFSourceEditorTokenKindBoldItalics,
+    /// @c '''text'''
+    WMFSourceEditorTokenKindBold,
+    /// @c ''text'' with exactly two apostrophes on each side
+    WMFSourceEditorTokenKindItalics,
+    /// @c [[Page]] or @c [[Page|text]]
+    WMFSourceEditorTokenKindSimpleLink,
+    /// @c [[File:A.jpg|thumb|[[Page]]]], one token for each outermost link that contains other links
+    WMFSourceEditorTokenKindLinkWithNestedLink,
+    /// @c {{Template|a}} on one line, with at most one level of nested templates
+    WMFSourceEditorTokenKindHorizontalTemplate,
+    /// The last unclosed @c {{Template on a line. The token covers the template, not the start of the line.
+    WMFSourceEditorTokenKindVerticalTemplateStart,
+    /// A line starting with @c | after optional white space
+    WMFSourceEditorTokenKindVerticalTemplateParameter,
+    /// The start of a line up to the first @c }}. The token doesn't include the rest of the line.
+    WMFSourceEditorTokenKindVerticalTemplateEnd,
+    /// @c ==Heading==
+    WMFSourceEditorTokenKindHeading,
+    /// @c ===Subheading===
+    WMFSourceEditorTokenKindSubheading1,
+    /// @c ====Subheading====
+    WMFSourceEditorTokenKindSubheading2,
+    /// @c =====Subheading=====
+    WMFSourceEditorTokenKindSubheading3,
+    /// @c ======Subheading======
+    WMFSourceEditorTokenKindSubheading4,
+    /// A line starting with @c *. The opening is the first @c * only.
+    WMFSourceEditorTokenKindBulletSingle,
+    /// A line starting with @c ** or more. The opening is every leading @c *.
+    WMFSourceEditorTokenKindBulletMultiple,
+    /// A line starting with @c #. The opening is the first @c # only.
+    WMFSourceEditorTokenKindNumberSingle,
+    /// A line starting with @c ## or more. The opening is every leading @c #.
+    WMFSourceEditorTokenKindNumberMultiple,
+    /// @c <ref>text</ref> or @c <ref name="a">text</ref> on one line
+    WMFSourceEditorTokenKindReferenceHorizontal,
+    /// @c <ref name="a" />
+    WMFSourceEditorTokenKindReferenceEmpty,
+    /// Any @c <ref> or @c <ref name="a">, matched or not
+    WMFSourceEditorTokenKindReferenceOpen,
+    /// Any @c </ref>, matched or not
+    WMFSourceEditorTokenKindReferenceClose,
+    /// @c <s>text</s>. Leading white space in the content can span lines.
+    WMFSourceEditorTokenKindStrikethrough,
+    /// @c <sub>text</sub>
+    WMFSourceEditorTokenKindSubscript,
+    /// @c <sup>text</sup>
+    WMFSourceEditorTokenKindSuperscript,
+    /// @c <u>text</u>
+    WMFSourceEditorTokenKindUnderline,
+    /// @c <!--text-->, which can span lines. A comment that isn't closed by the end of the range runs to its end.
+    WMFSourceEditorTokenKindComment,
+    WMFSourceEditorTokenKindCount
+} WMFSourceEditorTokenKind;
+
+/// A set of token kinds, one bit per kind.
+typedef uint32_t WMFSourceEditorTokenKindSet;
+
+static inline WMFSourceEditorTokenKindSet WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKind kind) {
+    return (WMFSourceEditorTokenKindSet)1 << kind;
+}
+
+/// Every token kind
+#define WMFSourceEditorTokenKindSetAll ((WMFSourceEditorTokenKindSet)((1ull << WMFSourceEditorTokenKindCount) - 1))
+
+/**
+ * A highlighted construct, with its markup at either end. The content is whatever is between the opening and the
+ * closing. Either can be empty, for example list items have no closing markup.
+ */
+typedef struct {
+    WMFSourceEditorTokenKind kind;
+    size_t location;
+    size_t length;
+    size_t openingLength;
+    size_t closingLength;
+} WMFSourceEditorToken;
+
+/**
+ * The tokens found by @c WMFSourceEditorLex, grouped by kind. Tokens of one kind are in the order they were found,
+ * which is the order of their locations except for links with nested links, which are in the order they close.
+ */
+typedef struct {
+    WMFSourceEditorToken *tokens;
+    size_t count;
+    size_t capacity;
+    /// The index of the first token of each kind in @c tokens, and the count at the end
+    size_t kindStarts[WMFSourceEditorTokenKindCount + 1];
+} WMFSourceEditorTokenList;
+
+/**
+ * What the lexer carries from one line to the next. Every other construct starts and ends on one line, so lexing any
+ * range that starts at the start of a line only depends on whether it starts inside a comment. The zero value is the
+ * state at the start of a document.
+ */
+typedef struct {
+    bool isInComment;
+} WMFSourceEditorLexerState;
+
+extern bool WMFSourceEditorLexerStateEqualToState(WMFSourceEditorLexerState state, WMFSourceEditorLexerState otherState);
+
+/**
+ * @return The state after @c characters, when it was @c state before them.
+ */
+extern WMFSourceEditorLexerState WMFSourceEditorLexerStateAfterCharacters(const uint16_t *characters, size_t length, WMFSourceEditorLexerState state);
+
+/**
+ * Advances two states over @c characters one line at a time until they're equal, which they'll stay for the rest of
+ * them. Used after an edit to find how far it changed what follows it.
+ *
+ * @return The location of the first line start where the states are equal, or @c length if they never are.
+ */
+extern size_t WMFSourceEditorLexerStatesConverge(const uint16_t *characters, size_t length, WMFSourceEditorLexerState *state, WMFSourceEditorLexerState *otherState);
+
+/// The lexer state at the start of a line
+typedef struct {
+    size_t location;
+    WMFSourceEditorLexerState state;
+} WMFSourceEditorCheckpoint;
+
+/**
+ * Lexer states saved at line starts in a document, sorted by location, so the state anywhere in it can be found by
+ * scanning from the nearest checkpoint before it instead of from the start. There's always one at @c 0.
+ */
+typedef struct {
+    WMFSourceEditorCheckpoint *checkpoints;
+    size_t count;
+    size_t capacity;
+} WMFSourceEditorCheckpointList;
+
+/// How many characters apart to save checkpoints
+#define WMFSourceEditorCheckpointInterval 2048
+
+extern void WMFSourceEditorCheckpointListInit(WMFSourceEditorCheckpointList *list);
+extern void WMFSourceEditorCheckpointListFree(WMFSourceEditorCheckpointList *list);
+
+/**
+ * @return The index of the first checkpoint after @c location, or the count if there isn't one.
+ */
+extern size_t WMFSourceEditorCheckpointIndexAfterLocation(const WMFSourceEditorCheckpointList *list, size_t location);
+
+/**
+ * @return The last checkpoint at or before @c location.
+ */
+extern WMFSourceEditorCheckpoint WMFSourceEditorCheckpointBeforeLocation(const WMFSourceEditorCheckpointList *list, size_t location);
+
+/**
+ * Saves @c state at @c location, replacing the checkpoint there if there is one.
+ */
+extern void WMFSourceEditorCheckpointListInsert(WMFSourceEditorCheckpointList *list, size_t location, WMFSourceEditorLexerState state);
+
+/**
+ * Removes the checkpoints after @c location and before @c end.
+ */
+extern void WMFSourceEditorCheckpointListRemove(WMFSourceEditorCheckpointList *list, size_t location, size_t end);
+
+/**
+ * Updates the checkpoints for @c replacedLength characters at @c location being replaced with @c replacementLength
+ * characters. Checkpoints in or right after the replaced characters are removed and the ones after them are moved. Their
+ * states are kept, so the caller removes any that the edit changed.
+ */
+extern void WMFSourceEditorCheckpointListReplaceCharacters(WMFSourceEditorCheckpointList *list, size_t location, size_t replacedLength, size_t replacementLength);
+
+extern void WMFSourceEditorTokenListInit(WMFSourceEditorTokenList *list);
+extern void WMFSourceEditorTokenListFree(WMFSourceEditorTokenList *list);
+
+/**
+ * @return The tokens of @c kind, with their count in @c count.
+ */
+extern const WMFSourceEditorToken *WMFSourceEditorTokensOfKind(const WMFSourceEditorTokenList *list, WMFSourceEditorTokenKind kind, size_t *count);
+
+/**
+ * Finds every token of @c kinds in the range of @c characters starting at @c location, in one pass over it, and
+ * replaces the contents of @c list with them.
+ *
+ * Matches exactly what the formatters' regular expressions matched when enumerated over the same range, including
+ * their line rules: the ends of the range are the start and end of a line. Two things look outside of the range like
+ * they did before. Italics check that the character before the range isn't an apostrophe, and links with nested
+ * links are followed to the end of their line. So pass the character before @c location when there is one, and
+ * characters up to the end of the last line, which may be read up to @c length.
+ *
+ * Comments are the one difference: they're matched across lines, and @c state says whether the range starts inside
+ * one, so a range can be lexed the same way as the whole document when @c location is the start of a line.
+ */
+extern void WMFSourceEditorLex(const uint16_t *characters, size_t length, size_t location, size_t rangeLength, WMFSourceEditorLexerState state, WMFSourceEditorTokenKindSet kinds, WMFSourceEditorTokenList *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,19 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@class WMFSourceEditorFormatter;
+
+/// Whether lines of a document start inside a comment, saved every few thousand characters so the state anywhere in it can be found without lexing from the start.
+@interface WMFSourceEditorLexerCheckpoints : NSObject
+
+/// Highlights a TextKit 2 paragraph, which is at @c documentRange in @c fullAttributedString, with each of @c formatters in order. It's lexed from the state at its start, so a comment left open in an earlier paragraph carries over into it. That state is saved too, for -rangeToHighlightAgainInFullAttributedString:afterEditingRange:changeInLength:.
+- (void)addSyntaxHighlightingToParagraphAttributedString:(NSMutableAttributedString *)attributedString documentRange:(NSRange)documentRange fullAttributedString:(NSAttributedString *)fullAttributedString formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters;
+
+/// Updates the checkpoints after the text changed. Call after every character edit.
+/// @return The paragraphs after the edit that were highlighted from a state the edit changed, for example because it opened or closed a comment, or a range with location @c NSNotFound if there are none.
+- (NSRange)rangeToHighlightAgainInFullAttributedString:(NSAttributedString *)fullAttributedString afterEditingRange:(NSRange)editedRange changeInLength:(NSInteger)delta;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,95 @@
+#import "WMFSourceEditorLexerCheckpoints_Private.h"
+#import "WMFSourceEditorFormatter_Private.h"
+
+@implementation WMFSourceEditorLexerCheckpoints {
+    WMFSourceEditorCheckpointList _checkpoints;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        WMFSourceEditorCheckpointListInit(&_checkpoints);
+    }
+    return self;
+}
+
+- (void)dealloc {
+    WMFSourceEditorCheckpointListFree(&_checkpoints);
+}
+
+- (WMFSourceEditorCheckpointList *)checkpointList {
+    return &_checkpoints;
+}
+
+// MARK: - Public
+
+- (void)addSyntaxHighlightingToParagraphAttributedString:(NSMutableAttributedString *)attributedString documentRange:(NSRange)documentRange fullAttributedString:(NSAttributedString *)fullAttributedString formatters:(NSArray<WMFSourceEditorFormatter *> *)formatters {
+    WMFSourceEditorLexerState lexerState = [self lexerStateAtLocation:documentRange.location inString:fullAttributedString.string];
+
+    // Saved even when it's close to another checkpoint, so an edit before this paragraph can tell whether it was highlighted from the wrong state
+    WMFSourceEditorCheckpointListInsert(&_checkpoints, documentRange.location, lexerState);
+
+    [WMFSourceEditorFormatter addSyntaxHighlightingToAttributedString:attributedString inRange:NSMakeRange(0, attributedString.length) formatters:formatters lexerState:lexerState];
+}
+
+- (NSRange)rangeToHighlightAgainInFullAttributedString:(NSAttributedString *)fullAttributedString afterEditingRange:(NSRange)editedRange changeInLength:(NSInteger)delta {
+    NSString *string = fullAttributedString.string;
+    NSUInteger replacedLength = (NSUInteger)((NSInteger)editedRange.length - delta);
+    WMFSourceEditorCheckpointListReplaceCharacters(&_checkpoints, editedRange.location, replacedLength, editedRange.length);
+
+    NSUInteger lineEnd = NSMaxRange([string lineRangeForRange:NSMakeRange(NSMaxRange(editedRange), 0)]);
+    WMFSourceEditorCheckpointListRemove(&_checkpoints, editedRange.location, lineEnd);
+
+    // The checkpoints from the end of the edited lines on still have their states from before the edit, which their paragraphs were highlighted from. Once one of them agrees with the text as it is now, so do the rest.
+    WMFSourceEditorCheckpoint checkpoint = WMFSourceEditorCheckpointBeforeLocation(&_checkpoints, editedRange.location);
+    size_t firstIndex = lineEnd > 0 ? WMFSourceEditorCheckpointIndexAfterLocation(&_checkpoints, lineEnd - 1) : 0;
+    size_t index = firstIndex;
+    for (; index < _checkpoints.count; index++) {
+        WMFSourceEditorCheckpoint *oldCheckpoint = &_checkpoints.checkpoints[index];
+        checkpoint.state = [WMFSourceEditorLexerCheckpoints lexerStateAfterRange:NSMakeRange(checkpoint.location, oldCheckpoint->location - checkpoint.location) inString:string state:checkpoint.state];
+        checkpoint.location = oldCheckpoint->location;
+        if (WMFSourceEditorLexerStateEqualToState(checkpoint.state, oldCheckpoint->state)) {
+            break;
+        }
+        oldCheckpoint->state = checkpoint.state;
+    }
+
+    if (index == firstIndex) {
+        return NSMakeRange(NSNotFound, 0);
+    }
+    NSUInteger end = index < _checkpoints.count ? checkpoint.location : string.length;
+    return NSMakeRange(lineEnd, end - lineEnd);
+}
+
+// MARK: - Lexer States
+
+// Only comments carry over from one line to the next, so the state at a line start is found by scanning for comment markup from the nearest checkpoint before it. Checkpoints are saved along the way every WMFSourceEditorCheckpointInterval characters.
+
+- (WMFSourceEditorLexerState)lexerStateAtLocation:(NSUInteger)location inString:(NSString *)string {
+    WMFSourceEditorCheckpoint checkpoint = WMFSourceEditorCheckpointBeforeLocation(&_checkpoints, location);
+    while (location - checkpoint.location > WMFSourceEditorCheckpointInterval) {
+        NSUInteger lineEnd = NSMaxRange([string lineRangeForRange:NSMakeRange(checkpoint.location + WMFSourceEditorCheckpointInterval, 0)]);
+        if (lineEnd >= location) {
+            break;
+        }
+        checkpoint.state = [WMFSourceEditorLexerCheckpoints lexerStateAfterRange:NSMakeRange(checkpoint.location, lineEnd - checkpoint.location) inString:string state:checkpoint.state];
+        checkpoint.location = lineEnd;
+        WMFSourceEditorCheckpointListInsert(&_checkpoints, checkpoint.location, checkpoint.state);
+    }
+    return [WMFSourceEditorLexerCheckpoints lexerStateAfterRange:NSMakeRange(checkpoint.location, location - checkpoint.location) inString:string state:checkpoint.state];
+}
+
++ (WMFSourceEditorLexerState)lexerStateAfterRange:(NSRange)range inString:(NSString *)string state:(WMFSourceEditorLexerState)state {
+    if (range.length == 0) {
+        return state;
+    }
+    unichar *characters = malloc(range.length * sizeof(unichar));
+    if (!characters) {
+        return state;
+    }
+    [string getCharacters:characters range:range];
+    state = WMFSourceEditorLexerStateAfterCharacters(characters, range.length, state);
+    free(characters);
+    return state;
+}
+
+@end
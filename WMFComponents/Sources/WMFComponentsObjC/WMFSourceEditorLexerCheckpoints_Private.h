@@ -0,0 +1,19 @@
+#import "WMFSourceEditorLexerCheckpoints.h"
+#import "WMFSourceEditorLexer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface WMFSourceEditorLexerCheckpoints ()
+
+/// The saved states, for callers that move and remove them after an edit themselves
+@property (nonatomic, readonly) WMFSourceEditorCheckpointList *checkpointList;
+
+/// @return The state at @c location, which is the start of a line in @c string. Saves checkpoints on the way there.
+- (WMFSourceEditorLexerState)lexerStateAtLocation:(NSUInteger)location inString:(NSString *)string;
+
+/// @return The state after @c range of @c string, when it was @c state before it.
++ (WMFSourceEditorLexerState)lexerStateAfterRange:(NSRange)range inString:(NSString *)string state:(WMFSourceEditorLexerState)state;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,21 @@
+#import <Foundation/Foundation.h>
+#import "WMFSourceEditorLexer.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A copy of the characters the lexer reads for a range of a string, so the range can be lexed on any thread while the string keeps changing.
+@interface WMFSourceEditorLexingSnapshot : NSObject
+
+@property (nonatomic, assign, readonly) NSRange range;
+
+/// The tokens found by -lex, at their locations in the string the snapshot was taken of
+@property (nonatomic, readonly) const WMFSourceEditorTokenList *tokens;
+
+- (instancetype)initWithString:(NSString *)string range:(NSRange)range lexerState:(WMFSourceEditorLexerState)lexerState kinds:(WMFSourceEditorTokenKindSet)kinds;
+- (instancetype)init NS_UNAVAILABLE;
+
+- (void)lex;
+
+@end
+
+NS_ASSUME_NONNULL_END
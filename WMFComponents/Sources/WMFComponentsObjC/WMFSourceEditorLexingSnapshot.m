@@ -0,0 +1,57 @@
+#import "WMFSourceEditorLexingSnapshot.h"
+
+@implementation WMFSourceEditorLexingSnapshot {
+    unichar *_characters;
+    NSRange _charactersRange;
+    WMFSourceEditorLexerState _lexerState;
+    WMFSourceEditorTokenKindSet _kinds;
+    WMFSourceEditorTokenList _tokens;
+}
+
+- (instancetype)initWithString:(NSString *)string range:(NSRange)range lexerState:(WMFSourceEditorLexerState)lexerState kinds:(WMFSourceEditorTokenKindSet)kinds {
+    if (self = [super init]) {
+        _range = range;
+        _lexerState = lexerState;
+        _kinds = kinds;
+        WMFSourceEditorTokenListInit(&_tokens);
+        
+        // The lexer also reads the character before the range, and links with nested links to the end of their line
+        NSUInteger start = range.location > 0 ? range.location - 1 : 0;
+        NSUInteger end = NSMaxRange(range);
+        NSUInteger searchLocation = range.length > 0 ? end - 1 : end;
+        NSRange newlineRange = [string rangeOfString:@"\n" options:NSLiteralSearch range:NSMakeRange(searchLocation, string.length - searchLocation)];
+        end = newlineRange.location != NSNotFound ? NSMaxRange(newlineRange) : string.length;
+        
+        _charactersRange = NSMakeRange(start, end - start);
+        _characters = malloc(_charactersRange.length * sizeof(unichar));
+        if (_characters) {
+            [string getCharacters:_characters range:_charactersRange];
+        }
+    }
+    return self;
+}
+
+- (void)dealloc {
+    free(_characters);
+    WMFSourceEditorTokenListFree(&_tokens);
+}
+
+- (const WMFSourceEditorTokenList *)tokens {
+    return &_tokens;
+}
+
+- (void)lex {
+    if (!_characters) {
+        return;
+    }
+    
+    WMFSourceEditorLex(_characters, _charactersRange.length, _range.location - _charactersRange.location, _range.length, _lexerState, _kinds, &_tokens);
+    for (size_t i = 0; i < _tokens.count; i++) {
+        _tokens.tokens[i].location += _charactersRange.location;
+    }
+    
+    free(_characters);
+    _characters = NULL;
+}
+
+@end
@@ -5,11 +5,21 @@ NS_ASSUME_NONNULL_BEGIN
 @class WMFSourceEditorColors, WMFSourceEditorFonts, WMFSourceEditorFormatter;
 @protocol WMFSourceEditorStorageDelegate;
 
+/// Runs @c lex off the main thread, then @c apply on the main thread.
+typedef void (^WMFSourceEditorHighlightingScheduler)(dispatch_block_t lex, dispatch_block_t apply);
+
 @interface WMFSourceEditorTextStorage : NSTextStorage
 
 @property (nonatomic, weak) id<WMFSourceEditorStorageDelegate> storageDelegate;
 @property (nonatomic, assign) BOOL syntaxHighlightProcessingEnabled;
 
+/// Schedules highlighting for the lines of an edit past the first few thousand characters, like most of a newly loaded article or the lines after an opened comment, and slices of -updateColorsAndFonts. Results from before a later edit are thrown away and the lines are lexed again. Defaults to a serial background queue.
+@property (nonatomic, copy) WMFSourceEditorHighlightingScheduler highlightingScheduler;
+
+/// The characters on screen. Highlighting and updating colors and fonts start around them, and catch up right away when text that hasn't been done yet scrolls into view.
+@property (nonatomic, assign) NSRange visibleRange;
+
+/// Updates the text around the visible range right away and the rest in slices.
 - (void)updateColorsAndFonts;
 
 @end
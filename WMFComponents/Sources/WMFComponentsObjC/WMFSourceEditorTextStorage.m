@@ -1,19 +1,75 @@
 #import "WMFSourceEditorTextStorage.h"
 #import "WMFSourceEditorFormatterBase.h"
+#import "WMFSourceEditorFormatter_Private.h"
+#import "WMFSourceEditorLexingSnapshot.h"
+#import "WMFSourceEditorLexerCheckpoints_Private.h"
 #import "WMFSourceEditorStorageDelegate.h"
 
+// How much of an edit's lines are highlighted in -processEditing. The rest are lexed in the background this many characters at a time.
+static const NSUInteger WMFSourceEditorSynchronousHighlightingLength = 8192;
+static const NSUInteger WMFSourceEditorBackgroundHighlightingLength = 16384;
+// How far around the visible range to highlight and restyle right away, so short scrolls don't reach unhighlighted text
+static const NSUInteger WMFSourceEditorVisibleRangeMargin = 4096;
+// How many characters to update colors and fonts in at a time, and for how long a slice of that can run on the main thread
+static const NSUInteger WMFSourceEditorRestylingLength = 4096;
+static const CFTimeInterval WMFSourceEditorRestylingSliceDuration = 0.004;
+
 @interface WMFSourceEditorTextStorage ()
 
 @property (nonatomic, strong) NSMutableAttributedString *backingStore;
+@property (nonatomic, strong) WMFSourceEditorLexerCheckpoints *lexerCheckpoints;
+
+// Lines after the edited ones that need highlighting again because an edit opened or closed a comment, or NSNotFound
+@property (nonatomic, assign) NSRange damagedRange;
+
+// Counts character edits, so background highlighting can tell whether the text changed since its snapshot was taken
+@property (nonatomic, assign) NSUInteger generation;
+// Characters waiting to be highlighted in the background
+@property (nonatomic, strong) NSMutableIndexSet *unhighlightedIndexes;
+@property (nonatomic, assign) BOOL isHighlightingScheduled;
+// Characters still in the colors and fonts from before the last -updateColorsAndFonts
+@property (nonatomic, strong) NSMutableIndexSet *unstyledIndexes;
+@property (nonatomic, assign) BOOL isRestylingScheduled;
 
 @end
 
+/// @return @c range moved to where it is after replacing @c replacedRange with @c replacementLength characters, growing to cover the replacement if it overlaps it.
+static NSRange WMFSourceEditorRangeAfterReplacingCharacters(NSRange range, NSRange replacedRange, NSUInteger replacementLength) {
+    NSUInteger start = range.location;
+    NSUInteger end = NSMaxRange(range);
+    if (start > replacedRange.location) {
+        start = start >= NSMaxRange(replacedRange) ? start - replacedRange.length + replacementLength : replacedRange.location;
+    }
+    if (end > replacedRange.location) {
+        end = end >= NSMaxRange(replacedRange) ? end - replacedRange.length + replacementLength : replacedRange.location + replacementLength;
+    }
+    return NSMakeRange(start, end - start);
+}
+
+/// Moves @c indexes to where they are after replacing @c replacedRange with @c replacementLength characters, dropping the replaced ones.
+static void WMFSourceEditorIndexesReplaceCharacters(NSMutableIndexSet *indexes, NSRange replacedRange, NSUInteger replacementLength) {
+    [indexes removeIndexesInRange:replacedRange];
+    [indexes shiftIndexesStartingAtIndex:NSMaxRange(replacedRange) by:(NSInteger)replacementLength - (NSInteger)replacedRange.length];
+}
+
 @implementation WMFSourceEditorTextStorage
 
 - (nonnull instancetype)init {
     if (self = [super init]) {
         _backingStore = [[NSMutableAttributedString alloc] init];
         _syntaxHighlightProcessingEnabled = YES;
+        _damagedRange = NSMakeRange(NSNotFound, 0);
+        _unhighlightedIndexes = [[NSMutableIndexSet alloc] init];
+        _unstyledIndexes = [[NSMutableIndexSet alloc] init];
+        _lexerCheckpoints = [[WMFSourceEditorLexerCheckpoints alloc] init];
+        
+        dispatch_queue_t queue = dispatch_queue_create("org.wikimedia.wikipedia.sourceeditor.highlighting", DISPATCH_QUEUE_SERIAL);
+        _highlightingScheduler = ^(dispatch_block_t lex, dispatch_block_t apply) {
+            dispatch_async(queue, ^{
+                lex();
+                dispatch_async(dispatch_get_main_queue(), apply);
+            });
+        };
     }
     return self;
 }
@@ -30,8 +86,18 @@
 
 - (void)replaceCharactersInRange:(NSRange)range withString:(NSString *)str {
     [self beginEditing];
+    
+    // Compared with the state there after the edit to find out whether it changed the lines after it
+    NSUInteger lineEnd = NSMaxRange([self.backingStore.string lineRangeForRange:NSMakeRange(NSMaxRange(range), 0)]);
+    WMFSourceEditorLexerState lineEndState = [self lexerStateAtLocation:lineEnd];
+    
     [self.backingStore replaceCharactersInRange:range withString:str];
     [self edited:NSTextStorageEditedCharacters range:range changeInLength:str.length - range.length];
+    [self updateLexerStatesAfterReplacingCharactersInRange:range replacementLength:str.length oldLineEnd:lineEnd oldLineEndState:lineEndState];
+    
+    self.generation++;
+    WMFSourceEditorIndexesReplaceCharacters(self.unhighlightedIndexes, range, str.length);
+    WMFSourceEditorIndexesReplaceCharacters(self.unstyledIndexes, range, str.length);
     [self endEditing];
 }
 
@@ -47,39 +113,289 @@
     if (self.syntaxHighlightProcessingEnabled) {
         [self addSyntaxHighlightingToEditedRange:self.editedRange];
     }
+    self.damagedRange = NSMakeRange(NSNotFound, 0);
     
     [super processEditing];
 }
 
 // MARK: - Public
 
-- (void)updateColorsAndFonts {
-    WMFSourceEditorColors *colors = [self.storageDelegate colors];
-    WMFSourceEditorFonts *fonts = [self.storageDelegate fonts];
+- (void)setVisibleRange:(NSRange)visibleRange {
+    _visibleRange = visibleRange;
     
-    [self beginEditing];
-    NSRange allRange = NSMakeRange(0, self.backingStore.length);
-    for (WMFSourceEditorFormatter *formatter in [self.storageDelegate formatters]) {
-        [formatter updateColors:colors inAttributedString:self inRange:allRange];
-        [formatter updateFonts:fonts inAttributedString:self inRange:allRange];
+    // Text scrolling into view is caught up before it's drawn
+    NSRange range = [self visibleRangeWithMargin];
+    if (![self.unhighlightedIndexes intersectsIndexesInRange:range] && ![self.unstyledIndexes intersectsIndexesInRange:range]) {
+        return;
     }
+    [self performAttributeEdits:^{
+        [self highlightUnhighlightedLinesInRange:range];
+        [self updateColorsAndFontsOfUnstyledLinesInRange:range];
+    }];
+}
+
+- (void)updateColorsAndFonts {
     
+    // Only the text around the visible range is updated right away. The rest is updated a slice at a time, or when it scrolls into view.
+    [self.unstyledIndexes addIndexesInRange:NSMakeRange(0, self.backingStore.length)];
+    [self beginEditing];
+    [self updateColorsAndFontsOfUnstyledLinesInRange:[self visibleRangeWithMargin]];
     [self endEditing];
+    [self scheduleRestylingIfNeeded];
 }
 
 // MARK: - Private
 
 - (void)addSyntaxHighlightingToEditedRange:(NSRange)editedRange {
     
+    // Also reevaluate the lines after an edit that opened or closed a comment
+    if (self.damagedRange.location != NSNotFound) {
+        editedRange = NSUnionRange(editedRange, self.damagedRange);
+    }
+    
     // Extend range to entire line for reevaluation, not just what was edited
     NSRange extendedRange = NSUnionRange(editedRange, [self.backingStore.string lineRangeForRange:NSMakeRange(editedRange.location, 0)]);
-    extendedRange = NSUnionRange(editedRange, [self.backingStore.string lineRangeForRange:NSMakeRange(NSMaxRange(editedRange), 0)]);
+    extendedRange = NSUnionRange(extendedRange, [self.backingStore.string lineRangeForRange:NSMakeRange(NSMaxRange(editedRange), 0)]);
+    
+    // Highlight the first lines now, which include the edit, and leave the rest to the background
+    if (extendedRange.length > WMFSourceEditorSynchronousHighlightingLength) {
+        NSUInteger synchronousEnd = NSMaxRange([self.backingStore.string lineRangeForRange:NSMakeRange(extendedRange.location + WMFSourceEditorSynchronousHighlightingLength, 0)]);
+        if (synchronousEnd < NSMaxRange(extendedRange)) {
+            NSRange backgroundRange = NSMakeRange(synchronousEnd, NSMaxRange(extendedRange) - synchronousEnd);
+            [self.unhighlightedIndexes addIndexesInRange:backgroundRange];
+            extendedRange = NSMakeRange(extendedRange.location, synchronousEnd - extendedRange.location);
+        }
+    }
+    
     [self addSyntaxHighlightingToExtendedRange:extendedRange];
+    [self highlightUnhighlightedLinesInRange:[self visibleRangeWithMargin]];
+    [self scheduleHighlightingIfNeeded];
 }
 
 - (void)addSyntaxHighlightingToExtendedRange:(NSRange)extendedRange {
-    for (WMFSourceEditorFormatter *formatter in [self.storageDelegate formatters]) {
-        [formatter addSyntaxHighlightingToAttributedString:self inRange:extendedRange];
+    WMFSourceEditorLexerState lexerState = [self lexerStateAtLocation:extendedRange.location];
+    NSArray<WMFSourceEditorFormatter *> *formatters = [self.storageDelegate formatters];
+    [self highlightRange:extendedRange usingBlock:^(NSMutableAttributedString *attributedString) {
+        [WMFSourceEditorFormatter addSyntaxHighlightingToAttributedString:attributedString inRange:extendedRange formatters:formatters lexerState:lexerState];
+    }];
+    
+    // Highlighting uses the formatters' current colors and fonts too
+    [self.unhighlightedIndexes removeIndexesInRange:extendedRange];
+    [self.unstyledIndexes removeIndexesInRange:extendedRange];
+}
+
+// MARK: - Pending Work
+
+// Highlighting past the first lines of a long edit, and updating colors and fonts, is left for later where it isn't visible. The characters still to do are kept in index sets, moved along by edits. What's around the visible range is done first.
+
+- (NSRange)visibleRangeWithMargin {
+    NSUInteger length = self.backingStore.length;
+    NSUInteger start = MIN(self.visibleRange.location > WMFSourceEditorVisibleRangeMargin ? self.visibleRange.location - WMFSourceEditorVisibleRangeMargin : 0, length);
+    NSUInteger end = MIN(NSMaxRange(self.visibleRange) + WMFSourceEditorVisibleRangeMargin, length);
+    return NSMakeRange(start, MAX(end, start) - start);
+}
+
+/// @return The first index of @c indexes at or after the start of the visible range, or else the first one.
+- (NSUInteger)nextIndexInIndexes:(NSMutableIndexSet *)indexes {
+    NSUInteger length = self.backingStore.length;
+    [indexes removeIndexesInRange:NSMakeRange(length, NSNotFound - length)];
+    NSUInteger index = [indexes indexGreaterThanOrEqualToIndex:self.visibleRange.location];
+    return index != NSNotFound ? index : indexes.firstIndex;
+}
+
+/// @return The lines containing the indexes of @c indexes in @c range, or a range with a length of @c 0 if there aren't any.
+- (NSRange)linesOfIndexes:(NSIndexSet *)indexes inRange:(NSRange)range {
+    if (range.length == 0 || ![indexes intersectsIndexesInRange:range]) {
+        return NSMakeRange(range.location, 0);
+    }
+    NSUInteger first = [indexes indexGreaterThanOrEqualToIndex:range.location];
+    NSUInteger last = [indexes indexLessThanIndex:NSMaxRange(range)];
+    return [self.backingStore.string lineRangeForRange:NSMakeRange(first, last + 1 - first)];
+}
+
+- (void)highlightUnhighlightedLinesInRange:(NSRange)range {
+    NSRange lines = [self linesOfIndexes:self.unhighlightedIndexes inRange:range];
+    if (lines.length > 0) {
+        [self addSyntaxHighlightingToExtendedRange:lines];
+    }
+}
+
+- (void)updateColorsAndFontsOfUnstyledLinesInRange:(NSRange)range {
+    NSRange lines = [self linesOfIndexes:self.unstyledIndexes inRange:range];
+    if (lines.length == 0) {
+        return;
+    }
+    
+    [WMFSourceEditorFormatter updateColors:[self.storageDelegate colors] fonts:[self.storageDelegate fonts] inAttributedString:self inRange:lines formatters:[self.storageDelegate formatters]];
+    [self.unstyledIndexes removeIndexesInRange:lines];
+}
+
+- (void)scheduleRestylingIfNeeded {
+    if (self.isRestylingScheduled || self.unstyledIndexes.count == 0) {
+        return;
+    }
+    
+    self.isRestylingScheduled = YES;
+    __weak typeof(self) weakSelf = self;
+    self.highlightingScheduler(^{
+    }, ^{
+        [weakSelf updateColorsAndFontsOfNextUnstyledLines];
+    });
+}
+
+- (void)updateColorsAndFontsOfNextUnstyledLines {
+    self.isRestylingScheduled = NO;
+    
+    CFTimeInterval start = CACurrentMediaTime();
+    [self performAttributeEdits:^{
+        NSUInteger location;
+        while ((location = [self nextIndexInIndexes:self.unstyledIndexes]) != NSNotFound && CACurrentMediaTime() - start < WMFSourceEditorRestylingSliceDuration) {
+            [self updateColorsAndFontsOfUnstyledLinesInRange:NSMakeRange(location, MIN(WMFSourceEditorRestylingLength, self.backingStore.length - location))];
+        }
+    }];
+    
+    [self scheduleRestylingIfNeeded];
+}
+
+/// Makes attribute changes outside of -processEditing, without highlighting them again in it.
+- (void)performAttributeEdits:(void (NS_NOESCAPE ^)(void))edits {
+    BOOL syntaxHighlightProcessingEnabled = self.syntaxHighlightProcessingEnabled;
+    self.syntaxHighlightProcessingEnabled = NO;
+    [self beginEditing];
+    edits();
+    [self endEditing];
+    self.syntaxHighlightProcessingEnabled = syntaxHighlightProcessingEnabled;
+}
+
+// MARK: - Attribute Changes
+
+// Formatters remove every attribute they own from the range they highlight and add them back to their matches, so most attributes end up the same as before. They run on the backing store, which nothing observes, and only the runs that came out different are reported as edited, so TextKit only lays those out again.
+
+- (void)highlightRange:(NSRange)range usingBlock:(void (NS_NOESCAPE ^)(NSMutableAttributedString *attributedString))block {
+    NSAttributedString *previousAttributedString = [self.backingStore attributedSubstringFromRange:range];
+    block(self.backingStore);
+    
+    [self beginEditing];
+    NSUInteger location = range.location;
+    NSUInteger end = NSMaxRange(range);
+    NSRange changedRange = NSMakeRange(NSNotFound, 0);
+    while (location < end) {
+        NSRange runRange;
+        NSRange previousRunRange;
+        NSDictionary<NSAttributedStringKey, id> *attributes = [self.backingStore attributesAtIndex:location effectiveRange:&runRange];
+        NSDictionary<NSAttributedStringKey, id> *previousAttributes = [previousAttributedString attributesAtIndex:location - range.location effectiveRange:&previousRunRange];
+        NSUInteger runEnd = MIN(MIN(NSMaxRange(runRange), range.location + NSMaxRange(previousRunRange)), end);
+        
+        if (![attributes isEqualToDictionary:previousAttributes]) {
+            NSRange differentRange = NSMakeRange(location, runEnd - location);
+            changedRange = changedRange.location != NSNotFound ? NSUnionRange(changedRange, differentRange) : differentRange;
+        } else if (changedRange.location != NSNotFound) {
+            [self edited:NSTextStorageEditedAttributes range:changedRange changeInLength:0];
+            changedRange = NSMakeRange(NSNotFound, 0);
+        }
+        location = runEnd;
+    }
+    
+    if (changedRange.location != NSNotFound) {
+        [self edited:NSTextStorageEditedAttributes range:changedRange changeInLength:0];
+    }
+    [self endEditing];
+}
+
+// MARK: - Background Highlighting
+
+- (void)scheduleHighlightingIfNeeded {
+    if (self.isHighlightingScheduled) {
+        return;
+    }
+    
+    NSUInteger location = [self nextIndexInIndexes:self.unhighlightedIndexes];
+    if (location == NSNotFound) {
+        return;
+    }
+    
+    NSArray<WMFSourceEditorFormatter *> *formatters = [self.storageDelegate formatters];
+    WMFSourceEditorTokenKindSet kinds = [WMFSourceEditorFormatter tokenKindsOfFormatters:formatters];
+    if (kinds == 0) {
+        [self.unhighlightedIndexes removeAllIndexes];
+        return;
+    }
+    
+    NSString *string = self.backingStore.string;
+    NSRange range = [string lineRangeForRange:NSMakeRange(location, MIN(WMFSourceEditorBackgroundHighlightingLength, string.length - location))];
+    WMFSourceEditorLexingSnapshot *snapshot = [[WMFSourceEditorLexingSnapshot alloc] initWithString:string range:range lexerState:[self lexerStateAtLocation:range.location] kinds:kinds];
+    NSUInteger generation = self.generation;
+    self.isHighlightingScheduled = YES;
+    
+    __weak typeof(self) weakSelf = self;
+    self.highlightingScheduler(^{
+        [snapshot lex];
+    }, ^{
+        [weakSelf applyHighlightingFromSnapshot:snapshot generation:generation];
+    });
+}
+
+- (void)applyHighlightingFromSnapshot:(WMFSourceEditorLexingSnapshot *)snapshot generation:(NSUInteger)generation {
+    self.isHighlightingScheduled = NO;
+    
+    // Tokens from before a later edit are out of date. The lines they were for are still unhighlighted, moved by the edit.
+    if (generation == self.generation) {
+        NSRange range = snapshot.range;
+        NSArray<WMFSourceEditorFormatter *> *formatters = [self.storageDelegate formatters];
+        [self performAttributeEdits:^{
+            [self highlightRange:range usingBlock:^(NSMutableAttributedString *attributedString) {
+                [WMFSourceEditorFormatter addSyntaxHighlightingToAttributedString:attributedString inRange:range formatters:formatters tokens:snapshot.tokens];
+            }];
+        }];
+        [self.unhighlightedIndexes removeIndexesInRange:range];
+        [self.unstyledIndexes removeIndexesInRange:range];
+    }
+    
+    [self scheduleHighlightingIfNeeded];
+}
+
+// MARK: - Lexer States
+
+- (WMFSourceEditorLexerState)lexerStateAtLocation:(NSUInteger)location {
+    return [self.lexerCheckpoints lexerStateAtLocation:location inString:self.backingStore.string];
+}
+
+- (void)updateLexerStatesAfterReplacingCharactersInRange:(NSRange)range replacementLength:(NSUInteger)replacementLength oldLineEnd:(NSUInteger)oldLineEnd oldLineEndState:(WMFSourceEditorLexerState)oldLineEndState {
+    
+    WMFSourceEditorCheckpointList *checkpoints = self.lexerCheckpoints.checkpointList;
+    WMFSourceEditorCheckpointListReplaceCharacters(checkpoints, range.location, range.length, replacementLength);
+    if (self.damagedRange.location != NSNotFound) {
+        self.damagedRange = WMFSourceEditorRangeAfterReplacingCharacters(self.damagedRange, range, replacementLength);
+    }
+    
+    NSString *string = self.backingStore.string;
+    NSUInteger length = string.length;
+    NSUInteger lineEnd = oldLineEnd - range.length + replacementLength;
+    WMFSourceEditorCheckpoint checkpoint = WMFSourceEditorCheckpointBeforeLocation(checkpoints, range.location);
+    WMFSourceEditorLexerState lineEndState = [WMFSourceEditorLexerCheckpoints lexerStateAfterRange:NSMakeRange(checkpoint.location, lineEnd - checkpoint.location) inString:string state:checkpoint.state];
+    
+    // The lines after the edit lex differently until the state is back to what it was before the edit
+    NSUInteger damageEnd = lineEnd;
+    while (!WMFSourceEditorLexerStateEqualToState(lineEndState, oldLineEndState) && damageEnd < length) {
+        NSUInteger chunkEnd = NSMaxRange([string lineRangeForRange:NSMakeRange(MIN(damageEnd + WMFSourceEditorCheckpointInterval, length), 0)]);
+        NSUInteger chunkLength = chunkEnd - damageEnd;
+        unichar *characters = malloc(chunkLength * sizeof(unichar));
+        if (!characters) {
+            damageEnd = length;
+            break;
+        }
+        [string getCharacters:characters range:NSMakeRange(damageEnd, chunkLength)];
+        damageEnd += WMFSourceEditorLexerStatesConverge(characters, chunkLength, &lineEndState, &oldLineEndState);
+        free(characters);
+    }
+    
+    // Checkpoints from the edit to where the states match again are out of date
+    BOOL didConverge = WMFSourceEditorLexerStateEqualToState(lineEndState, oldLineEndState);
+    WMFSourceEditorCheckpointListRemove(checkpoints, range.location, didConverge ? damageEnd : length + 1);
+    
+    if (damageEnd > lineEnd) {
+        NSRange damagedRange = NSMakeRange(lineEnd, damageEnd - lineEnd);
+        self.damagedRange = self.damagedRange.location != NSNotFound ? NSUnionRange(self.damagedRange, damagedRange) : damagedRange;
     }
 }
 
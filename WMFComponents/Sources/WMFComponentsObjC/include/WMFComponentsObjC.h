@@ -19,5 +19,6 @@
 #import "WMFSourceEditorFormatterLink.h"
 #import "WMFSourceEditorFormatterComment.h"
 #import "WMFSourceEditorStorageDelegate.h"
+#import "WMFSourceEditorLexerCheckpoints.h"
 
 #endif /* Header_h */
@@ -0,0 +1 @@
+../WMFSourceEditorLexerCheckpoints.h
\ No newline at end of file
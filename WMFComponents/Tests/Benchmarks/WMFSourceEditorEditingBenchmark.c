@@ -0,0 +1,783 @@
+// Per-edit latency benchmarks for a model of the source editor's highlighting built on WMFSourceEditorLexer, with JSON
+// output for tracking the lexer over time.
+//
+// Plain C with no Foundation, so it runs anywhere there's a C compiler, including Linux CI machines:
+//
+//     scripts/benchmark_source_editor_editing [--article file] [--session file] [--p99-limit microseconds]
+//
+// This times the lexer and the bookkeeping around it, not WMFSourceEditorTextStorage, its formatters or TextKit.
+// testTextStorageReplaysEditingSession and testTextStorageEditingSessionPerformance in WMFSourceEditorFormatterTests
+// replay the same checked-in article and session through the text storage itself. Here they're replayed with:
+//
+//     scripts/benchmark_source_editor_editing --article WMFComponents/Tests/Benchmarks/JuanDeSalmeron.wikitext
+//         --session WMFComponents/Tests/Benchmarks/JuanDeSalmeron.session
+//
+// Editing sessions are replayed against a model document that does what WMFSourceEditorTextStorage does for each edit:
+// -replaceCharactersInRange:withString: finds the lexer state at the end of the edited line, replaces the characters
+// and updates the lexer checkpoints and the lines the edit damaged, then -processEditing extends the edit to whole
+// lines, lexes up to WMFEditingSynchronousHighlightingLength characters of them and applies the tokens. Attributes
+// are one style word per character, with a bit for each token kind and another for its markup, and the runs that come
+// out different are counted like the text storage reports them to TextKit. Moving the characters and styles for an
+// edit isn't timed, and neither is what's left for the background, which is highlighted between edits.
+//
+// Without arguments, synthetic articles of three sizes get typing, deleting, pasting and comment sessions at their
+// start, middle and end. --article replays them on UTF-8 wikitext from a file instead. --session replays a session
+// from a file instead, one edit per line, with locations in UTF-16 code units and text after the one space that
+// follows the location:
+//
+//     insert <location> <text>    Text can have \n, \t, \r and \\ escapes
+//     paste <location> <text>
+//     delete <location> <length>
+//     undo                        Reverts the last edit that hasn't been undone
+//
+// Locations past the end of the document are moved to its end, and lines starting with # are ignored.
+//
+// Every session is checked every WMFEditingCheckInterval edits and at its end: the document's styles have to be the
+// styles of highlighting all of its text at once, so an edit that skips lines it changed can't report a time.
+// --p99-limit fails the run when any session's 99th percentile is longer, to catch lexer regressions.
+
+#include "WMFSourceEditorLexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/// The same limits as WMFSourceEditorTextStorage
+#define WMFEditingSynchronousHighlightingLength 8192
+
+/// How many edits apart to check the document's styles. The pasting and comment sessions repeat every 2 and 10 edits, so checks land at every point of their cycles.
+#define WMFEditingCheckInterval 7
+
+/// One bit for each token kind, and one above them for its markup
+#define WMFEditingMarkupStyleShift 32
+
+#pragma mark - Timing
+
+static double WMFEditingNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static int WMFEditingCompareDurations(const void *duration, const void *otherDuration) {
+    double difference = *(const double *)duration - *(const double *)otherDuration;
+    return difference < 0 ? -1 : difference > 0 ? 1 : 0;
+}
+
+/// @return The nearest-rank percentile of sorted @c durations.
+static double WMFEditingPercentile(const double *durations, size_t count, double percentile) {
+    if (count == 0) {
+        return 0;
+    }
+    size_t rank = (size_t)(percentile * (double)count + 0.999999);
+    return durations[rank > 0 ? rank - 1 : 0];
+}
+
+#pragma mark - Document
+
+/// Text with a style word for each character, which stands in for its attributes.
+typedef struct {
+    uint16_t *characters;
+    uint64_t *styles;
+    size_t length;
+    size_t capacity;
+    WMFSourceEditorCheckpointList checkpoints;
+    /// Lines after an edit that need highlighting again because it opened or closed a comment
+    bool isDamaged;
+    size_t damagedStart;
+    size_t damagedEnd;
+    WMFSourceEditorTokenList tokens;
+    uint64_t *highlightedStyles;
+    size_t highlightedCapacity;
+} WMFEditingDocument;
+
+/// What highlighting after edits touched
+typedef struct {
+    size_t highlightedCharacterCount;
+    size_t deferredCharacterCount;
+    size_t changedRunCount;
+    size_t changedCharacterCount;
+} WMFEditingStatistics;
+
+static void WMFEditingDocumentInit(WMFEditingDocument *document) {
+    memset(document, 0, sizeof(WMFEditingDocument));
+    WMFSourceEditorCheckpointListInit(&document->checkpoints);
+    WMFSourceEditorTokenListInit(&document->tokens);
+}
+
+static void WMFEditingDocumentFree(WMFEditingDocument *document) {
+    free(document->characters);
+    free(document->styles);
+    free(document->highlightedStyles);
+    WMFSourceEditorCheckpointListFree(&document->checkpoints);
+    WMFSourceEditorTokenListFree(&document->tokens);
+}
+
+/// @return The start of the line @c location is on. Lines end with \n, which is what wikitext from the API uses.
+static size_t WMFEditingLineStart(const WMFEditingDocument *document, size_t location) {
+    while (location > 0 && document->characters[location - 1] != '\n') {
+        location--;
+    }
+    return location;
+}
+
+/// @return The end of the line @c location is on, after its \n, like @c NSMaxRange(-lineRangeForRange:).
+static size_t WMFEditingLineEnd(const WMFEditingDocument *document, size_t location) {
+    while (location < document->length && document->characters[location] != '\n') {
+        location++;
+    }
+    return location < document->length ? location + 1 : location;
+}
+
+#pragma mark - Highlighting
+
+/// Sets the style of the tokens' characters in @c styles, which starts at @c start and ends at @c end.
+static void WMFEditingApplyTokens(const WMFSourceEditorTokenList *tokens, size_t offset, uint64_t *styles, size_t start, size_t end) {
+    memset(styles, 0, (end - start) * sizeof(uint64_t));
+    for (size_t i = 0; i < tokens->count; i++) {
+        const WMFSourceEditorToken *token = &tokens->tokens[i];
+        size_t tokenStart = token->location + offset;
+        size_t tokenEnd = tokenStart + token->length;
+        uint64_t style = (uint64_t)1 << token->kind;
+        uint64_t markupStyle = (uint64_t)1 << (token->kind + WMFEditingMarkupStyleShift);
+        for (size_t location = tokenStart > start ? tokenStart : start; location < tokenEnd && location < end; location++) {
+            bool isMarkup = location < tokenStart + token->openingLength || location >= tokenEnd - token->closingLength;
+            styles[location - start] |= isMarkup ? style | markupStyle : style;
+        }
+    }
+}
+
+/// Highlights whole lines from @c start to @c end like WMFSourceEditorLexingSnapshot and the formatters do, and counts the runs that changed.
+static void WMFEditingHighlight(WMFEditingDocument *document, size_t start, size_t end, WMFSourceEditorLexerState state, WMFEditingStatistics *statistics) {
+    if (end <= start) {
+        return;
+    }
+
+    // The lexer also reads the character before the range, and links with nested links to the end of their line
+    size_t charactersStart = start > 0 ? start - 1 : 0;
+    size_t charactersEnd = end - 1;
+    while (charactersEnd < document->length && document->characters[charactersEnd] != '\n') {
+        charactersEnd++;
+    }
+    charactersEnd = charactersEnd < document->length ? charactersEnd + 1 : document->length;
+    WMFSourceEditorLex(document->characters + charactersStart, charactersEnd - charactersStart, start - charactersStart, end - start, state, WMFSourceEditorTokenKindSetAll, &document->tokens);
+
+    if (end - start > document->highlightedCapacity) {
+        document->highlightedCapacity = end - start;
+        document->highlightedStyles = realloc(document->highlightedStyles, document->highlightedCapacity * sizeof(uint64_t));
+    }
+    WMFEditingApplyTokens(&document->tokens, charactersStart, document->highlightedStyles, start, end);
+
+    // Runs of changed characters are reported to TextKit one range at a time
+    bool isChanged = false;
+    for (size_t location = start; location < end; location++) {
+        uint64_t style = document->highlightedStyles[location - start];
+        if (document->styles[location] != style) {
+            document->styles[location] = style;
+            statistics->changedCharacterCount++;
+            statistics->changedRunCount += isChanged ? 0 : 1;
+            isChanged = true;
+        } else {
+            isChanged = false;
+        }
+    }
+    statistics->highlightedCharacterCount += end - start;
+}
+
+/// @return The number of characters whose style isn't the style of highlighting the whole document at once, apart from the kinds that can span lines.
+static size_t WMFEditingStaleCharacterCount(WMFEditingDocument *document) {
+    uint64_t *styles = malloc((document->length > 0 ? document->length : 1) * sizeof(uint64_t));
+    WMFSourceEditorLex(document->characters, document->length, 0, document->length, (WMFSourceEditorLexerState){0}, WMFSourceEditorTokenKindSetAll, &document->tokens);
+    WMFEditingApplyTokens(&document->tokens, 0, styles, 0, document->length);
+    // Strikethroughs and references can start on one line and end on the next, which highlighting the edited lines doesn't see, like the regular expressions before the lexer didn't
+    static const WMFSourceEditorTokenKind lineSpanningKinds[] = {WMFSourceEditorTokenKindStrikethrough, WMFSourceEditorTokenKindReferenceHorizontal, WMFSourceEditorTokenKindReferenceEmpty, WMFSourceEditorTokenKindReferenceOpen};
+    uint64_t checkedStyles = UINT64_MAX;
+    for (size_t i = 0; i < sizeof(lineSpanningKinds) / sizeof(lineSpanningKinds[0]); i++) {
+        checkedStyles &= ~((uint64_t)1 << lineSpanningKinds[i] | (uint64_t)1 << (lineSpanningKinds[i] + WMFEditingMarkupStyleShift));
+    }
+    size_t staleCount = 0;
+    for (size_t location = 0; location < document->length; location++) {
+        staleCount += (styles[location] & checkedStyles) != (document->styles[location] & checkedStyles) ? 1 : 0;
+    }
+    free(styles);
+    return staleCount;
+}
+
+#pragma mark - Lexer States
+
+/// Like -lexerStateAtLocation:, scanning from the nearest checkpoint and saving new ones along the way.
+static WMFSourceEditorLexerState WMFEditingLexerStateAtLocation(WMFEditingDocument *document, size_t location) {
+    WMFSourceEditorCheckpoint checkpoint = WMFSourceEditorCheckpointBeforeLocation(&document->checkpoints, location);
+    while (location - checkpoint.location > WMFSourceEditorCheckpointInterval) {
+        size_t lineEnd = WMFEditingLineEnd(document, checkpoint.location + WMFSourceEditorCheckpointInterval);
+        if (lineEnd >= location) {
+            break;
+        }
+        checkpoint.state = WMFSourceEditorLexerStateAfterCharacters(document->characters + checkpoint.location, lineEnd - checkpoint.location, checkpoint.state);
+        checkpoint.location = lineEnd;
+        WMFSourceEditorCheckpointListInsert(&document->checkpoints, checkpoint.location, checkpoint.state);
+    }
+    return WMFSourceEditorLexerStateAfterCharacters(document->characters + checkpoint.location, location - checkpoint.location, checkpoint.state);
+}
+
+/// @return @c location moved to where it is after replacing @c replacedLength characters at @c replacedLocation, like WMFSourceEditorRangeAfterReplacingCharacters.
+static size_t WMFEditingLocationAfterReplacingCharacters(size_t location, size_t replacedLocation, size_t replacedLength, size_t replacementLength) {
+    if (location <= replacedLocation) {
+        return location;
+    }
+    return location >= replacedLocation + replacedLength ? location - replacedLength + replacementLength : replacedLocation + replacementLength;
+}
+
+/// Like -updateLexerStatesAfterReplacingCharactersInRange:replacementLength:oldLineEnd:oldLineEndState:.
+static void WMFEditingUpdateLexerStates(WMFEditingDocument *document, size_t location, size_t replacedLength, size_t replacementLength, size_t oldLineEnd, WMFSourceEditorLexerState oldLineEndState) {
+    WMFSourceEditorCheckpointListReplaceCharacters(&document->checkpoints, location, replacedLength, replacementLength);
+    if (document->isDamaged) {
+        document->damagedStart = WMFEditingLocationAfterReplacingCharacters(document->damagedStart, location, replacedLength, replacementLength);
+        document->damagedEnd = WMFEditingLocationAfterReplacingCharacters(document->damagedEnd, location, replacedLength, replacementLength);
+    }
+
+    size_t lineEnd = oldLineEnd - replacedLength + replacementLength;
+    WMFSourceEditorCheckpoint checkpoint = WMFSourceEditorCheckpointBeforeLocation(&document->checkpoints, location);
+    WMFSourceEditorLexerState lineEndState = WMFSourceEditorLexerStateAfterCharacters(document->characters + checkpoint.location, lineEnd - checkpoint.location, checkpoint.state);
+
+    size_t damageEnd = lineEnd;
+    while (!WMFSourceEditorLexerStateEqualToState(lineEndState, oldLineEndState) && damageEnd < document->length) {
+        size_t chunkEnd = WMFEditingLineEnd(document, damageEnd + WMFSourceEditorCheckpointInterval < document->length ? damageEnd + WMFSourceEditorCheckpointInterval : document->length);
+        damageEnd += WMFSourceEditorLexerStatesConverge(document->characters + damageEnd, chunkEnd - damageEnd, &lineEndState, &oldLineEndState);
+    }
+
+    bool didConverge = WMFSourceEditorLexerStateEqualToState(lineEndState, oldLineEndState);
+    WMFSourceEditorCheckpointListRemove(&document->checkpoints, location, didConverge ? damageEnd : document->length + 1);
+
+    if (damageEnd > lineEnd) {
+        document->damagedStart = document->isDamaged && document->damagedStart < lineEnd ? document->damagedStart : lineEnd;
+        document->damagedEnd = document->isDamaged && document->damagedEnd > damageEnd ? document->damagedEnd : damageEnd;
+        document->isDamaged = true;
+    }
+}
+
+#pragma mark - Edits
+
+/**
+ * Like -replaceCharactersInRange:withString:. Inserted characters take the style of the one before them, like attributes do.
+ *
+ * @return How long replacing the characters and moving their styles took. That's the backing store's work, which a flat array of styles makes much slower than attribute runs are, so it's left out of the edit's time.
+ */
+static double WMFEditingReplaceCharacters(WMFEditingDocument *document, size_t location, size_t replacedLength, const uint16_t *replacement, size_t replacementLength) {
+    size_t oldLineEnd = WMFEditingLineEnd(document, location + replacedLength);
+    WMFSourceEditorLexerState oldLineEndState = WMFEditingLexerStateAtLocation(document, oldLineEnd);
+
+    double start = WMFEditingNow();
+
+    size_t length = document->length - replacedLength + replacementLength;
+    if (length > document->capacity) {
+        document->capacity = length * 2;
+        document->characters = realloc(document->characters, document->capacity * sizeof(uint16_t));
+        document->styles = realloc(document->styles, document->capacity * sizeof(uint64_t));
+    }
+    size_t tailLength = document->length - location - replacedLength;
+    memmove(document->characters + location + replacementLength, document->characters + location + replacedLength, tailLength * sizeof(uint16_t));
+    memmove(document->styles + location + replacementLength, document->styles + location + replacedLength, tailLength * sizeof(uint64_t));
+    uint64_t style = location > 0 ? document->styles[location - 1] : 0;
+    for (size_t i = 0; i < replacementLength; i++) {
+        document->characters[location + i] = replacement[i];
+        document->styles[location + i] = style;
+    }
+    document->length = length;
+    double duration = WMFEditingNow() - start;
+
+    WMFEditingUpdateLexerStates(document, location, replacedLength, replacementLength, oldLineEnd, oldLineEndState);
+    return duration;
+}
+
+/// Like -processEditing for @c editedStart to @c editedEnd. The lines past the synchronous limit are left in @c deferredStart to @c deferredEnd.
+static void WMFEditingProcessEditing(WMFEditingDocument *document, size_t editedStart, size_t editedEnd, size_t *deferredStart, size_t *deferredEnd, WMFEditingStatistics *statistics) {
+    if (document->isDamaged) {
+        editedStart = editedStart < document->damagedStart ? editedStart : document->damagedStart;
+        editedEnd = editedEnd > document->damagedEnd ? editedEnd : document->damagedEnd;
+    }
+    size_t start = WMFEditingLineStart(document, editedStart);
+    size_t end = WMFEditingLineEnd(document, editedEnd);
+    size_t editedLineEnd = WMFEditingLineEnd(document, editedStart);
+    end = end > editedLineEnd ? end : editedLineEnd;
+
+    *deferredStart = *deferredEnd = end;
+    if (end - start > WMFEditingSynchronousHighlightingLength) {
+        size_t synchronousEnd = WMFEditingLineEnd(document, start + WMFEditingSynchronousHighlightingLength);
+        if (synchronousEnd < end) {
+            *deferredStart = synchronousEnd;
+            end = synchronousEnd;
+        }
+    }
+
+    WMFEditingHighlight(document, start, end, WMFEditingLexerStateAtLocation(document, start), statistics);
+    document->isDamaged = false;
+}
+
+#pragma mark - Sessions
+
+typedef enum {
+    WMFEditingEditKindInsert,
+    WMFEditingEditKindPaste,
+    WMFEditingEditKindDelete,
+    WMFEditingEditKindUndo,
+} WMFEditingEditKind;
+
+typedef struct {
+    WMFEditingEditKind kind;
+    size_t location;
+    /// The number of characters to delete, or of @c text
+    size_t length;
+    uint16_t *text;
+} WMFEditingEdit;
+
+typedef struct {
+    const char *name;
+    const char *position;
+    WMFEditingEdit *edits;
+    size_t count;
+    size_t capacity;
+} WMFEditingSession;
+
+static void WMFEditingSessionAppend(WMFEditingSession *session, WMFEditingEditKind kind, size_t location, const uint16_t *text, size_t length) {
+    if (session->count == session->capacity) {
+        session->capacity = session->capacity > 0 ? session->capacity * 2 : 256;
+        session->edits = realloc(session->edits, session->capacity * sizeof(WMFEditingEdit));
+    }
+    WMFEditingEdit edit = {kind, location, length, NULL};
+    if (text) {
+        edit.text = malloc((length > 0 ? length : 1) * sizeof(uint16_t));
+        memcpy(edit.text, text, length * sizeof(uint16_t));
+    }
+    session->edits[session->count++] = edit;
+}
+
+static void WMFEditingSessionFree(WMFEditingSession *session) {
+    for (size_t i = 0; i < session->count; i++) {
+        free(session->edits[i].text);
+    }
+    free(session->edits);
+}
+
+#pragma mark - Corpus
+
+/// Article-like wikitext: paragraphs of prose with inline markup, headings, lists, references and templates.
+static uint16_t *WMFEditingCreateArticle(size_t length) {
+    static const char *const lines[] = {
+        "== History ==",
+        "=== Early life ===",
+        "* A bulleted item with a [[Link|label]]",
+        "** A nested item",
+        "# A numbered item",
+        "{{Infobox person",
+        "| name = Ada Lovelace",
+        "| birth_date = {{birth date|1815|12|10}}",
+        "}}",
+        "[[File:Ada Lovelace portrait.jpg|thumb|Portrait by [[Alfred Edward Chalon]]]]",
+        "<!-- Hidden comment -->",
+    };
+    static const char *const words[] = {"the", "'''analytical'''", "engine", "of", "''Babbage''", "[[mathematics]]", "{{citation needed}}", "<ref>Toole 1992</ref>", "<ref name=\"a\" />", "was", "<sup>1</sup>", "<s>old</s>", "<u>new</u>", "a", "notes", "in"};
+    const size_t lineCount = sizeof(lines) / sizeof(lines[0]);
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+    uint16_t *characters = malloc((length > 0 ? length : 1) * sizeof(uint16_t));
+    size_t i = 0;
+    unsigned int state = 1;
+    while (i < length) {
+        state = state * 1103515245 + 12345;
+        if (((state >> 16) & 3) == 0) {
+            const char *line = lines[(state >> 18) % lineCount];
+            for (size_t j = 0; line[j] != 0 && i < length; j++) {
+                characters[i++] = (uint8_t)line[j];
+            }
+        } else {
+            // A paragraph of around 60 words
+            for (int word = 0; word < 60 && i < length; word++) {
+                state = state * 1103515245 + 12345;
+                const char *text = words[(state >> 16) % wordCount];
+                for (size_t j = 0; text[j] != 0 && i < length; j++) {
+                    characters[i++] = (uint8_t)text[j];
+                }
+                if (i < length) {
+                    characters[i++] = ' ';
+                }
+            }
+        }
+        if (i < length) {
+            characters[i++] = '\n';
+        }
+    }
+    return characters;
+}
+
+/// @return The UTF-16 of @c length bytes of UTF-8, with its length in @c count. Malformed bytes become U+FFFD.
+static uint16_t *WMFEditingCreateCharactersFromUTF8(const unsigned char *bytes, size_t length, size_t *count) {
+    uint16_t *characters = malloc((length > 0 ? length : 1) * sizeof(uint16_t));
+    size_t i = 0;
+    *count = 0;
+    while (i < length) {
+        uint32_t codePoint = bytes[i];
+        size_t continuationCount = codePoint >= 0xF0 ? 3 : codePoint >= 0xE0 ? 2 : codePoint >= 0xC0 ? 1 : 0;
+        if (codePoint >= 0x80 && (continuationCount == 0 || i + continuationCount >= length)) {
+            characters[(*count)++] = 0xFFFD;
+            i++;
+            continue;
+        }
+        codePoint &= continuationCount == 3 ? 0x07 : continuationCount == 2 ? 0x0F : continuationCount == 1 ? 0x1F : 0x7F;
+        for (size_t j = 1; j <= continuationCount; j++) {
+            codePoint = codePoint << 6 | (bytes[i + j] & 0x3F);
+        }
+        i += continuationCount + 1;
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            characters[(*count)++] = (uint16_t)(0xD800 | codePoint >> 10);
+            characters[(*count)++] = (uint16_t)(0xDC00 | (codePoint & 0x3FF));
+        } else {
+            characters[(*count)++] = (uint16_t)codePoint;
+        }
+    }
+    return characters;
+}
+
+/// @return The contents of the file at @c path, or @c NULL if it can't be read.
+static unsigned char *WMFEditingCreateContentsOfFile(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        return NULL;
+    }
+    size_t capacity = 1 << 16;
+    unsigned char *bytes = malloc(capacity + 1);
+    *length = 0;
+    size_t readLength;
+    while ((readLength = fread(bytes + *length, 1, capacity - *length, file)) > 0) {
+        *length += readLength;
+        if (*length == capacity) {
+            capacity *= 2;
+            bytes = realloc(bytes, capacity + 1);
+        }
+    }
+    fclose(file);
+    bytes[*length] = 0;
+    return bytes;
+}
+
+#pragma mark - Generated Sessions
+
+/// Typed in bursts, with a new line now and then
+static const char WMFEditingTypedText[] = "The '''engine''' was [[Charles Babbage|Babbage's]] design{{sfn|Toole|1992}} for a <ref>general</ref> computer.\n";
+
+static unsigned int WMFEditingRandomState;
+
+static size_t WMFEditingRandom(size_t limit) {
+    WMFEditingRandomState = WMFEditingRandomState * 1103515245 + 12345;
+    return limit > 0 ? (WMFEditingRandomState >> 8) % limit : 0;
+}
+
+/// Typing one character at a time, with a mistake corrected every so often
+static void WMFEditingCreateTypingSession(WMFEditingSession *session, size_t location) {
+    size_t textLength = strlen(WMFEditingTypedText);
+    for (size_t i = 0; session->count < 400; i++) {
+        uint16_t character = (uint8_t)WMFEditingTypedText[i % textLength];
+        WMFEditingSessionAppend(session, WMFEditingEditKindInsert, location++, &character, 1);
+        if (WMFEditingRandom(12) == 0) {
+            WMFEditingSessionAppend(session, WMFEditingEditKindDelete, --location, NULL, 1);
+        }
+    }
+}
+
+/// Deleting one character at a time backwards, then forwards once the start of the document is reached
+static void WMFEditingCreateDeletingSession(WMFEditingSession *session, size_t location) {
+    for (size_t i = 0; i < 400; i++) {
+        location = location > 0 ? location - 1 : 0;
+        WMFEditingSessionAppend(session, WMFEditingEditKindDelete, location, NULL, 1);
+    }
+}
+
+/// Pasting a few paragraphs and undoing it
+static void WMFEditingCreatePastingSession(WMFEditingSession *session, size_t location) {
+    uint16_t *text = WMFEditingCreateArticle(2048);
+    for (size_t i = 0; i < 40; i++) {
+        WMFEditingSessionAppend(session, WMFEditingEditKindPaste, location + WMFEditingRandom(64), text, 2048);
+        WMFEditingSessionAppend(session, WMFEditingEditKindUndo, 0, NULL, 0);
+    }
+    free(text);
+}
+
+/// Typing and undoing the opening of a comment on a new line, which changes how everything after it is lexed until the next closing
+static void WMFEditingCreateCommentSession(WMFEditingSession *session, size_t location) {
+    static const char opening[] = "\n<!--";
+    for (size_t i = 0; i < 40; i++) {
+        size_t start = location + WMFEditingRandom(64);
+        for (size_t j = 0; opening[j] != 0; j++) {
+            uint16_t character = (uint8_t)opening[j];
+            WMFEditingSessionAppend(session, WMFEditingEditKindInsert, start + j, &character, 1);
+        }
+        for (size_t j = 0; opening[j] != 0; j++) {
+            WMFEditingSessionAppend(session, WMFEditingEditKindUndo, 0, NULL, 0);
+        }
+    }
+}
+
+#pragma mark - Recorded Sessions
+
+/// @return Whether the session file at @c path could be read into @c session.
+static bool WMFEditingReadSession(const char *path, WMFEditingSession *session) {
+    size_t length;
+    unsigned char *contents = WMFEditingCreateContentsOfFile(path, &length);
+    if (!contents) {
+        return false;
+    }
+    bool isValid = true;
+    char *line = (char *)contents;
+    for (size_t lineNumber = 1; isValid && *line != 0; lineNumber++) {
+        char *next = strchr(line, '\n');
+        if (next) {
+            *next++ = 0;
+        } else {
+            next = line + strlen(line);
+        }
+
+        char kind[16];
+        unsigned long location = 0;
+        unsigned long deletedLength = 0;
+        int textStart = 0;
+        if (line[0] == '#' || line[0] == 0) {
+            // A comment or an empty line
+        } else if (strcmp(line, "undo") == 0) {
+            WMFEditingSessionAppend(session, WMFEditingEditKindUndo, 0, NULL, 0);
+        } else if (sscanf(line, "%15s %lu%n", kind, &location, &textStart) == 2 && line[textStart] == ' ' && (strcmp(kind, "insert") == 0 || strcmp(kind, "paste") == 0)) {
+            // Unescape in place, then decode as UTF-8. Only the one space after the location separates it, so text can start with spaces.
+            char *text = line + textStart + 1;
+            size_t textLength = 0;
+            for (size_t i = 0; text[i] != 0; i++) {
+                char character = text[i];
+                if (character == '\\' && text[i + 1] != 0) {
+                    character = text[++i];
+                    character = character == 'n' ? '\n' : character == 't' ? '\t' : character == 'r' ? '\r' : character;
+                }
+                text[textLength++] = character;
+            }
+            size_t count;
+            uint16_t *characters = WMFEditingCreateCharactersFromUTF8((const unsigned char *)text, textLength, &count);
+            WMFEditingSessionAppend(session, strcmp(kind, "paste") == 0 ? WMFEditingEditKindPaste : WMFEditingEditKindInsert, location, characters, count);
+            free(characters);
+        } else if (sscanf(line, "delete %lu %lu", &location, &deletedLength) == 2) {
+            WMFEditingSessionAppend(session, WMFEditingEditKindDelete, location, NULL, deletedLength);
+        } else {
+            fprintf(stderr, "%s:%zu: expected insert, paste, delete or undo\n", path, lineNumber);
+            isValid = false;
+        }
+        line = next;
+    }
+    free(contents);
+    return isValid;
+}
+
+#pragma mark - Replay
+
+typedef struct {
+    size_t location;
+    size_t insertedLength;
+    uint16_t *replacedCharacters;
+    size_t replacedLength;
+} WMFEditingUndo;
+
+typedef struct {
+    size_t editCount;
+    double p50;
+    double p95;
+    double p99;
+    double max;
+    WMFEditingStatistics statistics;
+    size_t staleCharacterCount;
+} WMFEditingResult;
+
+/// Replays @c session on a copy of @c characters and times each edit in microseconds.
+static WMFEditingResult WMFEditingReplay(const uint16_t *characters, size_t length, const WMFEditingSession *session) {
+    WMFEditingDocument document;
+    WMFEditingDocumentInit(&document);
+    document.capacity = length > 0 ? length * 2 : 1;
+    document.characters = malloc(document.capacity * sizeof(uint16_t));
+    document.styles = malloc(document.capacity * sizeof(uint64_t));
+    memcpy(document.characters, characters, length * sizeof(uint16_t));
+    document.length = length;
+    WMFSourceEditorLex(document.characters, length, 0, length, (WMFSourceEditorLexerState){0}, WMFSourceEditorTokenKindSetAll, &document.tokens);
+    WMFEditingApplyTokens(&document.tokens, 0, document.styles, 0, length);
+
+    WMFEditingUndo *undos = malloc((session->count > 0 ? session->count : 1) * sizeof(WMFEditingUndo));
+    size_t undoCount = 0;
+    double *durations = malloc((session->count > 0 ? session->count : 1) * sizeof(double));
+    WMFEditingResult result = {0};
+    WMFEditingStatistics deferredStatistics = {0};
+
+    for (size_t e = 0; e < session->count; e++) {
+        const WMFEditingEdit *edit = &session->edits[e];
+        size_t location;
+        size_t replacedLength;
+        const uint16_t *replacement;
+        size_t replacementLength;
+        uint16_t *undoneCharacters = NULL;
+        if (edit->kind == WMFEditingEditKindUndo) {
+            if (undoCount == 0) {
+                continue;
+            }
+            WMFEditingUndo *undo = &undos[--undoCount];
+            location = undo->location;
+            replacedLength = undo->insertedLength;
+            replacement = undoneCharacters = undo->replacedCharacters;
+            replacementLength = undo->replacedLength;
+        } else {
+            location = edit->location < document.length ? edit->location : document.length;
+            replacedLength = edit->kind == WMFEditingEditKindDelete ? edit->length : 0;
+            replacedLength = replacedLength < document.length - location ? replacedLength : document.length - location;
+            replacement = edit->text;
+            replacementLength = edit->kind == WMFEditingEditKindDelete ? 0 : edit->length;
+            WMFEditingUndo undo = {location, replacementLength, malloc((replacedLength > 0 ? replacedLength : 1) * sizeof(uint16_t)), replacedLength};
+            memcpy(undo.replacedCharacters, document.characters + location, replacedLength * sizeof(uint16_t));
+            undos[undoCount++] = undo;
+        }
+
+        size_t deferredStart;
+        size_t deferredEnd;
+        double start = WMFEditingNow();
+        double storageDuration = WMFEditingReplaceCharacters(&document, location, replacedLength, replacement, replacementLength);
+        WMFEditingProcessEditing(&document, location, location + replacementLength, &deferredStart, &deferredEnd, &result.statistics);
+        durations[result.editCount++] = (WMFEditingNow() - start - storageDuration) * 1e6;
+        free(undoneCharacters);
+
+        // The background catches up before the next edit
+        if (deferredEnd > deferredStart) {
+            WMFEditingHighlight(&document, deferredStart, deferredEnd, WMFEditingLexerStateAtLocation(&document, deferredStart), &deferredStatistics);
+            result.statistics.deferredCharacterCount += deferredEnd - deferredStart;
+        }
+        if (result.editCount % WMFEditingCheckInterval == 0) {
+            result.staleCharacterCount += WMFEditingStaleCharacterCount(&document);
+        }
+    }
+
+    qsort(durations, result.editCount, sizeof(double), WMFEditingCompareDurations);
+    result.p50 = WMFEditingPercentile(durations, result.editCount, 0.50);
+    result.p95 = WMFEditingPercentile(durations, result.editCount, 0.95);
+    result.p99 = WMFEditingPercentile(durations, result.editCount, 0.99);
+    result.max = result.editCount > 0 ? durations[result.editCount - 1] : 0;
+    result.staleCharacterCount += WMFEditingStaleCharacterCount(&document);
+
+    for (size_t i = 0; i < undoCount; i++) {
+        free(undos[i].replacedCharacters);
+    }
+    free(undos);
+    free(durations);
+    WMFEditingDocumentFree(&document);
+    return result;
+}
+
+#pragma mark - Output
+
+static bool WMFEditingHasResults;
+
+static void WMFEditingPrintResult(const char *article, size_t length, const WMFEditingSession *session, const WMFEditingResult *result) {
+    printf("%s\n    {\"article\": \"%s\", \"characters\": %zu, \"session\": \"%s\", \"position\": \"%s\", \"edits\": %zu, ", WMFEditingHasResults ? "," : "", article, length, session->name, session->position, result->editCount);
+    printf("\"p50_us\": %.2f, \"p95_us\": %.2f, \"p99_us\": %.2f, \"max_us\": %.2f, ", result->p50, result->p95, result->p99, result->max);
+    printf("\"highlighted_characters\": %zu, \"deferred_characters\": %zu, \"changed_attribute_runs\": %zu, \"changed_attribute_characters\": %zu, \"stale_characters\": %zu}", result->statistics.highlightedCharacterCount, result->statistics.deferredCharacterCount, result->statistics.changedRunCount, result->statistics.changedCharacterCount, result->staleCharacterCount);
+    WMFEditingHasResults = true;
+}
+
+/// Replays @c session and prints its result.
+/// @return Whether the session left no stale characters and, when there's a limit, stayed under it.
+static bool WMFEditingReport(const char *article, const uint16_t *characters, size_t length, const WMFEditingSession *session, double p99Limit) {
+    WMFEditingResult result = WMFEditingReplay(characters, length, session);
+    WMFEditingPrintResult(article, length, session, &result);
+    if (result.staleCharacterCount > 0) {
+        fprintf(stderr, "%s %s at %s: %zu characters aren't highlighted like the whole document\n", article, session->name, session->position, result.staleCharacterCount);
+        return false;
+    }
+    if (p99Limit > 0 && result.p99 > p99Limit) {
+        fprintf(stderr, "%s %s at %s: p99 of %.2f us is over the limit of %.2f us\n", article, session->name, session->position, result.p99, p99Limit);
+        return false;
+    }
+    return true;
+}
+
+/// Replays every generated session at the start, middle and end of @c characters.
+static bool WMFEditingReportGeneratedSessions(const char *article, const uint16_t *characters, size_t length, double p99Limit) {
+    typedef void (*WMFEditingSessionCreator)(WMFEditingSession *session, size_t location);
+    static const struct {
+        const char *name;
+        WMFEditingSessionCreator creator;
+    } sessions[] = {
+        {"typing", WMFEditingCreateTypingSession},
+        {"deleting", WMFEditingCreateDeletingSession},
+        {"pasting", WMFEditingCreatePastingSession},
+        {"comment", WMFEditingCreateCommentSession},
+    };
+    static const struct {
+        const char *name;
+        double fraction;
+    } positions[] = {{"start", 0.0}, {"middle", 0.5}, {"end", 1.0}};
+
+    bool isPassing = true;
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++) {
+        for (size_t s = 0; s < sizeof(sessions) / sizeof(sessions[0]); s++) {
+            WMFEditingRandomState = 7;
+            WMFEditingSession session = {sessions[s].name, positions[p].name, NULL, 0, 0};
+            sessions[s].creator(&session, (size_t)(positions[p].fraction * (double)length));
+            isPassing = WMFEditingReport(article, characters, length, &session, p99Limit) && isPassing;
+            WMFEditingSessionFree(&session);
+        }
+    }
+    return isPassing;
+}
+
+int main(int argc, const char *argv[]) {
+    const char *articlePath = NULL;
+    const char *sessionPath = NULL;
+    double p99Limit = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--article") == 0 && i + 1 < argc) {
+            articlePath = argv[++i];
+        } else if (strcmp(argv[i], "--session") == 0 && i + 1 < argc) {
+            sessionPath = argv[++i];
+        } else if (strcmp(argv[i], "--p99-limit") == 0 && i + 1 < argc) {
+            p99Limit = strtod(argv[++i], NULL);
+        } else {
+            fprintf(stderr, "Usage: %s [--article file] [--session file] [--p99-limit microseconds]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    WMFEditingSession recordedSession = {"recorded", "recorded", NULL, 0, 0};
+    if (sessionPath && !WMFEditingReadSession(sessionPath, &recordedSession)) {
+        fprintf(stderr, "Can't read the session in %s\n", sessionPath);
+        WMFEditingSessionFree(&recordedSession);
+        return EXIT_FAILURE;
+    }
+
+    printf("{\n  \"benchmark\": \"source_editor_editing\",\n  \"version\": 1,\n  \"results\": [");
+    bool isPassing = true;
+    if (articlePath) {
+        size_t byteCount;
+        unsigned char *bytes = WMFEditingCreateContentsOfFile(articlePath, &byteCount);
+        if (!bytes) {
+            fprintf(stderr, "Can't read the article in %s\n", articlePath);
+            WMFEditingSessionFree(&recordedSession);
+            return EXIT_FAILURE;
+        }
+        size_t length;
+        uint16_t *characters = WMFEditingCreateCharactersFromUTF8(bytes, byteCount, &length);
+        free(bytes);
+        const char *name = strrchr(articlePath, '/') ? strrchr(articlePath, '/') + 1 : articlePath;
+        isPassing = sessionPath ? WMFEditingReport(name, characters, length, &recordedSession, p99Limit) : WMFEditingReportGeneratedSessions(name, characters, length, p99Limit);
+        free(characters);
+    } else {
+        static const size_t lengths[] = {10 * 1024, 100 * 1024, 1024 * 1024};
+        for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+            uint16_t *characters = WMFEditingCreateArticle(lengths[i]);
+            bool isArticlePassing = sessionPath ? WMFEditingReport("synthetic", characters, lengths[i], &recordedSession, p99Limit) : WMFEditingReportGeneratedSessions("synthetic", characters, lengths[i], p99Limit);
+            isPassing = isArticlePassing && isPassing;
+            free(characters);
+        }
+    }
+    printf("\n  ]\n}\n");
+
+    WMFEditingSessionFree(&recordedSession);
+    return isPassing ? EXIT_SUCCESS : EXIT_FAILURE;
+}
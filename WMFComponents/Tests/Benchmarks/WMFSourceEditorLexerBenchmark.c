@@ -0,0 +1,211 @@
+// Keystroke benchmarks for the source editor's wikitext lexer.
+//
+// Plain C with no Foundation, so it runs anywhere there's a C compiler, including Linux CI machines:
+//
+//     scripts/benchmark_source_editor_lexer
+//
+// Each keystroke re-lexes the line around a random location in a synthetic article, like
+// WMFSourceEditorTextStorage does after an edit. The single pass is timed next to lexing one kind at a time, which
+// is how the formatters used to scan the range with one regular expression each, and checked against it first so a
+// fast but wrong lexer can't report a result.
+
+#include "WMFSourceEditorLexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#pragma mark - Timing
+
+static double WMFBenchmarkNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/// Prevents the compiler from optimizing away results.
+static volatile size_t WMFBenchmarkSink;
+
+static int WMFBenchmarkFailures;
+
+#pragma mark - Corpus
+
+/// Article-like wikitext: paragraphs of prose with inline markup, headings, lists, references and templates.
+static uint16_t *WMFBenchmarkCreateArticle(size_t length) {
+    static const char *const lines[] = {
+        "== History ==",
+        "=== Early life ===",
+        "* A bulleted item with a [[Link|label]]",
+        "** A nested item",
+        "# A numbered item",
+        "{{Infobox person",
+        "| name = Ada Lovelace",
+        "| birth_date = {{birth date|1815|12|10}}",
+        "}}",
+        "[[File:Ada Lovelace portrait.jpg|thumb|Portrait by [[Alfred Edward Chalon]]]]",
+        "<!-- Hidden comment -->",
+    };
+    static const char *const words[] = {"the", "'''analytical'''", "engine", "of", "''Babbage''", "[[mathematics]]", "{{citation needed}}", "<ref>Toole 1992</ref>", "<ref name=\"a\" />", "was", "<sup>1</sup>", "<s>old</s>", "<u>new</u>", "a", "notes", "in"};
+    const size_t lineCount = sizeof(lines) / sizeof(lines[0]);
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+    uint16_t *characters = malloc(length * sizeof(uint16_t));
+    size_t i = 0;
+    unsigned int state = 1;
+    while (i < length) {
+        state = state * 1103515245 + 12345;
+        if (((state >> 16) & 3) == 0) {
+            const char *line = lines[(state >> 18) % lineCount];
+            for (size_t j = 0; line[j] != 0 && i < length; j++) {
+                characters[i++] = (uint8_t)line[j];
+            }
+        } else {
+            // A paragraph of around 60 words
+            for (int word = 0; word < 60 && i < length; word++) {
+                state = state * 1103515245 + 12345;
+                const char *text = words[(state >> 16) % wordCount];
+                for (size_t j = 0; text[j] != 0 && i < length; j++) {
+                    characters[i++] = (uint8_t)text[j];
+                }
+                if (i < length) {
+                    characters[i++] = ' ';
+                }
+            }
+        }
+        if (i < length) {
+            characters[i++] = '\n';
+        }
+    }
+    return characters;
+}
+
+/// One long line of image links with links in their captions, like a gallery or an infobox row.
+static uint16_t *WMFBenchmarkCreateImageLinkLine(size_t length) {
+    static const char *const link = "[[File:Example.jpg|thumb|A [[caption]] with [[two|links]] in it]] ";
+    const size_t linkLength = strlen(link);
+    uint16_t *characters = malloc(length * sizeof(uint16_t));
+    for (size_t i = 0; i < length; i++) {
+        characters[i] = (uint8_t)link[i % linkLength];
+    }
+    return characters;
+}
+
+#pragma mark - Keystrokes
+
+typedef struct {
+    size_t start;
+    size_t location;
+    size_t length;
+    size_t end;
+} WMFBenchmarkKeystroke;
+
+/// The line around a random location, with the character before it and through its \n, which is what the text storage passes to the lexer
+static WMFBenchmarkKeystroke *WMFBenchmarkCreateKeystrokes(const uint16_t *characters, size_t length, size_t count) {
+    WMFBenchmarkKeystroke *keystrokes = malloc(count * sizeof(WMFBenchmarkKeystroke));
+    unsigned int state = 7;
+    for (size_t k = 0; k < count; k++) {
+        state = state * 1103515245 + 12345;
+        size_t location = ((size_t)state << 8 ^ (state >> 8)) % length;
+        size_t lineStart = location;
+        while (lineStart > 0 && characters[lineStart - 1] != '\n') {
+            lineStart--;
+        }
+        size_t lineEnd = location;
+        while (lineEnd < length && characters[lineEnd] != '\n') {
+            lineEnd++;
+        }
+        if (lineEnd < length) {
+            lineEnd++;
+        }
+        keystrokes[k] = (WMFBenchmarkKeystroke){lineStart > 0 ? lineStart - 1 : 0, lineStart, lineEnd - lineStart, lineEnd};
+    }
+    return keystrokes;
+}
+
+typedef size_t (*WMFBenchmarkLexer)(const uint16_t *characters, const WMFBenchmarkKeystroke *keystroke, WMFSourceEditorTokenList *list);
+
+/// @return A checksum of every token found in one pass over the keystroke's range.
+static size_t WMFBenchmarkLexOnce(const uint16_t *characters, const WMFBenchmarkKeystroke *keystroke, WMFSourceEditorTokenList *list) {
+    const uint16_t *buffer = characters + keystroke->start;
+    WMFSourceEditorLex(buffer, keystroke->end - keystroke->start, keystroke->location - keystroke->start, keystroke->length, (WMFSourceEditorLexerState){0}, WMFSourceEditorTokenKindSetAll, list);
+    size_t checksum = 0;
+    for (size_t i = 0; i < list->count; i++) {
+        const WMFSourceEditorToken *token = &list->tokens[i];
+        checksum += (token->kind + 1) * (token->location * 31 + token->length * 7 + token->openingLength * 3 + token->closingLength);
+    }
+    return checksum;
+}
+
+/// @return The same checksum, scanning the range once for each kind.
+static size_t WMFBenchmarkLexEachKind(const uint16_t *characters, const WMFBenchmarkKeystroke *keystroke, WMFSourceEditorTokenList *list) {
+    const uint16_t *buffer = characters + keystroke->start;
+    size_t checksum = 0;
+    for (size_t kind = 0; kind < WMFSourceEditorTokenKindCount; kind++) {
+        WMFSourceEditorLex(buffer, keystroke->end - keystroke->start, keystroke->location - keystroke->start, keystroke->length, (WMFSourceEditorLexerState){0}, WMFSourceEditorTokenKindSetWithKind((WMFSourceEditorTokenKind)kind), list);
+        for (size_t i = 0; i < list->count; i++) {
+            const WMFSourceEditorToken *token = &list->tokens[i];
+            checksum += (token->kind + 1) * (token->location * 31 + token->length * 7 + token->openingLength * 3 + token->closingLength);
+        }
+    }
+    return checksum;
+}
+
+/// @return Microseconds per keystroke for the fastest of several runs of @c lexer.
+static double WMFBenchmarkMeasure(WMFBenchmarkLexer lexer, const uint16_t *characters, const WMFBenchmarkKeystroke *keystrokes, size_t count, WMFSourceEditorTokenList *list) {
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        double start = WMFBenchmarkNow();
+        for (size_t k = 0; k < count; k++) {
+            WMFBenchmarkSink += lexer(characters, &keystrokes[k], list);
+        }
+        double elapsed = (WMFBenchmarkNow() - start) / (double)count;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best * 1e6;
+}
+
+static void WMFBenchmarkReport(const char *name, const uint16_t *characters, const WMFBenchmarkKeystroke *keystrokes, size_t count) {
+    WMFSourceEditorTokenList list;
+    WMFSourceEditorTokenListInit(&list);
+    for (size_t k = 0; k < count; k++) {
+        size_t result = WMFBenchmarkLexOnce(characters, &keystrokes[k], &list);
+        size_t expected = WMFBenchmarkLexEachKind(characters, &keystrokes[k], &list);
+        if (result != expected) {
+            printf("%-30s FAILED at %zu: %zu != %zu\n", name, keystrokes[k].location, result, expected);
+            WMFBenchmarkFailures++;
+            WMFSourceEditorTokenListFree(&list);
+            return;
+        }
+    }
+    size_t characterCount = 0;
+    for (size_t k = 0; k < count; k++) {
+        characterCount += keystrokes[k].length;
+    }
+    double microseconds = WMFBenchmarkMeasure(WMFBenchmarkLexOnce, characters, keystrokes, count, &list);
+    double eachKindMicroseconds = WMFBenchmarkMeasure(WMFBenchmarkLexEachKind, characters, keystrokes, count, &list);
+    printf("%-30s %8.0f chars %9.2f us %9.2f us (each kind) %6.1fx\n", name, (double)characterCount / (double)count, microseconds, eachKindMicroseconds, eachKindMicroseconds / microseconds);
+    WMFSourceEditorTokenListFree(&list);
+}
+
+int main(int argc, const char *argv[]) {
+    size_t length = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 200 * 1024;
+    size_t keystrokeCount = argc > 2 ? (size_t)strtoul(argv[2], NULL, 10) : 2000;
+    uint16_t *characters = WMFBenchmarkCreateArticle(length);
+    WMFBenchmarkKeystroke *keystrokes = WMFBenchmarkCreateKeystrokes(characters, length, keystrokeCount);
+    WMFBenchmarkKeystroke article = {0, 0, length, length};
+
+    printf("%zu characters, best of 5 runs, per keystroke\n\n", length);
+    WMFBenchmarkReport("Edited line", characters, keystrokes, keystrokeCount);
+    WMFBenchmarkReport("Whole article", characters, &article, 1);
+
+    size_t imageLinkLineLength = length < 20 * 1024 ? length : 20 * 1024;
+    uint16_t *imageLinkLine = WMFBenchmarkCreateImageLinkLine(imageLinkLineLength);
+    WMFBenchmarkKeystroke imageLinks = {0, 0, imageLinkLineLength, imageLinkLineLength};
+    WMFBenchmarkReport("Line of image links", imageLinkLine, &imageLinks, 1);
+    free(imageLinkLine);
+
+    free(keystrokes);
+    free(characters);
+    return WMFBenchmarkFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,346 @@
+// Equivalence check for the source editor's wikitext lexer against the regular expressions it replaced.
+//
+// Plain C with ICU, whose regular expressions NSRegularExpression is built on, so it runs anywhere ICU is installed,
+// including Linux CI machines:
+//
+//     scripts/check_source_editor_lexer [iteration count] [seed]
+//
+// Each iteration strings together random wikitext fragments and lexes a random range of them with every kind at
+// once. Each formatter's old pattern is matched over the same range, its capture groups are turned into tokens the
+// way the formatter used them, and the two lists have to be the same. A second pass checks that lexing from the start
+// of a line, with the lexer state there, finds the same comments as lexing everything before it too.
+
+#include "WMFSourceEditorLexer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unicode/uregex.h>
+#include <unicode/ustring.h>
+
+#pragma mark - Patterns
+
+/// How a pattern's capture groups become a token
+typedef enum {
+    /// Groups 1 and 3 are the opening and closing
+    WMFEquivalenceShapeDelimited,
+    /// Group 1 is the opening, and there's no closing
+    WMFEquivalenceShapeList,
+    /// The whole match, without an opening or closing
+    WMFEquivalenceShapeWhole,
+    /// The whole match is the opening
+    WMFEquivalenceShapeOpening,
+    /// The whole match, with @c {{ and @c }}
+    WMFEquivalenceShapeTemplate,
+    /// Group 1, with @c {{
+    WMFEquivalenceShapeVerticalTemplateStart,
+    /// Group 1, with @c }}
+    WMFEquivalenceShapeVerticalTemplateEnd,
+    /// The links paired up from the match to the end of the line, like WMFSourceEditorFormatterLink used to
+    WMFEquivalenceShapeNestedLinks,
+} WMFEquivalenceShape;
+
+typedef struct {
+    WMFSourceEditorTokenKind kind;
+    const char *pattern;
+    uint32_t flags;
+    WMFEquivalenceShape shape;
+} WMFEquivalencePattern;
+
+/// The formatters' patterns, in token kind order. Comments span lines and can be left open at the end of the text,
+/// which is what the lexer's state carries from one line to the next.
+static const WMFEquivalencePattern WMFEquivalencePatterns[] = {
+    {WMFSourceEditorTokenKindBoldItalics, "('{5})(.*?)('{5})", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindBold, "('{3})(.*?)('{3})", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindItalics, "((?<!')'{2}(?!'))(.*?)((?<!')'{2}(?!'))", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSimpleLink, "(\\[{2})([^\\[\\]\\n]*)(\\]{2})", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindLinkWithNestedLink, "\\[{2}[^\\[\\]\\n]*\\[{2}", 0, WMFEquivalenceShapeNestedLinks},
+    {WMFSourceEditorTokenKindHorizontalTemplate, "\\{{2}[^\\{\\}\\n]*(?:\\{{2}[^\\{\\}\\n]*\\}{2})*[^\\{\\}\\n]*\\}{2}", 0, WMFEquivalenceShapeTemplate},
+    {WMFSourceEditorTokenKindVerticalTemplateStart, "^(?:.*)(\\{{2}[^\\{\\}\\n]*)$", UREGEX_MULTILINE, WMFEquivalenceShapeVerticalTemplateStart},
+    {WMFSourceEditorTokenKindVerticalTemplateParameter, "^\\s*\\|.*$", UREGEX_MULTILINE, WMFEquivalenceShapeWhole},
+    {WMFSourceEditorTokenKindVerticalTemplateEnd, "^([^\\{\\}\n]*\\}{2})(?:.)*$", UREGEX_MULTILINE, WMFEquivalenceShapeVerticalTemplateEnd},
+    {WMFSourceEditorTokenKindHeading, "^(={2})([^=]*)(={2})(?!=)$", UREGEX_MULTILINE, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSubheading1, "^(={3})([^=]*)(={3})(?!=)$", UREGEX_MULTILINE, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSubheading2, "^(={4})([^=]*)(={4})(?!=)$", UREGEX_MULTILINE, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSubheading3, "^(={5})([^=]*)(={5})(?!=)$", UREGEX_MULTILINE, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSubheading4, "^(={6})([^=]*)(={6})(?!=)$", UREGEX_MULTILINE, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindBulletSingle, "^(\\*{1})(.*)$", UREGEX_MULTILINE, WMFEquivalenceShapeList},
+    {WMFSourceEditorTokenKindBulletMultiple, "^(\\*{2,})(.*)$", UREGEX_MULTILINE, WMFEquivalenceShapeList},
+    {WMFSourceEditorTokenKindNumberSingle, "^(#{1})(.*)$", UREGEX_MULTILINE, WMFEquivalenceShapeList},
+    {WMFSourceEditorTokenKindNumberMultiple, "^(#{2,})(.*)$", UREGEX_MULTILINE, WMFEquivalenceShapeList},
+    {WMFSourceEditorTokenKindReferenceHorizontal, "(<ref(?:[^\\/>]+?)?>)(.*?)(<\\/ref>)", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindReferenceEmpty, "<ref[^>]+?\\/>", 0, WMFEquivalenceShapeWhole},
+    {WMFSourceEditorTokenKindReferenceOpen, "<ref(?:[^\\/>]+?)?>", 0, WMFEquivalenceShapeOpening},
+    {WMFSourceEditorTokenKindReferenceClose, "<\\/ref>", 0, WMFEquivalenceShapeOpening},
+    {WMFSourceEditorTokenKindStrikethrough, "(<s>)(\\s*.*?)(<\\/s>)", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSubscript, "(<sub>)(.*?)(<\\/sub>)", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindSuperscript, "(<sup>)(.*?)(<\\/sup>)", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindUnderline, "(<u>)(.*?)(<\\/u>)", 0, WMFEquivalenceShapeDelimited},
+    {WMFSourceEditorTokenKindComment, "(<!--)((?s:.*?))(-->|\\z)", 0, WMFEquivalenceShapeDelimited},
+};
+
+#define WMFEquivalencePatternCount (sizeof(WMFEquivalencePatterns) / sizeof(WMFEquivalencePatterns[0]))
+
+static URegularExpression *WMFEquivalenceExpressions[WMFEquivalencePatternCount];
+
+#pragma mark - Expected Tokens
+
+static WMFSourceEditorTokenList WMFEquivalenceExpected;
+
+static void WMFEquivalenceAppend(WMFSourceEditorTokenKind kind, size_t location, size_t length, size_t openingLength, size_t closingLength) {
+    WMFSourceEditorTokenList *list = &WMFEquivalenceExpected;
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity > 0 ? list->capacity * 2 : 64;
+        list->tokens = realloc(list->tokens, list->capacity * sizeof(WMFSourceEditorToken));
+    }
+    list->tokens[list->count++] = (WMFSourceEditorToken){kind, location, length, openingLength, closingLength};
+}
+
+static bool WMFEquivalenceTokensAreEqual(const WMFSourceEditorToken *token, const WMFSourceEditorToken *otherToken) {
+    return token->kind == otherToken->kind && token->location == otherToken->location && token->length == otherToken->length && token->openingLength == otherToken->openingLength && token->closingLength == otherToken->closingLength;
+}
+
+/// Pairs up @c [[ and @c ]] from @c location to the end of the line and appends every outermost link that closes after a nested one. A link found from an earlier match is only appended once.
+static void WMFEquivalenceAppendNestedLinks(const UChar *characters, size_t length, size_t location, WMFSourceEditorTokenKind kind) {
+    size_t openLinks[4096];
+    size_t openCount = 0;
+    bool lastClosedLinkWasNested = false;
+    for (size_t i = location; i + 1 < length && characters[i] != '\n'; i++) {
+        if (characters[i] == '[' && characters[i + 1] == '[') {
+            openLinks[openCount++] = i;
+        } else if (characters[i] == ']' && characters[i + 1] == ']') {
+            if (openCount == 0) {
+                break;
+            }
+            size_t linkLocation = openLinks[--openCount];
+            if (lastClosedLinkWasNested && openCount == 0) {
+                WMFSourceEditorToken token = {kind, linkLocation, i + 2 - linkLocation, 0, 0};
+                bool isAppended = false;
+                for (size_t j = 0; j < WMFEquivalenceExpected.count && !isAppended; j++) {
+                    isAppended = WMFEquivalenceTokensAreEqual(&WMFEquivalenceExpected.tokens[j], &token);
+                }
+                if (!isAppended) {
+                    WMFEquivalenceAppend(kind, token.location, token.length, 0, 0);
+                }
+            }
+            lastClosedLinkWasNested = openCount > 0;
+        }
+    }
+}
+
+/// The tokens the formatters' patterns find in @c [start, end), in kind order and then in the order they were found.
+static void WMFEquivalenceFindExpectedTokens(const UChar *characters, size_t length, size_t start, size_t end) {
+    WMFEquivalenceExpected.count = 0;
+    UErrorCode status = U_ZERO_ERROR;
+    for (size_t p = 0; p < WMFEquivalencePatternCount; p++) {
+        const WMFEquivalencePattern *pattern = &WMFEquivalencePatterns[p];
+        URegularExpression *expression = WMFEquivalenceExpressions[p];
+        uregex_setText(expression, characters, (int32_t)length, &status);
+        uregex_setRegion64(expression, (int64_t)start, (int64_t)end, &status);
+        while (uregex_findNext(expression, &status)) {
+            size_t matchStart = (size_t)uregex_start(expression, 0, &status);
+            size_t matchEnd = (size_t)uregex_end(expression, 0, &status);
+            size_t matchLength = matchEnd - matchStart;
+            switch (pattern->shape) {
+                case WMFEquivalenceShapeDelimited: {
+                    size_t openingEnd = (size_t)uregex_end(expression, 1, &status);
+                    size_t closingStart = (size_t)uregex_start(expression, 3, &status);
+                    WMFEquivalenceAppend(pattern->kind, matchStart, matchLength, openingEnd - matchStart, matchEnd - closingStart);
+                    break;
+                }
+                case WMFEquivalenceShapeList:
+                    WMFEquivalenceAppend(pattern->kind, matchStart, matchLength, (size_t)uregex_end(expression, 1, &status) - matchStart, 0);
+                    break;
+                case WMFEquivalenceShapeWhole:
+                    WMFEquivalenceAppend(pattern->kind, matchStart, matchLength, 0, 0);
+                    break;
+                case WMFEquivalenceShapeOpening:
+                    WMFEquivalenceAppend(pattern->kind, matchStart, matchLength, matchLength, 0);
+                    break;
+                case WMFEquivalenceShapeTemplate:
+                    WMFEquivalenceAppend(pattern->kind, matchStart, matchLength, 2, 2);
+                    break;
+                case WMFEquivalenceShapeVerticalTemplateStart:
+                case WMFEquivalenceShapeVerticalTemplateEnd: {
+                    size_t groupStart = (size_t)uregex_start(expression, 1, &status);
+                    size_t groupEnd = (size_t)uregex_end(expression, 1, &status);
+                    bool isStart = pattern->shape == WMFEquivalenceShapeVerticalTemplateStart;
+                    WMFEquivalenceAppend(pattern->kind, groupStart, groupEnd - groupStart, isStart ? 2 : 0, isStart ? 0 : 2);
+                    break;
+                }
+                case WMFEquivalenceShapeNestedLinks:
+                    WMFEquivalenceAppendNestedLinks(characters, length, matchStart, pattern->kind);
+                    break;
+            }
+        }
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "ICU error %s matching %s\n", u_errorName(status), pattern->pattern);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+#pragma mark - Corpus
+
+/// Fragments of markup, including partial and mismatched ones, and line terminators and white space beyond \n and the space
+static const char *const WMFEquivalenceFragments[] = {
+    "'", "''", "'''", "'''''", "[", "[[", "]", "]]", "{", "{{", "}", "}}", "=", "==", "===", "*", "**", "#", "<", ">", "/", "|",
+    " ", "  ", "\n", "\n", "\r", "\r\n", "\t", "a", "b", "x", "-", "!", "s", "u", "sub", "sup", "r",
+    "<ref", "<ref>", "</ref>", "<ref name=a>", "<ref name=b/>", "<s>", "</s>", "<sub>", "</sub>", "<sup>", "</sup>", "<u>", "</u>", "<!--", "-->",
+    "[[a|[[b]]]]", "[[F|[[b]] [[c]]]]", "]][[", "[[[[", "{{a|{{b}}}}",
+    "\xE2\x80\xA8", "\xE3\x80\x80", "\xC2\x85", "\x0b", "\x0c", "\xC5\x9B",
+};
+
+#define WMFEquivalenceFragmentCount (sizeof(WMFEquivalenceFragments) / sizeof(WMFEquivalenceFragments[0]))
+
+#define WMFEquivalenceMaximumLength 4096
+
+/// @return The length of random wikitext written to @c characters.
+static size_t WMFEquivalenceCreateText(UChar *characters) {
+    size_t length = 0;
+    int fragmentCount = rand() % 60;
+    for (int f = 0; f < fragmentCount; f++) {
+        UChar fragment[64];
+        int32_t fragmentLength = 0;
+        UErrorCode status = U_ZERO_ERROR;
+        u_strFromUTF8(fragment, 64, &fragmentLength, WMFEquivalenceFragments[rand() % WMFEquivalenceFragmentCount], -1, &status);
+        memcpy(characters + length, fragment, (size_t)fragmentLength * sizeof(UChar));
+        length += (size_t)fragmentLength;
+    }
+    return length;
+}
+
+static void WMFEquivalencePrintText(const UChar *characters, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] >= 32 && characters[i] < 127) {
+            putchar(characters[i]);
+        } else {
+            printf("\\u%04x", characters[i]);
+        }
+    }
+    printf("\n");
+}
+
+static void WMFEquivalencePrintToken(const char *label, const WMFSourceEditorToken *token) {
+    printf("  %s kind %d at %zu length %zu opening %zu closing %zu\n", label, token->kind, token->location, token->length, token->openingLength, token->closingLength);
+}
+
+#pragma mark - Checks
+
+/// @return The number of ranges where the lexer's tokens weren't the patterns' tokens.
+static long WMFEquivalenceCheckTokens(long iterationCount) {
+    static UChar characters[WMFEquivalenceMaximumLength];
+    WMFSourceEditorTokenList list;
+    WMFSourceEditorTokenListInit(&list);
+    long failureCount = 0;
+    for (long iteration = 0; iteration < iterationCount; iteration++) {
+        size_t length = WMFEquivalenceCreateText(characters);
+        size_t start = length > 0 && rand() % 3 == 0 ? (size_t)rand() % (length + 1) : 0;
+        size_t end = rand() % 3 == 0 ? start + (size_t)rand() % (length - start + 1) : length;
+
+        WMFEquivalenceFindExpectedTokens(characters, length, start, end);
+        WMFSourceEditorLex(characters, length, start, end - start, (WMFSourceEditorLexerState){0}, WMFSourceEditorTokenKindSetAll, &list);
+
+        bool isEqual = list.count == WMFEquivalenceExpected.count;
+        for (size_t i = 0; isEqual && i < list.count; i++) {
+            isEqual = WMFEquivalenceTokensAreEqual(&list.tokens[i], &WMFEquivalenceExpected.tokens[i]);
+        }
+        if (isEqual) {
+            continue;
+        }
+        if (++failureCount <= 5) {
+            printf("Mismatch lexing [%zu, %zu) of ", start, end);
+            WMFEquivalencePrintText(characters, length);
+            size_t count = list.count > WMFEquivalenceExpected.count ? list.count : WMFEquivalenceExpected.count;
+            for (size_t i = 0, printed = 0; i < count && printed < 8; i++) {
+                bool hasToken = i < list.count;
+                bool hasExpectedToken = i < WMFEquivalenceExpected.count;
+                if (hasToken && hasExpectedToken && WMFEquivalenceTokensAreEqual(&list.tokens[i], &WMFEquivalenceExpected.tokens[i])) {
+                    continue;
+                }
+                if (hasToken) {
+                    WMFEquivalencePrintToken("lexed   ", &list.tokens[i]);
+                }
+                if (hasExpectedToken) {
+                    WMFEquivalencePrintToken("expected", &WMFEquivalenceExpected.tokens[i]);
+                }
+                printed++;
+            }
+        }
+    }
+    WMFSourceEditorTokenListFree(&list);
+    return failureCount;
+}
+
+/// @return The number of line starts where lexing with the lexer state there found different comments than lexing the whole text.
+static long WMFEquivalenceCheckLexerStates(long iterationCount) {
+    static UChar characters[WMFEquivalenceMaximumLength];
+    WMFSourceEditorTokenList whole;
+    WMFSourceEditorTokenList list;
+    WMFSourceEditorTokenListInit(&whole);
+    WMFSourceEditorTokenListInit(&list);
+    WMFSourceEditorTokenKindSet comments = WMFSourceEditorTokenKindSetWithKind(WMFSourceEditorTokenKindComment);
+    long failureCount = 0;
+    for (long iteration = 0; iteration < iterationCount; iteration++) {
+        size_t length = WMFEquivalenceCreateText(characters);
+        size_t start = length > 0 ? (size_t)rand() % (length + 1) : 0;
+        while (start > 0 && characters[start - 1] != '\n') {
+            start--;
+        }
+
+        WMFSourceEditorLexerState state = WMFSourceEditorLexerStateAfterCharacters(characters, start, (WMFSourceEditorLexerState){0});
+        WMFSourceEditorLex(characters, length, 0, length, (WMFSourceEditorLexerState){0}, comments, &whole);
+        WMFSourceEditorLex(characters, length, start, length - start, state, comments, &list);
+
+        // A comment that starts before the line continues into it without an opening
+        bool isEqual = true;
+        size_t next = 0;
+        for (size_t i = 0; i < whole.count && isEqual; i++) {
+            WMFSourceEditorToken token = whole.tokens[i];
+            size_t tokenEnd = token.location + token.length;
+            if (tokenEnd <= start) {
+                continue;
+            }
+            if (token.location < start) {
+                token.location = start;
+                token.length = tokenEnd - start;
+                token.openingLength = 0;
+            }
+            isEqual = next < list.count && WMFEquivalenceTokensAreEqual(&list.tokens[next++], &token);
+        }
+        isEqual = isEqual && next == list.count;
+        if (!isEqual && ++failureCount <= 5) {
+            printf("Lexer state mismatch from %zu in ", start);
+            WMFEquivalencePrintText(characters, length);
+        }
+    }
+    WMFSourceEditorTokenListFree(&whole);
+    WMFSourceEditorTokenListFree(&list);
+    return failureCount;
+}
+
+int main(int argc, const char *argv[]) {
+    long iterationCount = argc > 1 ? strtol(argv[1], NULL, 10) : 200000;
+    unsigned int seed = argc > 2 ? (unsigned int)strtoul(argv[2], NULL, 10) : 1;
+    srand(seed);
+
+    for (size_t p = 0; p < WMFEquivalencePatternCount; p++) {
+        UErrorCode status = U_ZERO_ERROR;
+        UParseError parseError;
+        WMFEquivalenceExpressions[p] = uregex_openC(WMFEquivalencePatterns[p].pattern, WMFEquivalencePatterns[p].flags, &parseError, &status);
+        if (U_FAILURE(status)) {
+            fprintf(stderr, "Invalid pattern %s\n", WMFEquivalencePatterns[p].pattern);
+            return EXIT_FAILURE;
+        }
+    }
+
+    long tokenFailureCount = WMFEquivalenceCheckTokens(iterationCount);
+    printf("%ld random ranges, %ld mismatches\n", iterationCount, tokenFailureCount);
+    long stateFailureCount = WMFEquivalenceCheckLexerStates(iterationCount);
+    printf("%ld random line starts, %ld mismatches\n", iterationCount, stateFailureCount);
+
+    for (size_t p = 0; p < WMFEquivalencePatternCount; p++) {
+        uregex_close(WMFEquivalenceExpressions[p]);
+    }
+    free(WMFEquivalenceExpected.tokens);
+    return tokenFailureCount == 0 && stateFailureCount == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1602,6 +1602,25 @@ final class WMFSourceEditorFormatterTests: XCTestCase {
         XCTAssertEqual(base2Attributes[.foregroundColor] as! UIColor, colors.baseForegroundColor, "Incorrect base formatting")
     }
     
+    func testLinksWithNestedLinksOnOneLine() {
+        let string = "[[File:A.jpg|[[a]] b]] and [[File:B.jpg|[[c]] d]] end"
+        let mutAttributedString = NSMutableAttributedString(string: string)
+
+        for formatter in formatters {
+            formatter.addSyntaxHighlighting(to: mutAttributedString, in: NSRange(location: 0, length: string.count))
+        }
+
+        // "[[File:A.jpg|[[a]] b]]" and "[[File:B.jpg|[[c]] d]]"
+        XCTAssertTrue(linkFormatter.attributedString(mutAttributedString, isLinkWithNestedLinkIn: NSRange(location: 0, length: 22)), "Incorrect link formatting")
+        XCTAssertTrue(linkFormatter.attributedString(mutAttributedString, isLinkWithNestedLinkIn: NSRange(location: 27, length: 22)), "Incorrect link formatting")
+
+        // " and " and " end"
+        XCTAssertFalse(linkFormatter.attributedString(mutAttributedString, isLinkWithNestedLinkIn: NSRange(location: 22, length: 5)), "Incorrect base formatting")
+        XCTAssertFalse(linkFormatter.attributedString(mutAttributedString, isLinkWithNestedLinkIn: NSRange(location: 49, length: 4)), "Incorrect base formatting")
+        XCTAssertEqual(mutAttributedString.attribute(.foregroundColor, at: 23, effectiveRange: nil) as! UIColor, colors.baseForegroundColor, "Incorrect base formatting")
+        XCTAssertEqual(mutAttributedString.attribute(.foregroundColor, at: 30, effectiveRange: nil) as! UIColor, colors.blueForegroundColor, "Incorrect link formatting")
+    }
+    
     func testFind() {
         let string = "Find a '''word''' and highlight that word."
         let mutAttributedString = NSMutableAttributedString(string: string)
@@ -1695,4 +1714,480 @@ final class WMFSourceEditorFormatterTests: XCTestCase {
         XCTAssertEqual(match2Attributes[.foregroundColor] as! UIColor, colors.matchForegroundColor, "Incorrect match formatting")
         XCTAssertEqual(match2Attributes[.backgroundColor] as! UIColor, colors.selectedMatchBackgroundColor, "Incorrect match formatting")
     }
+    
+    func testFindUpdatesMatchesAfterEdits() {
+        let mutAttributedString = NSMutableAttributedString(string: "word word word")
+        WMFSourceEditorFormatter.addSyntaxHighlighting(to: mutAttributedString, in: NSRange(location: 0, length: mutAttributedString.length), formatters: formatters)
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "word")
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 3, "Incorrect match count")
+        
+        // Typing between matches moves the ones after it
+        mutAttributedString.replaceCharacters(in: NSRange(location: 5, length: 0), with: "a ")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: 5, length: 2), changeInLength: 2)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 3, "Incorrect match count")
+        XCTAssertEqual(findAndReplaceFormatter.selectedMatchRange, NSRange(location: 0, length: 4), "Incorrect selected match")
+        XCTAssertEqual(mutAttributedString.attributes(at: 7, effectiveRange: nil)[.backgroundColor] as? UIColor, colors.matchBackgroundColor, "Incorrect match formatting")
+        
+        // Typing in a match removes it, and typing one adds it
+        mutAttributedString.replaceCharacters(in: NSRange(location: 7, length: 1), with: "s")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: 7, length: 1), changeInLength: 0)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        XCTAssertNil(mutAttributedString.attributes(at: 7, effectiveRange: nil)[.backgroundColor], "Incorrect match formatting")
+        
+        mutAttributedString.replaceCharacters(in: NSRange(location: 5, length: 1), with: "Word")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: 5, length: 4), changeInLength: 3)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 3, "Incorrect match count")
+        XCTAssertEqual(mutAttributedString.attributes(at: 5, effectiveRange: nil)[.backgroundColor] as? UIColor, colors.matchBackgroundColor, "Incorrect match formatting")
+        
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+    
+    func testFindUpdatesOverlappingMatchesAfterTheEdit() {
+        let mutAttributedString = NSMutableAttributedString(string: "aaaa")
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "aa")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        
+        // Matches don't overlap, so one more "a" at the start moves which characters the rest match instead of moving the matches
+        mutAttributedString.replaceCharacters(in: NSRange(location: 0, length: 0), with: "a")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: 0, length: 1), changeInLength: 1)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        XCTAssertEqual(findAndReplaceFormatter.selectedMatchRange, NSRange(location: 0, length: 2), "Incorrect selected match")
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        XCTAssertEqual(findAndReplaceFormatter.selectedMatchRange, NSRange(location: 2, length: 2), "Incorrect selected match")
+        
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+    
+    func testFindMatchesCharactersThatFoldToMoreThanOne() {
+        let mutAttributedString = NSMutableAttributedString(string: "Straße and STRASSE")
+        
+        // "ß" folds to "ss"
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "strasse")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        XCTAssertEqual(findAndReplaceFormatter.selectedMatchRange, NSRange(location: 0, length: 6), "Incorrect selected match")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "Straße")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+        
+        // "ﬁ" folds to "fi"
+        mutAttributedString.setAttributedString(NSAttributedString(string: "ﬁnd the fi"))
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "fi")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        XCTAssertEqual(findAndReplaceFormatter.selectedMatchRange, NSRange(location: 0, length: 1), "Incorrect selected match")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "ﬁ")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+    
+    func testFindMatchesCharactersThatFoldToMoreThanOneAfterEdits() {
+        let mutAttributedString = NSMutableAttributedString(string: "fi and strasse")
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "fi")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 1, "Incorrect match count")
+        
+        // Typing "ﬁ" adds a match, even though the document didn't have characters like it when the search started
+        mutAttributedString.replaceCharacters(in: NSRange(location: 0, length: 0), with: "ﬁ ")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: 0, length: 2), changeInLength: 2)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "STRASSE")
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 1, "Incorrect match count")
+        
+        mutAttributedString.replaceCharacters(in: NSRange(location: mutAttributedString.length, length: 0), with: " Straße")
+        findAndReplaceFormatter.updateMatches(inFullAttributedString: mutAttributedString, afterEditingRange: NSRange(location: mutAttributedString.length - 7, length: 7), changeInLength: 7)
+        XCTAssertEqual(findAndReplaceFormatter.matchCount, 2, "Incorrect match count")
+        XCTAssertEqual(mutAttributedString.attributes(at: mutAttributedString.length - 1, effectiveRange: nil)[.backgroundColor] as? UIColor, colors.matchBackgroundColor, "Incorrect match formatting")
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+    
+    func testFindHighlightsMatchesInRepeatedParagraphs() {
+        let paragraph = "Find a '''word'''.\n"
+        let mutAttributedString = NSMutableAttributedString(string: String(repeating: paragraph, count: 3))
+        let paragraphLength = paragraph.utf16.count
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "word")
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        findAndReplaceFormatter.highlightNextMatch(inFullAttributedString: mutAttributedString, afterRangeValue: nil)
+        
+        // Each paragraph is highlighted with its own matches, even though they all have the same text
+        var backgroundColors: [UIColor?] = []
+        for i in 0..<3 {
+            let paragraphRange = NSRange(location: i * paragraphLength, length: paragraphLength)
+            let paragraphAttributedString = NSMutableAttributedString(attributedString: mutAttributedString.attributedSubstring(from: paragraphRange))
+            WMFSourceEditorFormatter.addSyntaxHighlighting(to: paragraphAttributedString, in: NSRange(location: 0, length: paragraphLength), formatters: formatters)
+            findAndReplaceFormatter.addSyntaxHighlighting(toParagraphAttributedString: paragraphAttributedString, documentRange: paragraphRange)
+            backgroundColors.append(paragraphAttributedString.attributes(at: 10, effectiveRange: nil)[.backgroundColor] as? UIColor)
+        }
+        
+        XCTAssertEqual(backgroundColors, [colors.matchBackgroundColor, colors.selectedMatchBackgroundColor, colors.matchBackgroundColor], "Incorrect match formatting")
+        
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+    
+    func testFindParagraphHighlightingPerformance() {
+        let paragraph = "Find a '''word''' and another word in a paragraph.\n"
+        let paragraphCount = 5000
+        let mutAttributedString = NSMutableAttributedString(string: String(repeating: paragraph, count: paragraphCount))
+        let paragraphLength = paragraph.utf16.count
+        
+        findAndReplaceFormatter.startMatchSession(withFullAttributedString: mutAttributedString, searchText: "word")
+        
+        // Highlighting every paragraph should scale with the number of paragraphs, not with their number times the document length
+        measure {
+            for i in 0..<paragraphCount {
+                let paragraphRange = NSRange(location: i * paragraphLength, length: paragraphLength)
+                let paragraphAttributedString = NSMutableAttributedString(attributedString: mutAttributedString.attributedSubstring(from: paragraphRange))
+                findAndReplaceFormatter.addSyntaxHighlighting(toParagraphAttributedString: paragraphAttributedString, documentRange: paragraphRange)
+            }
+        }
+        
+        findAndReplaceFormatter.endMatchSession(withFullAttributedString: mutAttributedString)
+    }
+
+    func testFormattersHighlightTheSameTogetherAsOneAtATime() {
+        let string = "== Heading ==\n* '''Bold''' and ''italic'' with a [[Link]]\n[[File:Cat.jpg|thumb|A [[cat]]]] {{Cite|a}}<ref>Ref</ref>\n{{Infobox\n| name = <s>a</s> <sub>b</sub> <sup>c</sup> <u>d</u>\n}}<!-- comment -->"
+        let lineRange = (string as NSString).lineRange(for: NSRange(location: 20, length: 0))
+        
+        for range in [NSRange(location: 0, length: string.utf16.count), lineRange] {
+            let oneAtATime = NSMutableAttributedString(string: string)
+            for formatter in formatters {
+                formatter.addSyntaxHighlighting(to: oneAtATime, in: range)
+            }
+            
+            let together = NSMutableAttributedString(string: string)
+            WMFSourceEditorFormatter.addSyntaxHighlighting(to: together, in: range, formatters: formatters)
+            
+            XCTAssertEqual(oneAtATime, together, "Formatters highlighted differently together")
+        }
+    }
+
+    func testUpdatingColorsAndFontsRestylesLikeHighlightingWithThem() {
+        let string = "== Heading ==\n* '''Bold''' and ''italic'' with a [[Link]]\n[[File:Cat.jpg|thumb|A [[cat]]]] {{Cite|a}}<ref>Ref</ref>\n{{Infobox\n| name = <s>a</s> <sub>b</sub> <sup>c</sup> <u>d</u>\n}}<!-- comment -->"
+        let range = NSRange(location: 0, length: string.utf16.count)
+        
+        let darkColors = WMFSourceEditorColors()
+        darkColors.baseForegroundColor = WMFTheme.dark.text
+        darkColors.orangeForegroundColor = WMFTheme.dark.editorOrange
+        darkColors.purpleForegroundColor = WMFTheme.dark.editorPurple
+        darkColors.greenForegroundColor = WMFTheme.dark.editorGreen
+        darkColors.blueForegroundColor = WMFTheme.dark.editorBlue
+        darkColors.grayForegroundColor = WMFTheme.dark.editorGray
+        darkColors.matchForegroundColor = WMFTheme.dark.editorMatchForeground
+        darkColors.matchBackgroundColor = WMFTheme.dark.editorMatchBackground
+        darkColors.selectedMatchBackgroundColor = WMFTheme.dark.editorSelectedMatchBackground
+        darkColors.replacedMatchBackgroundColor = WMFTheme.dark.editorReplacedMatchBackground
+        
+        let traitCollection = UITraitCollection(preferredContentSizeCategory: .extraExtraLarge)
+        let largeFonts = WMFSourceEditorFonts()
+        largeFonts.baseFont = WMFFont.for(.callout, compatibleWith: traitCollection)
+        largeFonts.boldFont = WMFFont.for(.boldCallout, compatibleWith: traitCollection)
+        largeFonts.italicsFont = WMFFont.for(.italicCallout, compatibleWith: traitCollection)
+        largeFonts.boldItalicsFont = WMFFont.for(.boldItalicCallout, compatibleWith: traitCollection)
+        largeFonts.headingFont = WMFFont.for(.editorHeading, compatibleWith: traitCollection)
+        largeFonts.subheading1Font = WMFFont.for(.editorSubheading1, compatibleWith: traitCollection)
+        largeFonts.subheading2Font = WMFFont.for(.editorSubheading2, compatibleWith: traitCollection)
+        largeFonts.subheading3Font = WMFFont.for(.editorSubheading3, compatibleWith: traitCollection)
+        largeFonts.subheading4Font = WMFFont.for(.editorSubheading4, compatibleWith: traitCollection)
+        
+        let restyled = NSMutableAttributedString(string: string)
+        WMFSourceEditorFormatter.addSyntaxHighlighting(to: restyled, in: range, formatters: formatters)
+        WMFSourceEditorFormatter.update(darkColors, fonts: largeFonts, in: restyled, in: range, formatters: formatters)
+        
+        let highlighted = NSMutableAttributedString(string: string)
+        let darkFormatters: [WMFSourceEditorFormatter] = [WMFSourceEditorFormatterBase(colors: darkColors, fonts: largeFonts, textAlignment: .left), WMFSourceEditorFormatterTemplate(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterBoldItalics(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterReference(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterList(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterHeading(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterStrikethrough(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterSubscript(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterSuperscript(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterUnderline(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterLink(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterComment(colors: darkColors, fonts: largeFonts), WMFSourceEditorFormatterFindAndReplace(colors: darkColors, fonts: largeFonts)]
+        WMFSourceEditorFormatter.addSyntaxHighlighting(to: highlighted, in: range, formatters: darkFormatters)
+        
+        XCTAssertEqual(restyled, highlighted, "Restyling for new colors and fonts didn't match highlighting with them")
+    }
+
+    func testTextStorageRehighlightsLinesAfterAnEditThatOpensOrClosesAComment() {
+        let storageDelegate = StorageDelegate(formatters: formatters, colors: colors, fonts: fonts)
+        let textStorage = WMFSourceEditorTextStorage()
+        textStorage.storageDelegate = storageDelegate
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: "Testing\n<!-- Comment\nStill comment\n-->\nTesting")
+        
+        // "Still comment"
+        XCTAssertEqual(textStorage.attributes(at: 21, effectiveRange: nil)[.foregroundColor] as! UIColor, colors.grayForegroundColor, "Incorrect comment formatting")
+        // "Testing"
+        XCTAssertEqual(textStorage.attributes(at: 39, effectiveRange: nil)[.foregroundColor] as! UIColor, colors.baseForegroundColor, "Incorrect base formatting")
+        
+        // Removing "<!--" uncomments the lines after it too
+        textStorage.replaceCharacters(in: NSRange(location: 8, length: 4), with: "")
+        XCTAssertEqual(textStorage.attributes(at: 17, effectiveRange: nil)[.foregroundColor] as! UIColor, colors.baseForegroundColor, "Incorrect base formatting")
+        
+        // Adding it back comments them again
+        textStorage.replaceCharacters(in: NSRange(location: 8, length: 0), with: "<!--")
+        XCTAssertEqual(textStorage.attributes(at: 21, effectiveRange: nil)[.foregroundColor] as! UIColor, colors.grayForegroundColor, "Incorrect comment formatting")
+        XCTAssertEqual(textStorage.attributes(at: 39, effectiveRange: nil)[.foregroundColor] as! UIColor, colors.baseForegroundColor, "Incorrect base formatting")
+    }
+    
+    func testTextStorageOnlyAppliesBackgroundHighlightingForTheLatestText() {
+        var scheduled: [(lex: () -> Void, apply: () -> Void)] = []
+        let storageDelegate = StorageDelegate(formatters: formatters, colors: colors, fonts: fonts)
+        let textStorage = WMFSourceEditorTextStorage()
+        textStorage.storageDelegate = storageDelegate
+        textStorage.highlightingScheduler = { lex, apply in
+            scheduled.append((lex, apply))
+        }
+        
+        let line = "The quick '''brown''' fox\n"
+        let lineLength = line.utf16.count
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: String(repeating: line, count: 2000))
+        
+        // The first lines are highlighted right away and the rest are left to the background
+        XCTAssertEqual(textStorage.attributes(at: 13, effectiveRange: nil)[.font] as? UIFont, fonts.boldFont, "Incorrect bold formatting")
+        XCTAssertNil(textStorage.attributes(at: textStorage.length - lineLength + 13, effectiveRange: nil)[.font], "Highlighted too much synchronously")
+        XCTAssertEqual(scheduled.count, 1)
+        
+        // Lexed before an edit and applied after it
+        scheduled[0].lex()
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: line)
+        scheduled.removeFirst().apply()
+        XCTAssertNil(textStorage.attributes(at: textStorage.length - lineLength + 13, effectiveRange: nil)[.font], "Applied out of date highlighting")
+        XCTAssertEqual(scheduled.count, 1)
+        
+        // Snapshot taken before an edit and lexed after it
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: lineLength), with: "")
+        scheduled[0].lex()
+        scheduled.removeFirst().apply()
+        XCTAssertNil(textStorage.attributes(at: textStorage.length - lineLength + 13, effectiveRange: nil)[.font], "Applied out of date highlighting")
+        XCTAssertEqual(scheduled.count, 1)
+        
+        // Once edits stop, the rest is highlighted one piece at a time, the same as highlighting everything at once
+        while !scheduled.isEmpty {
+            let next = scheduled.removeFirst()
+            next.lex()
+            next.apply()
+        }
+        
+        let expected = NSMutableAttributedString(string: textStorage.string)
+        WMFSourceEditorFormatter.addSyntaxHighlighting(to: expected, in: NSRange(location: 0, length: expected.length), formatters: formatters)
+        XCTAssertEqual(NSAttributedString(attributedString: textStorage), expected, "Background highlighting is different")
+    }
+    
+    func testTextStorageOnlyReportsAttributeChangesWhereHighlightingChanged() {
+        let storageDelegate = StorageDelegate(formatters: formatters, colors: colors, fonts: fonts)
+        let editingRecorder = EditingRecorder()
+        let textStorage = WMFSourceEditorTextStorage()
+        textStorage.storageDelegate = storageDelegate
+        textStorage.delegate = editingRecorder
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: "The quick '''brown''' fox jumps over the lazy dog")
+        
+        // Typing inside a word leaves the highlighting of the rest of the line as it was
+        textStorage.replaceCharacters(in: NSRange(location: 2, length: 0), with: "e")
+        XCTAssertEqual(editingRecorder.editedRanges.last, NSRange(location: 2, length: 1), "Reported unchanged attributes")
+        
+        // Removing the closing bold markup only changes the bold text and its opening
+        textStorage.replaceCharacters(in: NSRange(location: 19, length: 3), with: "")
+        XCTAssertEqual(editingRecorder.editedRanges.last, NSRange(location: 11, length: 8), "Reported unchanged attributes")
+        XCTAssertEqual(textStorage.attributes(at: 14, effectiveRange: nil)[.font] as? UIFont, fonts.baseFont, "Incorrect base formatting")
+    }
+    
+    func testTextStorageHighlightsAndRestylesAroundTheVisibleRangeFirst() {
+        var scheduled: [(lex: () -> Void, apply: () -> Void)] = []
+        let storageDelegate = StorageDelegate(formatters: formatters, colors: colors, fonts: fonts)
+        let textStorage = WMFSourceEditorTextStorage()
+        textStorage.storageDelegate = storageDelegate
+        textStorage.highlightingScheduler = { lex, apply in
+            scheduled.append((lex, apply))
+        }
+        
+        let line = "The quick '''brown''' fox\n"
+        let lineLength = line.utf16.count
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: String(repeating: line, count: 2000))
+        let lastLineLocation = textStorage.length - lineLength
+        XCTAssertNil(textStorage.attributes(at: lastLineLocation + 13, effectiveRange: nil)[.font], "Highlighted too much synchronously")
+        
+        // Scrolling to the end highlights it right away, before the background gets to it
+        textStorage.visibleRange = NSRange(location: lastLineLocation, length: lineLength)
+        XCTAssertEqual(textStorage.attributes(at: lastLineLocation + 13, effectiveRange: nil)[.font] as? UIFont, fonts.boldFont, "Incorrect bold formatting")
+        
+        // Changing colors only updates what's around the visible range right away
+        let oldColor = colors.baseForegroundColor
+        colors.baseForegroundColor = .red
+        textStorage.updateColorsAndFonts()
+        XCTAssertEqual(textStorage.attributes(at: lastLineLocation, effectiveRange: nil)[.foregroundColor] as? UIColor, .red, "Incorrect base color")
+        XCTAssertEqual(textStorage.attributes(at: 0, effectiveRange: nil)[.foregroundColor] as? UIColor, oldColor, "Updated too much synchronously")
+        
+        // The rest is updated in slices
+        while !scheduled.isEmpty {
+            let next = scheduled.removeFirst()
+            next.lex()
+            next.apply()
+        }
+        XCTAssertEqual(textStorage.attributes(at: 0, effectiveRange: nil)[.foregroundColor] as? UIColor, .red, "Incorrect base color")
+        XCTAssertEqual(textStorage.attributes(at: 13, effectiveRange: nil)[.font] as? UIFont, fonts.boldFont, "Incorrect bold formatting")
+    }
+    
+    func testTextStorageReplaysEditingSession() throws {
+        let session = try EditingSession(article: "JuanDeSalmeron.wikitext", session: "JuanDeSalmeron.session")
+        let replay = EditingReplay(session: session, formatters: formatters, colors: colors, fonts: fonts)
+        
+        // Every few edits, the text storage has to be highlighted the same as highlighting all of its text at once. How long the edits take is measured by testTextStorageEditingSessionPerformance.
+        for (index, edit) in session.edits.enumerated() {
+            replay.perform(edit)
+            if index % 7 == 6 || index == session.edits.count - 1 {
+                let expected = NSMutableAttributedString(string: replay.textStorage.string)
+                WMFSourceEditorFormatter.addSyntaxHighlighting(to: expected, in: NSRange(location: 0, length: expected.length), formatters: formatters)
+                XCTAssertEqual(NSAttributedString(attributedString: replay.textStorage), expected, "Stale highlighting after edit \(index + 1)")
+            }
+        }
+    }
+    
+    func testTextStorageEditingSessionPerformance() throws {
+        let session = try EditingSession(article: "JuanDeSalmeron.wikitext", session: "JuanDeSalmeron.session")
+        let options = XCTMeasureOptions()
+        options.invocationOptions = [.manuallyStart]
+        
+        // Only the edits are timed, not loading the article
+        measure(metrics: [XCTClockMetric()], options: options) {
+            let replay = EditingReplay(session: session, formatters: self.formatters, colors: self.colors, fonts: self.fonts)
+            self.startMeasuring()
+            for edit in session.edits {
+                replay.perform(edit)
+            }
+            self.stopMeasuring()
+        }
+    }
+}
+
+/// An article and an editing session on it from Tests/Benchmarks, which scripts/benchmark_source_editor_editing replays too. See WMFSourceEditorEditingBenchmark.c for the session format.
+private struct EditingSession {
+    enum Edit {
+        case insert(location: Int, text: String)
+        case delete(location: Int, length: Int)
+        case undo
+        
+        var isUndo: Bool {
+            if case .undo = self {
+                return true
+            }
+            return false
+        }
+    }
+    
+    let article: String
+    let edits: [Edit]
+    
+    init(article articleFileName: String, session sessionFileName: String) throws {
+        let benchmarksURL = URL(fileURLWithPath: #filePath).deletingLastPathComponent().deletingLastPathComponent().appendingPathComponent("Benchmarks")
+        article = try String(contentsOf: benchmarksURL.appendingPathComponent(articleFileName), encoding: .utf8)
+        
+        var edits: [Edit] = []
+        let session = try String(contentsOf: benchmarksURL.appendingPathComponent(sessionFileName), encoding: .utf8)
+        for line in session.split(separator: "\n", omittingEmptySubsequences: true) where !line.hasPrefix("#") {
+            let parts = line.split(separator: " ", maxSplits: 2, omittingEmptySubsequences: false)
+            if parts.count == 1 && parts[0] == "undo" {
+                edits.append(.undo)
+            } else if parts.count == 3, parts[0] == "insert" || parts[0] == "paste", let location = Int(parts[1]) {
+                edits.append(.insert(location: location, text: Self.unescape(parts[2])))
+            } else if parts.count == 3, parts[0] == "delete", let location = Int(parts[1]), let length = Int(parts[2]) {
+                edits.append(.delete(location: location, length: length))
+            } else {
+                throw CocoaError(.fileReadCorruptFile)
+            }
+        }
+        self.edits = edits
+    }
+    
+    private static func unescape(_ text: Substring) -> String {
+        var unescaped = ""
+        var isEscaped = false
+        for character in text {
+            if isEscaped {
+                unescaped.append(character == "n" ? "\n" : character == "t" ? "\t" : character == "r" ? "\r" : character)
+                isEscaped = false
+            } else if character == "\\" {
+                isEscaped = true
+            } else {
+                unescaped.append(character)
+            }
+        }
+        return unescaped
+    }
+}
+
+/// Replays edits on a text storage the way typing in the editor does, with background highlighting done between edits.
+private class EditingReplay {
+    let textStorage = WMFSourceEditorTextStorage()
+    private let storageDelegate: StorageDelegate
+    private var scheduled: [(lex: () -> Void, apply: () -> Void)] = []
+    private var undos: [(range: NSRange, replacedText: String)] = []
+    
+    init(session: EditingSession, formatters: [WMFSourceEditorFormatter], colors: WMFSourceEditorColors, fonts: WMFSourceEditorFonts) {
+        storageDelegate = StorageDelegate(formatters: formatters, colors: colors, fonts: fonts)
+        textStorage.storageDelegate = storageDelegate
+        textStorage.highlightingScheduler = { [unowned self] lex, apply in
+            self.scheduled.append((lex, apply))
+        }
+        textStorage.replaceCharacters(in: NSRange(location: 0, length: 0), with: session.article)
+        finishBackgroundHighlighting()
+    }
+    
+    /// Replaces the characters for `edit` and finishes highlighting them. Locations past the end of the text are moved to its end.
+    func perform(_ edit: EditingSession.Edit) {
+        let length = textStorage.length
+        let range: NSRange
+        let text: String
+        switch edit {
+        case .insert(let location, let insertedText):
+            range = NSRange(location: min(location, length), length: 0)
+            text = insertedText
+        case .delete(let location, let deletedLength):
+            range = NSRange(location: min(location, length), length: min(deletedLength, length - min(location, length)))
+            text = ""
+        case .undo:
+            guard let undo = undos.popLast() else {
+                return
+            }
+            range = undo.range
+            text = undo.replacedText
+        }
+        if !edit.isUndo {
+            undos.append((NSRange(location: range.location, length: (text as NSString).length), textStorage.attributedSubstring(from: range).string))
+        }
+        
+        textStorage.replaceCharacters(in: range, with: text)
+        finishBackgroundHighlighting()
+    }
+    
+    private func finishBackgroundHighlighting() {
+        while !scheduled.isEmpty {
+            let next = scheduled.removeFirst()
+            next.lex()
+            next.apply()
+        }
+    }
+}
+
+private class EditingRecorder: NSObject, NSTextStorageDelegate {
+    var editedRanges: [NSRange] = []
+    
+    func textStorage(_ textStorage: NSTextStorage, didProcessEditing editedMask: NSTextStorage.EditActions, range editedRange: NSRange, changeInLength delta: Int) {
+        editedRanges.append(editedRange)
+    }
+}
+
+private class StorageDelegate: NSObject, WMFSourceEditorStorageDelegate {
+    let formatters: [WMFSourceEditorFormatter]
+    let colors: WMFSourceEditorColors
+    let fonts: WMFSourceEditorFonts
+    
+    init(formatters: [WMFSourceEditorFormatter], colors: WMFSourceEditorColors, fonts: WMFSourceEditorFonts) {
+        self.formatters = formatters
+        self.colors = colors
+        self.fonts = fonts
+    }
 }
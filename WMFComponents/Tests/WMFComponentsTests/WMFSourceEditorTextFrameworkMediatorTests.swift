@@ -490,6 +490,39 @@ final class WMFSourceEditorTextFrameworkMediatorTests: XCTestCase {
         XCTAssertFalse(selectionStates3.isComment)
     }
     
+    func testTextKit2ParagraphsAfterAnUnclosedComment() throws {
+        let text = "Testing\n<!-- Comment\nStill comment\nStill comment too"
+        mediator.textView.attributedText = NSAttributedString(string: text)
+        
+        // TextKit 2 is only used from iOS 17. The TextKit 1 storage has its own test in WMFSourceEditorFormatterTests.
+        guard #available(iOS 16.0, *),
+              let textContentStorage = mediator.textView.textLayoutManager?.textContentManager as? NSTextContentStorage,
+              let textStorage = textContentStorage.textStorage else {
+            return
+        }
+        
+        let colors = mediator.colors
+        
+        // "Still comment too", then "Still comment", out of order like TextKit 2 can ask for them
+        let lastParagraph = mediator.textContentStorage(textContentStorage, textParagraphWith: NSRange(location: 35, length: 17))
+        let paragraph = mediator.textContentStorage(textContentStorage, textParagraphWith: NSRange(location: 21, length: 14))
+        XCTAssertEqual(lastParagraph?.attributedString.attribute(.foregroundColor, at: 0, effectiveRange: nil) as? UIColor, colors.grayForegroundColor, "Incorrect comment formatting")
+        XCTAssertEqual(paragraph?.attributedString.attribute(.foregroundColor, at: 0, effectiveRange: nil) as? UIColor, colors.grayForegroundColor, "Incorrect comment formatting")
+        
+        // Removing "<!--" marks the paragraphs after it as edited too, so TextKit 2 asks for them again
+        var editedRange = NSRange(location: NSNotFound, length: 0)
+        let observer = NotificationCenter.default.addObserver(forName: NSTextStorage.didProcessEditingNotification, object: textStorage, queue: nil) { _ in
+            editedRange = textStorage.editedRange
+        }
+        textStorage.replaceCharacters(in: NSRange(location: 8, length: 4), with: "")
+        NotificationCenter.default.removeObserver(observer)
+        XCTAssertEqual(NSMaxRange(editedRange), textStorage.length, "Paragraphs after the edit not marked as edited")
+        
+        // "Still comment too"
+        let lastParagraphAfterEdit = mediator.textContentStorage(textContentStorage, textParagraphWith: NSRange(location: 31, length: 17))
+        XCTAssertEqual(lastParagraphAfterEdit?.attributedString.attribute(.foregroundColor, at: 0, effectiveRange: nil) as? UIColor, colors.baseForegroundColor, "Incorrect comment formatting")
+    }
+    
     func testFindWithResults() throws {
         let text = "Find a '''word''' and highlight that word."
         mediator.textView.attributedText = NSAttributedString(string: text)
@@ -551,4 +584,39 @@ final class WMFSourceEditorTextFrameworkMediatorTests: XCTestCase {
         XCTAssertEqual(formatter.selectedMatchIndex, NSNotFound, "Replace all - Incorrect selected match index")
         XCTAssertEqual(formatter.matchCount, 0, "Replace all - Incorrect match count")
     }
+    
+    func testFindIgnoresCaseWithAndWithoutRegularExpressionSyntax() throws {
+        let text = "Find a '''Word''' and replace that WORD in a wo.d."
+        mediator.textView.attributedText = NSAttributedString(string: text)
+        
+        mediator.findStart(text: "word")
+        XCTAssertEqual(mediator.findAndReplaceFormatter?.matchCount, 2, "Find - Incorrect match count")
+        
+        mediator.findStart(text: "wo.d")
+        XCTAssertEqual(mediator.findAndReplaceFormatter?.matchCount, 3, "Find - Incorrect match count")
+    }
+    
+    func testReplaceAllWithDifferentLengthMatches() throws {
+        let text = "Find a '''word''' and replace that wooord."
+        mediator.textView.attributedText = NSAttributedString(string: text)
+        
+        mediator.findStart(text: "wo+rd")
+        mediator.replaceAll(replaceText: "testing")
+        XCTAssertEqual(mediator.textView.attributedText.string, "Find a '''testing''' and replace that testing.", "Replace all failure")
+        XCTAssertEqual(mediator.findAndReplaceFormatter?.lastReplacedRange, NSRange(location: 38, length: 7), "Replace all - Incorrect replaced range")
+    }
+    
+    func testReplaceAllPerformance() throws {
+        // About 300 KB with 1,000 matches
+        let line = "Some '''wikitext''' with a [[Link]] and a {{Template|a}} in a long article, like this one and many others.\n"
+        let text = String(repeating: String(repeating: line, count: 3) + "A word.\n", count: 1000)
+        
+        measure {
+            mediator.textView.attributedText = NSAttributedString(string: text)
+            mediator.findStart(text: "word")
+            mediator.replaceAll(replaceText: "phrase")
+        }
+        
+        XCTAssertFalse(mediator.textView.attributedText.string.contains("word"), "Replace all failure")
+    }
 }
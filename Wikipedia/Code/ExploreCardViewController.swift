@@ -299,7 +299,7 @@ class ExploreCardViewController: UIViewController, UICollectionViewDataSource, U
         }
         if !imageInfo.imageDescription.isEmpty {
             cell.captionIsRTL = imageInfo.imageDescriptionIsRTL
-            cell.caption = imageInfo.imageDescription.wmf_stringByRemovingHTML()
+            cell.caption = imageInfo.imageDescription.wmf_stringByRemovingHTML(withMaximumLength: Int(WMFNumberOfExtractCharacters))
         } else {
             cell.caption = imageInfo.canonicalPageTitle
         }
@@ -1,6 +1,7 @@
 #import <WMF/WMF-Swift.h>
 #import <WMF/WMFCrossProcessCoreDataSynchronizer.h>
 #import "WMFAnnouncement.h"
+#import <WMF/WMFHTMLRenderCache.h>
 
 @import CoreData;
 
@@ -682,6 +683,7 @@ NSString *const WMFCacheContextCrossProcessNotificiationChannelNamePrefix = @"or
 
 - (void)didReceiveMemoryWarningWithNotification:(NSNotification *)note {
     [self clearMemoryCache];
+    [[WMFHTMLRenderCache sharedCache] removeAllAttributedStrings];
 }
 
 #pragma mark - Accessors
@@ -942,16 +944,16 @@ NSString *const WMFCacheContextCrossProcessNotificiationChannelNamePrefix = @"or
 
 - (nullable WMFArticle *)fetchArticleWithKey:(NSString *)key variant:(nullable NSString *)variant inManagedObjectContext:(nonnull NSManagedObjectContext *)moc {
     WMFArticle *article = nil;
+    WMFInMemoryURLKey *cacheKey = nil;
     if (moc == _viewContext) { // use ivar to avoid main thread check
-        WMFInMemoryURLKey *cacheKey = [[WMFInMemoryURLKey alloc] initWithDatabaseKey:key languageVariantCode:variant];
+        cacheKey = [WMFInMemoryURLKey internedKeyWithDatabaseKey:key languageVariantCode:variant];
         article = [self.articleCache objectForKey:cacheKey];
         if (article) {
             return article;
         }
     }
     article = [moc fetchArticleWithKey:key variant:variant];
-    if (article && moc == _viewContext) { // use ivar to avoid main thread check
-        WMFInMemoryURLKey *cacheKey = [[WMFInMemoryURLKey alloc] initWithDatabaseKey:key languageVariantCode:variant];
+    if (article && cacheKey) {
         [self.articleCache setObject:article forKey:cacheKey];
     }
     return article;
@@ -974,7 +976,7 @@ NSString *const WMFCacheContextCrossProcessNotificiationChannelNamePrefix = @"or
         article = [moc createArticleWithKey:key variant:variant];
         article.displayTitleHTML = article.displayTitle;
         if (moc == self.viewContext) {
-            WMFInMemoryURLKey *cacheKey = [[WMFInMemoryURLKey alloc] initWithDatabaseKey:key languageVariantCode:variant];
+            WMFInMemoryURLKey *cacheKey = [WMFInMemoryURLKey internedKeyWithDatabaseKey:key languageVariantCode:variant];
             [self.articleCache setObject:article forKey:cacheKey];
         }
     }
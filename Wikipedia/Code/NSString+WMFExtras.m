@@ -3,6 +3,7 @@
 @import MobileCoreServices;
 #import <WMF/NSDateFormatter+WMFExtensions.h>
 #import <WMF/WMF-Swift.h>
+#import <WMF/WMFTextBuffer.h>
 @import UniformTypeIdentifiers;
 
 @implementation NSString (WMFExtras)
@@ -119,16 +120,34 @@
 }
 
 - (NSString *)wmf_substringBeforeString:(NSString *)string {
-    return [[self componentsSeparatedByString:string] firstObject];
+    // Same as the first of componentsSeparatedByString:, without splitting the rest of the receiver
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, self);
+    WMFTextBuffer separator;
+    WMFTextBufferInit(&separator, string);
+    size_t location = WMFTextIndexOfCharacters(buffer.characters, buffer.length, 0, separator.characters, separator.length);
+    NSString *substring = location == buffer.length ? self : WMFTextBufferSubstring(&buffer, WMFTextSpanMake(0, location));
+    WMFTextBufferRelease(&separator);
+    WMFTextBufferRelease(&buffer);
+    return substring;
 }
 
 - (NSString *)wmf_substringAfterString:(NSString *)string {
-    NSArray *components = [self componentsSeparatedByString:string];
-    if ([components count] > 2) {
-        return components[1];
-    } else {
-        return [components lastObject];
+    // Same as the second of componentsSeparatedByString:, or the receiver if there's only one
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, self);
+    WMFTextBuffer separator;
+    WMFTextBufferInit(&separator, string);
+    NSString *substring = self;
+    size_t location = WMFTextIndexOfCharacters(buffer.characters, buffer.length, 0, separator.characters, separator.length);
+    if (location < buffer.length) {
+        size_t start = location + separator.length;
+        size_t end = WMFTextIndexOfCharacters(buffer.characters, buffer.length, start, separator.characters, separator.length);
+        substring = WMFTextBufferSubstring(&buffer, WMFTextSpanMake(start, end - start));
     }
+    WMFTextBufferRelease(&separator);
+    WMFTextBufferRelease(&buffer);
+    return substring;
 }
 
 @end
@@ -24,10 +24,28 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (NSString *)wmf_summaryFromText;
 
+/**
+ * Performs @c wmf_summaryFromText on each of @c texts, spreading the work across all cores.
+ * @return The summaries, in the same order as @c texts.
+ */
++ (NSArray<NSString *> *)wmf_summariesFromTexts:(NSArray<NSString *> *)texts;
+
+/**
+ * Performs @c wmf_summaryFromText on each of @c texts on at most @c maximumThreadCount threads at a time.
+ * @return The summaries, in the same order as @c texts.
+ */
++ (NSArray<NSString *> *)wmf_summariesFromTexts:(NSArray<NSString *> *)texts maximumThreadCount:(NSUInteger)maximumThreadCount;
+
 - (void)wmf_enumerateHTMLImageTagContentsWithHandler:(nonnull void (^)(NSString *imageTagContents, NSRange range))handler;
 
 - (nonnull NSString *)wmf_stringByRemovingHTML;
 
+/**
+ * The first @c maximumLength characters of @c wmf_stringByRemovingHTML, without reading any further into the receiver than needed.
+ * Use this when only the start of the text is displayed, e.g. for a snippet of a long HTML document.
+ */
+- (nonnull NSString *)wmf_stringByRemovingHTMLWithMaximumLength:(NSUInteger)maximumLength;
+
 /**
  * DEPRECATION WARNING: Utilize byAttributingString in String+HTML.swift for all new HTML --> NSAttributedString conversions. Only use this if absolutely necessary from Objective-C.
  */
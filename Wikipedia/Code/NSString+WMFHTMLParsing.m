@@ -5,12 +5,26 @@
 #import <WMF/NSRegularExpression+HTML.h>
 #import <WMF/NSCharacterSet+WMFExtras.h>
 #import <WMF/NSCharacterSet+WMFLinkParsing.h>
-#import "WMF/WMFHTMLElement.h"
+#import <WMF/WMFHTMLTokenizer.h>
+#import <WMF/WMFHTMLElementTree.h>
+#import <WMF/WMFTextBuffer.h>
+#import <WMF/WMFTextCleanup.h>
+#import <WMF/WMFHTMLRenderCache.h>
+#import <stdatomic.h>
 @import CoreText;
 
-@interface NSMutableAttributedString (WMFListHandling)
-- (NSInteger)performReplacementsForListElement:(nonnull WMFHTMLElement *)listElement currentList:(nullable WMFHTMLElement *)currentList withAttributes:(nullable NSDictionary *)attributes listIndex:(NSInteger)index replacementOffset:(NSInteger)offset;
-@end
+static NSString *WMFStringByPerformingTextCleanupSteps(NSString *string, const WMFTextCleanupStep *steps, size_t stepCount, NSUInteger maximumLength) {
+    NSUInteger length = string.length;
+    if (length == 0 || maximumLength == 0) {
+        return @"";
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    unichar *output = malloc(MIN(length, maximumLength) * sizeof(unichar));
+    NSUInteger outputLength = WMFTextCleanup(buffer.characters, length, steps, stepCount, maximumLength, output);
+    WMFTextBufferRelease(&buffer);
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
+}
 
 @implementation NSString (WMFHTMLParsing)
 
@@ -24,12 +38,17 @@
 #pragma mark - String simplification and cleanup
 
 - (NSString *)wmf_shareSnippetFromText {
-    return [[[[[[self wmf_stringByDecodingHTMLEntities]
-        wmf_stringByCollapsingConsecutiveNewlines]
-        wmf_stringByRemovingBracketedContent]
-        wmf_stringByRemovingWhiteSpaceBeforePeriodsCommasSemicolonsAndDashes]
-        wmf_stringByCollapsingConsecutiveSpaces]
-        wmf_stringByRemovingLeadingOrTrailingSpacesNewlinesOrColons];
+    // Same as chaining wmf_stringByDecodingHTMLEntities, wmf_stringByCollapsingConsecutiveNewlines,
+    // wmf_stringByRemovingBracketedContent, wmf_stringByRemovingWhiteSpaceBeforePeriodsCommasSemicolonsAndDashes,
+    // wmf_stringByCollapsingConsecutiveSpaces and wmf_stringByRemovingLeadingOrTrailingSpacesNewlinesOrColons
+    static const WMFTextCleanupStep steps[] = {
+        WMFTextCleanupStepDecodeEntities,
+        WMFTextCleanupStepCollapseNewlines,
+        WMFTextCleanupStepRemoveBracketedContent,
+        WMFTextCleanupStepRemoveWhitespaceBeforePunctuation,
+        WMFTextCleanupStepCollapseSpaces,
+        WMFTextCleanupStepTrim};
+    return WMFStringByPerformingTextCleanupSteps(self, steps, sizeof(steps) / sizeof(steps[0]), NSUIntegerMax);
 }
 
 - (NSString *)wmf_stringByCollapsingConsecutiveNewlines {
@@ -48,27 +67,15 @@
 
 - (NSString *)wmf_stringByRecursivelyRemovingParenthesizedContent {
     // We probably don't want to handle ideographic parens
-    static NSRegularExpression *parensRegex;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        parensRegex = [NSRegularExpression
-            regularExpressionWithPattern:@"[(][^()]+[)]"
-                                 options:0
-                                   error:nil];
-    });
-
-    NSString *string = [self copy];
-    NSString *oldResult;
-    NSRange range;
-    do {
-        oldResult = [string copy];
-        range = NSMakeRange(0, string.length);
-        string = [parensRegex stringByReplacingMatchesInString:string
-                                                       options:0
-                                                         range:range
-                                                  withTemplate:@""];
-    } while (![oldResult isEqualToString:string]);
-    return string;
+    NSUInteger length = self.length;
+    if (length == 0) {
+        return [self copy];
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, self);
+    unichar *output = WMFTextBufferTakeHeapStorage(&buffer) ?: malloc(length * sizeof(unichar));
+    NSUInteger outputLength = WMFTextCleanupRemoveParenthesizedContent(buffer.characters, length, output);
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
 }
 
 - (NSString *)wmf_stringByRemovingBracketedContent {
@@ -164,18 +171,62 @@
 }
 
 - (NSString *)wmf_summaryFromText {
-    // Cleanups which need to happen before string is shortened.
-    NSString *output = [self wmf_stringByRecursivelyRemovingParenthesizedContent];
-    output = [output wmf_stringByRemovingBracketedContent];
-
-    // Now ok to shorten so remaining cleanups are faster.
-    output = [output wmf_safeSubstringToIndex:WMFNumberOfExtractCharacters];
-
-    // Cleanups safe to do on shortened string.
-    return [[[[output wmf_stringByDecodingHTMLEntities]
-        wmf_stringByCollapsingAllWhitespaceToSingleSpaces]
-        wmf_stringByRemovingWhiteSpaceBeforePeriodsCommasSemicolonsAndDashes]
-        wmf_stringByRemovingLeadingOrTrailingSpacesNewlinesOrColons];
+    static const WMFTextCleanupStep steps[] = {
+        // Cleanups which need to happen before string is shortened.
+        WMFTextCleanupStepRemoveParenthesizedContent,
+        WMFTextCleanupStepRemoveBracketedContent,
+        // Nothing after WMFNumberOfExtractCharacters is read.
+        WMFTextCleanupStepLimitLength,
+        // Cleanups safe to do on shortened string.
+        WMFTextCleanupStepDecodeEntities,
+        WMFTextCleanupStepCollapseWhitespace,
+        WMFTextCleanupStepRemoveWhitespaceBeforePunctuation,
+        WMFTextCleanupStepTrim};
+    return WMFStringByPerformingTextCleanupSteps(self, steps, sizeof(steps) / sizeof(steps[0]), WMFNumberOfExtractCharacters);
+}
+
+/// The number of texts summarized together by one thread. Small enough to even out texts of different lengths,
+/// large enough that taking the next chunk costs nothing next to summarizing it.
+static const NSUInteger WMFSummaryBatchChunkLength = 16;
+
++ (NSArray<NSString *> *)wmf_summariesFromTexts:(NSArray<NSString *> *)texts {
+    return [self wmf_summariesFromTexts:texts maximumThreadCount:NSProcessInfo.processInfo.activeProcessorCount];
+}
+
++ (NSArray<NSString *> *)wmf_summariesFromTexts:(NSArray<NSString *> *)texts maximumThreadCount:(NSUInteger)maximumThreadCount {
+    texts = [texts copy];
+    NSUInteger count = texts.count;
+    NSUInteger chunkCount = (count + WMFSummaryBatchChunkLength - 1) / WMFSummaryBatchChunkLength;
+    NSUInteger threadCount = MAX(1, MIN(maximumThreadCount, chunkCount));
+    if (threadCount == 1) {
+        NSMutableArray<NSString *> *summaries = [NSMutableArray arrayWithCapacity:count];
+        for (NSString *text in texts) {
+            [summaries addObject:[text wmf_summaryFromText]];
+        }
+        return summaries;
+    }
+
+    // Each summary is written straight to its slot, so they come back in order without any locking
+    NSString *__strong *summaries = (NSString *__strong *)calloc(count, sizeof(NSString *));
+    _Atomic NSUInteger nextChunk = 0;
+    _Atomic NSUInteger *nextChunkPointer = &nextChunk;
+    dispatch_apply(threadCount, DISPATCH_APPLY_AUTO, ^(size_t thread) {
+        NSUInteger chunk;
+        while ((chunk = atomic_fetch_add(nextChunkPointer, 1)) < chunkCount) {
+            @autoreleasepool {
+                NSUInteger end = MIN(count, (chunk + 1) * WMFSummaryBatchChunkLength);
+                for (NSUInteger i = chunk * WMFSummaryBatchChunkLength; i < end; i++) {
+                    summaries[i] = [texts[i] wmf_summaryFromText];
+                }
+            }
+        }
+    });
+    NSArray<NSString *> *result = [NSArray arrayWithObjects:summaries count:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        summaries[i] = nil;
+    }
+    free(summaries);
+    return result;
 }
 
 - (void)wmf_enumerateHTMLImageTagContentsWithHandler:(nonnull void (^)(NSString *imageTagContents, NSRange range))handler {
@@ -199,233 +250,384 @@
                                  }];
 }
 
-- (void)wmf_enumerateHTMLTagsWithBlock:(void (^)(NSString *tagName, NSString *tagAttributes, NSRange range))block {
-    NSRegularExpression *tagRegex = [NSRegularExpression wmf_HTMLTagRegularExpression];
-    [tagRegex enumerateMatchesInString:self
-                               options:0
-                                 range:NSMakeRange(0, self.length)
-                            usingBlock:^(NSTextCheckingResult *_Nullable tagResult, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                NSString *tagName = [tagRegex replacementStringForResult:tagResult inString:self offset:0 template:@"$1"];
-                                NSString *tagAttributes = [tagRegex replacementStringForResult:tagResult inString:self offset:0 template:@"$2"];
-                                block(tagName, tagAttributes, tagResult.range);
-                            }];
+- (NSString *)wmf_stringByDecodingHTMLEntities {
+    NSUInteger length = self.length;
+    if (length == 0) {
+        return [self copy];
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, self);
+    if (WMFTextIndexOfCharacter(buffer.characters, length, 0, '&') == length) {
+        WMFTextBufferRelease(&buffer);
+        return [self copy];
+    }
+    unichar *output = WMFTextBufferTakeHeapStorage(&buffer) ?: malloc(length * sizeof(unichar));
+    NSUInteger outputLength = WMFHTMLDecodeEntities(buffer.characters, length, output);
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
 }
 
-- (void)wmf_enumerateHTMLEntitiesWithBlock:(void (^)(NSString *entityName, NSRange range))block {
-    NSRegularExpression *entityRegex = [NSRegularExpression wmf_HTMLEntityRegularExpression];
-    [entityRegex enumerateMatchesInString:self
-                                  options:0
-                                    range:NSMakeRange(0, self.length)
-                               usingBlock:^(NSTextCheckingResult *_Nullable entityResult, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                   NSString *entityName = [entityRegex replacementStringForResult:entityResult inString:self offset:0 template:@"$1"];
-                                   block(entityName, entityResult.range);
-                               }];
+static NSString *WMFStringByRemovingHTML(NSString *string, NSUInteger maximumLength) {
+    NSUInteger length = string.length;
+    if (length == 0) {
+        return [string copy];
+    }
+    if (maximumLength == 0) {
+        return @"";
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    unichar *output = malloc(MIN(length, maximumLength) * sizeof(unichar));
+    NSUInteger outputLength = WMFHTMLRemoveTagsWithMaximumLength(buffer.characters, length, maximumLength, output, NULL, NULL);
+    WMFTextBufferRelease(&buffer);
+    return [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
 }
 
-- (NSString *)wmf_stringByDecodingHTMLEntities {
-    static NSDictionary *entityReplacements;
-    static dispatch_once_t onceToken;
-    dispatch_once(&onceToken, ^{
-        entityReplacements = @{@"amp": @"&", @"nbsp": @" ", @"gt": @">", @"lt": @"<", @"apos": @"'", @"quot": @"\"", @"ndash": @"\u2013", @"mdash": @"\u2014", @"#8722": @"\u2212"};
-    });
-    NSMutableString *mutableSelf = [self mutableCopy];
-    __block NSInteger offset = 0;
-    [self wmf_enumerateHTMLEntitiesWithBlock:^(NSString *entityName, NSRange range) {
-        entityName = [entityName lowercaseString];
-        NSString *replacement = entityReplacements[entityName] ?: @"";
-        [mutableSelf replaceCharactersInRange:NSMakeRange(range.location + offset, range.length) withString:replacement];
-        offset += replacement.length - range.length;
-        ;
-    }];
-    return mutableSelf;
+- (nonnull NSString *)wmf_stringByRemovingHTML {
+    return WMFStringByRemovingHTML(self, NSUIntegerMax);
 }
 
-- (nonnull NSString *)wmf_stringByRemovingHTMLWithParsingBlock:(nullable void (^)(NSString *lowercasedHTMLTagName, BOOL isEndTag, NSString *HTMLTagAttributes, NSInteger offset, NSInteger currentLocation))parsingBlock {
-    __block NSInteger offset = 0;
+- (nonnull NSString *)wmf_stringByRemovingHTMLWithMaximumLength:(NSUInteger)maximumLength {
+    return WMFStringByRemovingHTML(self, maximumLength);
+}
 
-    NSMutableString *cleanedString = [self mutableCopy];
+#pragma mark - Attributed strings
+
+/// Tags that change how text is attributed. Tags in @c additionalTagAttributes are given the bits after these.
+typedef NS_ENUM(NSUInteger, WMFHTMLAttributedTag) {
+    WMFHTMLAttributedTagB,
+    WMFHTMLAttributedTagI,
+    WMFHTMLAttributedTagSub,
+    WMFHTMLAttributedTagSup,
+    WMFHTMLAttributedTagDel,
+    WMFHTMLAttributedTagS,
+    WMFHTMLAttributedTagU,
+    WMFHTMLAttributedTagCount
+};
+
+/// The most tags that can be told apart in a run. Additional tags past this are ignored.
+static const NSUInteger WMFHTMLAttributedTagMaximumCount = 64;
+
+static inline uint64_t WMFHTMLAttributedTagMask(NSUInteger tag) {
+    return (uint64_t)1 << tag;
+}
 
-    __block NSInteger plainTextStartLocation = 0;
-    __block NSInteger tagToRemoveStartLocation = NSNotFound;
+/// @return The bit of the attributed tag with @c tagID, or @c 0 if it isn't attributed.
+static inline uint64_t WMFHTMLAttributedTagMaskForTagID(WMFHTMLTagID tagID) {
+    switch (tagID) {
+        case WMFHTMLTagIDB:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagB);
+        case WMFHTMLTagIDI:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagI);
+        case WMFHTMLTagIDSub:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagSub);
+        case WMFHTMLTagIDSup:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagSup);
+        case WMFHTMLTagIDDel:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagDel);
+        case WMFHTMLTagIDS:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagS);
+        case WMFHTMLTagIDU:
+            return WMFHTMLAttributedTagMask(WMFHTMLAttributedTagU);
+        default:
+            return 0;
+    }
+}
 
-    static NSSet<NSString *> *tagsToRemove;
-    static dispatch_once_t tagsToRemoveOnceToken;
-    dispatch_once(&tagsToRemoveOnceToken, ^{
-        tagsToRemove = [NSSet setWithObjects:@"script", @"style", nil];
-    });
+/// A range of the text without any tags, along with the tags that were open over it.
+typedef struct {
+    NSUInteger location;
+    NSUInteger length;
+    uint64_t tags;
+    NSUInteger linkIndex;
+} WMFHTMLAttributedRun;
+
+typedef struct {
+    WMFHTMLAttributedRun *runs;
+    NSUInteger count;
+    NSUInteger capacity;
+} WMFHTMLAttributedRuns;
+
+/// Adds a run, merging it into the previous run if they touch and have the same tags and link.
+static void WMFHTMLAttributedRunsAppend(WMFHTMLAttributedRuns *runs, NSUInteger location, NSUInteger length, uint64_t tags, NSUInteger linkIndex) {
+    if (length == 0 || (tags == 0 && linkIndex == NSNotFound)) {
+        return;
+    }
+    if (runs->count > 0) {
+        WMFHTMLAttributedRun *last = &runs->runs[runs->count - 1];
+        if (last->location + last->length == location && last->tags == tags && last->linkIndex == linkIndex) {
+            last->length += length;
+            return;
+        }
+    }
+    if (runs->count == runs->capacity) {
+        runs->capacity = MAX(8, 2 * runs->capacity);
+        runs->runs = realloc(runs->runs, runs->capacity * sizeof(WMFHTMLAttributedRun));
+    }
+    runs->runs[runs->count++] = (WMFHTMLAttributedRun){location, length, tags, linkIndex};
+}
 
-    [self wmf_enumerateHTMLTagsWithBlock:^(NSString *HTMLTagName, NSString *HTMLTagAttributes, NSRange range) {
-        HTMLTagName = [HTMLTagName lowercaseString];
-        BOOL isEnd = false;
-        if ([HTMLTagName hasPrefix:@"/"]) {
-            isEnd = true;
-            HTMLTagName = [HTMLTagName substringFromIndex:1];
+/// How tags are turned into attributes. Borrows everything from the caller.
+typedef struct {
+    __unsafe_unretained UIFont *boldFont;
+    __unsafe_unretained UIFont *italicFont;
+    __unsafe_unretained UIFont *boldItalicFont;
+    __unsafe_unretained UIColor *linkColor;
+    BOOL handlingSuperSubscripts;
+} WMFHTMLAttributedStyle;
+
+/// @return @c attributes with everything the tags and link of @c run add to them.
+static NSDictionary *WMFHTMLAttributesForRun(const WMFHTMLAttributedRun *run, NSDictionary *attributes, NSMutableDictionary<NSNumber *, NSDictionary *> *attributesByTags, NSArray<NSURL *> *linkURLs, const WMFHTMLAttributedStyle *style, NSArray<NSString *> *additionalTags, const uint64_t *additionalTagMasks, NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *_Nullable additionalTagAttributes) {
+    NSNumber *key = run->linkIndex == NSNotFound ? @(run->tags) : nil;
+    NSDictionary *cachedAttributes = key ? attributesByTags[key] : nil;
+    if (cachedAttributes) {
+        return cachedAttributes;
+    }
+    NSMutableDictionary *runAttributes = [attributes mutableCopy];
+    uint64_t tags = run->tags;
+    BOOL isItalic = (tags & WMFHTMLAttributedTagMask(WMFHTMLAttributedTagI)) != 0;
+    BOOL isBold = (tags & WMFHTMLAttributedTagMask(WMFHTMLAttributedTagB)) != 0;
+    if (isItalic && isBold) {
+        runAttributes[NSFontAttributeName] = style->boldItalicFont;
+    } else if (isItalic) {
+        runAttributes[NSFontAttributeName] = style->italicFont;
+    } else if (isBold) {
+        runAttributes[NSFontAttributeName] = style->boldFont;
+    }
+    if (style->handlingSuperSubscripts) {
+        if (tags & WMFHTMLAttributedTagMask(WMFHTMLAttributedTagSup)) {
+            runAttributes[(NSString *)kCTSuperscriptAttributeName] = @1;
+        } else if (tags & WMFHTMLAttributedTagMask(WMFHTMLAttributedTagSub)) {
+            runAttributes[(NSString *)kCTSuperscriptAttributeName] = @-1;
         }
-        if ([tagsToRemove containsObject:HTMLTagName]) {
-            if (isEnd) {
-                if (tagToRemoveStartLocation != NSNotFound) {
-                    NSInteger length = range.location + range.length - tagToRemoveStartLocation;
-                    [cleanedString replaceCharactersInRange:NSMakeRange(tagToRemoveStartLocation + offset, length) withString:@""];
-                    offset -= length;
-                    tagToRemoveStartLocation = NSNotFound;
-                    return;
-                }
-                return;
-            } else {
-                tagToRemoveStartLocation = range.location;
-                return;
-            }
+        if (tags & (WMFHTMLAttributedTagMask(WMFHTMLAttributedTagDel) | WMFHTMLAttributedTagMask(WMFHTMLAttributedTagS))) {
+            runAttributes[NSStrikethroughStyleAttributeName] = @2;
         }
-        if (tagToRemoveStartLocation != NSNotFound) {
-            return;
+        if (tags & WMFHTMLAttributedTagMask(WMFHTMLAttributedTagU)) {
+            runAttributes[NSUnderlineStyleAttributeName] = @1;
         }
-        NSString *replacement = [HTMLTagName isEqualToString:@"br"] || [HTMLTagName isEqualToString:@"br/"] ? @"\n" : @"";
-        [cleanedString replaceCharactersInRange:NSMakeRange(range.location + offset, range.length) withString:replacement];
-        offset -= (range.length - replacement.length);
-
-        NSInteger currentLocation = range.location + range.length + offset;
-
-        if (currentLocation > plainTextStartLocation) {
-            NSRange plainTextRange = NSMakeRange(plainTextStartLocation, currentLocation - plainTextStartLocation);
-            NSString *plainText = [cleanedString substringWithRange:plainTextRange];
-            NSString *cleanedSubstring = [plainText wmf_stringByDecodingHTMLEntities];
-            [cleanedString replaceCharactersInRange:plainTextRange withString:cleanedSubstring];
-            NSInteger delta = cleanedSubstring.length - plainText.length;
-            offset += delta;
-            currentLocation += delta;
-            plainTextStartLocation = currentLocation;
+    }
+    if (run->linkIndex != NSNotFound) {
+        runAttributes[NSLinkAttributeName] = linkURLs[run->linkIndex];
+        if (style->linkColor) {
+            runAttributes[NSForegroundColorAttributeName] = style->linkColor;
+        }
+    }
+    for (NSUInteger i = 0; i < additionalTags.count; i++) {
+        if (tags & additionalTagMasks[i]) {
+            [runAttributes addEntriesFromDictionary:additionalTagAttributes[additionalTags[i]]];
         }
+    }
+    if (key) {
+        attributesByTags[key] = runAttributes;
+    }
+    return runAttributes;
+}
 
-        if (parsingBlock) {
-            parsingBlock(HTMLTagName, isEnd, HTMLTagAttributes, offset, currentLocation);
+static NSRegularExpression *WMFHTMLHrefRegularExpression(void) {
+    static NSRegularExpression *hrefRegex;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSString *hrefPattern = @"href[\\s]*=[\\s]*[\"']?[\\s]*((?:.(?![\"']?\\s+(?:\\S+)=|[>\"']))+.)[\\s]*[\"']?";
+        hrefRegex = [NSRegularExpression regularExpressionWithPattern:hrefPattern options:NSRegularExpressionCaseInsensitive error:nil];
+    });
+    return hrefRegex;
+}
+
+/// @return The ID of the tag named @c tagName, which is how mapped tags are matched.
+static WMFHTMLTagID WMFHTMLTagIDForString(NSString *tagName) {
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, tagName);
+    WMFHTMLTagID tagID = WMFHTMLTagIDForName(buffer.characters, WMFTextSpanMake(0, buffer.length));
+    WMFTextBufferRelease(&buffer);
+    return tagID;
+}
+
+/// Everything collected about the tags while they're removed. Borrows the objects from the caller.
+typedef struct {
+    __unsafe_unretained NSDictionary<NSString *, NSString *> *_Nullable tagMapping;
+    __unsafe_unretained NSDictionary<NSString *, NSNumber *> *additionalTagBits;
+    __unsafe_unretained NSMutableArray<NSURL *> *linkURLs;
+    BOOL handlingLinks;
+    BOOL handlingLists;
+    uint64_t currentTags;
+    NSUInteger currentLinkIndex;
+    NSUInteger runLocation;
+    WMFHTMLAttributedRuns runs;
+    WMFHTMLElementTree lists;
+} WMFHTMLAttributedParsing;
+
+static void WMFHTMLAttributedParsingTagHandler(const uint16_t *characters, const WMFHTMLTag *tag, size_t outputLength, void *context) {
+    WMFHTMLAttributedParsing *parsing = context;
+    WMFHTMLAttributedRunsAppend(&parsing->runs, parsing->runLocation, outputLength - parsing->runLocation, parsing->currentTags, parsing->currentLinkIndex);
+    parsing->runLocation = outputLength;
+
+    WMFHTMLTagID tagID = tag->tagID;
+    uint64_t tagMask = WMFHTMLAttributedTagMaskForTagID(tagID);
+    if (parsing->tagMapping.count > 0 || parsing->additionalTagBits.count > 0) {
+        // Only mapped and additional tags need the name as a string
+        NSString *tagName = [[NSString alloc] initWithCharacters:characters + tag->name.location length:tag->name.length].lowercaseString;
+        NSString *mapping = parsing->tagMapping[tagName];
+        if (mapping) {
+            tagName = mapping;
+            tagID = WMFHTMLTagIDForString(mapping);
+            tagMask = WMFHTMLAttributedTagMaskForTagID(tagID);
         }
-    }];
+        if (tagMask == 0) {
+            NSNumber *bit = parsing->additionalTagBits[tagName];
+            tagMask = bit ? WMFHTMLAttributedTagMask(bit.unsignedIntegerValue) : 0;
+        }
+    }
 
-    if (cleanedString.length > plainTextStartLocation) {
-        NSRange plainTextRange = NSMakeRange(plainTextStartLocation, cleanedString.length - plainTextStartLocation);
-        NSString *plainText = [cleanedString substringWithRange:plainTextRange];
-        NSString *cleanedSubstring = [plainText wmf_stringByDecodingHTMLEntities];
-        [cleanedString replaceCharactersInRange:plainTextRange withString:cleanedSubstring];
+    if (tag->isEndTag) {
+        if (tagID == WMFHTMLTagIDA) {
+            parsing->currentLinkIndex = NSNotFound;
+        } else if (parsing->handlingLists) {
+            WMFHTMLElementTreeHandleTag(&parsing->lists, tagID, true, outputLength);
+        }
+        parsing->currentTags &= ~tagMask;
+        return;
+    }
+    parsing->currentTags |= tagMask;
+    if (parsing->handlingLinks && tagID == WMFHTMLTagIDA) {
+        NSRegularExpression *hrefRegex = WMFHTMLHrefRegularExpression();
+        NSString *attributes = [[NSString alloc] initWithCharacters:characters + tag->attributes.location length:tag->attributes.length];
+        NSMutableArray<NSURL *> *linkURLs = parsing->linkURLs;
+        __block NSUInteger linkIndex = parsing->currentLinkIndex;
+        [hrefRegex enumerateMatchesInString:attributes
+                                    options:0
+                                      range:NSMakeRange(0, attributes.length)
+                                 usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
+                                     NSString *URLString = [hrefRegex replacementStringForResult:result inString:attributes offset:0 template:@"$1"];
+                                     if ([URLString hasPrefix:@"."] || [URLString hasPrefix:@"/"]) {
+                                         URLString = [URLString stringByAddingPercentEncodingWithAllowedCharacters:[NSCharacterSet wmf_relativePathAndFragmentAllowedCharacterSet]];
+                                     }
+                                     NSURL *linkURL = [NSURL URLWithString:URLString];
+                                     if (linkURL) {
+                                         linkIndex = linkURLs.count;
+                                         [linkURLs addObject:linkURL];
+                                     }
+                                 }];
+        parsing->currentLinkIndex = linkIndex;
+    } else if (parsing->handlingLists) {
+        WMFHTMLElementTreeHandleTag(&parsing->lists, tagID, false, outputLength);
     }
-    return cleanedString;
 }
 
-- (nonnull NSString *)wmf_stringByRemovingHTML {
-    return [self wmf_stringByRemovingHTMLWithParsingBlock:NULL];
+/// @return The bullet or number in front of @c item, which is a list item in @c lists.
+static NSString *WMFHTMLListItemPrefix(const WMFHTMLElementTree *lists, const WMFHTMLElement *item) {
+    NSMutableString *prefix = [NSMutableString stringWithCapacity:8 + item->nestingDepth * 3];
+    [prefix appendString:@"\n"];
+    for (NSUInteger i = 0; i < item->nestingDepth * 3; i++) {
+        [prefix appendString:@" "];
+    }
+    if (lists->elements[item->parent].tagID == WMFHTMLTagIDOL) {
+        [prefix appendFormat:@"%lu. ", (unsigned long)item->childIndex + 1];
+    } else {
+        [prefix appendString:@"• "];
+    }
+    return prefix;
 }
 
 - (NSMutableAttributedString *)wmf_attributedStringFromHTMLWithFont:(UIFont *)font boldFont:(nullable UIFont *)boldFont italicFont:(nullable UIFont *)italicFont boldItalicFont:(nullable UIFont *)boldItalicFont color:(nullable UIColor *)color linkColor:(nullable UIColor *)linkColor handlingLinks:(BOOL)handlingLinks handlingLists:(BOOL)handlingLists handlingSuperSubscripts:(BOOL)handlingSuperSubscripts tagMapping:(nullable NSDictionary<NSString *, NSString *> *)tagMapping additionalTagAttributes:(nullable NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *)additionalTagAttributes {
+    WMFHTMLRenderCache *cache = [WMFHTMLRenderCache sharedCache];
+    WMFHTMLRenderCacheKey *key = [[WMFHTMLRenderCacheKey alloc] initWithHTML:self font:font boldFont:boldFont italicFont:italicFont boldItalicFont:boldItalicFont color:color linkColor:linkColor handlingLinks:handlingLinks handlingLists:handlingLists handlingSuperSubscripts:handlingSuperSubscripts tagMapping:tagMapping additionalTagAttributes:additionalTagAttributes];
+    NSMutableAttributedString *attributedString = [cache attributedStringForKey:key];
+    if (attributedString) {
+        return attributedString;
+    }
+    attributedString = [self wmf_uncachedAttributedStringFromHTMLWithFont:font boldFont:boldFont italicFont:italicFont boldItalicFont:boldItalicFont color:color linkColor:linkColor handlingLinks:handlingLinks handlingLists:handlingLists handlingSuperSubscripts:handlingSuperSubscripts tagMapping:tagMapping additionalTagAttributes:additionalTagAttributes];
+    [cache setAttributedString:attributedString forKey:key];
+    return attributedString;
+}
+
+- (NSMutableAttributedString *)wmf_uncachedAttributedStringFromHTMLWithFont:(UIFont *)font boldFont:(nullable UIFont *)boldFont italicFont:(nullable UIFont *)italicFont boldItalicFont:(nullable UIFont *)boldItalicFont color:(nullable UIColor *)color linkColor:(nullable UIColor *)linkColor handlingLinks:(BOOL)handlingLinks handlingLists:(BOOL)handlingLists handlingSuperSubscripts:(BOOL)handlingSuperSubscripts tagMapping:(nullable NSDictionary<NSString *, NSString *> *)tagMapping additionalTagAttributes:(nullable NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *)additionalTagAttributes {
     boldFont = boldFont ?: font;
     italicFont = italicFont ?: font;
     boldItalicFont = boldItalicFont ?: font;
-    static NSRegularExpression *hrefRegex;
-    static dispatch_once_t hrefOnceToken;
-    dispatch_once(&hrefOnceToken, ^{
-        NSString *hrefPattern = @"href[\\s]*=[\\s]*[\"']?[\\s]*((?:.(?![\"']?\\s+(?:\\S+)=|[>\"']))+.)[\\s]*[\"']?";
-        hrefRegex = [NSRegularExpression regularExpressionWithPattern:hrefPattern options:NSRegularExpressionCaseInsensitive error:nil];
-    });
 
-    NSMutableSet<NSString *> *currentTags = [NSMutableSet setWithCapacity:2];
-    NSMutableSet<NSURL *> *currentLinks = [NSMutableSet setWithCapacity:1];
-    NSMutableArray<NSSet<NSString *> *> *tags = [NSMutableArray arrayWithCapacity:1];
-    NSMutableArray<NSSet<NSURL *> *> *links = [NSMutableArray arrayWithCapacity:1];
-
-    NSMutableArray<WMFHTMLElement *> *lists = [NSMutableArray arrayWithCapacity:1];
-    NSMutableArray<WMFHTMLElement *> *unclosedListElements = [NSMutableArray arrayWithCapacity:1];
+    // Additional tags share a bit with the tag of the same name if it already has one
+    NSArray<NSString *> *additionalTags = additionalTagAttributes.allKeys;
+    NSMutableDictionary<NSString *, NSNumber *> *additionalTagBits = [NSMutableDictionary dictionaryWithCapacity:additionalTags.count];
+    uint64_t additionalTagMasks[additionalTags.count + 1];
+    NSUInteger nextTagBit = WMFHTMLAttributedTagCount;
+    for (NSUInteger i = 0; i < additionalTags.count; i++) {
+        NSString *tag = additionalTags[i];
+        uint64_t mask = WMFHTMLAttributedTagMaskForTagID(WMFHTMLTagIDForString(tag));
+        if (mask == 0 && nextTagBit < WMFHTMLAttributedTagMaximumCount) {
+            additionalTagBits[tag] = @(nextTagBit);
+            mask = WMFHTMLAttributedTagMask(nextTagBit++);
+        }
+        additionalTagMasks[i] = mask;
+    }
 
-    NSMutableArray<NSValue *> *ranges = [NSMutableArray arrayWithCapacity:1];
-    __block NSInteger startLocation = NSNotFound;
-    NSString *cleanedString = [self wmf_stringByRemovingHTMLWithParsingBlock:^(NSString *HTMLTagName, BOOL isEndTag, NSString *HTMLTagAttributes, NSInteger offset, NSInteger currentLocation) {
-        NSString *mapping = tagMapping[HTMLTagName];
-        if (mapping) {
-            HTMLTagName = mapping;
+    NSMutableArray<NSURL *> *linkURLs = [NSMutableArray arrayWithCapacity:1];
+    WMFHTMLAttributedParsing parsing = {
+        .tagMapping = tagMapping,
+        .additionalTagBits = additionalTagBits,
+        .linkURLs = linkURLs,
+        .handlingLinks = handlingLinks,
+        .handlingLists = handlingLists,
+        .currentTags = 0,
+        .currentLinkIndex = NSNotFound,
+        .runLocation = 0,
+        .runs = {NULL, 0, 0}};
+    WMFHTMLElementTreeInit(&parsing.lists);
+
+    // Runs and lists are collected by the same pass that removes the tags
+    NSString *cleanedString = @"";
+    NSUInteger length = self.length;
+    if (length > 0) {
+        WMFTextBuffer buffer;
+        WMFTextBufferInit(&buffer, self);
+        unichar *output = malloc(length * sizeof(unichar));
+        NSUInteger outputLength = WMFHTMLRemoveTags(buffer.characters, length, output, WMFHTMLAttributedParsingTagHandler, &parsing);
+        WMFTextBufferRelease(&buffer);
+        cleanedString = [[NSString alloc] initWithCharactersNoCopy:output length:outputLength freeWhenDone:YES];
+    }
+    WMFHTMLAttributedRunsAppend(&parsing.runs, parsing.runLocation, cleanedString.length - parsing.runLocation, parsing.currentTags, parsing.currentLinkIndex);
+    WMFHTMLAttributedRuns runs = parsing.runs;
+
+    // List item prefixes and the newline after each list are inserted as the text is copied, in the order they appear.
+    // Elements are stored in the order they start, so a single loop visits every list item in text order, and each
+    // outermost list is followed by everything inside of it before the next one starts.
+    const WMFHTMLElementTree *lists = &parsing.lists;
+    NSMutableArray<NSString *> *insertions = [NSMutableArray arrayWithCapacity:lists->count];
+    NSMutableArray<NSNumber *> *insertionLocations = [NSMutableArray arrayWithCapacity:lists->count];
+    NSMutableIndexSet *listEndInsertions = [NSMutableIndexSet indexSet];
+    size_t currentRoot = WMFHTMLElementNone;
+    for (size_t i = 0; i <= lists->count; i++) {
+        if (i == lists->count || lists->elements[i].parent == WMFHTMLElementNone) {
+            if (currentRoot != WMFHTMLElementNone && lists->elements[currentRoot].endLocation != WMFHTMLElementNone) {
+                [listEndInsertions addIndex:insertions.count];
+                [insertions addObject:@"\n"];
+                [insertionLocations addObject:@(lists->elements[currentRoot].endLocation)];
+            }
+            currentRoot = i;
         }
-        if (startLocation != NSNotFound && currentLocation > startLocation) {
-            [ranges addObject:[NSValue valueWithRange:NSMakeRange(startLocation, currentLocation - startLocation)]];
-            [tags addObject:[currentTags copy]];
-            [links addObject:[currentLinks copy]];
+        if (i < lists->count && lists->elements[i].tagID == WMFHTMLTagIDLI) {
+            [insertions addObject:WMFHTMLListItemPrefix(lists, &lists->elements[i])];
+            [insertionLocations addObject:@(lists->elements[i].startLocation)];
         }
-        if (isEndTag) {
-            if ([HTMLTagName isEqualToString:@"a"]) {
-                [currentLinks removeAllObjects];
-            } else if (handlingLists && ([HTMLTagName isEqualToString:@"ul"] || [HTMLTagName isEqualToString:@"ol"] || [HTMLTagName isEqualToString:@"li"])) {
-                WMFHTMLElement *lastUnclosedListElement = nil;
-                NSInteger index = unclosedListElements.count;
-                for (WMFHTMLElement *unclosedListElement in [unclosedListElements reverseObjectEnumerator]) {
-                    index -= 1;
-                    if ([unclosedListElement.tagName isEqualToString:HTMLTagName]) {
-                        lastUnclosedListElement = unclosedListElement;
-                        break;
-                    }
-                }
-                if (lastUnclosedListElement != nil) {
-                    lastUnclosedListElement.endLocation = currentLocation;
-                    [unclosedListElements removeObjectAtIndex:index];
-                } else {
-                    assert(false);
-                }
-            }
-            [currentTags removeObject:HTMLTagName];
-            if ([currentTags count] > 0) {
-                startLocation = currentLocation;
-            } else {
-                startLocation = NSNotFound;
-            }
-        } else {
-            startLocation = currentLocation;
-            [currentTags addObject:HTMLTagName];
-            if (handlingLinks && [HTMLTagName isEqualToString:@"a"]) {
-                [hrefRegex enumerateMatchesInString:HTMLTagAttributes
-                                            options:0
-                                              range:NSMakeRange(0, HTMLTagAttributes.length)
-                                         usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
-                                             NSString *URLString = [hrefRegex replacementStringForResult:result inString:HTMLTagAttributes offset:0 template:@"$1"];
-                                             if ([URLString hasPrefix:@"."] || [URLString hasPrefix:@"/"]) {
-                                                 URLString = [URLString stringByAddingPercentEncodingWithAllowedCharacters:[NSCharacterSet wmf_relativePathAndFragmentAllowedCharacterSet]];
-                                             }
-                                             NSURL *linkURL = [NSURL URLWithString:URLString];
-                                             if (linkURL) {
-                                                 [currentLinks addObject:linkURL];
-                                             }
-                                         }];
-            } else if (handlingLists) {
-                if ([HTMLTagName isEqualToString:@"ul"] || [HTMLTagName isEqualToString:@"ol"]) {
-                    WMFHTMLElement *list = [[WMFHTMLElement alloc] initWithTagName:HTMLTagName];
-                    list.startLocation = startLocation;
-                    list.children = [NSMutableArray arrayWithCapacity:2];
-                    WMFHTMLElement *lastUnclosedListElement = unclosedListElements.lastObject;
-                    if (lastUnclosedListElement) {
-                        [lastUnclosedListElement.children addObject:list];
-                        list.nestingDepth = lastUnclosedListElement.nestingDepth + 1;
-                    } else {
-                        list.nestingDepth = 1;
-                        [lists addObject:list];
-                    }
-                    [unclosedListElements addObject:list];
-                } else if ([HTMLTagName isEqualToString:@"li"]) {
-                    WMFHTMLElement *lastUnclosedListElement = nil;
-                    NSInteger index = unclosedListElements.count;
-                    for (WMFHTMLElement *unclosedListElement in [unclosedListElements reverseObjectEnumerator]) {
-                        index -= 1;
-                        if (![unclosedListElement.tagName isEqualToString:@"li"]) {
-                            lastUnclosedListElement = unclosedListElement;
-                            break;
-                        }
-                    }
-                    if (lastUnclosedListElement == nil) {
-                        assert(false);
-                        return;
-                    }
-                    WMFHTMLElement *listItem = [[WMFHTMLElement alloc] initWithTagName:HTMLTagName];
-                    listItem.nestingDepth = lastUnclosedListElement.nestingDepth;
-                    listItem.startLocation = startLocation;
-                    listItem.children = [NSMutableArray arrayWithCapacity:2];
-                    [lastUnclosedListElement.children addObject:listItem];
-                    [unclosedListElements addObject:listItem];
-                }
-            }
+    }
+    WMFHTMLElementTreeFree(&parsing.lists);
+
+    NSString *string = cleanedString;
+    NSUInteger insertionCount = insertions.count;
+    NSUInteger *insertionFinalLocations = malloc((insertionCount + 1) * sizeof(NSUInteger));
+    if (insertionCount > 0) {
+        NSMutableString *mutableString = [NSMutableString stringWithCapacity:cleanedString.length + 8 * insertionCount];
+        NSUInteger location = 0;
+        for (NSUInteger i = 0; i < insertionCount; i++) {
+            NSUInteger insertionLocation = MIN(MAX(insertionLocations[i].unsignedIntegerValue, location), cleanedString.length);
+            insertionLocations[i] = @(insertionLocation);
+            [mutableString appendString:[cleanedString substringWithRange:NSMakeRange(location, insertionLocation - location)]];
+            insertionFinalLocations[i] = mutableString.length;
+            [mutableString appendString:insertions[i]];
+            location = insertionLocation;
         }
-    }];
+        [mutableString appendString:[cleanedString substringFromIndex:location]];
+        string = mutableString;
+    }
 
     NSMutableDictionary *attributes = [NSMutableDictionary dictionaryWithCapacity:2];
     if (font) {
@@ -434,107 +636,43 @@
     if (color) {
         [attributes setObject:color forKey:NSForegroundColorAttributeName];
     }
-    NSMutableAttributedString *attributedString = [[NSMutableAttributedString alloc] initWithString:cleanedString attributes:attributes];
-
-    NSRange matchingRange = NSMakeRange(NSNotFound, 0);
-
-    [ranges enumerateObjectsUsingBlock:^(NSValue *_Nonnull obj, NSUInteger idx, BOOL *_Nonnull stop) {
-        NSRange range = [obj rangeValue];
-        NSSet *tagsForRange = [tags objectAtIndex:idx];
-        NSSet *linksForRange = [links objectAtIndex:idx];
-        BOOL isItalic = [tagsForRange containsObject:@"i"];
-        BOOL isBold = [tagsForRange containsObject:@"b"];
-        BOOL isSubscript = [tagsForRange containsObject:@"sub"];
-        BOOL isSuperscript = [tagsForRange containsObject:@"sup"];
-        BOOL isStrikethrough = [tagsForRange containsObject:@"del"] || [tagsForRange containsObject:@"s"];
-        BOOL isUnderline = [tagsForRange containsObject:@"u"];
-        if (isItalic && isBold) {
-            [attributedString addAttribute:NSFontAttributeName value:boldItalicFont range:range];
-        } else if (isItalic) {
-            [attributedString addAttribute:NSFontAttributeName value:italicFont range:range];
-            if (matchingRange.location != NSNotFound) {
-                NSRange intersection = NSIntersectionRange(matchingRange, range);
-                if (intersection.length > 0) {
-                    [attributedString addAttribute:NSFontAttributeName value:boldItalicFont range:intersection];
-                }
-            }
-        } else if (isBold) {
-            [attributedString addAttribute:NSFontAttributeName value:boldFont range:range];
-        }
-
-        if (handlingSuperSubscripts) {
-            if (isSubscript) {
-                [attributedString addAttribute:(NSString *)kCTSuperscriptAttributeName value:[NSNumber numberWithInt:-1] range:range];
-            }
-
-            if (isSuperscript) {
-                [attributedString addAttribute:(NSString *)kCTSuperscriptAttributeName value:[NSNumber numberWithInt:1] range:range];
-            }
-
-            if (isStrikethrough) {
-                [attributedString addAttribute:NSStrikethroughStyleAttributeName value:@2 range:range];
-            }
-
-            if (isUnderline) {
-                [attributedString addAttribute:NSUnderlineStyleAttributeName value:@1 range:range];
-            }
-        }
+    NSMutableAttributedString *attributedString = [[NSMutableAttributedString alloc] initWithString:string attributes:attributes];
+    [attributedString beginEditing];
 
-        NSURL *linkURL = [linksForRange anyObject];
-        if (linkURL) {
-            [attributedString addAttribute:NSLinkAttributeName value:linkURL range:range];
-            if (linkColor) {
-                [attributedString addAttribute:NSForegroundColorAttributeName value:linkColor range:range];
-            }
+    NSDictionary *listAttributes = font != nil ? @{NSFontAttributeName: font} : @{};
+    for (NSUInteger i = 0; i < insertionCount; i++) {
+        if (![listEndInsertions containsIndex:i]) {
+            [attributedString setAttributes:listAttributes range:NSMakeRange(insertionFinalLocations[i], insertions[i].length)];
         }
+    }
 
-        for (NSString *tag in additionalTagAttributes.allKeys) {
-            if (![tagsForRange containsObject:tag]) {
-                continue;
-            }
-            NSDictionary<NSAttributedStringKey, id> *attributes = additionalTagAttributes[tag];
-            if (attributes.count == 0) {
-                continue;
+    // Runs without links mostly repeat the same few combinations of tags
+    NSMutableDictionary<NSNumber *, NSDictionary *> *runAttributesByTags = [NSMutableDictionary dictionaryWithCapacity:4];
+    WMFHTMLAttributedStyle style = {boldFont, italicFont, boldItalicFont, linkColor, handlingSuperSubscripts};
+
+    // Insertions at a run's start go in front of it and insertions inside a run split it, so shift each piece by the
+    // length of everything inserted at or before its start.
+    NSUInteger insertionIndex = 0;
+    NSUInteger insertedLength = 0;
+    for (NSUInteger i = 0; i < runs.count; i++) {
+        WMFHTMLAttributedRun *run = &runs.runs[i];
+        NSDictionary *runAttributes = WMFHTMLAttributesForRun(run, attributes, runAttributesByTags, linkURLs, &style, additionalTags, additionalTagMasks, additionalTagAttributes);
+        NSUInteger location = run->location;
+        NSUInteger end = run->location + run->length;
+        while (location < end) {
+            while (insertionIndex < insertionCount && insertionLocations[insertionIndex].unsignedIntegerValue <= location) {
+                insertedLength += insertions[insertionIndex++].length;
             }
-            [attributedString addAttributes:attributes
-                                      range:range];
+            NSUInteger pieceEnd = insertionIndex < insertionCount ? MIN(end, insertionLocations[insertionIndex].unsignedIntegerValue) : end;
+            [attributedString setAttributes:runAttributes range:NSMakeRange(location + insertedLength, pieceEnd - location)];
+            location = pieceEnd;
         }
-    }];
-
-    NSDictionary *listAttributes = font != nil ? @{NSFontAttributeName: font} : @{};
-    __block NSInteger offset = 0;
-    [lists enumerateObjectsUsingBlock:^(WMFHTMLElement *_Nonnull list, NSUInteger idx, BOOL *_Nonnull stop) {
-        offset += [attributedString performReplacementsForListElement:list currentList:list withAttributes:listAttributes listIndex:0 replacementOffset:offset];
-        NSString *newline = @"\n";
-        NSAttributedString *attributedNewline = [[NSAttributedString alloc] initWithString:newline attributes:attributes];
-        [attributedString insertAttributedString:attributedNewline atIndex:list.endLocation + offset];
-        offset += attributedNewline.length;
-    }];
+    }
+    free(runs.runs);
+    free(insertionFinalLocations);
 
+    [attributedString endEditing];
     return attributedString;
 }
 
 @end
-
-@implementation NSMutableAttributedString (WMFListHandling)
-
-- (NSInteger)performReplacementsForListElement:(nonnull WMFHTMLElement *)listElement currentList:(nullable WMFHTMLElement *)currentList withAttributes:(nullable NSDictionary *)listAttributes listIndex:(NSInteger)index replacementOffset:(NSInteger)offset {
-    __block NSInteger offsetDelta = 0;
-    if ([listElement.tagName isEqualToString:@"ul"] || [listElement.tagName isEqualToString:@"ol"]) {
-        currentList = listElement;
-    } else if (currentList && [listElement.tagName isEqualToString:@"li"]) {
-        NSString *spaces = [@"" stringByPaddingToLength:listElement.nestingDepth * 3 withString:@" " startingAtIndex:0];
-        NSString *number = [NSString stringWithFormat:@"\n%@%lu. ", spaces, index + 1];
-        NSString *bulletPoint = [NSString stringWithFormat:@"\n%@• ", spaces];
-        NSString *bulletPointOrNumberWithNewline = [currentList.tagName isEqualToString:@"ol"] ? number : bulletPoint;
-        NSAttributedString *stringToInsert = [[NSAttributedString alloc] initWithString:bulletPointOrNumberWithNewline attributes:listAttributes];
-        [self insertAttributedString:stringToInsert atIndex:listElement.startLocation + offset + offsetDelta];
-        offsetDelta += stringToInsert.length;
-    }
-    [listElement.children enumerateObjectsUsingBlock:^(WMFHTMLElement *_Nonnull obj, NSUInteger idx, BOOL *_Nonnull stop) {
-        offsetDelta += [self performReplacementsForListElement:obj currentList:currentList withAttributes:listAttributes listIndex:idx replacementOffset:offset + offsetDelta];
-    }];
-    return offsetDelta;
-}
-
-@end
@@ -230,11 +230,16 @@ extern NSString *const WMFEditPencil;
  *
  * For Core Data entities, the key and variant are maintained as separate properties.
  * The key value in database entities is the value of wmf_databaseKey.
+ *
+ * Keys are interned: there's only ever one live instance for each database key and language variant code pair, so
+ * equality and hashing are by identity and never touch the strings.
 */
-@interface WMFInMemoryURLKey : NSObject
-- (instancetype)initWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode NS_DESIGNATED_INITIALIZER;
+@interface WMFInMemoryURLKey : NSObject <NSCopying>
+/// Returns the existing key for the pair when there is one, so the receiver may be replaced.
+- (instancetype)initWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode;
 - (nullable instancetype)initWithURL:(NSURL *)url;
 - (instancetype)init NS_UNAVAILABLE;
++ (WMFInMemoryURLKey *)internedKeyWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode;
 - (BOOL)isEqualToInMemoryURLKey:(WMFInMemoryURLKey *)rhs;
 @property (readonly, nonatomic, copy) NSString *databaseKey;
 @property (readonly, nonatomic, copy, nullable) NSString *languageVariantCode;
@@ -2,12 +2,206 @@
 #import <WMF/NSURLComponents+WMFLinkParsing.h>
 #import <WMF/NSURL+WMFExtras.h>
 #import <WMF/WMF-Swift.h>
+#import <WMF/WMFTextBuffer.h>
+#import <WMF/WMFWikiURL.h>
 #import <objc/runtime.h>
 
 NSString *const WMFMediaWikiDomain = @"mediawiki.org";
 NSString *const WMFAPIPath = @"/w/api.php";
 NSString *const WMFEditPencil = @"WMFEditPencil";
 
+#pragma mark - Parsing
+
+// These run thousands of times per feed load, so wiki URLs are taken apart with WMFWikiURLParse instead of
+// NSURLComponents. The parts are parsed again on every call into a struct on the stack rather than cached on the URL,
+// since an associated object lookup costs about as much as parsing a wiki URL. Anything the parser doesn't accept
+// falls back to NSURLComponents.
+
+typedef struct {
+    WMFTextBuffer buffer;
+    WMFWikiURLParts parts;
+} WMFParsedURL;
+
+/// @return Whether or not @c URL was parsed. @c WMFParsedURLRelease only needs to be called when it was.
+static BOOL WMFParsedURLInit(WMFParsedURL *parsed, NSURL *URL) {
+    // NSURLComponents only looks at the relative part of URLs with a base URL
+    NSString *string = URL.baseURL == nil ? URL.absoluteString : nil;
+    if (string == nil) {
+        return NO;
+    }
+    WMFTextBufferInit(&parsed->buffer, string);
+    if (!WMFWikiURLParse(parsed->buffer.characters, parsed->buffer.length, &parsed->parts)) {
+        WMFTextBufferRelease(&parsed->buffer);
+        return NO;
+    }
+    return YES;
+}
+
+static void WMFParsedURLRelease(WMFParsedURL *parsed) {
+    WMFTextBufferRelease(&parsed->buffer);
+}
+
+static inline NSUInteger WMFParsedURLAppendSpan(const WMFParsedURL *parsed, WMFTextSpan span, unichar *output, NSUInteger count) {
+    memcpy(output + count, parsed->buffer.characters + span.location, span.length * sizeof(unichar));
+    return count + span.length;
+}
+
+static inline NSUInteger WMFParsedURLAppendASCII(const char *ASCIIString, unichar *output, NSUInteger count) {
+    for (const char *c = ASCIIString; *c != 0; c++) {
+        output[count++] = (unsigned char)*c;
+    }
+    return count;
+}
+
+/// @return The URL in @c parsed with everything from @c start to the end of its path replaced by @c replacement, and without anything after @c end.
+static NSURL *_Nullable WMFParsedURLReplacingThroughPath(const WMFParsedURL *parsed, NSUInteger start, const unichar *_Nullable replacement, NSUInteger replacementLength, NSUInteger end, NSString *_Nullable languageVariantCode) {
+    NSUInteger pathEnd = WMFTextSpanEnd(parsed->parts.path);
+    NSUInteger length = start + replacementLength + (end - pathEnd);
+    unichar inlineStorage[WMFTextBufferInlineCapacity];
+    unichar *characters = length <= WMFTextBufferInlineCapacity ? inlineStorage : malloc(length * sizeof(unichar));
+    NSUInteger count = WMFParsedURLAppendSpan(parsed, WMFTextSpanMake(0, start), characters, 0);
+    if (replacementLength > 0) {
+        memcpy(characters + count, replacement, replacementLength * sizeof(unichar));
+        count += replacementLength;
+    }
+    count = WMFParsedURLAppendSpan(parsed, WMFTextSpanMake(pathEnd, end - pathEnd), characters, count);
+    NSURL *URL = [NSURL URLWithString:[[NSString alloc] initWithCharacters:characters length:count]];
+    if (characters != inlineStorage) {
+        free(characters);
+    }
+    URL.wmf_languageVariantCode = languageVariantCode;
+    return URL;
+}
+
+/// @return The title in the path of @c parsed, like @c -[NSURLComponents wmf_title] or @c wmf_titleWithUnderscores. Sets @c isKnown to @c NO for paths that need NSURLComponents.
+static NSString *_Nullable WMFParsedURLTitle(const WMFParsedURL *parsed, BOOL isNormalizing, BOOL *isKnown) {
+    const WMFWikiURLParts *parts = &parsed->parts;
+    const unichar *characters = parsed->buffer.characters;
+    NSUInteger pathEnd = WMFTextSpanEnd(parts->path);
+    // NSURL drops path parameters and decodes the path before looking for /wiki/, so those are left to it
+    BOOL hasParameters = WMFTextIndexOfCharacter(characters, pathEnd, parts->path.location, ';') != pathEnd;
+    if (!parts->hasTitle) {
+        BOOL hasEscapes = WMFTextIndexOfCharacter(characters, pathEnd, parts->path.location, '%') != pathEnd;
+        *isKnown = !hasParameters && !hasEscapes;
+        return nil;
+    }
+    *isKnown = NO;
+    if (hasParameters) {
+        return nil;
+    }
+    unichar inlineStorage[WMFTextBufferInlineCapacity];
+    unichar *title = parts->title.length <= WMFTextBufferInlineCapacity ? inlineStorage : malloc(parts->title.length * sizeof(unichar));
+    size_t length = WMFWikiURLDecodeTitle(characters, parts->title, isNormalizing, title);
+    NSString *result = nil;
+    if (length != SIZE_MAX && length > 0 && title[length - 1] != '/') {
+        // NSURL removes trailing slashes, and the regular expression that finds titles doesn't match line terminators
+        BOOL isASCII = YES;
+        BOOL isMatchable = YES;
+        for (size_t i = 0; i < length && isMatchable; i++) {
+            isMatchable = title[i] >= 0x20 && !WMFWikiURLIsLineTerminator(title[i]);
+            isASCII = isASCII && title[i] < 0x80;
+        }
+        if (isMatchable) {
+            result = [[NSString alloc] initWithCharacters:title length:length];
+            if (!isASCII) {
+                result = [result precomposedStringWithCanonicalMapping];
+            }
+            *isKnown = YES;
+        }
+    }
+    if (title != inlineStorage) {
+        free(title);
+    }
+    return result;
+}
+
+static inline BOOL WMFIsPlainPathCharacter(unichar c) {
+    // Characters that NSURLComponents doesn't percent encode when setting a path, apart from ;
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || (c != 0 && c < 0x80 && strchr("-._~!$&'()*+,=:@/", c) != NULL);
+}
+
+/// @return The URL in @c parsed with its path replaced by one for @c title, like @c -[NSURLComponents setWmf_title:], or @c nil if NSURLComponents is needed.
+static NSURL *_Nullable WMFParsedURLWithTitle(const WMFParsedURL *parsed, NSString *_Nullable title, NSString *_Nullable languageVariantCode) {
+    NSUInteger end = parsed->buffer.length;
+    if (title.length == 0) {
+        return WMFParsedURLReplacingThroughPath(parsed, parsed->parts.path.location, NULL, 0, end, languageVariantCode);
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, title);
+    if (!WMFTextIsASCII(buffer.characters, buffer.length)) {
+        WMFTextBufferRelease(&buffer);
+        title = [title precomposedStringWithCanonicalMapping];
+        WMFTextBufferInit(&buffer, title);
+    }
+    NSUInteger capacity = 6 + buffer.length * WMFWikiURLEncodedTitleCharactersPerCharacter;
+    unichar inlineStorage[WMFTextBufferInlineCapacity];
+    unichar *path = capacity <= WMFTextBufferInlineCapacity ? inlineStorage : malloc(capacity * sizeof(unichar));
+    NSUInteger count = WMFParsedURLAppendASCII("/wiki/", path, 0);
+    size_t encodedLength = WMFWikiURLEncodeTitle(buffer.characters, buffer.length, path + count);
+    WMFTextBufferRelease(&buffer);
+    NSURL *URL = nil;
+    // Unpaired surrogates can't be encoded, and NSString's path joining might treat dot segments specially
+    if (encodedLength != SIZE_MAX && path[count] != '.') {
+        URL = WMFParsedURLReplacingThroughPath(parsed, parsed->parts.path.location, path, count + encodedLength, end, languageVariantCode);
+    }
+    if (path != inlineStorage) {
+        free(path);
+    }
+    return URL;
+}
+
+/// @return The URL in @c parsed with @c path and a mobile or desktop host, like @c -[NSURL wmf_URLWithPath:isMobile:], or @c nil if NSURLComponents is needed.
+static NSURL *_Nullable WMFParsedURLWithPlainPath(const WMFParsedURL *parsed, NSString *path, BOOL isMobile, NSString *_Nullable languageVariantCode) {
+    if (path == nil) {
+        return nil;
+    }
+    const WMFWikiURLParts *parts = &parsed->parts;
+    WMFTextBuffer pathBuffer;
+    WMFTextBufferInit(&pathBuffer, path);
+    // Only paths that NSURLComponents wouldn't percent encode, which are ASCII and so already precomposed
+    BOOL isPlainPath = pathBuffer.length == 0 || pathBuffer.characters[0] == '/';
+    for (NSUInteger i = 0; i < pathBuffer.length && isPlainPath; i++) {
+        isPlainPath = WMFIsPlainPathCharacter(pathBuffer.characters[i]);
+    }
+    NSURL *URL = nil;
+    if (!isPlainPath) {
+        // Left to NSURLComponents
+    } else if (isMobile == parts->wikiHost.isMobile) {
+        URL = WMFParsedURLReplacingThroughPath(parsed, parts->path.location, pathBuffer.characters, pathBuffer.length, parsed->buffer.length, languageVariantCode);
+    } else {
+        // Same host as +[NSURLComponents wmf_hostWithDomain:languageCode:isMobile:], followed by the port and the new path
+        NSUInteger capacity = parts->host.length + 2 + parts->port.length + pathBuffer.length;
+        unichar inlineStorage[WMFTextBufferInlineCapacity];
+        unichar *replacement = capacity <= WMFTextBufferInlineCapacity ? inlineStorage : malloc(capacity * sizeof(unichar));
+        NSUInteger count = 0;
+        if (parts->wikiHost.hasLanguageCode) {
+            count = WMFParsedURLAppendSpan(parsed, parts->wikiHost.languageCode, replacement, count);
+            count = WMFParsedURLAppendASCII(".", replacement, count);
+        }
+        if (isMobile) {
+            count = WMFParsedURLAppendASCII("m.", replacement, count);
+        }
+        count = WMFParsedURLAppendSpan(parsed, parts->wikiHost.domain, replacement, count);
+        count = WMFParsedURLAppendSpan(parsed, parts->port, replacement, count);
+        if (pathBuffer.length > 0) {
+            memcpy(replacement + count, pathBuffer.characters, pathBuffer.length * sizeof(unichar));
+            count += pathBuffer.length;
+        }
+        URL = WMFParsedURLReplacingThroughPath(parsed, parts->host.location, replacement, count, parsed->buffer.length, languageVariantCode);
+        if (replacement != inlineStorage) {
+            free(replacement);
+        }
+    }
+    WMFTextBufferRelease(&pathBuffer);
+    return URL;
+}
+
+/// @return The parts of @c host, split like @c WMFWikiURLHostMake. @c buffer needs to be released.
+static WMFWikiURLHost WMFWikiURLHostFromString(NSString *host, WMFTextBuffer *buffer) {
+    WMFTextBufferInit(buffer, host);
+    return WMFWikiURLHostMake(buffer->characters, WMFTextSpanMake(0, buffer->length));
+}
+
 @implementation NSURL (WMFLinkParsing)
 
 #pragma mark - Constructors
@@ -91,6 +285,14 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (NSURL *)wmf_URLWithTitle:(NSString *)title {
+    WMFParsedURL parsed;
+    if (WMFParsedURLInit(&parsed, self)) {
+        NSURL *URL = WMFParsedURLWithTitle(&parsed, title, self.wmf_languageVariantCode);
+        WMFParsedURLRelease(&parsed);
+        if (URL) {
+            return URL;
+        }
+    }
     NSURLComponents *components = [NSURLComponents componentsWithURL:self resolvingAgainstBaseURL:NO];
     components.wmf_title = title;
     return [components wmf_URLWithLanguageVariantCode:self.wmf_languageVariantCode];
@@ -111,6 +313,14 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (NSURL *)wmf_URLWithPath:(NSString *)path isMobile:(BOOL)isMobile {
+    WMFParsedURL parsed;
+    if (WMFParsedURLInit(&parsed, self)) {
+        NSURL *URL = WMFParsedURLWithPlainPath(&parsed, path, isMobile, self.wmf_languageVariantCode);
+        WMFParsedURLRelease(&parsed);
+        if (URL) {
+            return URL;
+        }
+    }
     NSURLComponents *components = [NSURLComponents componentsWithURL:self resolvingAgainstBaseURL:NO];
     components.path = [path precomposedStringWithCanonicalMapping];
     if (isMobile != self.wmf_isMobile) {
@@ -120,6 +330,17 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (NSURL *)wmf_siteURL {
+    WMFParsedURL parsed;
+    if (WMFParsedURLInit(&parsed, self)) {
+        // Everything before the path, and the query
+        const WMFWikiURLParts *parts = &parsed.parts;
+        NSUInteger end = parts->hasQuery ? WMFTextSpanEnd(parts->query) : WMFTextSpanEnd(parts->path);
+        NSURL *URL = WMFParsedURLReplacingThroughPath(&parsed, parts->path.location, NULL, 0, end, self.wmf_languageVariantCode);
+        WMFParsedURLRelease(&parsed);
+        if (URL) {
+            return URL;
+        }
+    }
     NSURLComponents *components = [NSURLComponents componentsWithURL:self resolvingAgainstBaseURL:NO];
     components.path = nil;
     components.fragment = nil;
@@ -189,16 +410,14 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (BOOL)wmf_isMobile {
-    NSArray *hostComponents = [self.host componentsSeparatedByString:@"."];
-    if (hostComponents.count < 3) {
+    NSString *host = self.host;
+    if (host == nil) {
         return NO;
-    } else {
-        if ([hostComponents[0] isEqualToString:@"m"]) {
-            return true;
-        } else {
-            return [hostComponents[1] isEqualToString:@"m"];
-        }
     }
+    WMFTextBuffer buffer;
+    BOOL isMobile = WMFWikiURLHostFromString(host, &buffer).isMobile;
+    WMFTextBufferRelease(&buffer);
+    return isMobile;
 }
 
 - (NSString *)wmf_pathWithoutWikiPrefix {
@@ -206,27 +425,27 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (NSString *)wmf_domain {
-    NSArray *hostComponents = [self.host componentsSeparatedByString:@"."];
-    if (hostComponents.count < 3) {
-        return self.host;
-    } else {
-        NSInteger firstIndex = 1;
-        if ([hostComponents[1] isEqualToString:@"m"]) {
-            firstIndex = 2;
-        }
-        NSArray *subarray = [hostComponents subarrayWithRange:NSMakeRange(firstIndex, hostComponents.count - firstIndex)];
-        return [subarray componentsJoinedByString:@"."];
+    NSString *host = self.host;
+    if (host == nil) {
+        return nil;
     }
+    WMFTextBuffer buffer;
+    WMFTextSpan domain = WMFWikiURLHostFromString(host, &buffer).domain;
+    NSString *result = domain.length == buffer.length ? host : WMFTextBufferSubstring(&buffer, domain);
+    WMFTextBufferRelease(&buffer);
+    return result;
 }
 
 - (NSString *)wmf_languageCode {
-    NSArray *hostComponents = [self.host componentsSeparatedByString:@"."];
-    if (hostComponents.count < 3) {
+    NSString *host = self.host;
+    if (host == nil) {
         return nil;
-    } else {
-        NSString *potentialLanguage = hostComponents[0];
-        return [potentialLanguage isEqualToString:@"m"] ? nil : potentialLanguage;
     }
+    WMFTextBuffer buffer;
+    WMFWikiURLHost wikiHost = WMFWikiURLHostFromString(host, &buffer);
+    NSString *languageCode = wikiHost.hasLanguageCode ? WMFTextBufferSubstring(&buffer, wikiHost.languageCode) : nil;
+    WMFTextBufferRelease(&buffer);
+    return languageCode;
 }
 
 - (NSURL *)wmf_canonicalURL {
@@ -247,11 +466,28 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
     return [components wmf_URLWithLanguageVariantCode:self.wmf_languageVariantCode];
 }
 
+static id wmf_databaseKeyAssociatedObjectKey;
 - (NSString *)wmf_databaseKey {
-    return self.wmf_databaseURL.absoluteString.precomposedStringWithCanonicalMapping;
+    // URLs are immutable and the variant code isn't part of the key, so it's worked out once per URL
+    NSString *databaseKey = objc_getAssociatedObject(self, &wmf_databaseKeyAssociatedObjectKey);
+    if (databaseKey) {
+        return databaseKey;
+    }
+    databaseKey = self.wmf_databaseURL.absoluteString.precomposedStringWithCanonicalMapping;
+    objc_setAssociatedObject(self, &wmf_databaseKeyAssociatedObjectKey, databaseKey, OBJC_ASSOCIATION_RETAIN);
+    return databaseKey;
 }
 
 - (NSString *)wmf_title {
+    WMFParsedURL parsed;
+    if (WMFParsedURLInit(&parsed, self)) {
+        BOOL isKnown = NO;
+        NSString *title = WMFParsedURLTitle(&parsed, YES, &isKnown);
+        WMFParsedURLRelease(&parsed);
+        if (isKnown) {
+            return title;
+        }
+    }
     if (![self wmf_isWikiResource]) {
         return nil;
     }
@@ -259,6 +495,15 @@ NSString *const WMFEditPencil = @"WMFEditPencil";
 }
 
 - (NSString *)wmf_titleWithUnderscores {
+    WMFParsedURL parsed;
+    if (WMFParsedURLInit(&parsed, self)) {
+        BOOL isKnown = NO;
+        NSString *title = WMFParsedURLTitle(&parsed, NO, &isKnown);
+        WMFParsedURLRelease(&parsed);
+        if (isKnown) {
+            return title;
+        }
+    }
     if (![self wmf_isWikiResource]) {
         return nil;
     }
@@ -293,39 +538,96 @@ static id wmf_languageVariantAssociatedObjectKey;
 #pragma mark - WMFInMemoryURLKey
 
 @interface WMFInMemoryURLKey ()
-@property (nonatomic, copy) NSString *databaseKey;
-@property (nonatomic, copy, nullable) NSString *languageVariantCode;
+- (instancetype)initInternedKeyWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode;
 @end
 
+/// Interned keys by database key, in a table for each variant code. Keys are held weakly and remove themselves when
+/// they're deallocated, so the tables only hold the keys that are in use.
+static NSMutableDictionary<id, NSMapTable<NSString *, WMFInMemoryURLKey *> *> *WMFInMemoryURLKeysByVariantCode(void) {
+    static NSMutableDictionary *keysByVariantCode;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        keysByVariantCode = [NSMutableDictionary dictionary];
+    });
+    return keysByVariantCode;
+}
+
+static inline id WMFInMemoryURLKeyTableKey(NSString *_Nullable languageVariantCode) {
+    // nil and empty variant codes are different keys
+    return languageVariantCode ?: [NSNull null];
+}
+
 @implementation WMFInMemoryURLKey: NSObject
--(instancetype) initWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode {
+
++ (WMFInMemoryURLKey *)internedKeyWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode {
+    NSMutableDictionary<id, NSMapTable<NSString *, WMFInMemoryURLKey *> *> *keysByVariantCode = WMFInMemoryURLKeysByVariantCode();
+    @synchronized(keysByVariantCode) {
+        id tableKey = WMFInMemoryURLKeyTableKey(languageVariantCode);
+        NSMapTable<NSString *, WMFInMemoryURLKey *> *keys = keysByVariantCode[tableKey];
+        if (!keys) {
+            keys = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsCopyIn valueOptions:NSPointerFunctionsWeakMemory];
+            keysByVariantCode[tableKey] = keys;
+        }
+        WMFInMemoryURLKey *key = [keys objectForKey:databaseKey];
+        if (!key) {
+            key = [[WMFInMemoryURLKey alloc] initInternedKeyWithDatabaseKey:databaseKey languageVariantCode:languageVariantCode];
+            [keys setObject:key forKey:key.databaseKey];
+        }
+        return key;
+    }
+}
+
+- (instancetype)initInternedKeyWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode {
     if (self = [super init]) {
-        self.databaseKey = databaseKey;
-        self.languageVariantCode = languageVariantCode;
+        // Interned keys are shared, so these never change after they're set here
+        _databaseKey = [databaseKey copy];
+        _languageVariantCode = [languageVariantCode copy];
     }
     return self;
 }
 
+- (instancetype)initWithDatabaseKey:(NSString *)databaseKey languageVariantCode:(nullable NSString *)languageVariantCode {
+    return [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:languageVariantCode];
+}
+
 -(nullable instancetype) initWithURL:(NSURL *)URL {
     NSString *databaseKey = URL.wmf_databaseKey;
     if (!databaseKey) { return nil; }
     else { return [self initWithDatabaseKey:databaseKey languageVariantCode:URL.wmf_languageVariantCode]; }
 }
 
+- (void)dealloc {
+    NSString *databaseKey = _databaseKey;
+    if (!databaseKey) {
+        return;
+    }
+    NSMutableDictionary<id, NSMapTable<NSString *, WMFInMemoryURLKey *> *> *keysByVariantCode = WMFInMemoryURLKeysByVariantCode();
+    @synchronized(keysByVariantCode) {
+        NSMapTable<NSString *, WMFInMemoryURLKey *> *keys = keysByVariantCode[WMFInMemoryURLKeyTableKey(_languageVariantCode)];
+        // The weak reference is already gone. Another key for the same pair may have been interned since then, which stays.
+        if ([keys objectForKey:databaseKey] == nil) {
+            [keys removeObjectForKey:databaseKey];
+        }
+    }
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
 - (nullable NSURL *)URL {
     NSURL *URL = [NSURL URLWithString:self.databaseKey];
     URL.wmf_languageVariantCode = self.languageVariantCode;
     return URL;
 }
 
-WMF_SYNTHESIZE_IS_EQUAL(WMFInMemoryURLKey, isEqualToInMemoryURLKey:)
-
-- (BOOL)isEqualToInMemoryURLKey:(WMFInMemoryURLKey *)rhs {
-    return WMF_RHS_PROP_EQUAL(databaseKey, isEqualToString:) && WMF_RHS_PROP_EQUAL(languageVariantCode, isEqualToString:);
+// Interned keys are equal only to themselves, so NSObject's identity hash is the right one
+- (BOOL)isEqual:(id)object {
+    return self == object;
 }
 
-- (NSUInteger)hash {
-    return self.databaseKey.hash ^ flipBitsWithAdditionalRotation(self.languageVariantCode.hash, 1); // When languageVariantCode is nil, the XOR flips the bits
+- (BOOL)isEqualToInMemoryURLKey:(WMFInMemoryURLKey *)rhs {
+    return self == rhs;
 }
 
 - (NSString *)description {
@@ -340,7 +642,11 @@ WMF_SYNTHESIZE_IS_EQUAL(WMFInMemoryURLKey, isEqualToInMemoryURLKey:)
 
 @implementation NSURL (WMFInMemoryURLKeyExtensions)
 - (nullable WMFInMemoryURLKey *)wmf_inMemoryKey {
-    return [[WMFInMemoryURLKey alloc] initWithURL:self];
+    NSString *databaseKey = self.wmf_databaseKey;
+    if (!databaseKey) {
+        return nil;
+    }
+    return [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:self.wmf_languageVariantCode];
 }
 @end
 
@@ -10,6 +10,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, copy, readwrite, nullable) NSString *wikidataDescription;
 
+/// The extract as it was received, until it has been summarized into @c snippet. Not archived.
+@property (nonatomic, copy, readonly, nullable) NSString *extract;
+
+/// Summarized from @c extract unless it has been set.
 @property (nonatomic, copy, readwrite, nullable) NSString *snippet;
 
 @property (nonatomic, copy, readwrite, nullable) NSURL *thumbnailURL;
@@ -22,6 +26,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, copy, readwrite, nonnull) NSURL *articleURL;
 
+/**
+ * Summarizes the extracts of all of @c previews at once, in parallel, so reading their @c snippet doesn't have to.
+ */
++ (void)summarizeExtractsOfPreviews:(NSArray<WMFFeedArticlePreview *> *)previews;
+
 @end
 
 @interface WMFFeedTopReadArticlePreview : WMFFeedArticlePreview
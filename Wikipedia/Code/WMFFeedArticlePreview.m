@@ -10,6 +10,7 @@ NS_ASSUME_NONNULL_BEGIN
 @implementation WMFFeedArticlePreview
 @synthesize displayTitleHTML = _displayTitleHTML;
 @synthesize displayTitle = _displayTitle;
+@synthesize snippet = _snippet;
 
 + (NSUInteger)modelVersion {
     return 5;
@@ -23,7 +24,7 @@ NS_ASSUME_NONNULL_BEGIN
              WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, imageWidth): @"originalimage.width",
              WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, imageHeight): @"originalimage.height",
              WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, wikidataDescription): @"description",
-             WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, snippet): @"extract",
+             WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, extract): @"extract",
              WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, articleURL): @[@"content_urls.desktop.page", @"lang", @"normalizedtitle"]};
 };
 
@@ -123,18 +124,46 @@ NS_ASSUME_NONNULL_BEGIN
     return _displayTitleHTML && ![_displayTitleHTML isEqualToString:@""] ? _displayTitleHTML : _displayTitle;
 }
 
-+ (NSValueTransformer *)snippetJSONTransformer {
-    return [MTLValueTransformer
-        transformerUsingForwardBlock:^NSString *(NSString *extract,
-                                                 BOOL *success,
-                                                 NSError *__autoreleasing *error) {
-            return [extract wmf_summaryFromText];
++ (MTLPropertyStorage)storageBehaviorForPropertyWithKey:(NSString *)propertyKey {
+    // The extract is only kept until it's summarized into the snippet
+    if ([propertyKey isEqualToString:WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, extract)]) {
+        return MTLPropertyStorageTransitory;
+    }
+    return [super storageBehaviorForPropertyWithKey:propertyKey];
+}
+
++ (NSDictionary *)encodingBehaviorsByPropertyKey {
+    return [[super encodingBehaviorsByPropertyKey] mtl_dictionaryByAddingEntriesFromDictionary:@{WMF_SAFE_KEYPATH(WMFFeedArticlePreview.new, extract): @(MTLModelEncodingBehaviorExcluded)}];
+}
+
+- (nullable NSString *)snippet {
+    // Summarized at most once, then the extract isn't needed anymore
+    @synchronized(self) {
+        if (!_snippet && _extract) {
+            _snippet = [_extract wmf_summaryFromText];
+            _extract = nil;
         }
-        reverseBlock:^NSString *(NSString *snippet,
-                                 BOOL *success,
-                                 NSError *__autoreleasing *error) {
-            return snippet;
-        }];
+        return _snippet;
+    }
+}
+
++ (void)summarizeExtractsOfPreviews:(NSArray<WMFFeedArticlePreview *> *)previews {
+    NSMutableArray<WMFFeedArticlePreview *> *previewsToSummarize = [NSMutableArray arrayWithCapacity:previews.count];
+    NSMutableArray<NSString *> *extracts = [NSMutableArray arrayWithCapacity:previews.count];
+    for (WMFFeedArticlePreview *preview in previews) {
+        if (preview->_snippet || !preview->_extract) {
+            continue;
+        }
+        [previewsToSummarize addObject:preview];
+        [extracts addObject:preview->_extract];
+    }
+    NSArray<NSString *> *snippets = [NSString wmf_summariesFromTexts:extracts];
+    [previewsToSummarize enumerateObjectsUsingBlock:^(WMFFeedArticlePreview *_Nonnull preview, NSUInteger idx, BOOL *_Nonnull stop) {
+        @synchronized(preview) {
+            preview->_snippet = snippets[idx];
+            preview->_extract = nil;
+        }
+    }];
 }
 
 - (BOOL)validateValue:(inout id _Nullable *_Nonnull)ioValue forKey:(NSString *)inKey error:(out NSError **)outError {
@@ -165,6 +165,8 @@ NSInteger const WMFFeedInTheNewsNotificationViewCountDays = 5;
         NSNumber *value = @(feedDay.maxAge);
         [moc wmf_setValue:value forKey:key];
 
+        [WMFFeedArticlePreview summarizeExtractsOfPreviews:[self articlePreviewsForFeedDay:feedDay]];
+
         [self saveGroupForFeaturedPreview:feedDay.featuredArticle date:date inManagedObjectContext:moc];
         [self saveGroupForTopRead:feedDay.topRead pageViews:pageViews date:date inManagedObjectContext:moc];
         [self saveGroupForPictureOfTheDay:feedDay.pictureOfTheDay date:date inManagedObjectContext:moc];
@@ -177,6 +179,19 @@ NSInteger const WMFFeedInTheNewsNotificationViewCountDays = 5;
     }];
 }
 
+/// Every article preview in @c feedDay, so their extracts can be summarized together.
+- (NSArray<WMFFeedArticlePreview *> *)articlePreviewsForFeedDay:(WMFFeedDayResponse *)feedDay {
+    NSMutableArray<WMFFeedArticlePreview *> *previews = [NSMutableArray arrayWithCapacity:64];
+    if (feedDay.featuredArticle) {
+        [previews addObject:feedDay.featuredArticle];
+    }
+    [previews addObjectsFromArray:feedDay.topRead.articlePreviews ?: @[]];
+    for (WMFFeedNewsStory *story in feedDay.newsStories) {
+        [previews addObjectsFromArray:story.articlePreviews ?: @[]];
+    }
+    return previews;
+}
+
 - (void)saveGroupForFeaturedPreview:(WMFFeedArticlePreview *)preview date:(NSDate *)date inManagedObjectContext:(NSManagedObjectContext *)moc {
     if (!preview || !date) {
         return;
@@ -0,0 +1,83 @@
+#include "WMFHTMLElementTree.h"
+#include <stdlib.h>
+#include <string.h>
+
+void WMFHTMLElementTreeInit(WMFHTMLElementTree *tree) {
+    memset(tree, 0, sizeof(*tree));
+}
+
+void WMFHTMLElementTreeFree(WMFHTMLElementTree *tree) {
+    free(tree->elements);
+    free(tree->openElements);
+    memset(tree, 0, sizeof(*tree));
+}
+
+static inline bool WMFHTMLTagIDIsList(WMFHTMLTagID tagID) {
+    return tagID == WMFHTMLTagIDUL || tagID == WMFHTMLTagIDOL;
+}
+
+static void WMFHTMLElementTreeOpen(WMFHTMLElementTree *tree, WMFHTMLTagID tagID, size_t parent, size_t location) {
+    if (tree->count == tree->capacity) {
+        tree->capacity = tree->capacity > 0 ? 2 * tree->capacity : 8;
+        tree->elements = realloc(tree->elements, tree->capacity * sizeof(WMFHTMLElement));
+    }
+    if (tree->openCount == tree->openCapacity) {
+        tree->openCapacity = tree->openCapacity > 0 ? 2 * tree->openCapacity : 8;
+        tree->openElements = realloc(tree->openElements, tree->openCapacity * sizeof(size_t));
+    }
+    size_t index = tree->count++;
+    WMFHTMLElement *element = &tree->elements[index];
+    *element = (WMFHTMLElement){
+        .tagID = tagID,
+        .nestingDepth = 1,
+        .startLocation = location,
+        .endLocation = WMFHTMLElementNone,
+        .parent = parent,
+        .firstChild = WMFHTMLElementNone,
+        .lastChild = WMFHTMLElementNone,
+        .nextSibling = WMFHTMLElementNone,
+        .childIndex = 0};
+    if (parent != WMFHTMLElementNone) {
+        WMFHTMLElement *parentElement = &tree->elements[parent];
+        element->nestingDepth = parentElement->nestingDepth + (WMFHTMLTagIDIsList(tagID) ? 1 : 0);
+        if (parentElement->lastChild == WMFHTMLElementNone) {
+            parentElement->firstChild = index;
+        } else {
+            WMFHTMLElement *previousSibling = &tree->elements[parentElement->lastChild];
+            previousSibling->nextSibling = index;
+            element->childIndex = previousSibling->childIndex + 1;
+        }
+        parentElement->lastChild = index;
+    }
+    tree->openElements[tree->openCount++] = index;
+}
+
+void WMFHTMLElementTreeHandleTag(WMFHTMLElementTree *tree, WMFHTMLTagID tagID, bool isEndTag, size_t location) {
+    if (!WMFHTMLTagIDIsList(tagID) && tagID != WMFHTMLTagIDLI) {
+        return;
+    }
+    if (isEndTag) {
+        for (size_t i = tree->openCount; i > 0; i--) {
+            size_t index = tree->openElements[i - 1];
+            if (tree->elements[index].tagID == tagID) {
+                tree->elements[index].endLocation = location;
+                memmove(tree->openElements + i - 1, tree->openElements + i, (tree->openCount - i) * sizeof(size_t));
+                tree->openCount--;
+                return;
+            }
+        }
+        return;
+    }
+    if (WMFHTMLTagIDIsList(tagID)) {
+        size_t parent = tree->openCount > 0 ? tree->openElements[tree->openCount - 1] : WMFHTMLElementNone;
+        WMFHTMLElementTreeOpen(tree, tagID, parent, location);
+        return;
+    }
+    for (size_t i = tree->openCount; i > 0; i--) {
+        size_t index = tree->openElements[i - 1];
+        if (WMFHTMLTagIDIsList(tree->elements[index].tagID)) {
+            WMFHTMLElementTreeOpen(tree, tagID, index, location);
+            return;
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#ifndef WMFHTMLElementTree_h
+#define WMFHTMLElementTree_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "WMFHTMLTokenizer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// The index used for missing parents, children and siblings, and for the end of an element that was never closed.
+#define WMFHTMLElementNone SIZE_MAX
+
+/**
+ * A list element (@c ul, @c ol or @c li) in a @c WMFHTMLElementTree.
+ *
+ * Locations are in the output of @c WMFHTMLRemoveTags, not in the HTML. Related elements are referred to by their
+ * index in the tree's @c elements.
+ */
+typedef struct {
+    WMFHTMLTagID tagID;
+    /// @c 1 for lists that aren't inside another list. List items have the same depth as their list.
+    size_t nestingDepth;
+    size_t startLocation;
+    size_t endLocation;
+    size_t parent;
+    size_t firstChild;
+    size_t lastChild;
+    size_t nextSibling;
+    /// The position of the element among its parent's children
+    size_t childIndex;
+} WMFHTMLElement;
+
+/**
+ * The lists in a piece of HTML, kept in one flat array in the order their start tags appear.
+ *
+ * Visiting them with a plain loop goes through the text from start to end. Every element after a root (an element
+ * without a parent) and before the next root is one of its descendants.
+ */
+typedef struct {
+    WMFHTMLElement *elements;
+    size_t count;
+    size_t capacity;
+    /// Indexes of the elements that haven't been closed yet, in the order they were opened.
+    size_t *openElements;
+    size_t openCount;
+    size_t openCapacity;
+} WMFHTMLElementTree;
+
+extern void WMFHTMLElementTreeInit(WMFHTMLElementTree *tree);
+
+extern void WMFHTMLElementTreeFree(WMFHTMLElementTree *tree);
+
+/**
+ * Adds or closes an element if @c tagID is a @c ul, @c ol or @c li tag. Everything else is ignored.
+ *
+ * Meant to be called from a @c WMFHTMLTagHandler so that the tree is built while tags are removed. List items are
+ * children of the innermost open list and are dropped if there isn't one. An end tag closes the innermost open
+ * element with the same name, leaving anything opened after it open, and is ignored if there isn't one.
+ *
+ * @param location The location of the tag in the output.
+ */
+extern void WMFHTMLElementTreeHandleTag(WMFHTMLElementTree *tree, WMFHTMLTagID tagID, bool isEndTag, size_t location);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,2343 @@
+// This file is generated by scripts/generate_html_entity_table. Don't try to edit directly.
+
+#ifndef WMFHTMLEntityTable_h
+#define WMFHTMLEntityTable_h
+
+enum {
+    WMFHTMLEntityCount = 2125,
+    WMFHTMLEntityBucketCount = 532,
+    WMFHTMLEntityNameMaximumLength = 31
+};
+
+static const char WMFHTMLEntityNames[] =
+    "AEligAMPAacuteAbreveAcircAcyAfrAgraveAlphaAmacrAndAogonAopfApplyFunctionAringAscrAssignAtildeAuml"
+    "BackslashBarvBarwedBcyBecauseBernoullisBetaBfrBopfBreveBscrBumpeqCHcyCOPYCacuteCap"
+    "CapitalDifferentialDCayleysCcaronCcedilCcircCconintCdotCedillaCenterDotCfrChiCircleDotCircleMinus"
+    "CirclePlusCircleTimesClockwiseContourIntegralCloseCurlyDoubleQuoteCloseCurlyQuoteColonColone"
+    "CongruentConintContourIntegralCopfCoproductCounterClockwiseContourIntegralCrossCscrCupCupCapDD"
+    "DDotrahdDJcyDScyDZcyDaggerDarrDashvDcaronDcyDelDeltaDfrDiacriticalAcuteDiacriticalDot"
+    "DiacriticalDoubleAcuteDiacriticalGraveDiacriticalTildeDiamondDifferentialDDopfDotDotDotDotEqual"
+    "DoubleContourIntegralDoubleDotDoubleDownArrowDoubleLeftArrowDoubleLeftRightArrowDoubleLeftTee"
+    "DoubleLongLeftArrowDoubleLongLeftRightArrowDoubleLongRightArrowDoubleRightArrowDoubleRightTee"
+    "DoubleUpArrowDoubleUpDownArrowDoubleVerticalBarDownArrowDownArrowBarDownArrowUpArrowDownBreve"
+    "DownLeftRightVectorDownLeftTeeVectorDownLeftVectorDownLeftVectorBarDownRightTeeVectorDownRightVector"
+    "DownRightVectorBarDownTeeDownTeeArrowDownarrowDscrDstrokENGETHEacuteEcaronEcircEcyEdotEfrEgrave"
+    "ElementEmacrEmptySmallSquareEmptyVerySmallSquareEogonEopfEpsilonEqualEqualTildeEquilibriumEscrEsim"
+    "EtaEumlExistsExponentialEFcyFfrFilledSmallSquareFilledVerySmallSquareFopfForAllFouriertrfFscrGJcyGT"
+    "GammaGammadGbreveGcedilGcircGcyGdotGfrGgGopfGreaterEqualGreaterEqualLessGreaterFullEqual"
+    "GreaterGreaterGreaterLessGreaterSlantEqualGreaterTildeGscrGtHARDcyHacekHatHcircHfrHilbertSpaceHopf"
+    "HorizontalLineHscrHstrokHumpDownHumpHumpEqualIEcyIJligIOcyIacuteIcircIcyIdotIfrIgraveImImacr"
+    "ImaginaryIImpliesIntIntegralIntersectionInvisibleCommaInvisibleTimesIogonIopfIotaIscrItildeIukcyIuml"
+    "JcircJcyJfrJopfJscrJsercyJukcyKHcyKJcyKappaKcedilKcyKfrKopfKscrLJcyLTLacuteLambdaLangLaplacetrfLarr"
+    "LcaronLcedilLcyLeftAngleBracketLeftArrowLeftArrowBarLeftArrowRightArrowLeftCeilingLeftDoubleBracket"
+    "LeftDownTeeVectorLeftDownVectorLeftDownVectorBarLeftFloorLeftRightArrowLeftRightVectorLeftTee"
+    "LeftTeeArrowLeftTeeVectorLeftTriangleLeftTriangleBarLeftTriangleEqualLeftUpDownVectorLeftUpTeeVector"
+    "LeftUpVectorLeftUpVectorBarLeftVectorLeftVectorBarLeftarrowLeftrightarrowLessEqualGreater"
+    "LessFullEqualLessGreaterLessLessLessSlantEqualLessTildeLfrLlLleftarrowLmidotLongLeftArrow"
+    "LongLeftRightArrowLongRightArrowLongleftarrowLongleftrightarrowLongrightarrowLopfLowerLeftArrow"
+    "LowerRightArrowLscrLshLstrokLtMapMcyMediumSpaceMellintrfMfrMinusPlusMopfMscrMuNJcyNacuteNcaronNcedil"
+    "NcyNegativeMediumSpaceNegativeThickSpaceNegativeThinSpaceNegativeVeryThinSpaceNestedGreaterGreater"
+    "NestedLessLessNewLineNfrNoBreakNonBreakingSpaceNopfNotNotCongruentNotCupCapNotDoubleVerticalBar"
+    "NotElementNotEqualNotEqualTildeNotExistsNotGreaterNotGreaterEqualNotGreaterFullEqual"
+    "NotGreaterGreaterNotGreaterLessNotGreaterSlantEqualNotGreaterTildeNotHumpDownHumpNotHumpEqual"
+    "NotLeftTriangleNotLeftTriangleBarNotLeftTriangleEqualNotLessNotLessEqualNotLessGreaterNotLessLess"
+    "NotLessSlantEqualNotLessTildeNotNestedGreaterGreaterNotNestedLessLessNotPrecedesNotPrecedesEqual"
+    "NotPrecedesSlantEqualNotReverseElementNotRightTriangleNotRightTriangleBarNotRightTriangleEqual"
+    "NotSquareSubsetNotSquareSubsetEqualNotSquareSupersetNotSquareSupersetEqualNotSubsetNotSubsetEqual"
+    "NotSucceedsNotSucceedsEqualNotSucceedsSlantEqualNotSucceedsTildeNotSupersetNotSupersetEqualNotTilde"
+    "NotTildeEqualNotTildeFullEqualNotTildeTildeNotVerticalBarNscrNtildeNuOEligOacuteOcircOcyOdblacOfr"
+    "OgraveOmacrOmegaOmicronOopfOpenCurlyDoubleQuoteOpenCurlyQuoteOrOscrOslashOtildeOtimesOumlOverBar"
+    "OverBraceOverBracketOverParenthesisPartialDPcyPfrPhiPiPlusMinusPoincareplanePopfPrPrecedes"
+    "PrecedesEqualPrecedesSlantEqualPrecedesTildePrimeProductProportionProportionalPscrPsiQUOTQfrQopfQscr"
+    "RBarrREGRacuteRangRarrRarrtlRcaronRcedilRcyReReverseElementReverseEquilibriumReverseUpEquilibriumRfr"
+    "RhoRightAngleBracketRightArrowRightArrowBarRightArrowLeftArrowRightCeilingRightDoubleBracket"
+    "RightDownTeeVectorRightDownVectorRightDownVectorBarRightFloorRightTeeRightTeeArrowRightTeeVector"
+    "RightTriangleRightTriangleBarRightTriangleEqualRightUpDownVectorRightUpTeeVectorRightUpVector"
+    "RightUpVectorBarRightVectorRightVectorBarRightarrowRopfRoundImpliesRrightarrowRscrRshRuleDelayed"
+    "SHCHcySHcySOFTcySacuteScScaronScedilScircScySfrShortDownArrowShortLeftArrowShortRightArrow"
+    "ShortUpArrowSigmaSmallCircleSopfSqrtSquareSquareIntersectionSquareSubsetSquareSubsetEqual"
+    "SquareSupersetSquareSupersetEqualSquareUnionSscrStarSubSubsetSubsetEqualSucceedsSucceedsEqual"
+    "SucceedsSlantEqualSucceedsTildeSuchThatSumSupSupersetSupersetEqualSupsetTHORNTRADETSHcyTScyTabTau"
+    "TcaronTcedilTcyTfrThereforeThetaThickSpaceThinSpaceTildeTildeEqualTildeFullEqualTildeTildeTopf"
+    "TripleDotTscrTstrokUacuteUarrUarrocirUbrcyUbreveUcircUcyUdblacUfrUgraveUmacrUnderBarUnderBrace"
+    "UnderBracketUnderParenthesisUnionUnionPlusUogonUopfUpArrowUpArrowBarUpArrowDownArrowUpDownArrow"
+    "UpEquilibriumUpTeeUpTeeArrowUparrowUpdownarrowUpperLeftArrowUpperRightArrowUpsiUpsilonUringUscr"
+    "UtildeUumlVDashVbarVcyVdashVdashlVeeVerbarVertVerticalBarVerticalLineVerticalSeparatorVerticalTilde"
+    "VeryThinSpaceVfrVopfVscrVvdashWcircWedgeWfrWopfWscrXfrXiXopfXscrYAcyYIcyYUcyYacuteYcircYcyYfrYopf"
+    "YscrYumlZHcyZacuteZcaronZcyZdotZeroWidthSpaceZetaZfrZopfZscraacuteabreveacacEacdacircacuteacyaeligaf"
+    "afragravealefsymalephalphaamacramalgampandandandanddandslopeandvangangeangleangmsdangmsdaaangmsdab"
+    "angmsdacangmsdadangmsdaeangmsdafangmsdagangmsdahangrtangrtvbangrtvbdangsphangstangzarraogonaopfapapE"
+    "apacirapeapidaposapproxapproxeqaringascrastasympasympeqatildeaumlawconintawintbNotbackcong"
+    "backepsilonbackprimebacksimbacksimeqbarveebarwedbarwedgebbrkbbrktbrkbcongbcybdquobecausbecause"
+    "bemptyvbepsibernoubetabethbetweenbfrbigcapbigcircbigcupbigodotbigoplusbigotimesbigsqcupbigstar"
+    "bigtriangledownbigtriangleupbiguplusbigveebigwedgebkarowblacklozengeblacksquareblacktriangle"
+    "blacktriangledownblacktriangleleftblacktrianglerightblankblk12blk14blk34blockbnebnequivbnotbopfbot"
+    "bottombowtieboxDLboxDRboxDlboxDrboxHboxHDboxHUboxHdboxHuboxULboxURboxUlboxUrboxVboxVHboxVLboxVRboxVh"
+    "boxVlboxVrboxboxboxdLboxdRboxdlboxdrboxhboxhDboxhUboxhdboxhuboxminusboxplusboxtimesboxuLboxuRboxul"
+    "boxurboxvboxvHboxvLboxvRboxvhboxvlboxvrbprimebrevebrvbarbscrbsemibsimbsimebsolbsolbbsolhsubbull"
+    "bulletbumpbumpEbumpebumpeqcacutecapcapandcapbrcupcapcapcapcupcapdotcapscaretcaronccapsccaronccedil"
+    "ccircccupsccupssmcdotcedilcemptyvcentcenterdotcfrchcycheckcheckmarkchicircirEcirccirceq"
+    "circlearrowleftcirclearrowrightcircledRcircledScircledastcircledcirccircleddashcirecirfnintcirmid"
+    "cirscirclubsclubsuitcoloncolonecoloneqcommacommatcompcompfncomplementcomplexescongcongdotconintcopf"
+    "coprodcopycopysrcrarrcrosscscrcsubcsubecsupcsupectdotcudarrlcudarrrcueprcuesccularrcularrpcup"
+    "cupbrcapcupcapcupcupcupdotcuporcupscurarrcurarrmcurlyeqpreccurlyeqsucccurlyveecurlywedgecurren"
+    "curvearrowleftcurvearrowrightcuveecuwedcwconintcwintcylctydArrdHardaggerdalethdarrdashdashvdbkarow"
+    "dblacdcarondcyddddaggerddarrddotseqdegdeltademptyvdfishtdfrdharldharrdiamdiamonddiamondsuitdiamsdie"
+    "digammadisindivdividedivideontimesdivonxdjcydlcorndlcropdollardopfdotdoteqdoteqdotdotminusdotplus"
+    "dotsquaredoublebarwedgedownarrowdowndownarrowsdownharpoonleftdownharpoonrightdrbkarowdrcorndrcrop"
+    "dscrdscydsoldstrokdtdotdtridtrifduarrduhardwangledzcydzigrarreDDoteDoteacuteeasterecaronecirecirc"
+    "ecolonecyedoteeefDotefregegraveegsegsdotelelintersellelselsdotemacremptyemptysetemptyvemspemsp13"
+    "emsp14engenspeogoneopfepareparsleplusepsiepsilonepsiveqcirceqcoloneqsimeqslantgtreqslantlessequals"
+    "equestequivequivDDeqvparslerDoterarrescresdotesimetaetheumleuroexclexistexpectationexponentiale"
+    "fallingdotseqfcyfemaleffiligffligfflligffrfiligfjligflatflligfltnsfnoffopfforallforkforkvfpartint"
+    "frac12frac13frac14frac15frac16frac18frac23frac25frac34frac35frac38frac45frac56frac58frac78fraslfrown"
+    "fscrgEgElgacutegammagammadgapgbrevegcircgcygdotgegelgeqgeqqgeqslantgesgesccgesdotgesdotogesdotolgesl"
+    "geslesgfrggggggimelgjcyglglEglagljgnEgnapgnapproxgnegneqgneqqgnsimgopfgravegscrgsimgsimegsimlgtgtcc"
+    "gtcirgtdotgtlPargtquestgtrapproxgtrarrgtrdotgtreqlessgtreqqlessgtrlessgtrsimgvertneqqgvnEhArrhairsp"
+    "halfhamilthardcyharrharrcirharrwhbarhcircheartsheartsuithellipherconhfrhksearowhkswarowhoarrhomtht"
+    "hookleftarrowhookrightarrowhopfhorbarhscrhslashhstrokhybullhypheniacuteicicircicyiecyiexcliffifr"
+    "igraveiiiiiintiiintiinfiniiotaijligimacrimageimaglineimagpartimathimofimpedinincareinfininfintie"
+    "inodotintintcalintegersintercalintlarhkintprodiocyiogoniopfiotaiprodiquestiscrisinisinEisindotisins"
+    "isinsvisinvititildeiukcyiumljcircjcyjfrjmathjopfjscrjsercyjukcykappakappavkcedilkcykfrkgreenkhcykjcy"
+    "kopfkscrlAarrlArrlAtaillBarrlElEglHarlacutelaemptyvlagranlambdalanglangdlanglelaplaquolarrlarrb"
+    "larrbfslarrfslarrhklarrlplarrpllarrsimlarrtllatlataillatelateslbarrlbbrklbracelbracklbrkelbrksld"
+    "lbrkslulcaronlcedillceillcublcyldcaldquoldquorldrdharldrusharldshleleftarrowleftarrowtail"
+    "leftharpoondownleftharpoonupleftleftarrowsleftrightarrowleftrightarrowsleftrightharpoons"
+    "leftrightsquigarrowleftthreetimeslegleqleqqleqslantleslescclesdotlesdotolesdotorlesglesgeslessapprox"
+    "lessdotlesseqgtrlesseqqgtrlessgtrlesssimlfishtlfloorlfrlglgElhardlharulharullhblkljcyllllarrllcorner"
+    "llhardlltrilmidotlmoustlmoustachelnElnaplnapproxlnelneqlneqqlnsimloangloarrlobrklongleftarrow"
+    "longleftrightarrowlongmapstolongrightarrowlooparrowleftlooparrowrightloparlopflopluslotimeslowast"
+    "lowbarlozlozengelozflparlparltlrarrlrcornerlrharlrhardlrmlrtrilsaquolscrlshlsimlsimelsimglsqblsquo"
+    "lsquorlstrokltltccltcirltdotlthreeltimesltlarrltquestltrParltriltrieltriflurdsharluruharlvertneqq"
+    "lvnEmDDotmacrmalemaltmaltesemapmapstomapstodownmapstoleftmapstoupmarkermcommamcymdashmeasuredangle"
+    "mfrmhomicromidmidastmidcirmiddotminusminusbminusdminusdumlcpmldrmnplusmodelsmopfmpmscrmstposmu"
+    "multimapmumapnGgnGtnGtvnLeftarrownLeftrightarrownLlnLtnLtvnRightarrownVDashnVdashnablanacutenangnap"
+    "napEnapidnaposnapproxnaturnaturalnaturalsnbspnbumpnbumpencapncaronncedilncongncongdotncupncyndashne"
+    "neArrnearhknearrnearrownedotnequivnesearnesimnexistnexistsnfrngEngengeqngeqqngeqslantngesngsimngt"
+    "ngtrnhArrnharrnhparninisnisdnivnjcynlArrnlEnlarrnldrnlenleftarrownleftrightarrownleqnleqqnleqslant"
+    "nlesnlessnlsimnltnltrinltrienmidnopfnotnotinnotinEnotindotnotinvanotinvbnotinvcnotninotnivanotnivb"
+    "notnivcnparnparallelnparslnpartnpolintnprnprcuenprenprecnpreceqnrArrnrarrnrarrcnrarrwnrightarrow"
+    "nrtrinrtrienscnsccuenscenscrnshortmidnshortparallelnsimnsimensimeqnsmidnsparnsqsubensqsupensubnsubE"
+    "nsubensubsetnsubseteqnsubseteqqnsuccnsucceqnsupnsupEnsupensupsetnsupseteqnsupseteqqntglntildentlg"
+    "ntriangleleftntrianglelefteqntrianglerightntrianglerighteqnunumnumeronumspnvDashnvHarrnvapnvdashnvge"
+    "nvgtnvinfinnvlArrnvlenvltnvltrienvrArrnvrtrienvsimnwArrnwarhknwarrnwarrownwnearoSoacuteoastocirocirc"
+    "ocyodashodblacodivodotodsoldoeligofcirofrogonograveogtohbarohmointolarrolcirolcrossolineoltomacr"
+    "omegaomicronomidominusoopfoparoperpoplusororarrordorderorderofordfordmorigoforororslopeorvoscroslash"
+    "osolotildeotimesotimesasoumlovbarparparaparallelparsimparslpartpcypercntperiodpermilperppertenkpfr"
+    "phiphivphmmatphonepipitchforkpivplanckplanckhplankvplusplusacirplusbpluscirplusdoplusdupluseplusmn"
+    "plussimplustwopmpointintpopfpoundprprEprapprcuepreprecprecapproxpreccurlyeqpreceqprecnapproxprecneqq"
+    "precnsimprecsimprimeprimesprnEprnapprnsimprodprofalarproflineprofsurfpropproptoprsimprurelpscrpsi"
+    "puncspqfrqintqopfqprimeqscrquaternionsquatintquestquesteqquotrAarrrArrrAtailrBarrrHarraceracuteradic"
+    "raemptyvrangrangdrangerangleraquorarrrarraprarrbrarrbfsrarrcrarrfsrarrhkrarrlprarrplrarrsimrarrtl"
+    "rarrwratailratiorationalsrbarrrbbrkrbracerbrackrbrkerbrksldrbrkslurcaronrcedilrceilrcubrcyrdca"
+    "rdldharrdquordquorrdshrealrealinerealpartrealsrectregrfishtrfloorrfrrhardrharurharulrhorhov"
+    "rightarrowrightarrowtailrightharpoondownrightharpoonuprightleftarrowsrightleftharpoons"
+    "rightrightarrowsrightsquigarrowrightthreetimesringrisingdotseqrlarrrlharrlmrmoustrmoustachernmid"
+    "roangroarrrobrkroparropfroplusrotimesrparrpargtrppolintrrarrrsaquorscrrshrsqbrsquorsquorrthreertimes"
+    "rtrirtriertrifrtriltriruluharrxsacutesbquoscscEscapscaronsccuescescedilscircscnEscnapscnsimscpolint"
+    "scsimscysdotsdotbsdoteseArrsearhksearrsearrowsectsemiseswarsetminussetmnsextsfrsfrownsharpshchcyshcy"
+    "shortmidshortparallelshysigmasigmafsigmavsimsimdotsimesimeqsimgsimgEsimlsimlEsimnesimplussimrarr"
+    "slarrsmallsetminussmashpsmeparslsmidsmilesmtsmtesmtessoftcysolsolbsolbarsopfspadesspadesuitsparsqcap"
+    "sqcapssqcupsqcupssqsubsqsubesqsubsetsqsubseteqsqsupsqsupesqsupsetsqsupseteqsqusquaresquarfsqufsrarr"
+    "sscrssetmnssmilesstarfstarstarfstraightepsilonstraightphistrnssubsubEsubdotsubesubedotsubmultsubnE"
+    "subnesubplussubrarrsubsetsubseteqsubseteqqsubsetneqsubsetneqqsubsimsubsubsubsupsuccsuccapprox"
+    "succcurlyeqsucceqsuccnapproxsuccneqqsuccnsimsuccsimsumsungsupsup1sup2sup3supEsupdotsupdsubsupe"
+    "supedotsuphsolsuphsubsuplarrsupmultsupnEsupnesupplussupsetsupseteqsupseteqqsupsetneqsupsetneqqsupsim"
+    "supsubsupsupswArrswarhkswarrswarrowswnwarszligtargettautbrktcarontcediltcytdottelrectfrthere4"
+    "thereforethetathetasymthetavthickapproxthicksimthinspthkapthksimthorntildetimestimesbtimesbartimesd"
+    "tinttoeatoptopbottopcirtopftopforktosatprimetradetriangletriangledowntrianglelefttrianglelefteq"
+    "triangleqtrianglerighttrianglerighteqtridottrietriminustriplustrisbtritimetrpeziumtscrtscytshcy"
+    "tstroktwixttwoheadleftarrowtwoheadrightarrowuArruHaruacuteuarrubrcyubreveucircucyudarrudblacudhar"
+    "ufishtufrugraveuharluharruhblkulcornulcornerulcropultriumacrumluogonuopfuparrowupdownarrow"
+    "upharpoonleftupharpoonrightuplusupsiupsihupsilonupuparrowsurcornurcornerurcropuringurtriuscrutdot"
+    "utildeutriutrifuuarruumluwanglevArrvBarvBarvvDashvangrtvarepsilonvarkappavarnothingvarphivarpi"
+    "varproptovarrvarrhovarsigmavarsubsetneqvarsubsetneqqvarsupsetneqvarsupsetneqqvarthetavartriangleleft"
+    "vartrianglerightvcyvdashveeveebarveeeqvellipverbarvertvfrvltrivnsubvnsupvopfvpropvrtrivscrvsubnE"
+    "vsubnevsupnEvsupnevzigzagwcircwedbarwedgewedgeqweierpwfrwopfwpwrwreathwscrxcapxcircxcupxdtrixfrxhArr"
+    "xharrxixlArrxlarrxmapxnisxodotxopfxoplusxotimexrArrxrarrxscrxsqcupxuplusxutrixveexwedgeyacuteyacy"
+    "ycircycyyenyfryicyyopfyscryucyyumlzacutezcaronzcyzdotzeetrfzetazfrzhcyzigrarrzopfzscrzwjzwnj";
+
+static const uint16_t WMFHTMLEntitySeeds[WMFHTMLEntityBucketCount] = {
+    185, 6, 10, 142, 49, 165, 22, 101, 60, 27, 64, 81,
+    230, 121, 157, 38, 105, 16, 8, 69, 66, 2, 2, 15,
+    39, 12, 2, 7, 49, 1, 1, 1, 38, 6, 84, 26,
+    6, 127, 10, 38, 4, 41, 2, 34, 5, 16, 12, 9,
+    68, 74, 16, 3, 47, 8, 3, 2, 1, 21, 27, 3,
+    296, 0, 2, 17, 148, 7, 13, 69, 11, 284, 22, 2,
+    97, 13, 5, 2, 21, 3, 77, 13, 78, 152, 138, 64,
+    4, 1, 7, 17, 3, 13, 113, 20, 67, 1, 0, 80,
+    43, 0, 151, 171, 659, 1, 4, 215, 1, 12, 1, 2,
+    102, 24, 4, 91, 3, 3, 15, 161, 413, 893, 46, 6,
+    203, 59, 2, 10, 1, 106, 25, 3, 145, 0, 28, 15,
+    59, 133, 2, 10, 1, 31, 0, 24, 91, 149, 17, 28,
+    4, 12, 39, 5, 228, 77, 14, 57, 9, 545, 85, 2,
+    152, 46, 126, 18, 14, 328, 93, 6, 57, 67, 111, 203,
+    1, 247, 1, 7, 28, 1, 16, 74, 51, 8, 48, 5,
+    2, 8, 128, 8, 86, 21, 36, 62, 3, 476, 4, 135,
+    1, 11, 49, 99, 45, 54, 44, 84, 4, 57, 78, 15,
+    162, 8, 199, 3, 1, 69, 10, 25, 44, 270, 167, 1,
+    750, 6, 680, 194, 367, 345, 288, 103, 21, 32, 4, 93,
+    172, 0, 52, 396, 485, 5, 10, 33, 5, 28, 14, 14,
+    2, 162, 182, 28, 42, 17, 2, 21, 14, 102, 133, 75,
+    1, 205, 244, 37, 9, 66, 73, 72, 18, 10, 99, 4,
+    102, 4, 20, 301, 346, 69, 268, 14, 27, 15, 290, 125,
+    14, 26, 16, 2, 124, 28, 260, 195, 60, 23, 9, 999,
+    52, 36, 10, 22, 11, 293, 3, 33, 334, 7, 28, 139,
+    78, 16, 13, 380, 51, 38, 55, 187, 425, 1, 334, 461,
+    13, 62, 2, 304, 94, 34, 103, 140, 36, 1, 25, 146,
+    105, 26, 6, 269, 2, 2, 21, 569, 167, 21, 16, 115,
+    2, 505, 8, 44, 25, 409, 238, 41, 39, 13, 74, 141,
+    17, 18, 13, 305, 14, 2, 4, 17, 329, 113, 175, 28,
+    144, 40, 638, 1529, 270, 86, 257, 21, 91, 270, 63, 76,
+    3, 5, 14, 119, 82, 200, 447, 237, 71, 62, 120, 5,
+    6, 61, 408, 9, 1, 161, 16, 2984, 450, 131, 76, 454,
+    83, 299, 184, 25, 1, 246, 68, 450, 15, 38, 261, 2,
+    254, 3, 1226, 36, 685, 153, 1, 20, 20, 580, 307, 5,
+    356, 52, 964, 65, 131, 1, 26, 15, 105, 208, 35, 159,
+    2, 98, 39, 261, 89, 1, 169, 109, 92, 51, 178, 30,
+    94, 62, 184, 17, 467, 272, 1, 232, 948, 58, 45, 141,
+    52, 8, 1176, 1095, 83, 65, 87, 132, 1657, 35, 1067, 13,
+    100, 90, 81, 3869, 640, 501, 118, 24, 5, 171, 487, 79,
+    202, 99, 364, 14, 1286, 48, 2157, 728, 1192, 292, 10, 123,
+    3213, 8524, 587, 831, 29, 2, 128, 243, 201, 842, 108, 72,
+    526, 393, 2407, 150, 31, 0, 318, 1370, 170, 1, 80, 84,
+    74, 328, 76, 2378, 8305, 1193, 634, 3, 184, 747, 95, 54,
+    34, 1070, 614, 368,
+};
+
+typedef struct {
+    uint16_t nameOffset;
+    uint8_t nameLength;
+    uint8_t valueLength;
+    uint16_t value[2];
+} WMFHTMLEntityTableEntry;
+
+static const WMFHTMLEntityTableEntry WMFHTMLEntityTable[WMFHTMLEntityCount] = {
+    {6534, 7, 1, {0x2A6D, 0x0000}}, // congdot
+    {4617, 10, 1, {0x2248, 0x0000}}, // TildeTilde
+    {7279, 3, 1, {0x2A95, 0x0000}}, // els
+    {13982, 7, 1, {0x21DD, 0x0000}}, // zigrarr
+    {11438, 5, 1, {0x290D, 0x0000}}, // rbarr
+    {5474, 8, 1, {0x2233, 0x0000}}, // awconint
+    {362, 6, 1, {0x2A74, 0x0000}}, // Colone
+    {3591, 13, 1, {0x2AAF, 0x0000}}, // PrecedesEqual
+    {13989, 4, 2, {0xD835, 0xDD6B}}, // zopf
+    {1103, 4, 1, {0x0116, 0x0000}}, // Edot
+    {474, 4, 1, {0x0405, 0x0000}}, // DScy
+    {8179, 2, 1, {0x2063, 0x0000}}, // ic
+    {9059, 8, 1, {0x231E, 0x0000}}, // llcorner
+    {5400, 4, 2, {0xD835, 0xDD52}}, // aopf
+    {4838, 10, 1, {0x21A5, 0x0000}}, // UpTeeArrow
+    {4330, 17, 1, {0x2291, 0x0000}}, // SquareSubsetEqual
+    {7921, 6, 1, {0x2995, 0x0000}}, // gtlPar
+    {13101, 7, 1, {0x2A39, 0x0000}}, // triplus
+    {5171, 6, 1, {0x00E1, 0x0000}}, // aacute
+    {4866, 14, 1, {0x2196, 0x0000}}, // UpperLeftArrow
+    {7195, 4, 1, {0x2251, 0x0000}}, // eDot
+    {4290, 4, 1, {0x221A, 0x0000}}, // Sqrt
+    {9815, 5, 1, {0x2247, 0x0000}}, // ncong
+    {4702, 5, 1, {0x016A, 0x0000}}, // Umacr
+    {11911, 6, 1, {0x015B, 0x0000}}, // sacute
+    {1227, 12, 1, {0x2147, 0x0000}}, // ExponentialE
+    {11465, 7, 1, {0x298E, 0x0000}}, // rbrksld
+    {8051, 6, 1, {0x2665, 0x0000}}, // hearts
+    {13871, 4, 2, {0xD835, 0xDCCD}}, // xscr
+    {13168, 17, 1, {0x21A0, 0x0000}}, // twoheadrightarrow
+    {3734, 2, 1, {0x211C, 0x0000}}, // Re
+    {11407, 6, 1, {0x21A3, 0x0000}}, // rarrtl
+    {12800, 5, 1, {0x00DF, 0x0000}}, // szlig
+    {7981, 6, 1, {0x2273, 0x0000}}, // gtrsim
+    {13120, 8, 1, {0x23E2, 0x0000}}, // trpezium
+    {10668, 4, 1, {0x02DB, 0x0000}}, // ogon
+    {0, 5, 1, {0x00C6, 0x0000}}, // AElig
+    {9329, 3, 1, {0x21B0, 0x0000}}, // lsh
+    {8766, 13, 1, {0x21A2, 0x0000}}, // leftarrowtail
+    {8755, 2, 1, {0x2264, 0x0000}}, // le
+    {3056, 16, 1, {0x22EB, 0x0000}}, // NotRightTriangle
+    {12100, 3, 1, {0x00AD, 0x0000}}, // shy
+    {2878, 7, 1, {0x226E, 0x0000}}, // NotLess
+    {13908, 4, 1, {0x044F, 0x0000}}, // yacy
+    {9414, 4, 1, {0x25C3, 0x0000}}, // ltri
+    {12753, 6, 1, {0x2AC8, 0x0000}}, // supsim
+    {7964, 10, 1, {0x2A8C, 0x0000}}, // gtreqqless
+    {9361, 6, 1, {0x0142, 0x0000}}, // lstrok
+    {13978, 4, 1, {0x0436, 0x0000}}, // zhcy
+    {1754, 4, 1, {0x0409, 0x0000}}, // LJcy
+    {13317, 11, 1, {0x2195, 0x0000}}, // updownarrow
+    {2247, 13, 1, {0x27F5, 0x0000}}, // LongLeftArrow
+    {5362, 7, 1, {0x22BE, 0x0000}}, // angrtvb
+    {9593, 6, 1, {0x2238, 0x0000}}, // minusd
+    {6623, 5, 1, {0x22DF, 0x0000}}, // cuesc
+    {13727, 6, 2, {0x228B, 0xFE00}}, // vsupne
+    {8757, 9, 1, {0x2190, 0x0000}}, // leftarrow
+    {8223, 6, 1, {0x29DC, 0x0000}}, // iinfin
+    {11868, 6, 1, {0x22CC, 0x0000}}, // rthree
+    {13789, 4, 1, {0x22C2, 0x0000}}, // xcap
+    {8751, 4, 1, {0x21B2, 0x0000}}, // ldsh
+    {12405, 15, 1, {0x03F5, 0x0000}}, // straightepsilon
+    {7849, 4, 1, {0x2A8A, 0x0000}}, // gnap
+    {4627, 4, 2, {0xD835, 0xDD4B}}, // Topf
+    {3696, 3, 1, {0x00AE, 0x0000}}, // REG
+    {9994, 10, 1, {0x219A, 0x0000}}, // nleftarrow
+    {6314, 3, 2, {0xD835, 0xDD20}}, // cfr
+    {11349, 4, 1, {0x2192, 0x0000}}, // rarr
+    {6080, 4, 1, {0x2502, 0x0000}}, // boxv
+    {9367, 2, 1, {0x003C, 0x0000}}, // lt
+    {9960, 3, 1, {0x22FC, 0x0000}}, // nis
+    {5982, 5, 1, {0x255F, 0x0000}}, // boxVr
+    {2082, 12, 1, {0x21BF, 0x0000}}, // LeftUpVector
+    {12234, 3, 1, {0x002F, 0x0000}}, // sol
+    {722, 13, 1, {0x2AE4, 0x0000}}, // DoubleLeftTee
+    {5510, 9, 1, {0x2035, 0x0000}}, // backprime
+    {11548, 5, 1, {0x211D, 0x0000}}, // reals
+    {447, 4, 2, {0xD835, 0xDC9E}}, // Cscr
+    {12223, 5, 2, {0x2AAC, 0xFE00}}, // smtes
+    {12765, 6, 1, {0x2AD6, 0x0000}}, // supsup
+    {6604, 7, 1, {0x2938, 0x0000}}, // cudarrl
+    {8632, 6, 1, {0x21A2, 0x0000}}, // larrtl
+    {10871, 6, 1, {0x2AF3, 0x0000}}, // parsim
+    {2825, 15, 1, {0x22EA, 0x0000}}, // NotLeftTriangle
+    {13975, 3, 2, {0xD835, 0xDD37}}, // zfr
+    {12270, 5, 1, {0x2293, 0x0000}}, // sqcap
+    {9292, 8, 1, {0x231F, 0x0000}}, // lrcorner
+    {5918, 5, 1, {0x2569, 0x0000}}, // boxHU
+    {6241, 5, 1, {0x2041, 0x0000}}, // caret
+    {14000, 4, 1, {0x200C, 0x0000}}, // zwnj
+    {6490, 5, 1, {0x002C, 0x0000}}, // comma
+    {7420, 6, 1, {0x225F, 0x0000}}, // equest
+    {7465, 4, 1, {0x2242, 0x0000}}, // esim
+    {9784, 4, 1, {0x0020, 0x0000}}, // nbsp
+    {14, 6, 1, {0x0102, 0x0000}}, // Abreve
+    {11277, 5, 1, {0x21DB, 0x0000}}, // rAarr
+    {6567, 5, 1, {0x21B5, 0x0000}}, // crarr
+    {3547, 3, 2, {0xD835, 0xDD13}}, // Pfr
+    {6394, 8, 1, {0x24C8, 0x0000}}, // circledS
+    {6237, 4, 2, {0x2229, 0xFE00}}, // caps
+    {6135, 5, 1, {0x204F, 0x0000}}, // bsemi
+    {5082, 4, 1, {0x0407, 0x0000}}, // YIcy
+    {13887, 5, 1, {0x25B3, 0x0000}}, // xutri
+    {13089, 4, 1, {0x225C, 0x0000}}, // trie
+    {10989, 7, 1, {0x2A22, 0x0000}}, // pluscir
+    {11344, 5, 1, {0x00BB, 0x0000}}, // raquo
+    {7078, 15, 1, {0x21C3, 0x0000}}, // downharpoonleft
+    {11960, 5, 1, {0x2ABA, 0x0000}}, // scnap
+    {6590, 4, 1, {0x2AD0, 0x0000}}, // csup
+    {7831, 4, 1, {0x0453, 0x0000}}, // gjcy
+    {12216, 3, 1, {0x2AAA, 0x0000}}, // smt
+    {10321, 4, 1, {0x2284, 0x0000}}, // nsub
+    {6850, 2, 1, {0x2146, 0x0000}}, // dd
+    {10698, 5, 1, {0x29BE, 0x0000}}, // olcir
+    {11301, 4, 2, {0x223D, 0x0331}}, // race
+    {7630, 6, 1, {0x2155, 0x0000}}, // frac15
+    {8886, 14, 1, {0x22CB, 0x0000}}, // leftthreetimes
+    {10469, 16, 1, {0x22ED, 0x0000}}, // ntrianglerighteq
+    {7032, 9, 1, {0x22A1, 0x0000}}, // dotsquare
+    {5191, 5, 1, {0x00E2, 0x0000}}, // acirc
+    {4937, 5, 1, {0x22A9, 0x0000}}, // Vdash
+    {13777, 2, 1, {0x2240, 0x0000}}, // wr
+    {7721, 6, 1, {0x01F5, 0x0000}}, // gacute
+    {8499, 4, 2, {0xD835, 0xDD5C}}, // kopf
+    {5499, 11, 1, {0x03F6, 0x0000}}, // backepsilon
+    {12484, 7, 1, {0x2979, 0x0000}}, // subrarr
+    {8536, 6, 1, {0x013A, 0x0000}}, // lacute
+    {1802, 3, 1, {0x041B, 0x0000}}, // Lcy
+    {7779, 3, 1, {0x2A7E, 0x0000}}, // ges
+    {8279, 2, 1, {0x2208, 0x0000}}, // in
+    {4656, 4, 1, {0x219F, 0x0000}}, // Uarr
+    {10678, 3, 1, {0x29C1, 0x0000}}, // ogt
+    {10996, 6, 1, {0x2214, 0x0000}}, // plusdo
+    {143, 4, 2, {0xD835, 0xDD39}}, // Bopf
+    {12655, 4, 1, {0x2287, 0x0000}}, // supe
+    {4174, 4, 1, {0x0428, 0x0000}}, // SHcy
+    {10630, 5, 1, {0x229D, 0x0000}}, // odash
+    {9452, 4, 2, {0x2268, 0xFE00}}, // lvnE
+    {10307, 7, 1, {0x22E2, 0x0000}}, // nsqsube
+    {10723, 5, 1, {0x03C9, 0x0000}}, // omega
+    {7853, 8, 1, {0x2A8A, 0x0000}}, // gnapprox
+    {3683, 4, 1, {0x211A, 0x0000}}, // Qopf
+    {10019, 4, 1, {0x2270, 0x0000}}, // nleq
+    {7221, 5, 1, {0x00EA, 0x0000}}, // ecirc
+    {9073, 5, 1, {0x25FA, 0x0000}}, // lltri
+    {9523, 6, 1, {0x2A29, 0x0000}}, // mcomma
+    {5856, 3, 2, {0x003D, 0x20E5}}, // bne
+    {5642, 6, 1, {0x22C3, 0x0000}}, // bigcup
+    {11931, 6, 1, {0x0161, 0x0000}}, // scaron
+    {9747, 5, 2, {0x224B, 0x0338}}, // napid
+    {1100, 3, 1, {0x042D, 0x0000}}, // Ecy
+    {7752, 3, 1, {0x0433, 0x0000}}, // gcy
+    {7414, 6, 1, {0x003D, 0x0000}}, // equals
+    {13571, 12, 2, {0x228B, 0xFE00}}, // varsupsetneq
+    {9273, 4, 1, {0x29EB, 0x0000}}, // lozf
+    {7821, 2, 1, {0x226B, 0x0000}}, // gg
+    {5894, 5, 1, {0x2554, 0x0000}}, // boxDR
+    {9383, 6, 1, {0x22CB, 0x0000}}, // lthree
+    {858, 17, 1, {0x2225, 0x0000}}, // DoubleVerticalBar
+    {2195, 8, 1, {0x2AA1, 0x0000}}, // LessLess
+    {798, 16, 1, {0x21D2, 0x0000}}, // DoubleRightArrow
+    {4549, 3, 1, {0x0422, 0x0000}}, // Tcy
+    {9614, 6, 1, {0x2213, 0x0000}}, // mnplus
+    {12241, 6, 1, {0x233F, 0x0000}}, // solbar
+    {7306, 6, 1, {0x2205, 0x0000}}, // emptyv
+    {7738, 3, 1, {0x2A86, 0x0000}}, // gap
+    {12638, 4, 1, {0x2AC6, 0x0000}}, // supE
+    {9532, 5, 1, {0x2014, 0x0000}}, // mdash
+    {13411, 5, 1, {0x25F9, 0x0000}}, // urtri
+    {12582, 11, 1, {0x2ABA, 0x0000}}, // succnapprox
+    {8249, 8, 1, {0x2110, 0x0000}}, // imagline
+    {10161, 5, 2, {0x2202, 0x0338}}, // npart
+    {7812, 6, 1, {0x2A94, 0x0000}}, // gesles
+    {6611, 7, 1, {0x2935, 0x0000}}, // cudarrr
+    {10765, 5, 1, {0x21BB, 0x0000}}, // orarr
+    {12565, 11, 1, {0x227D, 0x0000}}, // succcurlyeq
+    {11364, 7, 1, {0x2920, 0x0000}}, // rarrbfs
+    {11942, 3, 1, {0x2AB0, 0x0000}}, // sce
+    {11033, 2, 1, {0x00B1, 0x0000}}, // pm
+    {8374, 4, 2, {0xD835, 0xDCBE}}, // iscr
+    {2666, 13, 2, {0x2242, 0x0338}}, // NotEqualTilde
+    {13845, 4, 2, {0xD835, 0xDD69}}, // xopf
+    {13745, 6, 1, {0x2A5F, 0x0000}}, // wedbar
+    {11266, 7, 1, {0x225F, 0x0000}}, // questeq
+    {13227, 6, 1, {0x0171, 0x0000}}, // udblac
+    {10593, 7, 1, {0x2196, 0x0000}}, // nwarrow
+    {8161, 6, 1, {0x2043, 0x0000}}, // hybull
+    {10622, 5, 1, {0x00F4, 0x0000}}, // ocirc
+    {9107, 8, 1, {0x2A89, 0x0000}}, // lnapprox
+    {12905, 5, 1, {0x2248, 0x0000}}, // thkap
+    {6120, 5, 1, {0x02D8, 0x0000}}, // breve
+    {9939, 4, 1, {0x226F, 0x0000}}, // ngtr
+    {6979, 6, 1, {0x231E, 0x0000}}, // dlcorn
+    {10041, 5, 1, {0x226E, 0x0000}}, // nless
+    {9667, 10, 1, {0x21CD, 0x0000}}, // nLeftarrow
+    {5977, 5, 1, {0x2562, 0x0000}}, // boxVl
+    {11233, 6, 1, {0x2057, 0x0000}}, // qprime
+    {13456, 4, 1, {0x21D5, 0x0000}}, // vArr
+    {6561, 6, 1, {0x2117, 0x0000}}, // copysr
+    {12120, 3, 1, {0x223C, 0x0000}}, // sim
+    {7340, 4, 2, {0xD835, 0xDD56}}, // eopf
+    {8270, 4, 1, {0x22B7, 0x0000}}, // imof
+    {11139, 6, 1, {0x2119, 0x0000}}, // primes
+    {12787, 7, 1, {0x2199, 0x0000}}, // swarrow
+    {12087, 13, 1, {0x2225, 0x0000}}, // shortparallel
+    {10507, 6, 1, {0x2904, 0x0000}}, // nvHarr
+    {8057, 9, 1, {0x2665, 0x0000}}, // heartsuit
+    {8651, 5, 2, {0x2AAD, 0xFE00}}, // lates
+    {5232, 5, 1, {0x03B1, 0x0000}}, // alpha
+    {10155, 6, 2, {0x2AFD, 0x20E5}}, // nparsl
+    {4531, 3, 1, {0x0009, 0x0000}}, // Tab
+    {4707, 8, 1, {0x005F, 0x0000}}, // UnderBar
+    {11894, 8, 1, {0x29CE, 0x0000}}, // rtriltri
+    {7642, 6, 1, {0x215B, 0x0000}}, // frac18
+    {7161, 5, 1, {0x21F5, 0x0000}}, // duarr
+    {8542, 8, 1, {0x29B4, 0x0000}}, // laemptyv
+    {55, 4, 2, {0xD835, 0xDD38}}, // Aopf
+    {6355, 15, 1, {0x21BA, 0x0000}}, // circlearrowleft
+    {11013, 6, 1, {0x00B1, 0x0000}}, // plusmn
+    {8485, 6, 1, {0x0138, 0x0000}}, // kgreen
+    {6985, 6, 1, {0x230D, 0x0000}}, // dlcrop
+    {10423, 4, 1, {0x2278, 0x0000}}, // ntlg
+    {3452, 14, 1, {0x2018, 0x0000}}, // OpenCurlyQuote
+    {10527, 4, 2, {0x003E, 0x20D2}}, // nvgt
+    {3635, 5, 1, {0x2033, 0x0000}}, // Prime
+    {4270, 5, 1, {0x03A3, 0x0000}}, // Sigma
+    {9695, 3, 2, {0x226A, 0x20D2}}, // nLt
+    {9692, 3, 2, {0x22D8, 0x0338}}, // nLl
+    {3768, 20, 1, {0x296F, 0x0000}}, // ReverseUpEquilibrium
+    {8903, 3, 1, {0x2264, 0x0000}}, // leq
+    {1796, 6, 1, {0x013B, 0x0000}}, // Lcedil
+    {10548, 4, 2, {0x003C, 0x20D2}}, // nvlt
+    {10109, 7, 1, {0x22F6, 0x0000}}, // notinvc
+    {497, 6, 1, {0x010E, 0x0000}}, // Dcaron
+    {8072, 6, 1, {0x22B9, 0x0000}}, // hercon
+    {11507, 7, 1, {0x2969, 0x0000}}, // rdldhar
+    {13681, 5, 2, {0x2282, 0x20D2}}, // vnsub
+    {5030, 4, 2, {0xD835, 0xDD4D}}, // Vopf
+    {4696, 6, 1, {0x00D9, 0x0000}}, // Ugrave
+    {1080, 3, 1, {0x00D0, 0x0000}}, // ETH
+    {7835, 2, 1, {0x2277, 0x0000}}, // gl
+    {5263, 8, 1, {0x2A58, 0x0000}}, // andslope
+    {492, 5, 1, {0x2AE4, 0x0000}}, // Dashv
+    {7335, 5, 1, {0x0119, 0x0000}}, // eogon
+    {10976, 8, 1, {0x2A23, 0x0000}}, // plusacir
+    {12545, 6, 1, {0x2AD3, 0x0000}}, // subsup
+    {10785, 4, 1, {0x00AA, 0x0000}}, // ordf
+    {735, 19, 1, {0x27F8, 0x0000}}, // DoubleLongLeftArrow
+    {7123, 6, 1, {0x230C, 0x0000}}, // drcrop
+    {4593, 10, 1, {0x2243, 0x0000}}, // TildeEqual
+    {110, 6, 1, {0x2306, 0x0000}}, // Barwed
+    {7531, 6, 1, {0x2640, 0x0000}}, // female
+    {10046, 5, 1, {0x2274, 0x0000}}, // nlsim
+    {10394, 9, 1, {0x2289, 0x0000}}, // nsupseteq
+    {10081, 6, 2, {0x22F9, 0x0338}}, // notinE
+    {6836, 5, 1, {0x02DD, 0x0000}}, // dblac
+    {8947, 4, 2, {0x22DA, 0xFE00}}, // lesg
+    {3402, 3, 2, {0xD835, 0xDD12}}, // Ofr
+    {5870, 4, 2, {0xD835, 0xDD53}}, // bopf
+    {6800, 4, 1, {0x2965, 0x0000}}, // dHar
+    {7388, 5, 1, {0x2242, 0x0000}}, // eqsim
+    {1523, 12, 1, {0x224E, 0x0000}}, // HumpDownHump
+    {5406, 3, 1, {0x2A70, 0x0000}}, // apE
+    {10614, 4, 1, {0x229B, 0x0000}}, // oast
+    {7571, 5, 1, {0xFB02, 0x0000}}, // fllig
+    {4725, 12, 1, {0x23B5, 0x0000}}, // UnderBracket
+    {9465, 4, 1, {0x2642, 0x0000}}, // male
+    {8721, 4, 1, {0x2936, 0x0000}}, // ldca
+    {8678, 5, 1, {0x298B, 0x0000}}, // lbrke
+    {1164, 5, 1, {0x0118, 0x0000}}, // Eogon
+    {7707, 5, 1, {0x2322, 0x0000}}, // frown
+    {6804, 6, 1, {0x2020, 0x0000}}, // dagger
+    {11061, 5, 1, {0x227C, 0x0000}}, // prcue
+    {8239, 5, 1, {0x012B, 0x0000}}, // imacr
+    {10245, 6, 1, {0x22E1, 0x0000}}, // nsccue
+    {8594, 7, 1, {0x291F, 0x0000}}, // larrbfs
+    {11730, 4, 1, {0x02DA, 0x0000}}, // ring
+    {2607, 12, 1, {0x2262, 0x0000}}, // NotCongruent
+    {7055, 9, 1, {0x2193, 0x0000}}, // downarrow
+    {12626, 4, 1, {0x00B9, 0x0000}}, // sup1
+    {6022, 5, 1, {0x2568, 0x0000}}, // boxhU
+    {11209, 4, 2, {0xD835, 0xDCC5}}, // pscr
+    {4517, 5, 1, {0x2122, 0x0000}}, // TRADE
+    {3284, 16, 1, {0x2289, 0x0000}}, // NotSupersetEqual
+    {13695, 5, 1, {0x221D, 0x0000}}, // vprop
+    {5167, 4, 2, {0xD835, 0xDCB5}}, // Zscr
+    {8066, 6, 1, {0x2026, 0x0000}}, // hellip
+    {6402, 10, 1, {0x229B, 0x0000}}, // circledast
+    {5078, 4, 1, {0x042F, 0x0000}}, // YAcy
+    {3834, 19, 1, {0x21C4, 0x0000}}, // RightArrowLeftArrow
+    {13721, 6, 2, {0x2ACC, 0xFE00}}, // vsupnE
+    {12985, 4, 1, {0x2929, 0x0000}}, // tosa
+    {1766, 6, 1, {0x039B, 0x0000}}, // Lambda
+    {13341, 14, 1, {0x21BE, 0x0000}}, // upharpoonright
+    {6196, 6, 1, {0x0107, 0x0000}}, // cacute
+    {4783, 10, 1, {0x2912, 0x0000}}, // UpArrowBar
+    {3416, 5, 1, {0x03A9, 0x0000}}, // Omega
+    {1920, 17, 1, {0x2959, 0x0000}}, // LeftDownVectorBar
+    {9776, 8, 1, {0x2115, 0x0000}}, // naturals
+    {4204, 5, 1, {0x015C, 0x0000}}, // Scirc
+    {9970, 4, 1, {0x045A, 0x0000}}, // njcy
+    {5061, 4, 2, {0xD835, 0xDCB2}}, // Wscr
+    {4059, 13, 1, {0x21BE, 0x0000}}, // RightUpVector
+    {4906, 5, 1, {0x016E, 0x0000}}, // Uring
+    {11119, 8, 1, {0x22E8, 0x0000}}, // precnsim
+    {6125, 6, 1, {0x00A6, 0x0000}}, // brvbar
+    {2278, 14, 1, {0x27F6, 0x0000}}, // LongRightArrow
+    {1341, 3, 1, {0x0413, 0x0000}}, // Gcy
+    {4555, 9, 1, {0x2234, 0x0000}}, // Therefore
+    {8405, 5, 1, {0x2208, 0x0000}}, // isinv
+    {9483, 6, 1, {0x21A6, 0x0000}}, // mapsto
+    {8910, 8, 1, {0x2A7D, 0x0000}}, // leqslant
+    {12634, 4, 1, {0x00B3, 0x0000}}, // sup3
+    {12937, 8, 1, {0x2A31, 0x0000}}, // timesbar
+    {13771, 4, 2, {0xD835, 0xDD68}}, // wopf
+    {6104, 5, 1, {0x2524, 0x0000}}, // boxvl
+    {6692, 11, 1, {0x22DE, 0x0000}}, // curlyeqprec
+    {2619, 9, 1, {0x226D, 0x0000}}, // NotCupCap
+    {5115, 4, 1, {0x0178, 0x0000}}, // Yuml
+    {9987, 4, 1, {0x2025, 0x0000}}, // nldr
+    {13538, 8, 1, {0x03C2, 0x0000}}, // varsigma
+    {11500, 3, 1, {0x0440, 0x0000}}, // rcy
+    {5899, 5, 1, {0x2556, 0x0000}}, // boxDl
+    {9257, 6, 1, {0x005F, 0x0000}}, // lowbar
+    {13997, 3, 1, {0x200D, 0x0000}}, // zwj
+    {7483, 4, 1, {0x0021, 0x0000}}, // excl
+    {6345, 4, 1, {0x02C6, 0x0000}}, // circ
+    {4229, 14, 1, {0x2190, 0x0000}}, // ShortLeftArrow
+    {1676, 6, 1, {0x0128, 0x0000}}, // Itilde
+    {12378, 6, 1, {0x2216, 0x0000}}, // ssetmn
+    {13775, 2, 1, {0x2118, 0x0000}}, // wp
+    {6153, 5, 1, {0x29C5, 0x0000}}, // bsolb
+    {12680, 7, 1, {0x297B, 0x0000}}, // suplarr
+    {1729, 5, 1, {0x039A, 0x0000}}, // Kappa
+    {7322, 6, 1, {0x2005, 0x0000}}, // emsp14
+    {11192, 6, 1, {0x221D, 0x0000}}, // propto
+    {13445, 4, 1, {0x00FC, 0x0000}}, // uuml
+    {1578, 6, 1, {0x00CC, 0x0000}}, // Igrave
+    {37, 5, 1, {0x0391, 0x0000}}, // Alpha
+    {342, 15, 1, {0x2019, 0x0000}}, // CloseCurlyQuote
+    {5491, 8, 1, {0x224C, 0x0000}}, // backcong
+    {460, 2, 1, {0x2145, 0x0000}}, // DD
+    {12350, 3, 1, {0x25A1, 0x0000}}, // squ
+    {4753, 5, 1, {0x22C3, 0x0000}}, // Union
+    {8718, 3, 1, {0x043B, 0x0000}}, // lcy
+    {8566, 5, 1, {0x2991, 0x0000}}, // langd
+    {9713, 6, 1, {0x22AF, 0x0000}}, // nVDash
+    {11066, 3, 1, {0x2AAF, 0x0000}}, // pre
+    {10665, 3, 2, {0xD835, 0xDD2C}}, // ofr
+    {3669, 4, 2, {0xD835, 0xDCAB}}, // Pscr
+    {1557, 6, 1, {0x00CD, 0x0000}}, // Iacute
+    {8683, 7, 1, {0x298F, 0x0000}}, // lbrksld
+    {13836, 4, 1, {0x22FB, 0x0000}}, // xnis
+    {11902, 7, 1, {0x2968, 0x0000}}, // ruluhar
+    {5074, 4, 2, {0xD835, 0xDCB3}}, // Xscr
+    {4948, 3, 1, {0x22C1, 0x0000}}, // Vee
+    {13369, 7, 1, {0x03C5, 0x0000}}, // upsilon
+    {72, 5, 1, {0x00C5, 0x0000}}, // Aring
+    {4275, 11, 1, {0x2218, 0x0000}}, // SmallCircle
+    {9215, 14, 1, {0x21AC, 0x0000}}, // looparrowright
+    {9369, 4, 1, {0x2AA6, 0x0000}}, // ltcc
+    {470, 4, 1, {0x0402, 0x0000}}, // DJcy
+    {11359, 5, 1, {0x21E5, 0x0000}}, // rarrb
+    {12794, 6, 1, {0x292A, 0x0000}}, // swnwar
+    {12286, 6, 2, {0x2294, 0xFE00}}, // sqcups
+    {3472, 6, 1, {0x00D8, 0x0000}}, // Oslash
+    {1107, 3, 2, {0xD835, 0xDD08}}, // Efr
+    {9663, 4, 2, {0x226B, 0x0338}}, // nGtv
+    {7266, 2, 1, {0x2A99, 0x0000}}, // el
+    {6572, 5, 1, {0x2717, 0x0000}}, // cross
+    {11746, 5, 1, {0x21C4, 0x0000}}, // rlarr
+    {11203, 6, 1, {0x22B0, 0x0000}}, // prurel
+    {533, 14, 1, {0x02D9, 0x0000}}, // DiacriticalDot
+    {8532, 4, 1, {0x2962, 0x0000}}, // lHar
+    {7171, 7, 1, {0x29A6, 0x0000}}, // dwangle
+    {9599, 7, 1, {0x2A2A, 0x0000}}, // minusdu
+    {3577, 4, 1, {0x2119, 0x0000}}, // Popf
+    {4300, 18, 1, {0x2293, 0x0000}}, // SquareIntersection
+    {7562, 5, 2, {0x0066, 0x006A}}, // fjlig
+    {8666, 6, 1, {0x007B, 0x0000}}, // lbrace
+    {4399, 3, 1, {0x22D0, 0x0000}}, // Sub
+    {3421, 7, 1, {0x039F, 0x0000}}, // Omicron
+    {11585, 6, 1, {0x296C, 0x0000}}, // rharul
+    {6301, 4, 1, {0x00A2, 0x0000}}, // cent
+    {5962, 5, 1, {0x2563, 0x0000}}, // boxVL
+    {1311, 2, 1, {0x003E, 0x0000}}, // GT
+    {3705, 4, 1, {0x27EB, 0x0000}}, // Rang
+    {9870, 6, 1, {0x2262, 0x0000}}, // nequiv
+    {5135, 3, 1, {0x0417, 0x0000}}, // Zcy
+    {13638, 5, 1, {0x22A2, 0x0000}}, // vdash
+    {11198, 5, 1, {0x227E, 0x0000}}, // prsim
+    {9461, 4, 1, {0x00AF, 0x0000}}, // macr
+    {1631, 14, 1, {0x2063, 0x0000}}, // InvisibleComma
+    {9418, 5, 1, {0x22B4, 0x0000}}, // ltrie
+    {81, 6, 1, {0x2254, 0x0000}}, // Assign
+    {3944, 8, 1, {0x22A2, 0x0000}}, // RightTee
+    {5227, 5, 1, {0x2135, 0x0000}}, // aleph
+    {5287, 6, 1, {0x2221, 0x0000}}, // angmsd
+    {5883, 6, 1, {0x22C8, 0x0000}}, // bowtie
+    {6027, 5, 1, {0x252C, 0x0000}}, // boxhd
+    {1173, 7, 1, {0x0395, 0x0000}}, // Epsilon
+    {7260, 6, 1, {0x2A98, 0x0000}}, // egsdot
+    {5183, 2, 1, {0x223E, 0x0000}}, // ac
+    {3680, 3, 2, {0xD835, 0xDD14}}, // Qfr
+    {6273, 5, 1, {0x2A4C, 0x0000}}, // ccups
+    {12138, 4, 1, {0x2A9E, 0x0000}}, // simg
+    {9332, 4, 1, {0x2272, 0x0000}}, // lsim
+    {9657, 3, 2, {0x22D9, 0x0338}}, // nGg
+    {1821, 9, 1, {0x2190, 0x0000}}, // LeftArrow
+    {7767, 4, 1, {0x2267, 0x0000}}, // geqq
+    {5737, 6, 1, {0x290D, 0x0000}}, // bkarow
+    {5593, 7, 1, {0x29B0, 0x0000}}, // bemptyv
+    {12142, 5, 1, {0x2AA0, 0x0000}}, // simgE
+    {12659, 7, 1, {0x2AC4, 0x0000}}, // supedot
+    {3466, 2, 1, {0x2A54, 0x0000}}, // Or
+    {13827, 5, 1, {0x27F5, 0x0000}}, // xlarr
+    {3750, 18, 1, {0x21CB, 0x0000}}, // ReverseEquilibrium
+    {9019, 3, 2, {0xD835, 0xDD29}}, // lfr
+    {12207, 4, 1, {0x2223, 0x0000}}, // smid
+    {13392, 8, 1, {0x231D, 0x0000}}, // urcorner
+    {8212, 6, 1, {0x2A0C, 0x0000}}, // iiiint
+    {2885, 12, 1, {0x2270, 0x0000}}, // NotLessEqual
+    {11917, 5, 1, {0x201A, 0x0000}}, // sbquo
+    {12477, 7, 1, {0x2ABF, 0x0000}}, // subplus
+    {9858, 7, 1, {0x2197, 0x0000}}, // nearrow
+    {6905, 4, 1, {0x22C4, 0x0000}}, // diam
+    {5214, 6, 1, {0x00E0, 0x0000}}, // agrave
+    {3091, 21, 1, {0x22ED, 0x0000}}, // NotRightTriangleEqual
+    {7375, 6, 1, {0x2256, 0x0000}}, // eqcirc
+    {1513, 4, 1, {0x210B, 0x0000}}, // Hscr
+    {11652, 15, 1, {0x21C4, 0x0000}}, // rightleftarrows
+    {10681, 5, 1, {0x29B5, 0x0000}}, // ohbar
+    {10939, 2, 1, {0x03C0, 0x0000}}, // pi
+    {13519, 9, 1, {0x221D, 0x0000}}, // varpropto
+    {13514, 5, 1, {0x03D6, 0x0000}}, // varpi
+    {1619, 12, 1, {0x22C2, 0x0000}}, // Intersection
+    {9103, 4, 1, {0x2A89, 0x0000}}, // lnap
+    {11394, 6, 1, {0x2945, 0x0000}}, // rarrpl
+    {2355, 15, 1, {0x2198, 0x0000}}, // LowerRightArrow
+    {8473, 6, 1, {0x0137, 0x0000}}, // kcedil
+    {11846, 4, 2, {0xD835, 0xDCC7}}, // rscr
+    {3510, 11, 1, {0x23B4, 0x0000}}, // OverBracket
+    {9401, 7, 1, {0x2A7B, 0x0000}}, // ltquest
+    {10672, 6, 1, {0x00F2, 0x0000}}, // ograve
+    {1937, 9, 1, {0x230A, 0x0000}}, // LeftFloor
+    {4880, 15, 1, {0x2197, 0x0000}}, // UpperRightArrow
+    {8491, 4, 1, {0x0445, 0x0000}}, // khcy
+    {7064, 14, 1, {0x21CA, 0x0000}}, // downdownarrows
+    {6256, 6, 1, {0x010D, 0x0000}}, // ccaron
+    {9054, 5, 1, {0x21C7, 0x0000}}, // llarr
+    {13055, 13, 1, {0x25B9, 0x0000}}, // triangleright
+    {5470, 4, 1, {0x00E4, 0x0000}}, // auml
+    {6262, 6, 1, {0x00E7, 0x0000}}, // ccedil
+    {50, 5, 1, {0x0104, 0x0000}}, // Aogon
+    {10889, 6, 1, {0x0025, 0x0000}}, // percnt
+    {9820, 8, 2, {0x2A6D, 0x0338}}, // ncongdot
+    {13756, 6, 1, {0x2259, 0x0000}}, // wedgeq
+    {8427, 5, 1, {0x0135, 0x0000}}, // jcirc
+    {13355, 5, 1, {0x228E, 0x0000}}, // uplus
+    {6438, 8, 1, {0x2A10, 0x0000}}, // cirfnint
+    {4925, 5, 1, {0x22AB, 0x0000}}, // VDash
+    {6847, 3, 1, {0x0434, 0x0000}}, // dcy
+    {4493, 13, 1, {0x2287, 0x0000}}, // SupersetEqual
+    {8359, 4, 1, {0x03B9, 0x0000}}, // iota
+    {9620, 6, 1, {0x22A7, 0x0000}}, // models
+    {6652, 6, 1, {0x2A46, 0x0000}}, // cupcap
+    {9346, 4, 1, {0x005B, 0x0000}}, // lsqb
+    {5054, 3, 2, {0xD835, 0xDD1A}}, // Wfr
+    {12266, 4, 1, {0x2225, 0x0000}}, // spar
+    {11971, 8, 1, {0x2A13, 0x0000}}, // scpolint
+    {7846, 3, 1, {0x2269, 0x0000}}, // gnE
+    {12673, 7, 1, {0x2AD7, 0x0000}}, // suphsub
+    {156, 6, 1, {0x224E, 0x0000}}, // Bumpeq
+    {6251, 5, 1, {0x2A4D, 0x0000}}, // ccaps
+    {12326, 6, 1, {0x2292, 0x0000}}, // sqsupe
+    {2171, 13, 1, {0x2266, 0x0000}}, // LessFullEqual
+    {11100, 11, 1, {0x2AB9, 0x0000}}, // precnapprox
+    {5388, 7, 1, {0x237C, 0x0000}}, // angzarr
+    {6581, 4, 1, {0x2ACF, 0x0000}}, // csub
+    {9428, 8, 1, {0x294A, 0x0000}}, // lurdshar
+    {10330, 5, 1, {0x2288, 0x0000}}, // nsube
+    {3791, 3, 1, {0x03A1, 0x0000}}, // Rho
+    {11804, 6, 1, {0x2A2E, 0x0000}}, // roplus
+    {875, 9, 1, {0x2193, 0x0000}}, // DownArrow
+    {6037, 8, 1, {0x229F, 0x0000}}, // boxminus
+    {12830, 3, 1, {0x0442, 0x0000}}, // tcy
+    {11052, 2, 1, {0x227A, 0x0000}}, // pr
+    {5278, 4, 1, {0x29A4, 0x0000}}, // ange
+    {7381, 7, 1, {0x2255, 0x0000}}, // eqcolon
+    {6505, 6, 1, {0x2218, 0x0000}}, // compfn
+    {13328, 13, 1, {0x21BF, 0x0000}}, // upharpoonleft
+    {10176, 6, 1, {0x22E0, 0x0000}}, // nprcue
+    {9127, 5, 1, {0x22E6, 0x0000}}, // lnsim
+    {625, 3, 1, {0x00A8, 0x0000}}, // Dot
+    {10220, 11, 1, {0x219B, 0x0000}}, // nrightarrow
+    {10314, 7, 1, {0x22E3, 0x0000}}, // nsqsupe
+    {6109, 5, 1, {0x251C, 0x0000}}, // boxvr
+    {12642, 6, 1, {0x2ABE, 0x0000}}, // supdot
+    {8198, 3, 1, {0x21D4, 0x0000}}, // iff
+    {2414, 9, 1, {0x2213, 0x0000}}, // MinusPlus
+    {12866, 8, 1, {0x03D1, 0x0000}}, // thetasym
+    {5766, 13, 1, {0x25B4, 0x0000}}, // blacktriangle
+    {13306, 4, 2, {0xD835, 0xDD66}}, // uopf
+    {11254, 7, 1, {0x2A16, 0x0000}}, // quatint
+    {11800, 4, 2, {0xD835, 0xDD63}}, // ropf
+    {4820, 13, 1, {0x296E, 0x0000}}, // UpEquilibrium
+    {9799, 4, 1, {0x2A43, 0x0000}}, // ncap
+    {13815, 5, 1, {0x27F7, 0x0000}}, // xharr
+    {13222, 5, 1, {0x21C5, 0x0000}}, // udarr
+    {7312, 4, 1, {0x2003, 0x0000}}, // emsp
+    {10268, 14, 1, {0x2226, 0x0000}}, // nshortparallel
+    {12704, 7, 1, {0x2AC0, 0x0000}}, // supplus
+    {13691, 4, 2, {0xD835, 0xDD67}}, // vopf
+    {7861, 3, 1, {0x2A88, 0x0000}}, // gne
+    {4776, 7, 1, {0x2191, 0x0000}}, // UpArrow
+    {3934, 10, 1, {0x230B, 0x0000}}, // RightFloor
+    {9473, 7, 1, {0x2720, 0x0000}}, // maltese
+    {2732, 17, 2, {0x226B, 0x0338}}, // NotGreaterGreater
+    {5383, 5, 1, {0x00C5, 0x0000}}, // angst
+    {1750, 4, 2, {0xD835, 0xDCA6}}, // Kscr
+    {4772, 4, 2, {0xD835, 0xDD4C}}, // Uopf
+    {13193, 6, 1, {0x00FA, 0x0000}}, // uacute
+    {11216, 6, 1, {0x2008, 0x0000}}, // puncsp
+    {2679, 9, 1, {0x2204, 0x0000}}, // NotExists
+    {1110, 6, 1, {0x00C8, 0x0000}}, // Egrave
+    {5044, 5, 1, {0x0174, 0x0000}}, // Wcirc
+    {8186, 3, 1, {0x0438, 0x0000}}, // icy
+    {13435, 5, 1, {0x25B4, 0x0000}}, // utrif
+    {4527, 4, 1, {0x0426, 0x0000}}, // TScy
+    {5655, 8, 1, {0x2A01, 0x0000}}, // bigoplus
+    {4603, 14, 1, {0x2245, 0x0000}}, // TildeFullEqual
+    {7017, 8, 1, {0x2238, 0x0000}}, // dotminus
+    {13258, 5, 1, {0x21BE, 0x0000}}, // uharr
+    {11222, 3, 2, {0xD835, 0xDD2E}}, // qfr
+    {8993, 7, 1, {0x2276, 0x0000}}, // lessgtr
+    {402, 9, 1, {0x2210, 0x0000}}, // Coproduct
+    {884, 12, 1, {0x2913, 0x0000}}, // DownArrowBar
+    {10116, 5, 1, {0x220C, 0x0000}}, // notni
+    {6070, 5, 1, {0x2518, 0x0000}}, // boxul
+    {6722, 10, 1, {0x22CF, 0x0000}}, // curlywedge
+    {13247, 6, 1, {0x00F9, 0x0000}}, // ugrave
+    {5253, 6, 1, {0x2A55, 0x0000}}, // andand
+    {3039, 17, 1, {0x220C, 0x0000}}, // NotReverseElement
+    {9266, 7, 1, {0x25CA, 0x0000}}, // lozenge
+    {4564, 5, 1, {0x0398, 0x0000}}, // Theta
+    {9037, 6, 1, {0x296A, 0x0000}}, // lharul
+    {7469, 3, 1, {0x03B7, 0x0000}}, // eta
+    {12945, 6, 1, {0x2A30, 0x0000}}, // timesd
+    {462, 8, 1, {0x2911, 0x0000}}, // DDotrahd
+    {12734, 9, 1, {0x228B, 0x0000}}, // supsetneq
+    {6190, 6, 1, {0x224F, 0x0000}}, // bumpeq
+    {106, 4, 1, {0x2AE7, 0x0000}}, // Barv
+    {12968, 6, 1, {0x2AF1, 0x0000}}, // topcir
+    {13460, 4, 1, {0x2AE8, 0x0000}}, // vBar
+    {1746, 4, 2, {0xD835, 0xDD42}}, // Kopf
+    {9909, 4, 1, {0x2271, 0x0000}}, // ngeq
+    {2911, 11, 2, {0x226A, 0x0338}}, // NotLessLess
+    {6796, 4, 1, {0x21D3, 0x0000}}, // dArr
+    {1743, 3, 2, {0xD835, 0xDD0E}}, // Kfr
+    {7666, 6, 1, {0x2157, 0x0000}}, // frac35
+    {5111, 4, 2, {0xD835, 0xDCB4}}, // Yscr
+    {12193, 6, 1, {0x2A33, 0x0000}}, // smashp
+    {6679, 6, 1, {0x21B7, 0x0000}}, // curarr
+    {2840, 18, 2, {0x29CF, 0x0338}}, // NotLeftTriangleBar
+    {7599, 5, 1, {0x2AD9, 0x0000}}, // forkv
+    {778, 20, 1, {0x27F9, 0x0000}}, // DoubleLongRightArrow
+    {11002, 6, 1, {0x2A25, 0x0000}}, // plusdu
+    {3220, 16, 2, {0x2AB0, 0x0338}}, // NotSucceedsEqual
+    {12133, 5, 1, {0x2243, 0x0000}}, // simeq
+    {10182, 4, 2, {0x2AAF, 0x0338}}, // npre
+    {7660, 6, 1, {0x00BE, 0x0000}}, // frac34
+    {10128, 7, 1, {0x22FE, 0x0000}}, // notnivb
+    {7431, 7, 1, {0x2A78, 0x0000}}, // equivDD
+    {1872, 17, 1, {0x27E6, 0x0000}}, // LeftDoubleBracket
+    {3112, 15, 2, {0x228F, 0x0338}}, // NotSquareSubset
+    {1039, 7, 1, {0x22A4, 0x0000}}, // DownTee
+    {6790, 6, 1, {0x232D, 0x0000}}, // cylcty
+    {11984, 3, 1, {0x0441, 0x0000}}, // scy
+    {8355, 4, 2, {0xD835, 0xDD5A}}, // iopf
+    {7996, 4, 2, {0x2269, 0xFE00}}, // gvnE
+    {5, 3, 1, {0x0026, 0x0000}}, // AMP
+    {7001, 3, 1, {0x02D9, 0x0000}}, // dot
+    {7955, 9, 1, {0x22DB, 0x0000}}, // gtreqless
+    {12340, 10, 1, {0x2292, 0x0000}}, // sqsupseteq
+    {13238, 6, 1, {0x297E, 0x0000}}, // ufisht
+    {7840, 3, 1, {0x2AA5, 0x0000}}, // gla
+    {10282, 4, 1, {0x2241, 0x0000}}, // nsim
+    {7041, 14, 1, {0x2306, 0x0000}}, // doublebarwedge
+    {8315, 8, 1, {0x2124, 0x0000}}, // integers
+    {4512, 5, 1, {0x00DE, 0x0000}}, // THORN
+    {11533, 7, 1, {0x211B, 0x0000}}, // realine
+    {12228, 6, 1, {0x044C, 0x0000}}, // softcy
+    {147, 5, 1, {0x02D8, 0x0000}}, // Breve
+    {634, 8, 1, {0x2250, 0x0000}}, // DotEqual
+    {6464, 8, 1, {0x2663, 0x0000}}, // clubsuit
+    {5070, 4, 2, {0xD835, 0xDD4F}}, // Xopf
+    {9084, 6, 1, {0x23B0, 0x0000}}, // lmoust
+    {6335, 3, 1, {0x03C7, 0x0000}}, // chi
+    {11448, 6, 1, {0x007D, 0x0000}}, // rbrace
+    {6386, 8, 1, {0x00AE, 0x0000}}, // circledR
+    {7282, 6, 1, {0x2A97, 0x0000}}, // elsdot
+    {11835, 5, 1, {0x21C9, 0x0000}}, // rrarr
+    {11608, 14, 1, {0x21A3, 0x0000}}, // rightarrowtail
+    {2051, 16, 1, {0x2951, 0x0000}}, // LeftUpDownVector
+    {6225, 6, 1, {0x2A47, 0x0000}}, // capcup
+    {1710, 6, 1, {0x0408, 0x0000}}, // Jsercy
+    {11338, 6, 1, {0x27E9, 0x0000}}, // rangle
+    {28, 3, 2, {0xD835, 0xDD04}}, // Afr
+    {6895, 5, 1, {0x21C3, 0x0000}}, // dharl
+    {8097, 5, 1, {0x21FF, 0x0000}}, // hoarr
+    {2477, 18, 1, {0x200B, 0x0000}}, // NegativeThickSpace
+    {12396, 4, 1, {0x2606, 0x0000}}, // star
+    {10984, 5, 1, {0x229E, 0x0000}}, // plusb
+    {6670, 5, 1, {0x2A45, 0x0000}}, // cupor
+    {11529, 4, 1, {0x211C, 0x0000}}, // real
+    {8265, 5, 1, {0x0131, 0x0000}}, // imath
+    {12711, 6, 1, {0x2283, 0x0000}}, // supset
+    {8189, 4, 1, {0x0435, 0x0000}}, // iecy
+    {2584, 16, 1, {0x00A0, 0x0000}}, // NonBreakingSpace
+    {1702, 4, 2, {0xD835, 0xDD41}}, // Jopf
+    {8743, 8, 1, {0x294B, 0x0000}}, // ldrushar
+    {3405, 6, 1, {0x00D2, 0x0000}}, // Ograve
+    {9373, 5, 1, {0x2A79, 0x0000}}, // ltcir
+    {1353, 4, 2, {0xD835, 0xDD3E}}, // Gopf
+    {13233, 5, 1, {0x296E, 0x0000}}, // udhar
+    {11160, 4, 1, {0x220F, 0x0000}}, // prod
+    {8046, 5, 1, {0x0125, 0x0000}}, // hcirc
+    {5104, 3, 2, {0xD835, 0xDD1C}}, // Yfr
+    {47, 3, 1, {0x2A53, 0x0000}}, // And
+    {12028, 4, 1, {0x003B, 0x0000}}, // semi
+    {6950, 6, 1, {0x00F7, 0x0000}}, // divide
+    {9137, 5, 1, {0x21FD, 0x0000}}, // loarr
+    {8368, 6, 1, {0x00BF, 0x0000}}, // iquest
+    {921, 19, 1, {0x2950, 0x0000}}, // DownLeftRightVector
+    {5836, 5, 1, {0x2592, 0x0000}}, // blk12
+    {368, 9, 1, {0x2261, 0x0000}}, // Congruent
+    {8201, 3, 2, {0xD835, 0xDD26}}, // ifr
+    {10538, 6, 1, {0x2902, 0x0000}}, // nvlArr
+    {12916, 5, 1, {0x00FE, 0x0000}}, // thorn
+    {8346, 4, 1, {0x0451, 0x0000}}, // iocy
+    {2305, 18, 1, {0x27FA, 0x0000}}, // Longleftrightarrow
+    {9178, 10, 1, {0x27FC, 0x0000}}, // longmapsto
+    {8779, 15, 1, {0x21BD, 0x0000}}, // leftharpoondown
+    {1046, 12, 1, {0x21A7, 0x0000}}, // DownTeeArrow
+    {13779, 6, 1, {0x2240, 0x0000}}, // wreath
+    {8443, 4, 2, {0xD835, 0xDD5B}}, // jopf
+    {11188, 4, 1, {0x221D, 0x0000}}, // prop
+    {5086, 4, 1, {0x042E, 0x0000}}, // YUcy
+    {10023, 5, 2, {0x2266, 0x0338}}, // nleqq
+    {11472, 7, 1, {0x2990, 0x0000}}, // rbrkslu
+    {9043, 5, 1, {0x2584, 0x0000}}, // lhblk
+    {13528, 4, 1, {0x2195, 0x0000}}, // varr
+    {5014, 13, 1, {0x200A, 0x0000}}, // VeryThinSpace
+    {4139, 11, 1, {0x21DB, 0x0000}}, // Rrightarrow
+    {10203, 5, 1, {0x219B, 0x0000}}, // nrarr
+    {9752, 5, 1, {0x0149, 0x0000}}, // napos
+    {7217, 4, 1, {0x2256, 0x0000}}, // ecir
+    {10641, 4, 1, {0x2A38, 0x0000}}, // odiv
+    {12648, 7, 1, {0x2AD8, 0x0000}}, // supdsub
+    {5993, 5, 1, {0x2555, 0x0000}}, // boxdL
+    {5027, 3, 2, {0xD835, 0xDD19}}, // Vfr
+    {3393, 3, 1, {0x041E, 0x0000}}, // Ocy
+    {11924, 3, 1, {0x2AB4, 0x0000}}, // scE
+    {13715, 6, 2, {0x228A, 0xFE00}}, // vsubne
+    {11069, 4, 1, {0x227A, 0x0000}}, // prec
+    {9389, 6, 1, {0x22C9, 0x0000}}, // ltimes
+    {13861, 5, 1, {0x27F9, 0x0000}}, // xrArr
+    {8078, 3, 2, {0xD835, 0xDD25}}, // hfr
+    {1776, 10, 1, {0x2112, 0x0000}}, // Laplacetrf
+    {12079, 8, 1, {0x2223, 0x0000}}, // shortmid
+    {2443, 6, 1, {0x0147, 0x0000}}, // Ncaron
+    {12959, 3, 1, {0x22A4, 0x0000}}, // top
+    {13132, 4, 1, {0x0446, 0x0000}}, // tscy
+    {11376, 6, 1, {0x291E, 0x0000}}, // rarrfs
+    {10302, 5, 1, {0x2226, 0x0000}}, // nspar
+    {5038, 6, 1, {0x22AA, 0x0000}}, // Vvdash
+    {7873, 5, 1, {0x22E7, 0x0000}}, // gnsim
+    {12369, 5, 1, {0x2192, 0x0000}}, // srarr
+    {13185, 4, 1, {0x21D1, 0x0000}}, // uArr
+    {9436, 7, 1, {0x2966, 0x0000}}, // luruhar
+    {11145, 4, 1, {0x2AB5, 0x0000}}, // prnE
+    {1548, 5, 1, {0x0132, 0x0000}}, // IJlig
+    {13855, 6, 1, {0x2A02, 0x0000}}, // xotime
+    {6859, 5, 1, {0x21CA, 0x0000}}, // ddarr
+    {1303, 4, 1, {0x2131, 0x0000}}, // Fscr
+    {7837, 3, 1, {0x2A92, 0x0000}}, // glE
+    {4951, 6, 1, {0x2016, 0x0000}}, // Verbar
+    {10907, 4, 1, {0x22A5, 0x0000}}, // perp
+    {1760, 6, 1, {0x0139, 0x0000}}, // Lacute
+    {5519, 7, 1, {0x223D, 0x0000}}, // backsim
+    {10833, 6, 1, {0x2297, 0x0000}}, // otimes
+    {4157, 11, 1, {0x29F4, 0x0000}}, // RuleDelayed
+    {4522, 5, 1, {0x040B, 0x0000}}, // TSHcy
+    {5743, 12, 1, {0x29EB, 0x0000}}, // blacklozenge
+    {10065, 4, 1, {0x2224, 0x0000}}, // nmid
+    {1889, 17, 1, {0x2961, 0x0000}}, // LeftDownTeeVector
+    {7895, 5, 1, {0x2A8E, 0x0000}}, // gsime
+    {9251, 6, 1, {0x2217, 0x0000}}, // lowast
+    {12297, 6, 1, {0x2291, 0x0000}}, // sqsube
+    {2433, 4, 1, {0x040A, 0x0000}}, // NJcy
+    {8193, 5, 1, {0x00A1, 0x0000}}, // iexcl
+    {9244, 7, 1, {0x2A34, 0x0000}}, // lotimes
+    {1495, 4, 1, {0x210D, 0x0000}}, // Hopf
+    {7354, 5, 1, {0x2A71, 0x0000}}, // eplus
+    {2323, 14, 1, {0x27F9, 0x0000}}, // Longrightarrow
+    {3308, 13, 1, {0x2244, 0x0000}}, // NotTildeEqual
+    {6675, 4, 2, {0x222A, 0xFE00}}, // cups
+    {7712, 4, 2, {0xD835, 0xDCBB}}, // fscr
+    {7678, 6, 1, {0x2158, 0x0000}}, // frac45
+    {1071, 6, 1, {0x0110, 0x0000}}, // Dstrok
+    {5138, 4, 1, {0x017B, 0x0000}}, // Zdot
+    {7891, 4, 1, {0x2273, 0x0000}}, // gsim
+    {10417, 6, 1, {0x00F1, 0x0000}}, // ntilde
+    {5247, 3, 1, {0x0026, 0x0000}}, // amp
+    {10778, 7, 1, {0x2134, 0x0000}}, // orderof
+    {5948, 5, 1, {0x2559, 0x0000}}, // boxUr
+    {8218, 5, 1, {0x222D, 0x0000}}, // iiint
+    {9903, 3, 2, {0x2267, 0x0338}}, // ngE
+    {3555, 9, 1, {0x00B1, 0x0000}}, // PlusMinus
+    {5987, 6, 1, {0x29C9, 0x0000}}, // boxbox
+    {6158, 8, 1, {0x27C8, 0x0000}}, // bsolhsub
+    {9078, 6, 1, {0x0140, 0x0000}}, // lmidot
+    {5049, 5, 1, {0x22C0, 0x0000}}, // Wedge
+    {9963, 4, 1, {0x22FA, 0x0000}}, // nisd
+    {11229, 4, 2, {0xD835, 0xDD62}}, // qopf
+    {2241, 6, 1, {0x013F, 0x0000}}, // Lmidot
+    {4767, 5, 1, {0x0172, 0x0000}}, // Uogon
+    {7927, 7, 1, {0x2A7C, 0x0000}}, // gtquest
+    {6452, 7, 1, {0x29C2, 0x0000}}, // cirscir
+    {6131, 4, 2, {0xD835, 0xDCB7}}, // bscr
+    {828, 13, 1, {0x21D1, 0x0000}}, // DoubleUpArrow
+    {5831, 5, 1, {0x2423, 0x0000}}, // blank
+    {10686, 3, 1, {0x03A9, 0x0000}}, // ohm
+    {6935, 7, 1, {0x03DD, 0x0000}}, // digamma
+    {10121, 7, 1, {0x220C, 0x0000}}, // notniva
+    {3484, 6, 1, {0x2A37, 0x0000}}, // Otimes
+    {3550, 3, 1, {0x03A6, 0x0000}}, // Phi
+    {8906, 4, 1, {0x2266, 0x0000}}, // leqq
+    {1786, 4, 1, {0x219E, 0x0000}}, // Larr
+    {9606, 4, 1, {0x2ADB, 0x0000}}, // mlcp
+    {2449, 6, 1, {0x0145, 0x0000}}, // Ncedil
+    {11667, 17, 1, {0x21CC, 0x0000}}, // rightleftharpoons
+    {1283, 4, 2, {0xD835, 0xDD3D}}, // Fopf
+    {1214, 3, 1, {0x0397, 0x0000}}, // Eta
+    {8451, 6, 1, {0x0458, 0x0000}}, // jsercy
+    {9564, 6, 1, {0x002A, 0x0000}}, // midast
+    {1740, 3, 1, {0x041A, 0x0000}}, // Kcy
+    {13971, 4, 1, {0x03B6, 0x0000}}, // zeta
+    {5687, 15, 1, {0x25BD, 0x0000}}, // bigtriangledown
+    {5333, 8, 1, {0x29AD, 0x0000}}, // angmsdaf
+    {9587, 6, 1, {0x229F, 0x0000}}, // minusb
+    {2897, 14, 1, {0x2278, 0x0000}}, // NotLessGreater
+    {6916, 11, 1, {0x2666, 0x0000}}, // diamondsuit
+    {11261, 5, 1, {0x003F, 0x0000}}, // quest
+    {12555, 10, 1, {0x2AB8, 0x0000}}, // succapprox
+    {223, 7, 1, {0x2230, 0x0000}}, // Cconint
+    {13820, 2, 1, {0x03BE, 0x0000}}, // xi
+    {12776, 6, 1, {0x2926, 0x0000}}, // swarhk
+    {11519, 6, 1, {0x201D, 0x0000}}, // rdquor
+    {13840, 5, 1, {0x2A00, 0x0000}}, // xodot
+    {12725, 9, 1, {0x2AC6, 0x0000}}, // supseteqq
+    {2991, 11, 1, {0x2280, 0x0000}}, // NotPrecedes
+    {4640, 4, 2, {0xD835, 0xDCAF}}, // Tscr
+    {13360, 4, 1, {0x03C5, 0x0000}}, // upsi
+    {13244, 3, 2, {0xD835, 0xDD32}}, // ufr
+    {11909, 2, 1, {0x211E, 0x0000}}, // rx
+    {7595, 4, 1, {0x22D4, 0x0000}}, // fork
+    {10198, 5, 1, {0x21CF, 0x0000}}, // nrArr
+    {12759, 6, 1, {0x2AD4, 0x0000}}, // supsub
+    {13912, 5, 1, {0x0177, 0x0000}}, // ycirc
+    {11540, 8, 1, {0x211C, 0x0000}}, // realpart
+    {10565, 7, 2, {0x22B5, 0x20D2}}, // nvrtrie
+    {9300, 5, 1, {0x21CB, 0x0000}}, // lrhar
+    {9517, 6, 1, {0x25AE, 0x0000}}, // marker
+    {9610, 4, 1, {0x2026, 0x0000}}, // mldr
+    {10214, 6, 2, {0x219D, 0x0338}}, // nrarrw
+    {11282, 4, 1, {0x21D2, 0x0000}}, // rArr
+    {10342, 9, 1, {0x2288, 0x0000}}, // nsubseteq
+    {7718, 3, 1, {0x2A8C, 0x0000}}, // gEl
+    {3147, 17, 2, {0x2290, 0x0338}}, // NotSquareSuperset
+    {10413, 4, 1, {0x2279, 0x0000}}, // ntgl
+    {11292, 5, 1, {0x290F, 0x0000}}, // rBarr
+    {7503, 12, 1, {0x2147, 0x0000}}, // exponentiale
+    {2858, 20, 1, {0x22EC, 0x0000}}, // NotLeftTriangleEqual
+    {8000, 4, 1, {0x21D4, 0x0000}}, // hArr
+    {5177, 6, 1, {0x0103, 0x0000}}, // abreve
+    {8725, 5, 1, {0x201C, 0x0000}}, // ldquo
+    {2577, 7, 1, {0x2060, 0x0000}}, // NoBreak
+    {1077, 3, 1, {0x014A, 0x0000}}, // ENG
+    {9743, 4, 2, {0x2A70, 0x0338}}, // napE
+    {10291, 6, 1, {0x2244, 0x0000}}, // nsimeq
+    {12151, 5, 1, {0x2A9F, 0x0000}}, // simlE
+    {9325, 4, 2, {0xD835, 0xDCC1}}, // lscr
+    {8135, 4, 2, {0xD835, 0xDD59}}, // hopf
+    {569, 16, 1, {0x0060, 0x0000}}, // DiacriticalGrave
+    {608, 13, 1, {0x2146, 0x0000}}, // DifferentialD
+    {6932, 3, 1, {0x00A8, 0x0000}}, // die
+    {11700, 15, 1, {0x219D, 0x0000}}, // rightsquigarrow
+    {8229, 5, 1, {0x2129, 0x0000}}, // iiota
+    {912, 9, 1, {0x0311, 0x0000}}, // DownBreve
+    {8900, 3, 1, {0x22DA, 0x0000}}, // leg
+    {6557, 4, 1, {0x00A9, 0x0000}}, // copy
+    {8418, 5, 1, {0x0456, 0x0000}}, // iukcy
+    {206, 6, 1, {0x010C, 0x0000}}, // Ccaron
+    {9007, 6, 1, {0x297C, 0x0000}}, // lfisht
+    {1645, 14, 1, {0x2062, 0x0000}}, // InvisibleTimes
+    {6886, 6, 1, {0x297F, 0x0000}}, // dfisht
+    {8638, 3, 1, {0x2AAB, 0x0000}}, // lat
+    {11987, 4, 1, {0x22C5, 0x0000}}, // sdot
+    {11638, 14, 1, {0x21C0, 0x0000}}, // rightharpoonup
+    {4380, 11, 1, {0x2294, 0x0000}}, // SquareUnion
+    {7093, 16, 1, {0x21C2, 0x0000}}, // downharpoonright
+    {11880, 4, 1, {0x25B9, 0x0000}}, // rtri
+    {8457, 5, 1, {0x0454, 0x0000}}, // jukcy
+    {11945, 6, 1, {0x015F, 0x0000}}, // scedil
+    {1116, 7, 1, {0x2208, 0x0000}}, // Element
+    {11496, 4, 1, {0x007D, 0x0000}}, // rcub
+    {59, 13, 1, {0x2061, 0x0000}}, // ApplyFunction
+    {12852, 9, 1, {0x2234, 0x0000}}, // therefore
+    {11083, 11, 1, {0x227C, 0x0000}}, // preccurlyeq
+    {6446, 6, 1, {0x2AEF, 0x0000}}, // cirmid
+    {5449, 3, 1, {0x002A, 0x0000}}, // ast
+    {12292, 5, 1, {0x228F, 0x0000}}, // sqsub
+    {9757, 7, 1, {0x2249, 0x0000}}, // napprox
+    {5409, 6, 1, {0x2A6F, 0x0000}}, // apacir
+    {10635, 6, 1, {0x0151, 0x0000}}, // odblac
+    {13406, 5, 1, {0x016F, 0x0000}}, // uring
+    {12523, 10, 1, {0x2ACB, 0x0000}}, // subsetneqq
+    {5057, 4, 2, {0xD835, 0xDD4E}}, // Wopf
+    {8435, 3, 2, {0xD835, 0xDD27}}, // jfr
+    {10928, 6, 1, {0x2133, 0x0000}}, // phmmat
+    {12609, 7, 1, {0x227F, 0x0000}}, // succsim
+    {9677, 15, 1, {0x21CE, 0x0000}}, // nLeftrightarrow
+    {3369, 6, 1, {0x00D1, 0x0000}}, // Ntilde
+    {10817, 6, 1, {0x00F8, 0x0000}}, // oslash
+    {9118, 4, 1, {0x2A87, 0x0000}}, // lneq
+    {11297, 4, 1, {0x2964, 0x0000}}, // rHar
+    {7604, 8, 1, {0x2A0D, 0x0000}}, // fpartint
+    {7451, 5, 1, {0x2971, 0x0000}}, // erarr
+    {8957, 10, 1, {0x2A85, 0x0000}}, // lessapprox
+    {3788, 3, 1, {0x211C, 0x0000}}, // Rfr
+    {2749, 14, 1, {0x2279, 0x0000}}, // NotGreaterLess
+    {6732, 6, 1, {0x00A4, 0x0000}}, // curren
+    {5068, 2, 1, {0x039E, 0x0000}}, // Xi
+    {6975, 4, 1, {0x0452, 0x0000}}, // djcy
+    {1517, 6, 1, {0x0126, 0x0000}}, // Hstrok
+    {8512, 4, 1, {0x21D0, 0x0000}}, // lArr
+    {663, 9, 1, {0x00A8, 0x0000}}, // DoubleDot
+    {8244, 5, 1, {0x2111, 0x0000}}, // image
+    {5119, 4, 1, {0x0416, 0x0000}}, // ZHcy
+    {4408, 11, 1, {0x2286, 0x0000}}, // SubsetEqual
+    {9853, 5, 1, {0x2197, 0x0000}}, // nearr
+    {5487, 4, 1, {0x2AED, 0x0000}}, // bNot
+    {1293, 10, 1, {0x2131, 0x0000}}, // Fouriertrf
+    {12623, 3, 1, {0x2283, 0x0000}}, // sup
+    {13934, 4, 2, {0xD835, 0xDCCE}}, // yscr
+    {2698, 15, 1, {0x2271, 0x0000}}, // NotGreaterEqual
+    {2455, 3, 1, {0x041D, 0x0000}}, // Ncy
+    {5559, 8, 1, {0x23B6, 0x0000}}, // bbrktbrk
+    {13920, 3, 1, {0x00A5, 0x0000}}, // yen
+    {6641, 3, 1, {0x222A, 0x0000}}, // cup
+    {957, 14, 1, {0x21BD, 0x0000}}, // DownLeftVector
+    {3300, 8, 1, {0x2241, 0x0000}}, // NotTilde
+    {11413, 5, 1, {0x219D, 0x0000}}, // rarrw
+    {10440, 15, 1, {0x22EC, 0x0000}}, // ntrianglelefteq
+    {2567, 7, 1, {0x000A, 0x0000}}, // NewLine
+    {12374, 4, 2, {0xD835, 0xDCC8}}, // sscr
+    {1123, 5, 1, {0x0112, 0x0000}}, // Emacr
+    {12630, 4, 1, {0x00B2, 0x0000}}, // sup2
+    {11951, 5, 1, {0x015D, 0x0000}}, // scirc
+    {13635, 3, 1, {0x0432, 0x0000}}, // vcy
+    {12782, 5, 1, {0x2199, 0x0000}}, // swarr
+    {13386, 6, 1, {0x231D, 0x0000}}, // urcorn
+    {11054, 3, 1, {0x2AB3, 0x0000}}, // prE
+    {9311, 3, 1, {0x200E, 0x0000}}, // lrm
+    {4440, 18, 1, {0x227D, 0x0000}}, // SucceedsSlantEqual
+    {6521, 9, 1, {0x2102, 0x0000}}, // complexes
+    {13268, 6, 1, {0x231C, 0x0000}}, // ulcorn
+    {12069, 6, 1, {0x0449, 0x0000}}, // shchcy
+    {7543, 5, 1, {0xFB00, 0x0000}}, // fflig
+    {179, 20, 1, {0x2145, 0x0000}}, // CapitalDifferentialD
+    {1401, 14, 1, {0x2AA2, 0x0000}}, // GreaterGreater
+    {6202, 3, 1, {0x2229, 0x0000}}, // cap
+    {488, 4, 1, {0x21A1, 0x0000}}, // Darr
+    {1475, 5, 1, {0x0124, 0x0000}}, // Hcirc
+    {11503, 4, 1, {0x2937, 0x0000}}, // rdca
+    {2094, 15, 1, {0x2958, 0x0000}}, // LeftUpVectorBar
+    {3396, 6, 1, {0x0150, 0x0000}}, // Odblac
+    {2658, 8, 1, {0x2260, 0x0000}}, // NotEqual
+    {3916, 18, 1, {0x2955, 0x0000}}, // RightDownVectorBar
+    {11353, 6, 1, {0x2975, 0x0000}}, // rarrap
+    {5615, 4, 1, {0x2136, 0x0000}}, // beth
+    {10076, 5, 1, {0x2209, 0x0000}}, // notin
+    {11874, 6, 1, {0x22CA, 0x0000}}, // rtimes
+    {7800, 8, 1, {0x2A84, 0x0000}}, // gesdotol
+    {2383, 2, 1, {0x226A, 0x0000}}, // Lt
+    {3719, 6, 1, {0x0158, 0x0000}}, // Rcaron
+    {12505, 9, 1, {0x2AC5, 0x0000}}, // subseteqq
+    {8412, 6, 1, {0x0129, 0x0000}}, // itilde
+    {12439, 4, 1, {0x2AC5, 0x0000}}, // subE
+    {10728, 7, 1, {0x03BF, 0x0000}}, // omicron
+    {3164, 22, 1, {0x22E3, 0x0000}}, // NotSquareSupersetEqual
+    {7818, 3, 2, {0xD835, 0xDD24}}, // gfr
+    {9582, 5, 1, {0x2212, 0x0000}}, // minus
+    {8983, 10, 1, {0x2A8B, 0x0000}}, // lesseqqgtr
+    {2533, 20, 1, {0x226B, 0x0000}}, // NestedGreaterGreater
+    {11979, 5, 1, {0x227F, 0x0000}}, // scsim
+    {3640, 7, 1, {0x220F, 0x0000}}, // Product
+    {3699, 6, 1, {0x0154, 0x0000}}, // Racute
+    {6317, 4, 1, {0x0447, 0x0000}}, // chcy
+    {3901, 15, 1, {0x21C2, 0x0000}}, // RightDownVector
+    {1734, 6, 1, {0x0136, 0x0000}}, // Kcedil
+    {451, 3, 1, {0x22D3, 0x0000}}, // Cup
+    {7235, 4, 1, {0x0117, 0x0000}}, // edot
+    {4154, 3, 1, {0x21B1, 0x0000}}, // Rsh
+    {42, 5, 1, {0x0100, 0x0000}}, // Amacr
+    {6483, 7, 1, {0x2254, 0x0000}}, // coloneq
+    {5432, 8, 1, {0x224A, 0x0000}}, // approxeq
+    {10618, 4, 1, {0x229A, 0x0000}}, // ocir
+    {10577, 5, 1, {0x21D6, 0x0000}}, // nwArr
+    {11575, 5, 1, {0x21C1, 0x0000}}, // rhard
+    {8331, 8, 1, {0x2A17, 0x0000}}, // intlarhk
+    {11443, 5, 1, {0x2773, 0x0000}}, // rbbrk
+    {12955, 4, 1, {0x2928, 0x0000}}, // toea
+    {13208, 6, 1, {0x016D, 0x0000}}, // ubreve
+    {5555, 4, 1, {0x23B5, 0x0000}}, // bbrk
+    {6777, 8, 1, {0x2232, 0x0000}}, // cwconint
+    {6089, 5, 1, {0x2561, 0x0000}}, // boxvL
+    {1691, 5, 1, {0x0134, 0x0000}}, // Jcirc
+    {509, 5, 1, {0x0394, 0x0000}}, // Delta
+    {5547, 8, 1, {0x2305, 0x0000}}, // barwedge
+    {13128, 4, 2, {0xD835, 0xDCC9}}, // tscr
+    {8020, 6, 1, {0x044A, 0x0000}}, // hardcy
+    {8697, 6, 1, {0x013E, 0x0000}}, // lcaron
+    {6956, 13, 1, {0x22C7, 0x0000}}, // divideontimes
+    {12551, 4, 1, {0x227B, 0x0000}}, // succ
+    {940, 17, 1, {0x295E, 0x0000}}, // DownLeftTeeVector
+    {6997, 4, 2, {0xD835, 0xDD55}}, // dopf
+    {13288, 5, 1, {0x25F8, 0x0000}}, // ultri
+    {10851, 5, 1, {0x233D, 0x0000}}, // ovbar
+    {5237, 5, 1, {0x0101, 0x0000}}, // amacr
+    {250, 3, 1, {0x212D, 0x0000}}, // Cfr
+    {13798, 4, 1, {0x22C3, 0x0000}}, // xcup
+    {241, 9, 1, {0x00B7, 0x0000}}, // CenterDot
+    {11164, 8, 1, {0x232E, 0x0000}}, // profalar
+    {5913, 5, 1, {0x2566, 0x0000}}, // boxHD
+    {11134, 5, 1, {0x2032, 0x0000}}, // prime
+    {2034, 17, 1, {0x22B4, 0x0000}}, // LeftTriangleEqual
+    {12743, 10, 1, {0x2ACC, 0x0000}}, // supsetneqq
+    {2922, 17, 2, {0x2A7D, 0x0338}}, // NotLessSlantEqual
+    {3657, 12, 1, {0x221D, 0x0000}}, // Proportional
+    {5967, 5, 1, {0x2560, 0x0000}}, // boxVR
+    {8522, 5, 1, {0x290E, 0x0000}}, // lBarr
+    {9698, 4, 2, {0x226A, 0x0338}}, // nLtv
+    {1415, 11, 1, {0x2277, 0x0000}}, // GreaterLess
+    {8257, 8, 1, {0x2111, 0x0000}}, // imagpart
+    {5426, 6, 1, {0x2248, 0x0000}}, // approx
+    {601, 7, 1, {0x22C4, 0x0000}}, // Diamond
+    {9982, 5, 1, {0x219A, 0x0000}}, // nlarr
+    {7472, 3, 1, {0x00F0, 0x0000}}, // eth
+    {11840, 6, 1, {0x203A, 0x0000}}, // rsaquo
+    {5259, 4, 1, {0x2A5C, 0x0000}}, // andd
+    {10028, 9, 2, {0x2A7D, 0x0338}}, // nleqslant
+    {6294, 7, 1, {0x29B2, 0x0000}}, // cemptyv
+    {2402, 9, 1, {0x2133, 0x0000}}, // Mellintrf
+    {8378, 4, 1, {0x2208, 0x0000}}, // isin
+    {12443, 6, 1, {0x2ABD, 0x0000}}, // subdot
+    {9499, 10, 1, {0x21A4, 0x0000}}, // mapstoleft
+    {7654, 6, 1, {0x2156, 0x0000}}, // frac25
+    {5953, 4, 1, {0x2551, 0x0000}}, // boxV
+    {10073, 3, 1, {0x00AC, 0x0000}}, // not
+    {12874, 6, 1, {0x03D1, 0x0000}}, // thetav
+    {3736, 14, 1, {0x220B, 0x0000}}, // ReverseElement
+    {9122, 5, 1, {0x2268, 0x0000}}, // lneqq
+    {4361, 19, 1, {0x2292, 0x0000}}, // SquareSupersetEqual
+    {4848, 7, 1, {0x21D1, 0x0000}}, // Uparrow
+    {6305, 9, 1, {0x00B7, 0x0000}}, // centerdot
+    {11172, 8, 1, {0x2312, 0x0000}}, // profline
+    {7359, 4, 1, {0x03B5, 0x0000}}, // epsi
+    {6892, 3, 2, {0xD835, 0xDD21}}, // dfr
+    {10924, 4, 1, {0x03D5, 0x0000}}, // phiv
+    {1128, 16, 1, {0x25FB, 0x0000}}, // EmptySmallSquare
+    {4644, 6, 1, {0x0166, 0x0000}}, // Tstrok
+    {31, 6, 1, {0x00C0, 0x0000}}, // Agrave
+    {11311, 5, 1, {0x221A, 0x0000}}, // radic
+    {4168, 6, 1, {0x0429, 0x0000}}, // SHCHcy
+    {7288, 5, 1, {0x0113, 0x0000}}, // emacr
+    {6321, 5, 1, {0x2713, 0x0000}}, // check
+    {6412, 11, 1, {0x229A, 0x0000}}, // circledcirc
+    {1021, 18, 1, {0x2957, 0x0000}}, // DownRightVectorBar
+    {3821, 13, 1, {0x21E5, 0x0000}}, // RightArrowBar
+    {814, 14, 1, {0x22A8, 0x0000}}, // DoubleRightTee
+    {12619, 4, 1, {0x266A, 0x0000}}, // sung
+    {10173, 3, 1, {0x2280, 0x0000}}, // npr
+    {9967, 3, 1, {0x220B, 0x0000}}, // niv
+    {7246, 3, 2, {0xD835, 0xDD22}}, // efr
+    {8139, 6, 1, {0x2015, 0x0000}}, // horbar
+    {4984, 17, 1, {0x2758, 0x0000}}, // VerticalSeparator
+    {13938, 4, 1, {0x044E, 0x0000}}, // yucy
+    {13214, 5, 1, {0x00FB, 0x0000}}, // ucirc
+    {11785, 5, 1, {0x21FE, 0x0000}}, // roarr
+    {9865, 5, 2, {0x2250, 0x0338}}, // nedot
+    {12303, 8, 1, {0x228F, 0x0000}}, // sqsubset
+    {297, 24, 1, {0x2232, 0x0000}}, // ClockwiseContourIntegral
+    {12491, 6, 1, {0x2282, 0x0000}}, // subset
+    {286, 11, 1, {0x2297, 0x0000}}, // CircleTimes
+    {77, 4, 2, {0xD835, 0xDC9C}}, // Ascr
+    {9443, 9, 2, {0x2268, 0xFE00}}, // lvertneqq
+    {9408, 6, 1, {0x2996, 0x0000}}, // ltrPar
+    {7182, 8, 1, {0x27FF, 0x0000}}, // dzigrarr
+    {988, 18, 1, {0x295F, 0x0000}}, // DownRightTeeVector
+    {1313, 5, 1, {0x0393, 0x0000}}, // Gamma
+    {11371, 5, 1, {0x2933, 0x0000}}, // rarrc
+    {12251, 6, 1, {0x2660, 0x0000}}, // spades
+    {8921, 5, 1, {0x2AA8, 0x0000}}, // lescc
+    {9456, 5, 1, {0x223A, 0x0000}}, // mDDot
+    {482, 6, 1, {0x2021, 0x0000}}, // Dagger
+    {4471, 8, 1, {0x220B, 0x0000}}, // SuchThat
+    {8399, 6, 1, {0x22F3, 0x0000}}, // isinsv
+    {10582, 6, 1, {0x2923, 0x0000}}, // nwarhk
+    {4552, 3, 2, {0xD835, 0xDD17}}, // Tfr
+    {10877, 5, 1, {0x2AFD, 0x0000}}, // parsl
+    {1584, 2, 1, {0x2111, 0x0000}}, // Im
+    {2783, 15, 1, {0x2275, 0x0000}}, // NotGreaterTilde
+    {2427, 4, 1, {0x2133, 0x0000}}, // Mscr
+    {10703, 7, 1, {0x29BB, 0x0000}}, // olcross
+    {12055, 3, 2, {0xD835, 0xDD30}}, // sfr
+    {5957, 5, 1, {0x256C, 0x0000}}, // boxVH
+    {3257, 16, 2, {0x227F, 0x0338}}, // NotSucceedsTilde
+    {9000, 7, 1, {0x2272, 0x0000}}, // lesssim
+    {10146, 9, 1, {0x2226, 0x0000}}, // nparallel
+    {218, 5, 1, {0x0108, 0x0000}}, // Ccirc
+    {13709, 6, 2, {0x2ACB, 0xFE00}}, // vsubnE
+    {9341, 5, 1, {0x2A8F, 0x0000}}, // lsimg
+    {6326, 9, 1, {0x2713, 0x0000}}, // checkmark
+    {10839, 8, 1, {0x2A36, 0x0000}}, // otimesas
+    {11572, 3, 2, {0xD835, 0xDD2F}}, // rfr
+    {8661, 5, 1, {0x2772, 0x0000}}, // lbbrk
+    {4588, 5, 1, {0x223C, 0x0000}}, // Tilde
+    {12926, 5, 1, {0x00D7, 0x0000}}, // times
+    {9570, 6, 1, {0x2AF0, 0x0000}}, // midcir
+    {841, 17, 1, {0x21D5, 0x0000}}, // DoubleUpDownArrow
+    {13425, 6, 1, {0x0169, 0x0000}}, // utilde
+    {1058, 9, 1, {0x21D3, 0x0000}}, // Downarrow
+    {8, 6, 1, {0x00C1, 0x0000}}, // Aacute
+    {11857, 5, 1, {0x2019, 0x0000}}, // rsquo
+    {5096, 5, 1, {0x0176, 0x0000}}, // Ycirc
+    {1790, 6, 1, {0x013D, 0x0000}}, // Lcaron
+    {2370, 4, 1, {0x2112, 0x0000}}, // Lscr
+    {10856, 3, 1, {0x2225, 0x0000}}, // par
+    {5729, 8, 1, {0x22C0, 0x0000}}, // bigwedge
+    {11429, 9, 1, {0x211A, 0x0000}}, // rationals
+    {3581, 2, 1, {0x2ABB, 0x0000}}, // Pr
+    {7370, 5, 1, {0x03F5, 0x0000}}, // epsiv
+    {1706, 4, 2, {0xD835, 0xDCA5}}, // Jscr
+    {13364, 5, 1, {0x03D2, 0x0000}}, // upsih
+    {3647, 10, 1, {0x2237, 0x0000}}, // Proportion
+    {2260, 18, 1, {0x27F7, 0x0000}}, // LongLeftRightArrow
+    {6991, 6, 1, {0x0024, 0x0000}}, // dollar
+    {10191, 7, 2, {0x2AAF, 0x0338}}, // npreceq
+    {9100, 3, 1, {0x2268, 0x0000}}, // lnE
+    {1239, 3, 1, {0x0424, 0x0000}}, // Fcy
+    {628, 6, 1, {0x20DC, 0x0000}}, // DotDot
+    {6114, 6, 1, {0x2035, 0x0000}}, // bprime
+    {4911, 4, 2, {0xD835, 0xDCB0}}, // Uscr
+    {2813, 12, 2, {0x224F, 0x0338}}, // NotHumpEqual
+    {7446, 5, 1, {0x2253, 0x0000}}, // erDot
+    {4294, 6, 1, {0x25A1, 0x0000}}, // Square
+    {10863, 8, 1, {0x2225, 0x0000}}, // parallel
+    {8589, 5, 1, {0x21E4, 0x0000}}, // larrb
+    {11026, 7, 1, {0x2A27, 0x0000}}, // plustwo
+    {11557, 3, 1, {0x00AE, 0x0000}}, // reg
+    {9378, 5, 1, {0x22D6, 0x0000}}, // ltdot
+    {7152, 4, 1, {0x25BF, 0x0000}}, // dtri
+    {5163, 4, 1, {0x2124, 0x0000}}, // Zopf
+    {8323, 8, 1, {0x22BA, 0x0000}}, // intercal
+    {12951, 4, 1, {0x222D, 0x0000}}, // tint
+    {5209, 2, 1, {0x2061, 0x0000}}, // af
+    {6285, 4, 1, {0x010B, 0x0000}}, // cdot
+    {11111, 8, 1, {0x2AB5, 0x0000}}, // precneqq
+    {5160, 3, 1, {0x2128, 0x0000}}, // Zfr
+    {10166, 7, 1, {0x2A14, 0x0000}}, // npolint
+    {6166, 4, 1, {0x2022, 0x0000}}, // bull
+    {8703, 6, 1, {0x013C, 0x0000}}, // lcedil
+    {12995, 5, 1, {0x2122, 0x0000}}, // trade
+    {7133, 4, 1, {0x0455, 0x0000}}, // dscy
+    {11622, 16, 1, {0x21C1, 0x0000}}, // rightharpoondown
+    {6219, 6, 1, {0x2A4B, 0x0000}}, // capcap
+    {6738, 14, 1, {0x21B6, 0x0000}}, // curvearrowleft
+    {6008, 5, 1, {0x250C, 0x0000}}, // boxdr
+    {1242, 3, 2, {0xD835, 0xDD09}}, // Ffr
+    {5457, 7, 1, {0x224D, 0x0000}}, // asympeq
+    {9809, 6, 1, {0x0146, 0x0000}}, // ncedil
+    {13298, 3, 1, {0x00A8, 0x0000}}, // uml
+    {3365, 4, 2, {0xD835, 0xDCA9}}, // Nscr
+    {12032, 6, 1, {0x2929, 0x0000}}, // seswar
+    {7887, 4, 1, {0x210A, 0x0000}}, // gscr
+    {2019, 15, 1, {0x29CF, 0x0000}}, // LeftTriangleBar
+    {5341, 8, 1, {0x29AE, 0x0000}}, // angmsdag
+    {12593, 8, 1, {0x2AB6, 0x0000}}, // succneqq
+    {6909, 7, 1, {0x22C4, 0x0000}}, // diamond
+    {12275, 6, 2, {0x2293, 0xFE00}}, // sqcaps
+    {12257, 9, 1, {0x2660, 0x0000}}, // spadesuit
+    {12805, 6, 1, {0x2316, 0x0000}}, // target
+    {6900, 5, 1, {0x21C2, 0x0000}}, // dharr
+    {4099, 14, 1, {0x2953, 0x0000}}, // RightVectorBar
+    {253, 3, 1, {0x03A7, 0x0000}}, // Chi
+    {13740, 5, 1, {0x0175, 0x0000}}, // wcirc
+    {13147, 5, 1, {0x226C, 0x0000}}, // twixt
+    {1544, 4, 1, {0x0415, 0x0000}}, // IEcy
+    {5090, 6, 1, {0x00DD, 0x0000}}, // Yacute
+    {1480, 3, 1, {0x210C, 0x0000}}, // Hfr
+    {13652, 5, 1, {0x225A, 0x0000}}, // veeeq
+    {12051, 4, 1, {0x2736, 0x0000}}, // sext
+    {136, 4, 1, {0x0392, 0x0000}}, // Beta
+    {12576, 6, 1, {0x2AB0, 0x0000}}, // succeq
+    {10102, 7, 1, {0x22F7, 0x0000}}, // notinvb
+    {7741, 6, 1, {0x011F, 0x0000}}, // gbreve
+    {3811, 10, 1, {0x2192, 0x0000}}, // RightArrow
+    {6942, 5, 1, {0x22F2, 0x0000}}, // disin
+    {12103, 5, 1, {0x03C3, 0x0000}}, // sigma
+    {6841, 6, 1, {0x010F, 0x0000}}, // dcaron
+    {11560, 6, 1, {0x297D, 0x0000}}, // rfisht
+    {478, 4, 1, {0x040F, 0x0000}}, // DZcy
+    {4008, 18, 1, {0x22B5, 0x0000}}, // RightTriangleEqual
+    {7943, 6, 1, {0x2978, 0x0000}}, // gtrarr
+    {2628, 20, 1, {0x2226, 0x0000}}, // NotDoubleVerticalBar
+    {5723, 6, 1, {0x22C1, 0x0000}}, // bigvee
+    {11324, 4, 1, {0x27E9, 0x0000}}, // rang
+    {4209, 3, 1, {0x0421, 0x0000}}, // Scy
+    {13849, 6, 1, {0x2A01, 0x0000}}, // xoplus
+    {5702, 13, 1, {0x25B3, 0x0000}}, // bigtriangleup
+    {5841, 5, 1, {0x2591, 0x0000}}, // blk14
+    {5275, 3, 1, {0x2220, 0x0000}}, // ang
+    {13604, 15, 1, {0x22B2, 0x0000}}, // vartriangleleft
+    {5185, 3, 2, {0x223E, 0x0333}}, // acE
+    {13093, 8, 1, {0x2A3A, 0x0000}}, // triminus
+    {5325, 8, 1, {0x29AC, 0x0000}}, // angmsdae
+    {6246, 5, 1, {0x02C7, 0x0000}}, // caron
+    {13508, 6, 1, {0x03D5, 0x0000}}, // varphi
+    {276, 10, 1, {0x2295, 0x0000}}, // CirclePlus
+    {11424, 5, 1, {0x2236, 0x0000}}, // ratio
+    {7328, 3, 1, {0x014B, 0x0000}}, // eng
+    {6268, 5, 1, {0x0109, 0x0000}}, // ccirc
+    {12281, 5, 1, {0x2294, 0x0000}}, // sqcup
+    {3501, 9, 1, {0x23DE, 0x0000}}, // OverBrace
+    {1696, 3, 1, {0x0419, 0x0000}}, // Jcy
+    {7567, 4, 1, {0x266D, 0x0000}}, // flat
+    {8516, 6, 1, {0x291B, 0x0000}}, // lAtail
+    {5440, 5, 1, {0x00E5, 0x0000}}, // aring
+    {754, 24, 1, {0x27FA, 0x0000}}, // DoubleLongLeftRightArrow
+    {5943, 5, 1, {0x255C, 0x0000}}, // boxUl
+    {5715, 8, 1, {0x2A04, 0x0000}}, // biguplus
+    {6871, 3, 1, {0x00B0, 0x0000}}, // deg
+    {11862, 6, 1, {0x2019, 0x0000}}, // rsquor
+    {1351, 2, 1, {0x22D9, 0x0000}}, // Gg
+    {10377, 5, 2, {0x2AC6, 0x0338}}, // nsupE
+    {5415, 3, 1, {0x224A, 0x0000}}, // ape
+    {10886, 3, 1, {0x043F, 0x0000}}, // pcy
+    {13917, 3, 1, {0x044B, 0x0000}}, // ycy
+    {9480, 3, 1, {0x21A6, 0x0000}}, // map
+    {11598, 10, 1, {0x2192, 0x0000}}, // rightarrow
+    {454, 6, 1, {0x224D, 0x0000}}, // CupCap
+    {3794, 17, 1, {0x27E9, 0x0000}}, // RightAngleBracket
+    {10531, 7, 1, {0x29DE, 0x0000}}, // nvinfin
+    {11780, 5, 1, {0x27ED, 0x0000}}, // roang
+    {1571, 4, 1, {0x0130, 0x0000}}, // Idot
+    {10608, 6, 1, {0x00F3, 0x0000}}, // oacute
+    {10490, 6, 1, {0x2116, 0x0000}}, // numero
+    {6634, 7, 1, {0x293D, 0x0000}}, // cularrp
+    {12017, 7, 1, {0x2198, 0x0000}}, // searrow
+    {6459, 5, 1, {0x2663, 0x0000}}, // clubs
+    {2341, 14, 1, {0x2199, 0x0000}}, // LowerLeftArrow
+    {9469, 4, 1, {0x2720, 0x0000}}, // malt
+    {7178, 4, 1, {0x045F, 0x0000}}, // dzcy
+    {9660, 3, 2, {0x226B, 0x20D2}}, // nGt
+    {9423, 5, 1, {0x25C2, 0x0000}}, // ltrif
+    {13253, 5, 1, {0x21BF, 0x0000}}, // uharl
+    {4793, 16, 1, {0x21C5, 0x0000}}, // UpArrowDownArrow
+    {7548, 6, 1, {0xFB04, 0x0000}}, // ffllig
+    {3583, 8, 1, {0x227A, 0x0000}}, // Precedes
+    {12989, 6, 1, {0x2034, 0x0000}}, // tprime
+    {4961, 11, 1, {0x2223, 0x0000}}, // VerticalBar
+    {11154, 6, 1, {0x22E8, 0x0000}}, // prnsim
+    {12687, 7, 1, {0x2AC2, 0x0000}}, // supmult
+    {5629, 6, 1, {0x22C2, 0x0000}}, // bigcap
+    {1330, 6, 1, {0x0122, 0x0000}}, // Gcedil
+    {4127, 12, 1, {0x2970, 0x0000}}, // RoundImplies
+    {10513, 4, 2, {0x224D, 0x20D2}}, // nvap
+    {10373, 4, 1, {0x2285, 0x0000}}, // nsup
+    {5586, 7, 1, {0x2235, 0x0000}}, // because
+    {6852, 7, 1, {0x2021, 0x0000}}, // ddagger
+    {7025, 7, 1, {0x2214, 0x0000}}, // dotplus
+    {8527, 2, 1, {0x2266, 0x0000}}, // lE
+    {12114, 6, 1, {0x03C2, 0x0000}}, // sigmav
+    {13136, 5, 1, {0x045B, 0x0000}}, // tshcy
+    {5626, 3, 2, {0xD835, 0xDD1F}}, // bfr
+    {7251, 6, 1, {0x00E8, 0x0000}}, // egrave
+    {8234, 5, 1, {0x0133, 0x0000}}, // ijlig
+    {4631, 9, 1, {0x20DB, 0x0000}}, // TripleDot
+    {10069, 4, 2, {0xD835, 0xDD5F}}, // nopf
+    {10950, 3, 1, {0x03D6, 0x0000}}, // piv
+    {4088, 11, 1, {0x21C0, 0x0000}}, // RightVector
+    {1344, 4, 1, {0x0120, 0x0000}}, // Gdot
+    {256, 9, 1, {0x2299, 0x0000}}, // CircleDot
+    {8656, 5, 1, {0x290C, 0x0000}}, // lbarr
+    {5938, 5, 1, {0x255A, 0x0000}}, // boxUR
+    {1467, 5, 1, {0x02C7, 0x0000}}, // Hacek
+    {3725, 6, 1, {0x0156, 0x0000}}, // Rcedil
+    {11765, 10, 1, {0x23B1, 0x0000}}, // rmoustache
+    {10735, 4, 1, {0x29B6, 0x0000}}, // omid
+    {1206, 4, 1, {0x2130, 0x0000}}, // Escr
+    {7759, 2, 1, {0x2265, 0x0000}}, // ge
+    {503, 3, 1, {0x0414, 0x0000}}, // Dcy
+    {5672, 8, 1, {0x2A06, 0x0000}}, // bigsqcup
+    {7456, 4, 1, {0x212F, 0x0000}}, // escr
+    {8204, 6, 1, {0x00EC, 0x0000}}, // igrave
+    {10770, 3, 1, {0x2A5D, 0x0000}}, // ord
+    {13583, 13, 2, {0x2ACC, 0xFE00}}, // varsupsetneqq
+    {8363, 5, 1, {0x2A3C, 0x0000}}, // iprod
+    {10600, 6, 1, {0x2927, 0x0000}}, // nwnear
+    {8145, 4, 2, {0xD835, 0xDCBD}}, // hscr
+    {6714, 8, 1, {0x22CE, 0x0000}}, // curlyvee
+    {4934, 3, 1, {0x0412, 0x0000}}, // Vcy
+    {11991, 5, 1, {0x22A1, 0x0000}}, // sdotb
+    {10793, 6, 1, {0x22B6, 0x0000}}, // origof
+    {3676, 4, 1, {0x0022, 0x0000}}, // QUOT
+    {9202, 13, 1, {0x21AB, 0x0000}}, // looparrowleft
+    {8507, 5, 1, {0x21DA, 0x0000}}, // lAarr
+    {4485, 8, 1, {0x2283, 0x0000}}, // Superset
+    {9115, 3, 1, {0x2A87, 0x0000}}, // lne
+    {9027, 5, 1, {0x21BD, 0x0000}}, // lhard
+    {9550, 3, 2, {0xD835, 0xDD2A}}, // mfr
+    {13733, 7, 1, {0x299A, 0x0000}}, // vzigzag
+    {5846, 5, 1, {0x2593, 0x0000}}, // blk34
+    {7585, 4, 2, {0xD835, 0xDD57}}, // fopf
+    {9630, 2, 1, {0x2213, 0x0000}}, // mp
+    {7690, 6, 1, {0x215D, 0x0000}}, // frac58
+    {12180, 13, 1, {0x2216, 0x0000}}, // smallsetminus
+    {7949, 6, 1, {0x22D7, 0x0000}}, // gtrdot
+    {7147, 5, 1, {0x22F1, 0x0000}}, // dtdot
+    {7479, 4, 1, {0x20AC, 0x0000}}, // euro
+    {13700, 5, 1, {0x22B3, 0x0000}}, // vrtri
+    {6628, 6, 1, {0x21B6, 0x0000}}, // cularr
+    {3494, 7, 1, {0x203E, 0x0000}}, // OverBar
+    {9847, 6, 1, {0x2924, 0x0000}}, // nearhk
+    {11810, 7, 1, {0x2A35, 0x0000}}, // rotimes
+    {6594, 5, 1, {0x2AD2, 0x0000}}, // csupe
+    {357, 5, 1, {0x2237, 0x0000}}, // Colon
+    {4113, 10, 1, {0x21D2, 0x0000}}, // Rightarrow
+    {1426, 17, 1, {0x2A7E, 0x0000}}, // GreaterSlantEqual
+    {442, 5, 1, {0x2A2F, 0x0000}}, // Cross
+    {8287, 5, 1, {0x221E, 0x0000}}, // infin
+    {1682, 5, 1, {0x0406, 0x0000}}, // Iukcy
+    {11243, 11, 1, {0x210D, 0x0000}}, // quaternions
+    {9652, 5, 1, {0x22B8, 0x0000}}, // mumap
+    {9740, 3, 1, {0x2249, 0x0000}}, // nap
+    {1357, 12, 1, {0x2265, 0x0000}}, // GreaterEqual
+    {7648, 6, 1, {0x2154, 0x0000}}, // frac23
+    {11759, 6, 1, {0x23B1, 0x0000}}, // rmoust
+    {6772, 5, 1, {0x22CF, 0x0000}}, // cuwed
+    {12846, 6, 1, {0x2234, 0x0000}}, // there4
+    {6013, 4, 1, {0x2500, 0x0000}}, // boxh
+    {212, 6, 1, {0x00C7, 0x0000}}, // Ccedil
+    {1601, 7, 1, {0x21D2, 0x0000}}, // Implies
+    {6003, 5, 1, {0x2510, 0x0000}}, // boxdl
+    {162, 4, 1, {0x0427, 0x0000}}, // CHcy
+    {4895, 4, 1, {0x03D2, 0x0000}}, // Upsi
+    {13946, 6, 1, {0x017A, 0x0000}}, // zacute
+    {12211, 5, 1, {0x2323, 0x0000}}, // smile
+    {93, 4, 1, {0x00C4, 0x0000}}, // Auml
+    {3428, 4, 2, {0xD835, 0xDD46}}, // Oopf
+    {5317, 8, 1, {0x29AB, 0x0000}}, // angmsdad
+    {5859, 7, 2, {0x2261, 0x20E5}}, // bnequiv
+    {2458, 19, 1, {0x200B, 0x0000}}, // NegativeMediumSpace
+    {12497, 8, 1, {0x2286, 0x0000}}, // subseteq
+    {13376, 10, 1, {0x21C8, 0x0000}}, // upuparrows
+    {7624, 6, 1, {0x00BC, 0x0000}}, // frac14
+    {5635, 7, 1, {0x25EF, 0x0000}}, // bigcirc
+    {10645, 4, 1, {0x2299, 0x0000}}, // odot
+    {9626, 4, 2, {0xD835, 0xDD5E}}, // mopf
+    {7211, 6, 1, {0x011B, 0x0000}}, // ecaron
+    {13896, 6, 1, {0x22C0, 0x0000}}, // xwedge
+    {1095, 5, 1, {0x00CA, 0x0000}}, // Ecirc
+    {4150, 4, 1, {0x211B, 0x0000}}, // Rscr
+    {9702, 11, 1, {0x21CF, 0x0000}}, // nRightarrow
+    {12824, 6, 1, {0x0163, 0x0000}}, // tcedil
+    {8714, 4, 1, {0x007B, 0x0000}}, // lcub
+    {10403, 10, 2, {0x2AC6, 0x0338}}, // nsupseteqq
+    {10004, 15, 1, {0x21AE, 0x0000}}, // nleftrightarrow
+    {7528, 3, 1, {0x0444, 0x0000}}, // fcy
+    {97, 9, 1, {0x2216, 0x0000}}, // Backslash
+    {4243, 15, 1, {0x2192, 0x0000}}, // ShortRightArrow
+    {1455, 4, 2, {0xD835, 0xDCA2}}, // Gscr
+    {5526, 9, 1, {0x22CD, 0x0000}}, // backsimeq
+    {8382, 5, 1, {0x22F9, 0x0000}}, // isinE
+    {13152, 16, 1, {0x219E, 0x0000}}, // twoheadleftarrow
+    {10959, 7, 1, {0x210E, 0x0000}}, // planckh
+    {7612, 6, 1, {0x00BD, 0x0000}}, // frac12
+    {5755, 11, 1, {0x25AA, 0x0000}}, // blacksquare
+    {9842, 5, 1, {0x21D7, 0x0000}}, // neArr
+    {1608, 3, 1, {0x222C, 0x0000}}, // Int
+    {12460, 7, 1, {0x2AC1, 0x0000}}, // submult
+    {8447, 4, 2, {0xD835, 0xDCBF}}, // jscr
+    {3564, 13, 1, {0x210C, 0x0000}}, // Poincareplane
+    {1461, 6, 1, {0x042A, 0x0000}}, // HARDcy
+    {8607, 6, 1, {0x21A9, 0x0000}}, // larrhk
+    {12390, 6, 1, {0x22C6, 0x0000}}, // sstarf
+    {6423, 11, 1, {0x229D, 0x0000}}, // circleddash
+    {11485, 6, 1, {0x0157, 0x0000}}, // rcedil
+    {20, 5, 1, {0x00C2, 0x0000}}, // Acirc
+    {5301, 8, 1, {0x29A9, 0x0000}}, // angmsdab
+    {3388, 5, 1, {0x00D4, 0x0000}}, // Ocirc
+    {4286, 4, 2, {0xD835, 0xDD4A}}, // Sopf
+    {6185, 5, 1, {0x224F, 0x0000}}, // bumpe
+    {7764, 3, 1, {0x2265, 0x0000}}, // geq
+    {8619, 6, 1, {0x2939, 0x0000}}, // larrpl
+    {9188, 14, 1, {0x27F6, 0x0000}}, // longrightarrow
+    {2229, 2, 1, {0x22D8, 0x0000}}, // Ll
+    {13293, 5, 1, {0x016B, 0x0000}}, // umacr
+    {3965, 14, 1, {0x295B, 0x0000}}, // RightTeeVector
+    {10259, 9, 1, {0x2224, 0x0000}}, // nshortmid
+    {140, 3, 2, {0xD835, 0xDD05}}, // Bfr
+    {13046, 9, 1, {0x225C, 0x0000}}, // triangleq
+    {3604, 18, 1, {0x227C, 0x0000}}, // PrecedesSlantEqual
+    {170, 6, 1, {0x0106, 0x0000}}, // Cacute
+    {9769, 7, 1, {0x266E, 0x0000}}, // natural
+    {13923, 3, 2, {0xD835, 0xDD36}}, // yfr
+    {7557, 5, 1, {0xFB01, 0x0000}}, // filig
+    {8339, 7, 1, {0x2A3C, 0x0000}}, // intprod
+    {2203, 14, 1, {0x2A7D, 0x0000}}, // LessSlantEqual
+    {4072, 16, 1, {0x2954, 0x0000}}, // RightUpVectorBar
+    {11180, 8, 1, {0x2313, 0x0000}}, // profsurf
+    {8690, 7, 1, {0x298D, 0x0000}}, // lbrkslu
+    {12699, 5, 1, {0x228B, 0x0000}}, // supne
+    {7793, 7, 1, {0x2A82, 0x0000}}, // gesdoto
+    {10799, 4, 1, {0x2A56, 0x0000}}, // oror
+    {5404, 2, 1, {0x2248, 0x0000}}, // ap
+    {6599, 5, 1, {0x22EF, 0x0000}}, // ctdot
+    {4192, 6, 1, {0x0160, 0x0000}}, // Scaron
+    {5972, 5, 1, {0x256B, 0x0000}}, // boxVh
+    {5418, 4, 1, {0x224B, 0x0000}}, // apid
+    {11965, 6, 1, {0x22E9, 0x0000}}, // scnsim
+    {5874, 3, 1, {0x22A5, 0x0000}}, // bot
+    {11514, 5, 1, {0x201D, 0x0000}}, // rdquo
+    {2713, 19, 2, {0x2267, 0x0338}}, // NotGreaterFullEqual
+    {10660, 5, 1, {0x29BF, 0x0000}}, // ofcir
+    {13449, 7, 1, {0x29A7, 0x0000}}, // uwangle
+    {7787, 6, 1, {0x2A80, 0x0000}}, // gesdot
+    {13189, 4, 1, {0x2963, 0x0000}}, // uHar
+    {5377, 6, 1, {0x2222, 0x0000}}, // angsph
+    {8932, 7, 1, {0x2A81, 0x0000}}, // lesdoto
+    {11491, 5, 1, {0x2309, 0x0000}}, // rceil
+    {12818, 6, 1, {0x0165, 0x0000}}, // tcaron
+    {13676, 5, 1, {0x22B2, 0x0000}}, // vltri
+    {6829, 7, 1, {0x290F, 0x0000}}, // dbkarow
+    {7916, 5, 1, {0x22D7, 0x0000}}, // gtdot
+    {12247, 4, 2, {0xD835, 0xDD64}}, // sopf
+    {3127, 20, 1, {0x22E2, 0x0000}}, // NotSquareSubsetEqual
+    {10588, 5, 1, {0x2196, 0x0000}}, // nwarr
+    {2391, 11, 1, {0x205F, 0x0000}}, // MediumSpace
+    {11454, 6, 1, {0x005D, 0x0000}}, // rbrack
+    {11756, 3, 1, {0x200F, 0x0000}}, // rlm
+    {3478, 6, 1, {0x00D5, 0x0000}}, // Otilde
+    {5211, 3, 2, {0xD835, 0xDD1E}}, // afr
+    {12467, 5, 1, {0x2ACB, 0x0000}}, // subnE
+    {10649, 6, 1, {0x29BC, 0x0000}}, // odsold
+    {9882, 5, 2, {0x2242, 0x0338}}, // nesim
+    {1369, 16, 1, {0x22DB, 0x0000}}, // GreaterEqualLess
+    {2184, 11, 1, {0x2276, 0x0000}}, // LessGreater
+    {398, 4, 1, {0x2102, 0x0000}}, // Copf
+    {6180, 5, 1, {0x2AAE, 0x0000}}, // bumpE
+    {3713, 6, 1, {0x2916, 0x0000}}, // Rarrtl
+    {4043, 16, 1, {0x295C, 0x0000}}, // RightUpTeeVector
+    {10552, 7, 2, {0x22B4, 0x20D2}}, // nvltrie
+    {13532, 6, 1, {0x03F1, 0x0000}}, // varrho
+    {6685, 7, 1, {0x293C, 0x0000}}, // curarrm
+    {10255, 4, 2, {0xD835, 0xDCC3}}, // nscr
+    {3018, 21, 1, {0x22E0, 0x0000}}, // NotPrecedesSlantEqual
+    {4673, 6, 1, {0x016C, 0x0000}}, // Ubreve
+    {12833, 4, 1, {0x20DB, 0x0000}}, // tdot
+    {4190, 2, 1, {0x2ABC, 0x0000}}, // Sc
+    {8462, 5, 1, {0x03BA, 0x0000}}, // kappa
+    {3002, 16, 2, {0x2AAF, 0x0338}}, // NotPrecedesEqual
+    {11019, 7, 1, {0x2A26, 0x0000}}, // plussim
+    {13474, 6, 1, {0x299C, 0x0000}}, // vangrt
+    {8867, 19, 1, {0x21AD, 0x0000}}, // leftrightsquigarrow
+    {1758, 2, 1, {0x003C, 0x0000}}, // LT
+    {8350, 5, 1, {0x012F, 0x0000}}, // iogon
+    {11734, 12, 1, {0x2253, 0x0000}}, // risingdotseq
+    {11094, 6, 1, {0x2AAF, 0x0000}}, // preceq
+    {5998, 5, 1, {0x2552, 0x0000}}, // boxdR
+    {9229, 5, 1, {0x2985, 0x0000}}, // lopar
+    {7492, 11, 1, {0x2130, 0x0000}}, // expectation
+    {1994, 13, 1, {0x295A, 0x0000}}, // LeftTeeVector
+    {6144, 5, 1, {0x22CD, 0x0000}}, // bsime
+    {12332, 8, 1, {0x2290, 0x0000}}, // sqsupset
+    {10693, 5, 1, {0x21BA, 0x0000}}, // olarr
+    {2437, 6, 1, {0x0143, 0x0000}}, // Nacute
+    {152, 4, 1, {0x212C, 0x0000}}, // Bscr
+    {10803, 7, 1, {0x2A57, 0x0000}}, // orslope
+    {514, 3, 2, {0xD835, 0xDD07}}, // Dfr
+    {971, 17, 1, {0x2956, 0x0000}}, // DownLeftVectorBar
+    {7276, 3, 1, {0x2113, 0x0000}}, // ell
+    {10789, 4, 1, {0x00BA, 0x0000}}, // ordm
+    {10059, 6, 1, {0x22EC, 0x0000}}, // nltrie
+    {9900, 3, 2, {0xD835, 0xDD2B}}, // nfr
+    {5123, 6, 1, {0x0179, 0x0000}}, // Zacute
+    {6541, 6, 1, {0x222E, 0x0000}}, // conint
+    {506, 3, 1, {0x2207, 0x0000}}, // Del
+    {7117, 6, 1, {0x231F, 0x0000}}, // drcorn
+    {9263, 3, 1, {0x25CA, 0x0000}}, // loz
+    {13793, 5, 1, {0x25EF, 0x0000}}, // xcirc
+    {11591, 3, 1, {0x03C1, 0x0000}}, // rho
+    {1568, 3, 1, {0x0418, 0x0000}}, // Icy
+    {13032, 14, 1, {0x22B4, 0x0000}}, // trianglelefteq
+    {9974, 5, 1, {0x21CD, 0x0000}}, // nlArr
+    {585, 16, 1, {0x02DC, 0x0000}}, // DiacriticalTilde
+    {9828, 4, 1, {0x2A42, 0x0000}}, // ncup
+    {7226, 6, 1, {0x2255, 0x0000}}, // ecolon
+    {10501, 6, 1, {0x22AD, 0x0000}}, // nvDash
+    {8647, 4, 1, {0x2AAD, 0x0000}}, // late
+    {10745, 4, 2, {0xD835, 0xDD60}}, // oopf
+    {8821, 14, 1, {0x2194, 0x0000}}, // leftrightarrow
+    {8004, 6, 1, {0x200A, 0x0000}}, // hairsp
+    {13881, 6, 1, {0x2A04, 0x0000}}, // xuplus
+    {11316, 8, 1, {0x29B3, 0x0000}}, // raemptyv
+    {11821, 6, 1, {0x2994, 0x0000}}, // rpargt
+    {12006, 6, 1, {0x2925, 0x0000}}, // searhk
+    {9958, 2, 1, {0x220B, 0x0000}}, // ni
+    {8550, 6, 1, {0x2112, 0x0000}}, // lagran
+    {1659, 5, 1, {0x012E, 0x0000}}, // Iogon
+    {1668, 4, 1, {0x0399, 0x0000}}, // Iota
+    {13965, 6, 1, {0x2128, 0x0000}}, // zeetrf
+    {11149, 5, 1, {0x2AB9, 0x0000}}, // prnap
+    {12921, 5, 1, {0x02DC, 0x0000}}, // tilde
+    {9319, 6, 1, {0x2039, 0x0000}}, // lsaquo
+    {10921, 3, 1, {0x03C6, 0x0000}}, // phi
+    {672, 15, 1, {0x21D3, 0x0000}}, // DoubleDownArrow
+    {6176, 4, 1, {0x224E, 0x0000}}, // bump
+    {11594, 4, 1, {0x03F1, 0x0000}}, // rhov
+    {3553, 2, 1, {0x03A0, 0x0000}}, // Pi
+    {6341, 4, 1, {0x29C3, 0x0000}}, // cirE
+    {1591, 10, 1, {0x2148, 0x0000}}, // ImaginaryI
+    {8281, 6, 1, {0x2105, 0x0000}}, // incare
+    {7393, 10, 1, {0x2A96, 0x0000}}, // eqslantgtr
+    {8410, 2, 1, {0x2062, 0x0000}}, // it
+    {7771, 8, 1, {0x2A7E, 0x0000}}, // geqslant
+    {8974, 9, 1, {0x22DA, 0x0000}}, // lesseqgtr
+    {13008, 12, 1, {0x25BF, 0x0000}}, // triangledown
+    {5242, 5, 1, {0x2A3F, 0x0000}}, // amalg
+    {4419, 8, 1, {0x227B, 0x0000}}, // Succeeds
+    {10763, 2, 1, {0x2228, 0x0000}}, // or
+    {10559, 6, 1, {0x2903, 0x0000}}, // nvrArr
+    {3072, 19, 2, {0x29D0, 0x0338}}, // NotRightTriangleBar
+    {7241, 5, 1, {0x2252, 0x0000}}, // efDot
+    {6170, 6, 1, {0x2022, 0x0000}}, // bullet
+    {11553, 4, 1, {0x25AD, 0x0000}}, // rect
+    {12365, 4, 1, {0x25AA, 0x0000}}, // squf
+    {7137, 4, 1, {0x29F6, 0x0000}}, // dsol
+    {9913, 5, 2, {0x2267, 0x0338}}, // ngeqq
+    {8014, 6, 1, {0x210B, 0x0000}}, // hamilt
+    {6874, 5, 1, {0x03B4, 0x0000}}, // delta
+    {2337, 4, 2, {0xD835, 0xDD43}}, // Lopf
+    {2688, 10, 1, {0x226F, 0x0000}}, // NotGreater
+    {8641, 6, 1, {0x2919, 0x0000}}, // latail
+    {9395, 6, 1, {0x2976, 0x0000}}, // ltlarr
+    {547, 22, 1, {0x02DD, 0x0000}}, // DiacriticalDoubleAcute
+    {383, 15, 1, {0x222E, 0x0000}}, // ContourIntegral
+    {230, 4, 1, {0x010A, 0x0000}}, // Cdot
+    {13546, 12, 2, {0x228A, 0xFE00}}, // varsubsetneq
+    {10051, 3, 1, {0x226E, 0x0000}}, // nlt
+    {6969, 6, 1, {0x22C7, 0x0000}}, // divonx
+    {12147, 4, 1, {0x2A9D, 0x0000}}, // siml
+    {4402, 6, 1, {0x22D0, 0x0000}}, // Subset
+    {13199, 4, 1, {0x2191, 0x0000}}, // uarr
+    {8181, 5, 1, {0x00EE, 0x0000}}, // icirc
+    {3321, 17, 1, {0x2247, 0x0000}}, // NotTildeFullEqual
+    {2226, 3, 2, {0xD835, 0xDD0F}}, // Lfr
+    {6618, 5, 1, {0x22DE, 0x0000}}, // cuepr
+    {10715, 3, 1, {0x29C0, 0x0000}}, // olt
+    {11239, 4, 2, {0xD835, 0xDCC6}}, // qscr
+    {1318, 6, 1, {0x03DC, 0x0000}}, // Gammad
+    {5369, 8, 1, {0x299D, 0x0000}}, // angrtvbd
+    {5866, 4, 1, {0x2310, 0x0000}}, // bnot
+    {6094, 5, 1, {0x255E, 0x0000}}, // boxvR
+    {9730, 6, 1, {0x0144, 0x0000}}, // nacute
+    {13807, 3, 2, {0xD835, 0xDD35}}, // xfr
+    {13958, 3, 1, {0x0437, 0x0000}}, // zcy
+    {3468, 4, 2, {0xD835, 0xDCAA}}, // Oscr
+    {3195, 14, 1, {0x2288, 0x0000}}, // NotSubsetEqual
+    {8300, 6, 1, {0x0131, 0x0000}}, // inodot
+    {7882, 5, 1, {0x0060, 0x0000}}, // grave
+    {199, 7, 1, {0x212D, 0x0000}}, // Cayleys
+    {7156, 5, 1, {0x25BE, 0x0000}}, // dtrif
+    {7403, 11, 1, {0x2A95, 0x0000}}, // eqslantless
+    {7515, 13, 1, {0x2252, 0x0000}}, // fallingdotseq
+    {2385, 3, 1, {0x2905, 0x0000}}, // Map
+    {11751, 5, 1, {0x21CC, 0x0000}}, // rlhar
+    {4668, 5, 1, {0x040E, 0x0000}}, // Ubrcy
+    {1499, 14, 1, {0x2500, 0x0000}}, // HorizontalLine
+    {8030, 7, 1, {0x2948, 0x0000}}, // harrcir
+    {1185, 10, 1, {0x2242, 0x0000}}, // EqualTilde
+    {5580, 6, 1, {0x2235, 0x0000}}, // becaus
+    {7268, 8, 1, {0x23E7, 0x0000}}, // elinters
+    {8081, 8, 1, {0x2925, 0x0000}}, // hksearow
+    {119, 7, 1, {0x2235, 0x0000}}, // Because
+    {12108, 6, 1, {0x03C2, 0x0000}}, // sigmaf
+    {13480, 10, 1, {0x03F5, 0x0000}}, // varepsilon
+    {4026, 17, 1, {0x294F, 0x0000}}, // RightUpDownVector
+    {13663, 6, 1, {0x007C, 0x0000}}, // verbar
+    {9336, 5, 1, {0x2A8D, 0x0000}}, // lsime
+    {5129, 6, 1, {0x017D, 0x0000}}, // Zcaron
+    {9991, 3, 1, {0x2270, 0x0000}}, // nle
+    {7761, 3, 1, {0x22DB, 0x0000}}, // gel
+    {13490, 8, 1, {0x03F0, 0x0000}}, // varkappa
+    {12024, 4, 1, {0x00A7, 0x0000}}, // sect
+    {5395, 5, 1, {0x0105, 0x0000}}, // aogon
+    {7934, 9, 1, {0x2A86, 0x0000}}, // gtrapprox
+    {1672, 4, 1, {0x2110, 0x0000}}, // Iscr
+    {3209, 11, 1, {0x2281, 0x0000}}, // NotSucceeds
+    {7460, 5, 1, {0x2250, 0x0000}}, // esdot
+    {10813, 4, 1, {0x2134, 0x0000}}, // oscr
+    {5142, 14, 1, {0x200B, 0x0000}}, // ZeroWidthSpace
+    {7141, 6, 1, {0x0111, 0x0000}}, // dstrok
+    {12420, 11, 1, {0x03D5, 0x0000}}, // straightphi
+    {13673, 3, 2, {0xD835, 0xDD33}}, // vfr
+    {10242, 3, 1, {0x2281, 0x0000}}, // nsc
+    {7363, 7, 1, {0x03B5, 0x0000}}, // epsilon
+    {8967, 7, 1, {0x22D6, 0x0000}}, // lessdot
+    {2600, 4, 1, {0x2115, 0x0000}}, // Nopf
+    {4178, 6, 1, {0x042C, 0x0000}}, // SOFTcy
+    {4809, 11, 1, {0x2195, 0x0000}}, // UpDownArrow
+    {10544, 4, 2, {0x2264, 0x20D2}}, // nvle
+    {9840, 2, 1, {0x2260, 0x0000}}, // ne
+    {10361, 5, 1, {0x2281, 0x0000}}, // nsucc
+    {11286, 6, 1, {0x291C, 0x0000}}, // rAtail
+    {12539, 6, 1, {0x2AD5, 0x0000}}, // subsub
+    {2553, 14, 1, {0x226A, 0x0000}}, // NestedLessLess
+    {12837, 6, 1, {0x2315, 0x0000}}, // telrec
+    {7009, 8, 1, {0x2251, 0x0000}}, // doteqdot
+    {13646, 6, 1, {0x22BB, 0x0000}}, // veebar
+    {7823, 3, 1, {0x22D9, 0x0000}}, // ggg
+    {9032, 5, 1, {0x21BC, 0x0000}}, // lharu
+    {9132, 5, 1, {0x27EC, 0x0000}}, // loang
+    {5452, 5, 1, {0x2248, 0x0000}}, // asymp
+    {1195, 11, 1, {0x21CC, 0x0000}}, // Equilibrium
+    {4506, 6, 1, {0x22D1, 0x0000}}, // Supset
+    {4687, 6, 1, {0x0170, 0x0000}}, // Udblac
+    {4543, 6, 1, {0x0162, 0x0000}}, // Tcedil
+    {7696, 6, 1, {0x215E, 0x0000}}, // frac78
+    {11035, 8, 1, {0x2A15, 0x0000}}, // pointint
+    {6785, 5, 1, {0x2231, 0x0000}}, // cwint
+    {4347, 14, 1, {0x2290, 0x0000}}, // SquareSuperset
+    {10485, 2, 1, {0x03BD, 0x0000}}, // nu
+    {5541, 6, 1, {0x2305, 0x0000}}, // barwed
+    {5796, 17, 1, {0x25C2, 0x0000}}, // blacktriangleleft
+    {7129, 4, 2, {0xD835, 0xDCB9}}, // dscr
+    {642, 21, 1, {0x222F, 0x0000}}, // DoubleContourIntegral
+    {12311, 10, 1, {0x2291, 0x0000}}, // sqsubseteq
+    {13866, 5, 1, {0x27F6, 0x0000}}, // xrarr
+    {10627, 3, 1, {0x043E, 0x0000}}, // ocy
+    {6434, 4, 1, {0x2257, 0x0000}}, // cire
+    {9022, 2, 1, {0x2276, 0x0000}}, // lg
+    {9803, 6, 1, {0x0148, 0x0000}}, // ncaron
+    {7987, 9, 2, {0x2269, 0xFE00}}, // gvertneqq
+    {7249, 2, 1, {0x2A9A, 0x0000}}, // eg
+    {9305, 6, 1, {0x296D, 0x0000}}, // lrhard
+    {3536, 8, 1, {0x2202, 0x0000}}, // PartialD
+    {3186, 9, 2, {0x2282, 0x20D2}}, // NotSubset
+    {5680, 7, 1, {0x2605, 0x0000}}, // bigstar
+    {4215, 14, 1, {0x2193, 0x0000}}, // ShortDownArrow
+    {4660, 8, 1, {0x2949, 0x0000}}, // Uarrocir
+    {896, 16, 1, {0x21F5, 0x0000}}, // DownArrowUpArrow
+    {8672, 6, 1, {0x005B, 0x0000}}, // lbrack
+    {13892, 4, 1, {0x22C1, 0x0000}}, // xvee
+    {10847, 4, 1, {0x00F6, 0x0000}}, // ouml
+    {12075, 4, 1, {0x0448, 0x0000}}, // shcy
+    {5001, 13, 1, {0x2240, 0x0000}}, // VerticalTilde
+    {7487, 5, 1, {0x2203, 0x0000}}, // exist
+    {2974, 17, 2, {0x2AA1, 0x0338}}, // NotNestedLessLess
+    {8387, 7, 1, {0x22F5, 0x0000}}, // isindot
+    {11047, 5, 1, {0x00A3, 0x0000}}, // pound
+    {7348, 6, 1, {0x29E3, 0x0000}}, // eparsl
+    {11827, 8, 1, {0x2A12, 0x0000}}, // rppolint
+    {11418, 6, 1, {0x291A, 0x0000}}, // ratail
+    {10710, 5, 1, {0x203E, 0x0000}}, // oline
+    {9943, 5, 1, {0x21CE, 0x0000}}, // nhArr
+    {5619, 7, 1, {0x226C, 0x0000}}, // between
+    {12129, 4, 1, {0x2243, 0x0000}}, // sime
+    {13219, 3, 1, {0x0443, 0x0000}}, // ucy
+    {9788, 5, 2, {0x224E, 0x0338}}, // nbump
+    {7109, 8, 1, {0x2910, 0x0000}}, // drbkarow
+    {8709, 5, 1, {0x2308, 0x0000}}, // lceil
+    {4479, 3, 1, {0x2211, 0x0000}}, // Sum
+    {12931, 6, 1, {0x22A0, 0x0000}}, // timesb
+    {87, 6, 1, {0x00C3, 0x0000}}, // Atilde
+    {6577, 4, 2, {0xD835, 0xDCB8}}, // cscr
+    {4198, 6, 1, {0x015E, 0x0000}}, // Scedil
+    {2388, 3, 1, {0x041C, 0x0000}}, // Mcy
+    {13020, 12, 1, {0x25C3, 0x0000}}, // triangleleft
+    {6338, 3, 1, {0x25CB, 0x0000}}, // cir
+    {5779, 17, 1, {0x25BE, 0x0000}}, // blacktriangledown
+    {1067, 4, 2, {0xD835, 0xDC9F}}, // Dscr
+    {12910, 6, 1, {0x223C, 0x0000}}, // thksim
+    {10142, 4, 1, {0x2226, 0x0000}}, // npar
+    {10749, 4, 1, {0x29B7, 0x0000}}, // opar
+    {7868, 5, 1, {0x2269, 0x0000}}, // gneqq
+    {2411, 3, 2, {0xD835, 0xDD10}}, // Mfr
+    {8210, 2, 1, {0x2148, 0x0000}}, // ii
+    {12175, 5, 1, {0x2190, 0x0000}}, // slarr
+    {9793, 6, 2, {0x224F, 0x0338}}, // nbumpe
+    {6501, 4, 1, {0x2201, 0x0000}}, // comp
+    {11956, 4, 1, {0x2AB6, 0x0000}}, // scnE
+    {10966, 6, 1, {0x210F, 0x0000}}, // plankv
+    {8562, 4, 1, {0x27E8, 0x0000}}, // lang
+    {411, 31, 1, {0x2233, 0x0000}}, // CounterClockwiseContourIntegral
+    {8951, 6, 1, {0x2A93, 0x0000}}, // lesges
+    {7316, 6, 1, {0x2004, 0x0000}}, // emsp13
+    {4482, 3, 1, {0x22D1, 0x0000}}, // Sup
+    {9556, 5, 1, {0x00B5, 0x0000}}, // micro
+    {6703, 11, 1, {0x22DF, 0x0000}}, // curlyeqsucc
+    {1611, 8, 1, {0x222B, 0x0000}}, // Integral
+    {517, 16, 1, {0x00B4, 0x0000}}, // DiacriticalAcute
+    {7878, 4, 2, {0xD835, 0xDD58}}, // gopf
+    {7576, 5, 1, {0x25B1, 0x0000}}, // fltns
+    {13762, 6, 1, {0x2118, 0x0000}}, // weierp
+    {12694, 5, 1, {0x2ACC, 0x0000}}, // supnE
+    {11996, 5, 1, {0x2A66, 0x0000}}, // sdote
+    {1144, 20, 1, {0x25AB, 0x0000}}, // EmptyVerySmallSquare
+    {9350, 5, 1, {0x2018, 0x0000}}, // lsquo
+    {5101, 3, 1, {0x042B, 0x0000}}, // Ycy
+    {10758, 5, 1, {0x2295, 0x0000}}, // oplus
+    {1699, 3, 2, {0xD835, 0xDD0D}}, // Jfr
+    {6349, 6, 1, {0x2257, 0x0000}}, // circeq
+    {5482, 5, 1, {0x2A11, 0x0000}}, // awint
+    {13942, 4, 1, {0x00FF, 0x0000}}, // yuml
+    {5196, 5, 1, {0x00B4, 0x0000}}, // acute
+    {2132, 9, 1, {0x21D0, 0x0000}}, // Leftarrow
+    {6075, 5, 1, {0x2514, 0x0000}}, // boxur
+    {7672, 6, 1, {0x215C, 0x0000}}, // frac38
+    {10882, 4, 1, {0x2202, 0x0000}}, // part
+    {4537, 6, 1, {0x0164, 0x0000}}, // Tcaron
+    {6816, 4, 1, {0x2193, 0x0000}}, // darr
+    {13068, 15, 1, {0x22B5, 0x0000}}, // trianglerighteq
+    {7826, 5, 1, {0x2137, 0x0000}}, // gimel
+    {10335, 7, 2, {0x2282, 0x20D2}}, // nsubset
+    {3382, 6, 1, {0x00D3, 0x0000}}, // Oacute
+    {8467, 6, 1, {0x03F0, 0x0000}}, // kappav
+    {6927, 5, 1, {0x2666, 0x0000}}, // diams
+    {6551, 6, 1, {0x2210, 0x0000}}, // coprod
+    {12453, 7, 1, {0x2AC3, 0x0000}}, // subedot
+    {166, 4, 1, {0x00A9, 0x0000}}, // COPY
+    {7438, 8, 1, {0x29E5, 0x0000}}, // eqvparsl
+    {13768, 3, 2, {0xD835, 0xDD34}}, // wfr
+    {25, 3, 1, {0x0410, 0x0000}}, // Acy
+    {6289, 5, 1, {0x00B8, 0x0000}}, // cedil
+    {3490, 4, 1, {0x00D6, 0x0000}}, // Ouml
+    {10655, 5, 1, {0x0153, 0x0000}}, // oelig
+    {13875, 6, 1, {0x2A06, 0x0000}}, // xsqcup
+    {13000, 8, 1, {0x25B5, 0x0000}}, // triangle
+    {12962, 6, 1, {0x2336, 0x0000}}, // topbot
+    {11479, 6, 1, {0x0159, 0x0000}}, // rcaron
+    {10366, 7, 2, {0x2AB0, 0x0338}}, // nsucceq
+    {4458, 13, 1, {0x227F, 0x0000}}, // SucceedsTilde
+    {7004, 5, 1, {0x2250, 0x0000}}, // doteq
+    {1385, 16, 1, {0x2267, 0x0000}}, // GreaterFullEqual
+    {4679, 5, 1, {0x00DB, 0x0000}}, // Ucirc
+    {9355, 6, 1, {0x201A, 0x0000}}, // lsquor
+    {13203, 5, 1, {0x045E, 0x0000}}, // ubrcy
+    {12431, 5, 1, {0x00AF, 0x0000}}, // strns
+    {13657, 6, 1, {0x22EE, 0x0000}}, // vellip
+    {10823, 4, 1, {0x2298, 0x0000}}, // osol
+    {8571, 6, 1, {0x27E8, 0x0000}}, // langle
+    {13619, 16, 1, {0x22B3, 0x0000}}, // vartriangleright
+    {10208, 6, 2, {0x2933, 0x0338}}, // nrarrc
+    {10286, 5, 1, {0x2244, 0x0000}}, // nsime
+    {13108, 5, 1, {0x29CD, 0x0000}}, // trisb
+    {4391, 4, 2, {0xD835, 0xDCAE}}, // Sscr
+    {9725, 5, 1, {0x2207, 0x0000}}, // nabla
+    {6045, 7, 1, {0x229E, 0x0000}}, // boxplus
+    {6947, 3, 1, {0x00F7, 0x0000}}, // div
+    {3544, 3, 1, {0x041F, 0x0000}}, // Pcy
+    {7589, 6, 1, {0x2200, 0x0000}}, // forall
+    {8292, 8, 1, {0x29DD, 0x0000}}, // infintie
+    {11889, 5, 1, {0x25B8, 0x0000}}, // rtrif
+    {12843, 3, 2, {0xD835, 0xDD31}}, // tfr
+    {13993, 4, 2, {0xD835, 0xDCCF}}, // zscr
+    {12353, 6, 1, {0x25A1, 0x0000}}, // square
+    {10251, 4, 2, {0x2AB0, 0x0338}}, // nsce
+    {10953, 6, 1, {0x210F, 0x0000}}, // planck
+    {5282, 5, 1, {0x2220, 0x0000}}, // angle
+    {12974, 4, 2, {0xD835, 0xDD65}}, // topf
+    {9013, 6, 1, {0x230A, 0x0000}}, // lfloor
+    {12161, 7, 1, {0x2A24, 0x0000}}, // simplus
+    {10827, 6, 1, {0x00F5, 0x0000}}, // otilde
+    {1960, 15, 1, {0x294E, 0x0000}}, // LeftRightVector
+    {5250, 3, 1, {0x2227, 0x0000}}, // and
+    {1089, 6, 1, {0x011A, 0x0000}}, // Ecaron
+    {1324, 6, 1, {0x011E, 0x0000}}, // Gbreve
+    {10911, 7, 1, {0x2031, 0x0000}}, // pertenk
+    {9509, 8, 1, {0x21A5, 0x0000}}, // mapstoup
+    {4715, 10, 1, {0x23DF, 0x0000}}, // UnderBrace
+    {4534, 3, 1, {0x03A4, 0x0000}}, // Tau
+    {8939, 8, 1, {0x2A83, 0x0000}}, // lesdotor
+    {12814, 4, 1, {0x23B4, 0x0000}}, // tbrk
+    {4972, 12, 1, {0x007C, 0x0000}}, // VerticalLine
+    {7293, 5, 1, {0x2205, 0x0000}}, // empty
+    {9736, 4, 2, {0x2220, 0x20D2}}, // nang
+    {13141, 6, 1, {0x0167, 0x0000}}, // tstrok
+    {11460, 5, 1, {0x298C, 0x0000}}, // rbrke
+    {10297, 5, 1, {0x2224, 0x0000}}, // nsmid
+    {10918, 3, 2, {0xD835, 0xDD2D}}, // pfr
+    {7298, 8, 1, {0x2205, 0x0000}}, // emptyset
+    {6231, 6, 1, {0x2A40, 0x0000}}, // capdot
+    {13926, 4, 1, {0x0457, 0x0000}}, // yicy
+    {7702, 5, 1, {0x2044, 0x0000}}, // frasl
+    {10231, 5, 1, {0x22EB, 0x0000}}, // nrtri
+    {6658, 6, 1, {0x2A4A, 0x0000}}, // cupcup
+    {8495, 4, 1, {0x045C, 0x0000}}, // kjcy
+    {11382, 6, 1, {0x21AA, 0x0000}}, // rarrhk
+    {8482, 3, 2, {0xD835, 0xDD28}}, // kfr
+    {2951, 23, 2, {0x2AA2, 0x0338}}, // NotNestedGreaterGreater
+    {4942, 6, 1, {0x2AE6, 0x0000}}, // Vdashl
+    {12449, 4, 1, {0x2286, 0x0000}}, // sube
+    {5349, 8, 1, {0x29AF, 0x0000}}, // angmsdah
+    {8850, 17, 1, {0x21CB, 0x0000}}, // leftrightharpoons
+    {12861, 5, 1, {0x03B8, 0x0000}}, // theta
+    {7974, 7, 1, {0x2277, 0x0000}}, // gtrless
+    {5220, 7, 1, {0x2135, 0x0000}}, // alefsym
+    {10054, 5, 1, {0x22EA, 0x0000}}, // nltri
+    {10517, 6, 1, {0x22AC, 0x0000}}, // nvdash
+    {6644, 8, 1, {0x2A48, 0x0000}}, // cupbrcap
+    {9024, 3, 1, {0x2A91, 0x0000}}, // lgE
+    {2141, 14, 1, {0x21D4, 0x0000}}, // Leftrightarrow
+    {5813, 18, 1, {0x25B8, 0x0000}}, // blacktriangleright
+    {8309, 6, 1, {0x22BA, 0x0000}}, // intcal
+    {4758, 9, 1, {0x228E, 0x0000}}, // UnionPlus
+    {8479, 3, 1, {0x043A, 0x0000}}, // kcy
+    {13310, 7, 1, {0x2191, 0x0000}}, // uparrow
+    {702, 20, 1, {0x21D4, 0x0000}}, // DoubleLeftRightArrow
+    {7911, 5, 1, {0x2A7A, 0x0000}}, // gtcir
+    {12359, 6, 1, {0x25AA, 0x0000}}, // squarf
+    {4957, 4, 1, {0x2016, 0x0000}}, // Vert
+    {377, 6, 1, {0x222F, 0x0000}}, // Conint
+    {2574, 3, 2, {0xD835, 0xDD11}}, // Nfr
+    {2604, 3, 1, {0x2AEC, 0x0000}}, // Not
+    {12219, 4, 1, {0x2AAC, 0x0000}}, // smte
+    {8438, 5, 1, {0x0237, 0x0000}}, // jmath
+    {3952, 13, 1, {0x21A6, 0x0000}}, // RightTeeArrow
+    {11043, 4, 2, {0xD835, 0xDD61}}, // popf
+    {5204, 5, 1, {0x00E6, 0x0000}}, // aelig
+    {11008, 5, 1, {0x2A72, 0x0000}}, // pluse
+    {9936, 3, 1, {0x226F, 0x0000}}, // ngt
+    {11927, 4, 1, {0x2AB8, 0x0000}}, // scap
+    {10325, 5, 2, {0x2AC5, 0x0338}}, // nsubE
+    {1245, 17, 1, {0x25FC, 0x0000}}, // FilledSmallSquare
+    {4915, 6, 1, {0x0168, 0x0000}}, // Utilde
+    {1563, 5, 1, {0x00CE, 0x0000}}, // Icirc
+    {2231, 10, 1, {0x21DA, 0x0000}}, // Lleftarrow
+    {234, 7, 1, {0x00B8, 0x0000}}, // Cedilla
+    {116, 3, 1, {0x0411, 0x0000}}, // Bcy
+    {2939, 12, 1, {0x2274, 0x0000}}, // NotLessTilde
+    {2423, 4, 2, {0xD835, 0xDD44}}, // Mopf
+    {10739, 6, 1, {0x2296, 0x0000}}, // ominus
+    {8042, 4, 1, {0x210F, 0x0000}}, // hbar
+    {13440, 5, 1, {0x21C8, 0x0000}}, // uuarr
+    {9287, 5, 1, {0x21C6, 0x0000}}, // lrarr
+    {5107, 4, 2, {0xD835, 0xDD50}}, // Yopf
+    {9067, 6, 1, {0x296B, 0x0000}}, // llhard
+    {7581, 4, 1, {0x0192, 0x0000}}, // fnof
+    {1772, 4, 1, {0x27EA, 0x0000}}, // Lang
+    {11937, 5, 1, {0x227D, 0x0000}}, // sccue
+    {6278, 7, 1, {0x2A50, 0x0000}}, // ccupssm
+    {8736, 7, 1, {0x2967, 0x0000}}, // ldrdhar
+    {5933, 5, 1, {0x255D, 0x0000}}, // boxUL
+    {12064, 5, 1, {0x266F, 0x0000}}, // sharp
+    {9238, 6, 1, {0x2A2D, 0x0000}}, // loplus
+    {6511, 10, 1, {0x2201, 0x0000}}, // complement
+    {1483, 12, 1, {0x210B, 0x0000}}, // HilbertSpace
+    {9887, 6, 1, {0x2204, 0x0000}}, // nexist
+    {10186, 5, 1, {0x2280, 0x0000}}, // nprec
+    {13952, 6, 1, {0x017E, 0x0000}}, // zcaron
+    {11850, 3, 1, {0x21B1, 0x0000}}, // rsh
+    {3338, 13, 1, {0x2249, 0x0000}}, // NotTildeTilde
+    {8010, 4, 1, {0x00BD, 0x0000}}, // half
+    {6065, 5, 1, {0x2558, 0x0000}}, // boxuR
+    {6211, 8, 1, {0x2A49, 0x0000}}, // capbrcup
+    {1006, 15, 1, {0x21C1, 0x0000}}, // DownRightVector
+    {7843, 3, 1, {0x2AA4, 0x0000}}, // glj
+    {12880, 11, 1, {0x2248, 0x0000}}, // thickapprox
+    {2067, 15, 1, {0x2960, 0x0000}}, // LeftUpTeeVector
+    {12001, 5, 1, {0x21D8, 0x0000}}, // seArr
+    {3979, 13, 1, {0x22B3, 0x0000}}, // RightTriangle
+    {11073, 10, 1, {0x2AB7, 0x0000}}, // precapprox
+    {12436, 3, 1, {0x2282, 0x0000}}, // sub
+    {5600, 5, 1, {0x03F6, 0x0000}}, // bepsi
+    {12514, 9, 1, {0x228A, 0x0000}}, // subsetneq
+    {2155, 16, 1, {0x22DA, 0x0000}}, // LessEqualGreater
+    {12601, 8, 1, {0x22E9, 0x0000}}, // succnsim
+    {7190, 5, 1, {0x2A77, 0x0000}}, // eDDot
+    {4395, 4, 1, {0x22C6, 0x0000}}, // Star
+    {10753, 5, 1, {0x29B9, 0x0000}}, // operp
+    {13832, 4, 1, {0x27FC, 0x0000}}, // xmap
+    {11922, 2, 1, {0x227B, 0x0000}}, // sc
+    {7199, 6, 1, {0x00E9, 0x0000}}, // eacute
+    {5445, 4, 2, {0xD835, 0xDCB6}}, // ascr
+    {4833, 5, 1, {0x22A5, 0x0000}}, // UpTee
+    {6472, 5, 1, {0x003A, 0x0000}}, // colon
+    {8529, 3, 1, {0x2A8B, 0x0000}}, // lEg
+    {10934, 5, 1, {0x260E, 0x0000}}, // phone
+    {321, 21, 1, {0x201D, 0x0000}}, // CloseCurlyDoubleQuote
+    {12811, 3, 1, {0x03C4, 0x0000}}, // tau
+    {12978, 7, 1, {0x2ADA, 0x0000}}, // topfork
+    {7344, 4, 1, {0x22D5, 0x0000}}, // epar
+    {12384, 6, 1, {0x2323, 0x0000}}, // ssmile
+    {5575, 5, 1, {0x201E, 0x0000}}, // bdquo
+    {1083, 6, 1, {0x00C9, 0x0000}}, // Eacute
+    {4684, 3, 1, {0x0423, 0x0000}}, // Ucy
+    {1906, 14, 1, {0x21C3, 0x0000}}, // LeftDownVector
+    {8794, 13, 1, {0x21BC, 0x0000}}, // leftharpoonup
+    {7205, 6, 1, {0x2A6E, 0x0000}}, // easter
+    {6879, 7, 1, {0x29B1, 0x0000}}, // demptyv
+    {10572, 5, 2, {0x223C, 0x20D2}}, // nvsim
+    {2109, 10, 1, {0x21BC, 0x0000}}, // LeftVector
+    {7331, 4, 1, {0x2002, 0x0000}}, // ensp
+    {4921, 4, 1, {0x00DC, 0x0000}}, // Uuml
+    {5201, 3, 1, {0x0430, 0x0000}}, // acy
+    {12771, 5, 1, {0x21D9, 0x0000}}, // swArr
+    {8580, 5, 1, {0x00AB, 0x0000}}, // laquo
+    {9948, 5, 1, {0x21AE, 0x0000}}, // nharr
+    {2217, 9, 1, {0x2272, 0x0000}}, // LessTilde
+    {3432, 20, 1, {0x201C, 0x0000}}, // OpenCurlyDoubleQuote
+    {6017, 5, 1, {0x2565, 0x0000}}, // boxhD
+    {3709, 4, 1, {0x21A0, 0x0000}}, // Rarr
+    {11127, 7, 1, {0x227E, 0x0000}}, // precsim
+    {265, 11, 1, {0x2296, 0x0000}}, // CircleMinus
+    {11225, 4, 1, {0x2A0C, 0x0000}}, // qint
+    {1336, 5, 1, {0x011C, 0x0000}}, // Gcirc
+    {12168, 7, 1, {0x2972, 0x0000}}, // simrarr
+    {1169, 4, 2, {0xD835, 0xDD3C}}, // Eopf
+    {11853, 4, 1, {0x005D, 0x0000}}, // rsqb
+    {11817, 4, 1, {0x0029, 0x0000}}, // rpar
+    {13822, 5, 1, {0x27F8, 0x0000}}, // xlArr
+    {9644, 8, 1, {0x22B8, 0x0000}}, // multimap
+    {11525, 4, 1, {0x21B3, 0x0000}}, // rdsh
+    {4258, 12, 1, {0x2191, 0x0000}}, // ShortUpArrow
+    {5605, 6, 1, {0x212C, 0x0000}}, // bernou
+    {10523, 4, 2, {0x2265, 0x20D2}}, // nvge
+    {13420, 5, 1, {0x22F0, 0x0000}}, // utdot
+    {7864, 4, 1, {0x2A88, 0x0000}}, // gneq
+    {4579, 9, 1, {0x2009, 0x0000}}, // ThinSpace
+    {3731, 3, 1, {0x0420, 0x0000}}, // Rcy
+    {9281, 6, 1, {0x2993, 0x0000}}, // lparlt
+    {9719, 6, 1, {0x22AE, 0x0000}}, // nVdash
+    {13400, 6, 1, {0x230E, 0x0000}}, // urcrop
+    {5293, 8, 1, {0x29A8, 0x0000}}, // angmsdaa
+    {12058, 6, 1, {0x2322, 0x0000}}, // sfrown
+    {10689, 4, 1, {0x222E, 0x0000}}, // oint
+    {13902, 6, 1, {0x00FD, 0x0000}}, // yacute
+    {9893, 7, 1, {0x2204, 0x0000}}, // nexists
+    {8173, 6, 1, {0x00ED, 0x0000}}, // iacute
+    {6149, 4, 1, {0x005C, 0x0000}}, // bsol
+    {9160, 18, 1, {0x27F7, 0x0000}}, // longleftrightarrow
+    {8926, 6, 1, {0x2A7F, 0x0000}}, // lesdot
+    {5572, 3, 1, {0x0431, 0x0000}}, // bcy
+    {9048, 4, 1, {0x0459, 0x0000}}, // ljcy
+    {7727, 5, 1, {0x03B3, 0x0000}}, // gamma
+    {10901, 6, 1, {0x2030, 0x0000}}, // permil
+    {3865, 18, 1, {0x27E7, 0x0000}}, // RightDoubleBracket
+    {5535, 6, 1, {0x22BD, 0x0000}}, // barvee
+    {5271, 4, 1, {0x2A5A, 0x0000}}, // andv
+    {9979, 3, 2, {0x2266, 0x0338}}, // nlE
+    {6370, 16, 1, {0x21BB, 0x0000}}, // circlearrowright
+    {10895, 6, 1, {0x002E, 0x0000}}, // period
+    {8807, 14, 1, {0x21C7, 0x0000}}, // leftleftarrows
+    {8601, 6, 1, {0x291D, 0x0000}}, // larrfs
+    {2119, 13, 1, {0x2952, 0x0000}}, // LeftVectorBar
+    {5877, 6, 1, {0x22A5, 0x0000}}, // bottom
+    {9090, 10, 1, {0x23B0, 0x0000}}, // lmoustache
+    {5889, 5, 1, {0x2557, 0x0000}}, // boxDL
+    {7554, 3, 2, {0xD835, 0xDD23}}, // ffr
+    {9147, 13, 1, {0x27F5, 0x0000}}, // longleftarrow
+    {13431, 4, 1, {0x25B5, 0x0000}}, // utri
+    {12400, 5, 1, {0x2605, 0x0000}}, // starf
+    {8577, 3, 1, {0x2A85, 0x0000}}, // lap
+    {1307, 4, 1, {0x0403, 0x0000}}, // GJcy
+    {8835, 15, 1, {0x21C6, 0x0000}}, // leftrightarrows
+    {11795, 5, 1, {0x2986, 0x0000}}, // ropar
+    {12237, 4, 1, {0x29C4, 0x0000}}, // solb
+    {11057, 4, 1, {0x2AB7, 0x0000}}, // prap
+    {2374, 3, 1, {0x21B0, 0x0000}}, // Lsh
+    {9632, 4, 2, {0xD835, 0xDCC2}}, // mscr
+    {13301, 5, 1, {0x0173, 0x0000}}, // uogon
+    {10087, 8, 2, {0x22F5, 0x0338}}, // notindot
+    {8613, 6, 1, {0x21AB, 0x0000}}, // larrlp
+    {9918, 9, 2, {0x2A7E, 0x0338}}, // ngeqslant
+    {7747, 5, 1, {0x011D, 0x0000}}, // gcirc
+    {10236, 6, 1, {0x22ED, 0x0000}}, // nrtrie
+    {6060, 5, 1, {0x255B, 0x0000}}, // boxuL
+    {5464, 6, 1, {0x00E3, 0x0000}}, // atilde
+    {2798, 15, 2, {0x224E, 0x0338}}, // NotHumpDownHump
+    {6140, 4, 1, {0x223D, 0x0000}}, // bsim
+    {10972, 4, 1, {0x002B, 0x0000}}, // plus
+    {8108, 13, 1, {0x21A9, 0x0000}}, // hookleftarrow
+    {9835, 5, 1, {0x2013, 0x0000}}, // ndash
+    {1725, 4, 1, {0x040C, 0x0000}}, // KJcy
+    {3375, 2, 1, {0x039D, 0x0000}}, // Nu
+    {10455, 14, 1, {0x22EB, 0x0000}}, // ntriangleright
+    {13416, 4, 2, {0xD835, 0xDCCA}}, // uscr
+    {8149, 6, 1, {0x210F, 0x0000}}, // hslash
+    {9052, 2, 1, {0x226A, 0x0000}}, // ll
+    {6084, 5, 1, {0x256A, 0x0000}}, // boxvH
+    {11580, 5, 1, {0x21C0, 0x0000}}, // rharu
+    {11388, 6, 1, {0x21AC, 0x0000}}, // rarrlp
+    {13785, 4, 2, {0xD835, 0xDCCC}}, // wscr
+    {8730, 6, 1, {0x201E, 0x0000}}, // ldquor
+    {1472, 3, 1, {0x005E, 0x0000}}, // Hat
+    {8423, 4, 1, {0x00EF, 0x0000}}, // iuml
+    {5357, 5, 1, {0x221F, 0x0000}}, // angrt
+    {8394, 5, 1, {0x22F4, 0x0000}}, // isins
+    {5188, 3, 1, {0x223F, 0x0000}}, // acd
+    {8918, 3, 1, {0x2A7D, 0x0000}}, // les
+    {11684, 16, 1, {0x21C9, 0x0000}}, // rightrightarrows
+    {7716, 2, 1, {0x2267, 0x0000}}, // gE
+    {5034, 4, 2, {0xD835, 0xDCB1}}, // Vscr
+    {9277, 4, 1, {0x0028, 0x0000}}, // lpar
+    {3521, 15, 1, {0x23DC, 0x0000}}, // OverParenthesis
+    {10718, 5, 1, {0x014D, 0x0000}}, // omacr
+    {6767, 5, 1, {0x22CE, 0x0000}}, // cuvee
+    {621, 4, 2, {0xD835, 0xDD3B}}, // Dopf
+    {10606, 2, 1, {0x24C8, 0x0000}}, // oS
+    {6205, 6, 1, {0x2A44, 0x0000}}, // capand
+    {1586, 5, 1, {0x012A, 0x0000}}, // Imacr
+    {126, 10, 1, {0x212C, 0x0000}}, // Bernoullis
+    {7782, 5, 1, {0x2AA9, 0x0000}}, // gescc
+    {6032, 5, 1, {0x2534, 0x0000}}, // boxhu
+    {10037, 4, 2, {0x2A7D, 0x0338}}, // nles
+    {5156, 4, 1, {0x0396, 0x0000}}, // Zeta
+    {2648, 10, 1, {0x2209, 0x0000}}, // NotElement
+    {3673, 3, 1, {0x03A8, 0x0000}}, // Psi
+    {8274, 5, 1, {0x01B5, 0x0000}}, // imped
+    {9876, 6, 1, {0x2928, 0x0000}}, // nesear
+    {13083, 6, 1, {0x25EC, 0x0000}}, // tridot
+    {13282, 6, 1, {0x230F, 0x0000}}, // ulcrop
+    {5065, 3, 2, {0xD835, 0xDD1B}}, // Xfr
+    {13802, 5, 1, {0x25BD, 0x0000}}, // xdtri
+    {4212, 3, 2, {0xD835, 0xDD16}}, // Sfr
+    {12899, 6, 1, {0x2009, 0x0000}}, // thinsp
+    {9234, 4, 2, {0xD835, 0xDD5D}}, // lopf
+    {11305, 6, 1, {0x0155, 0x0000}}, // racute
+    {1687, 4, 1, {0x00CF, 0x0000}}, // Iuml
+    {5909, 4, 1, {0x2550, 0x0000}}, // boxH
+    {11790, 5, 1, {0x27E7, 0x0000}}, // robrk
+    {2007, 12, 1, {0x22B2, 0x0000}}, // LeftTriangle
+    {8037, 5, 1, {0x21AD, 0x0000}}, // harrw
+    {1221, 6, 1, {0x2203, 0x0000}}, // Exists
+    {4899, 7, 1, {0x03A5, 0x0000}}, // Upsilon
+    {2763, 20, 2, {0x2A7E, 0x0338}}, // NotGreaterSlantEqual
+    {2512, 21, 1, {0x200B, 0x0000}}, // NegativeVeryThinSpace
+    {13498, 10, 1, {0x2205, 0x0000}}, // varnothing
+    {176, 3, 1, {0x22D2, 0x0000}}, // Cap
+    {9636, 6, 1, {0x223E, 0x0000}}, // mstpos
+    {10382, 5, 1, {0x2289, 0x0000}}, // nsupe
+    {12616, 3, 1, {0x2211, 0x0000}}, // sum
+    {9576, 6, 1, {0x00B7, 0x0000}}, // middot
+    {10095, 7, 1, {0x2209, 0x0000}}, // notinva
+    {12156, 5, 1, {0x2246, 0x0000}}, // simne
+    {5611, 4, 1, {0x03B2, 0x0000}}, // beta
+    {9489, 10, 1, {0x21A7, 0x0000}}, // mapstodown
+    {12666, 7, 1, {0x27C9, 0x0000}}, // suphsol
+    {9537, 13, 1, {0x2221, 0x0000}}, // measuredangle
+    {10487, 3, 1, {0x0023, 0x0000}}, // num
+    {13596, 8, 1, {0x03D1, 0x0000}}, // vartheta
+    {7618, 6, 1, {0x2153, 0x0000}}, // frac13
+    {6585, 5, 1, {0x2AD1, 0x0000}}, // csube
+    {12717, 8, 1, {0x2287, 0x0000}}, // supseteq
+    {13113, 7, 1, {0x2A3B, 0x0000}}, // tritime
+    {10773, 5, 1, {0x2134, 0x0000}}, // order
+    {6495, 6, 1, {0x0040, 0x0000}}, // commat
+    {7426, 5, 1, {0x2261, 0x0000}}, // equiv
+    {12038, 8, 1, {0x2216, 0x0000}}, // setminus
+    {5851, 5, 1, {0x2588, 0x0000}}, // block
+    {13464, 5, 1, {0x2AE9, 0x0000}}, // vBarv
+    {9561, 3, 1, {0x2223, 0x0000}}, // mid
+    {6810, 6, 1, {0x2138, 0x0000}}, // daleth
+    {3853, 12, 1, {0x2309, 0x0000}}, // RightCeiling
+    {7900, 5, 1, {0x2A90, 0x0000}}, // gsiml
+    {4427, 13, 1, {0x2AB0, 0x0000}}, // SucceedsEqual
+    {9642, 2, 1, {0x03BC, 0x0000}}, // mu
+    {12321, 5, 1, {0x2290, 0x0000}}, // sqsup
+    {3236, 21, 1, {0x22E1, 0x0000}}, // NotSucceedsSlantEqual
+    {4855, 11, 1, {0x21D5, 0x0000}}, // Updownarrow
+    {1946, 14, 1, {0x2194, 0x0000}}, // LeftRightArrow
+    {1842, 19, 1, {0x21C6, 0x0000}}, // LeftArrowRightArrow
+    {1830, 12, 1, {0x21E4, 0x0000}}, // LeftArrowBar
+    {4650, 6, 1, {0x00DA, 0x0000}}, // Uacute
+    {2431, 2, 1, {0x039C, 0x0000}}, // Mu
+    {7166, 5, 1, {0x296F, 0x0000}}, // duhar
+    {13274, 8, 1, {0x231C, 0x0000}}, // ulcorner
+    {5923, 5, 1, {0x2564, 0x0000}}, // boxHd
+    {6864, 7, 1, {0x2A77, 0x0000}}, // ddotseq
+    {9906, 3, 1, {0x2271, 0x0000}}, // nge
+    {4123, 4, 1, {0x211D, 0x0000}}, // Ropf
+    {13263, 5, 1, {0x2580, 0x0000}}, // uhblk
+    {13751, 5, 1, {0x2227, 0x0000}}, // wedge
+    {1180, 5, 1, {0x2A75, 0x0000}}, // Equal
+    {8585, 4, 1, {0x2190, 0x0000}}, // larr
+    {7905, 2, 1, {0x003E, 0x0000}}, // gt
+    {4318, 12, 1, {0x228F, 0x0000}}, // SquareSubset
+    {9142, 5, 1, {0x27E6, 0x0000}}, // lobrk
+    {6824, 5, 1, {0x22A3, 0x0000}}, // dashv
+    {13669, 4, 1, {0x007C, 0x0000}}, // vert
+    {2292, 13, 1, {0x27F8, 0x0000}}, // Longleftarrow
+    {10135, 7, 1, {0x22FD, 0x0000}}, // notnivc
+    {5309, 8, 1, {0x29AA, 0x0000}}, // angmsdac
+    {6099, 5, 1, {0x253C, 0x0000}}, // boxvh
+    {5648, 7, 1, {0x2A00, 0x0000}}, // bigodot
+    {1287, 6, 1, {0x2200, 0x0000}}, // ForAll
+    {13705, 4, 2, {0xD835, 0xDCCB}}, // vscr
+    {12012, 5, 1, {0x2198, 0x0000}}, // searr
+    {13469, 5, 1, {0x22A8, 0x0000}}, // vDash
+    {3622, 13, 1, {0x227E, 0x0000}}, // PrecedesTilde
+    {10859, 4, 1, {0x00B6, 0x0000}}, // para
+    {11273, 4, 1, {0x0022, 0x0000}}, // quot
+    {9314, 5, 1, {0x22BF, 0x0000}}, // lrtri
+    {9553, 3, 1, {0x2127, 0x0000}}, // mho
+    {7239, 2, 1, {0x2147, 0x0000}}, // ee
+    {7808, 4, 2, {0x22DB, 0xFE00}}, // gesl
+    {1575, 3, 1, {0x2111, 0x0000}}, // Ifr
+    {11400, 7, 1, {0x2974, 0x0000}}, // rarrsim
+    {5422, 4, 1, {0x0027, 0x0000}}, // apos
+    {3273, 11, 2, {0x2283, 0x20D2}}, // NotSuperset
+    {6664, 6, 1, {0x228D, 0x0000}}, // cupdot
+    {6547, 4, 2, {0xD835, 0xDD54}}, // copf
+    {1861, 11, 1, {0x2308, 0x0000}}, // LeftCeiling
+    {2495, 17, 1, {0x200B, 0x0000}}, // NegativeThinSpace
+    {5904, 5, 1, {0x2553, 0x0000}}, // boxDr
+    {5928, 5, 1, {0x2567, 0x0000}}, // boxHu
+    {8432, 3, 1, {0x0439, 0x0000}}, // jcy
+    {1716, 5, 1, {0x0404, 0x0000}}, // Jukcy
+    {3411, 5, 1, {0x014C, 0x0000}}, // Omacr
+    {4737, 16, 1, {0x23DD, 0x0000}}, // UnderParenthesis
+    {11715, 15, 1, {0x22CC, 0x0000}}, // rightthreetimes
+    {5663, 9, 1, {0x2A02, 0x0000}}, // bigotimes
+    {8155, 6, 1, {0x0127, 0x0000}}, // hstrok
+    {13961, 4, 1, {0x017C, 0x0000}}, // zdot
+    {12046, 5, 1, {0x2216, 0x0000}}, // setmn
+    {7755, 4, 1, {0x0121, 0x0000}}, // gdot
+    {1443, 12, 1, {0x2273, 0x0000}}, // GreaterTilde
+    {1348, 3, 2, {0xD835, 0xDD0A}}, // Gfr
+    {13930, 4, 2, {0xD835, 0xDD6A}}, // yopf
+    {1459, 2, 1, {0x226B, 0x0000}}, // Gt
+    {9953, 5, 1, {0x2AF2, 0x0000}}, // nhpar
+    {8026, 4, 1, {0x2194, 0x0000}}, // harr
+    {1664, 4, 2, {0xD835, 0xDD40}}, // Iopf
+    {687, 15, 1, {0x21D0, 0x0000}}, // DoubleLeftArrow
+    {5567, 5, 1, {0x224C, 0x0000}}, // bcong
+    {1975, 7, 1, {0x22A3, 0x0000}}, // LeftTee
+    {1262, 21, 1, {0x25AA, 0x0000}}, // FilledVerySmallSquare
+    {3687, 4, 2, {0xD835, 0xDCAC}}, // Qscr
+    {6530, 4, 1, {0x2245, 0x0000}}, // cong
+    {1553, 4, 1, {0x0401, 0x0000}}, // IOcy
+    {6820, 4, 1, {0x2010, 0x0000}}, // dash
+    {10810, 3, 1, {0x2A5B, 0x0000}}, // orv
+    {8306, 3, 1, {0x222B, 0x0000}}, // int
+    {1805, 16, 1, {0x27E8, 0x0000}}, // LeftAngleBracket
+    {13643, 3, 1, {0x2228, 0x0000}}, // vee
+    {3691, 5, 1, {0x2910, 0x0000}}, // RBarr
+    {12472, 5, 1, {0x228A, 0x0000}}, // subne
+    {6477, 6, 1, {0x2254, 0x0000}}, // colone
+    {9931, 5, 1, {0x2275, 0x0000}}, // ngsim
+    {9764, 5, 1, {0x266E, 0x0000}}, // natur
+    {3992, 16, 1, {0x29D0, 0x0000}}, // RightTriangleBar
+    {8503, 4, 2, {0xD835, 0xDCC0}}, // kscr
+    {11884, 5, 1, {0x22B5, 0x0000}}, // rtrie
+    {11775, 5, 1, {0x2AEE, 0x0000}}, // rnmid
+    {12199, 8, 1, {0x29E4, 0x0000}}, // smeparsl
+    {12123, 6, 1, {0x2A6A, 0x0000}}, // simdot
+    {4569, 10, 2, {0x205F, 0x200A}}, // ThickSpace
+    {8625, 7, 1, {0x2973, 0x0000}}, // larrsim
+    {3883, 18, 1, {0x295D, 0x0000}}, // RightDownTeeVector
+    {12891, 8, 1, {0x223C, 0x0000}}, // thicksim
+    {11328, 5, 1, {0x2992, 0x0000}}, // rangd
+    {7684, 6, 1, {0x215A, 0x0000}}, // frac56
+    {6052, 8, 1, {0x22A0, 0x0000}}, // boxtimes
+    {9832, 3, 1, {0x043D, 0x0000}}, // ncy
+    {6752, 15, 1, {0x21B7, 0x0000}}, // curvearrowright
+    {8121, 14, 1, {0x21AA, 0x0000}}, // hookrightarrow
+    {11213, 3, 1, {0x03C8, 0x0000}}, // psi
+    {4184, 6, 1, {0x015A, 0x0000}}, // Sacute
+    {9927, 4, 2, {0x2A7E, 0x0338}}, // nges
+    {2377, 6, 1, {0x0141, 0x0000}}, // Lstrok
+    {8167, 6, 1, {0x2010, 0x0000}}, // hyphen
+    {10496, 5, 1, {0x2007, 0x0000}}, // numsp
+    {11333, 5, 1, {0x29A5, 0x0000}}, // range
+    {10387, 7, 2, {0x2283, 0x20D2}}, // nsupset
+    {7636, 6, 1, {0x2159, 0x0000}}, // frac16
+    {7537, 6, 1, {0xFB03, 0x0000}}, // ffilig
+    {1982, 12, 1, {0x21A4, 0x0000}}, // LeftTeeArrow
+    {10941, 9, 1, {0x22D4, 0x0000}}, // pitchfork
+    {12533, 6, 1, {0x2AC7, 0x0000}}, // subsim
+    {1535, 9, 1, {0x224F, 0x0000}}, // HumpEqual
+    {7732, 6, 1, {0x03DD, 0x0000}}, // gammad
+    {10351, 10, 2, {0x2AC5, 0x0338}}, // nsubseteqq
+    {8102, 6, 1, {0x223B, 0x0000}}, // homtht
+    {4930, 4, 1, {0x2AEB, 0x0000}}, // Vbar
+    {13810, 5, 1, {0x27FA, 0x0000}}, // xhArr
+    {7475, 4, 1, {0x00EB, 0x0000}}, // euml
+    {4693, 3, 2, {0xD835, 0xDD18}}, // Ufr
+    {7257, 3, 1, {0x2A96, 0x0000}}, // egs
+    {11566, 6, 1, {0x230B, 0x0000}}, // rfloor
+    {7232, 3, 1, {0x044D, 0x0000}}, // ecy
+    {13686, 5, 2, {0x2283, 0x20D2}}, // vnsup
+    {7907, 4, 1, {0x2AA7, 0x0000}}, // gtcc
+    {3351, 14, 1, {0x2224, 0x0000}}, // NotVerticalBar
+    {9529, 3, 1, {0x043C, 0x0000}}, // mcy
+    {13558, 13, 2, {0x2ACB, 0xFE00}}, // varsubsetneqq
+    {3377, 5, 1, {0x0152, 0x0000}}, // OElig
+    {1721, 4, 1, {0x0425, 0x0000}}, // KHcy
+    {1217, 4, 1, {0x00CB, 0x0000}}, // Euml
+    {8556, 6, 1, {0x03BB, 0x0000}}, // lambda
+    {1210, 4, 1, {0x2A73, 0x0000}}, // Esim
+    {10427, 13, 1, {0x22EA, 0x0000}}, // ntriangleleft
+    {8089, 8, 1, {0x2926, 0x0000}}, // hkswarow
+};
+
+#endif
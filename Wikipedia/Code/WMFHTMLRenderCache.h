@@ -0,0 +1,70 @@
+#import <UIKit/UIKit.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Everything that affects the output of @c -[NSString wmf_attributedStringFromHTMLWithFont:...] other than the HTML itself.
+ */
+@interface WMFHTMLRenderCacheKey : NSObject <NSCopying>
+
+- (instancetype)initWithHTML:(NSString *)HTML
+                        font:(nullable UIFont *)font
+                    boldFont:(nullable UIFont *)boldFont
+                  italicFont:(nullable UIFont *)italicFont
+              boldItalicFont:(nullable UIFont *)boldItalicFont
+                       color:(nullable UIColor *)color
+                   linkColor:(nullable UIColor *)linkColor
+               handlingLinks:(BOOL)handlingLinks
+               handlingLists:(BOOL)handlingLists
+     handlingSuperSubscripts:(BOOL)handlingSuperSubscripts
+                  tagMapping:(nullable NSDictionary<NSString *, NSString *> *)tagMapping
+     additionalTagAttributes:(nullable NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *)additionalTagAttributes NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ * A thread safe, size limited cache of attributed strings converted from HTML.
+ *
+ * Entries are evicted once the estimated size of everything in the cache goes over @c totalByteLimit,
+ * and all of them are removed on memory warnings by @c MWKDataStore.
+ */
+@interface WMFHTMLRenderCache : NSObject
+
+@property (class, nonatomic, readonly) WMFHTMLRenderCache *sharedCache;
+
+/// The most bytes the cache should hold. Defaults to 4 MB.
+@property (nonatomic) NSUInteger totalByteLimit;
+
+/**
+ * @return A copy of the attributed string stored for @c key, or @c nil if there isn't one.
+ */
+- (nullable NSMutableAttributedString *)attributedStringForKey:(WMFHTMLRenderCacheKey *)key;
+
+/**
+ * Stores a copy of @c attributedString for @c key.
+ */
+- (void)setAttributedString:(NSAttributedString *)attributedString forKey:(WMFHTMLRenderCacheKey *)key;
+
+- (void)removeAllAttributedStrings;
+
+///
+/// @name Instrumentation
+///
+
+/// The number of lookups that found an attributed string since the statistics were last reset.
+@property (readonly) NSUInteger hitCount;
+
+/// The number of lookups that didn't find an attributed string since the statistics were last reset.
+@property (readonly) NSUInteger missCount;
+
+/// The estimated size of everything in the cache.
+@property (readonly) NSUInteger bytesHeld;
+
+/// Sets @c hitCount and @c missCount back to zero.
+- (void)resetStatistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,214 @@
+#import <WMF/WMFHTMLRenderCache.h>
+#import <WMF/WMFComparison.h>
+
+static const NSUInteger WMFHTMLRenderCacheDefaultTotalByteLimit = 4 * 1024 * 1024;
+
+/// A rough size of each attribute run on top of the characters.
+static const NSUInteger WMFHTMLRenderCacheBytesPerAttributeRun = 64;
+
+@interface WMFHTMLRenderCacheKey ()
+
+@property (nonatomic, copy, readonly) NSString *HTML;
+@property (nonatomic, strong, readonly, nullable) UIFont *font;
+@property (nonatomic, strong, readonly, nullable) UIFont *boldFont;
+@property (nonatomic, strong, readonly, nullable) UIFont *italicFont;
+@property (nonatomic, strong, readonly, nullable) UIFont *boldItalicFont;
+@property (nonatomic, strong, readonly, nullable) UIColor *color;
+@property (nonatomic, strong, readonly, nullable) UIColor *linkColor;
+@property (nonatomic, readonly) NSUInteger options;
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, NSString *> *tagMapping;
+@property (nonatomic, copy, readonly, nullable) NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *additionalTagAttributes;
+@property (nonatomic, readonly) NSUInteger precomputedHash;
+
+@end
+
+@implementation WMFHTMLRenderCacheKey
+
+- (instancetype)initWithHTML:(NSString *)HTML font:(nullable UIFont *)font boldFont:(nullable UIFont *)boldFont italicFont:(nullable UIFont *)italicFont boldItalicFont:(nullable UIFont *)boldItalicFont color:(nullable UIColor *)color linkColor:(nullable UIColor *)linkColor handlingLinks:(BOOL)handlingLinks handlingLists:(BOOL)handlingLists handlingSuperSubscripts:(BOOL)handlingSuperSubscripts tagMapping:(nullable NSDictionary<NSString *, NSString *> *)tagMapping additionalTagAttributes:(nullable NSDictionary<NSString *, NSDictionary<NSAttributedStringKey, id> *> *)additionalTagAttributes {
+    self = [super init];
+    if (self) {
+        _HTML = [HTML copy];
+        _font = font;
+        _boldFont = boldFont;
+        _italicFont = italicFont;
+        _boldItalicFont = boldItalicFont;
+        _color = color;
+        _linkColor = linkColor;
+        _options = (handlingLinks ? 1 : 0) | (handlingLists ? 2 : 0) | (handlingSuperSubscripts ? 4 : 0);
+        _tagMapping = [tagMapping copy];
+        _additionalTagAttributes = [additionalTagAttributes copy];
+        // The HTML tells entries apart far more often than anything else, so the rest only needs to be mixed in cheaply
+        _precomputedHash = _HTML.hash ^ (_font.hash * 31) ^ (_color.hash * 17) ^ (_linkColor.hash * 7) ^ _options;
+    }
+    return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+- (NSUInteger)hash {
+    return self.precomputedHash;
+}
+
+- (BOOL)isEqual:(id)object {
+    if (self == object) {
+        return YES;
+    }
+    if (![object isKindOfClass:[WMFHTMLRenderCacheKey class]]) {
+        return NO;
+    }
+    WMFHTMLRenderCacheKey *other = object;
+    return self.precomputedHash == other.precomputedHash
+           && self.options == other.options
+           && [self.HTML isEqualToString:other.HTML]
+           && WMF_IS_EQUAL(self.font, other.font)
+           && WMF_IS_EQUAL(self.boldFont, other.boldFont)
+           && WMF_IS_EQUAL(self.italicFont, other.italicFont)
+           && WMF_IS_EQUAL(self.boldItalicFont, other.boldItalicFont)
+           && WMF_IS_EQUAL(self.color, other.color)
+           && WMF_IS_EQUAL(self.linkColor, other.linkColor)
+           && WMF_EQUAL(self.tagMapping, isEqualToDictionary:, other.tagMapping)
+           && WMF_EQUAL(self.additionalTagAttributes, isEqualToDictionary:, other.additionalTagAttributes);
+}
+
+@end
+
+/// What the cache holds for each key, so its size is known when it is evicted.
+@interface WMFHTMLRenderCacheEntry : NSObject
+
+@property (nonatomic, strong, readonly) WMFHTMLRenderCacheKey *key;
+@property (nonatomic, copy, readonly) NSAttributedString *attributedString;
+/// The attributed string's characters and runs, plus the key's HTML, which is often the larger of the two
+@property (nonatomic, readonly) NSUInteger cost;
+
+@end
+
+@implementation WMFHTMLRenderCacheEntry
+
+- (instancetype)initWithAttributedString:(NSAttributedString *)attributedString key:(WMFHTMLRenderCacheKey *)key {
+    self = [super init];
+    if (self) {
+        _key = key;
+        _attributedString = [attributedString copy];
+        __block NSUInteger runCount = 0;
+        [_attributedString enumerateAttributesInRange:NSMakeRange(0, _attributedString.length)
+                                              options:NSAttributedStringEnumerationLongestEffectiveRangeNotRequired
+                                           usingBlock:^(NSDictionary<NSAttributedStringKey, id> *_Nonnull attrs, NSRange range, BOOL *_Nonnull stop) {
+                                               runCount++;
+                                           }];
+        _cost = (_attributedString.length + key.HTML.length) * sizeof(unichar) + runCount * WMFHTMLRenderCacheBytesPerAttributeRun;
+    }
+    return self;
+}
+
+@end
+
+@interface WMFHTMLRenderCache () <NSCacheDelegate>
+
+@property (nonatomic, strong) NSCache<WMFHTMLRenderCacheKey *, WMFHTMLRenderCacheEntry *> *cache;
+/// The entry counted in bytesHeld for each key. Only accessed while synchronized on self.
+@property (nonatomic, strong) NSMapTable<WMFHTMLRenderCacheKey *, WMFHTMLRenderCacheEntry *> *countedEntries;
+/// Serializes changes to the cache, so entries are counted in the same order NSCache stores them. Never taken by the
+/// NSCache delegate methods, which NSCache can call while holding its own lock.
+@property (nonatomic, strong) NSLock *changeLock;
+@property (readwrite) NSUInteger hitCount;
+@property (readwrite) NSUInteger missCount;
+@property (readwrite) NSUInteger bytesHeld;
+
+@end
+
+@implementation WMFHTMLRenderCache
+
++ (WMFHTMLRenderCache *)sharedCache {
+    static WMFHTMLRenderCache *sharedCache = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        sharedCache = [[WMFHTMLRenderCache alloc] init];
+    });
+    return sharedCache;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        self.cache = [[NSCache alloc] init];
+        self.cache.name = @"WMFHTMLRenderCache";
+        self.cache.totalCostLimit = WMFHTMLRenderCacheDefaultTotalByteLimit;
+        self.cache.delegate = self;
+        self.countedEntries = [NSMapTable strongToWeakObjectsMapTable];
+        self.changeLock = [[NSLock alloc] init];
+    }
+    return self;
+}
+
+- (NSUInteger)totalByteLimit {
+    return self.cache.totalCostLimit;
+}
+
+- (void)setTotalByteLimit:(NSUInteger)totalByteLimit {
+    self.cache.totalCostLimit = totalByteLimit;
+}
+
+- (nullable NSMutableAttributedString *)attributedStringForKey:(WMFHTMLRenderCacheKey *)key {
+    WMFHTMLRenderCacheEntry *entry = [self.cache objectForKey:key];
+    @synchronized(self) {
+        if (entry) {
+            self.hitCount++;
+        } else {
+            self.missCount++;
+        }
+    }
+    // Callers are free to change what they get back
+    return [entry.attributedString mutableCopy];
+}
+
+- (void)setAttributedString:(NSAttributedString *)attributedString forKey:(WMFHTMLRenderCacheKey *)key {
+    WMFHTMLRenderCacheEntry *entry = [[WMFHTMLRenderCacheEntry alloc] initWithAttributedString:attributedString key:key];
+    if (entry.cost > self.cache.totalCostLimit) {
+        return;
+    }
+    [self.changeLock lock];
+    @synchronized(self) {
+        // The entry being replaced stops counting now, whether or not NSCache tells the delegate about it
+        WMFHTMLRenderCacheEntry *replacedEntry = [self.countedEntries objectForKey:key];
+        if (replacedEntry) {
+            self.bytesHeld -= replacedEntry.cost;
+        }
+        [self.countedEntries setObject:entry forKey:key];
+        self.bytesHeld += entry.cost;
+    }
+    [self.cache setObject:entry forKey:key cost:entry.cost];
+    [self.changeLock unlock];
+}
+
+- (void)removeAllAttributedStrings {
+    [self.changeLock lock];
+    [self.cache removeAllObjects];
+    [self.changeLock unlock];
+}
+
+#pragma mark - NSCacheDelegate
+
+- (void)cache:(NSCache *)cache willEvictObject:(id)obj {
+    WMFHTMLRenderCacheEntry *entry = obj;
+    @synchronized(self) {
+        // Entries that were already replaced were uncounted when they were
+        if ([self.countedEntries objectForKey:entry.key] != entry) {
+            return;
+        }
+        [self.countedEntries removeObjectForKey:entry.key];
+        self.bytesHeld -= entry.cost;
+    }
+}
+
+#pragma mark - Instrumentation
+
+- (void)resetStatistics {
+    @synchronized(self) {
+        self.hitCount = 0;
+        self.missCount = 0;
+    }
+}
+
+@end
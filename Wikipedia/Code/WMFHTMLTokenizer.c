@@ -0,0 +1,307 @@
+#include "WMFHTMLTokenizer.h"
+#include <string.h>
+
+#pragma mark - Character Classes
+
+static inline bool WMFHTMLIsTagNameCharacter(uint16_t c) {
+    // [\/a-z0-9] matched case insensitively. ICU's case closure of [a-z] also
+    // includes LATIN SMALL LETTER LONG S and KELVIN SIGN.
+    uint16_t lower = c | 0x20;
+    return (lower >= 'a' && lower <= 'z') || (c >= '0' && c <= '9') || c == '/' || c == 0x017F || c == 0x212A;
+}
+
+#pragma mark - Tag IDs
+
+// Lowercase names, indexed by WMFHTMLTagID
+static const char *const WMFHTMLTagNames[WMFHTMLTagIDCount] = {
+    [WMFHTMLTagIDUnknown] = "",
+    [WMFHTMLTagIDA] = "a",
+    [WMFHTMLTagIDB] = "b",
+    [WMFHTMLTagIDBR] = "br",
+    [WMFHTMLTagIDDel] = "del",
+    [WMFHTMLTagIDI] = "i",
+    [WMFHTMLTagIDLI] = "li",
+    [WMFHTMLTagIDOL] = "ol",
+    [WMFHTMLTagIDS] = "s",
+    [WMFHTMLTagIDScript] = "script",
+    [WMFHTMLTagIDStyle] = "style",
+    [WMFHTMLTagIDSub] = "sub",
+    [WMFHTMLTagIDSup] = "sup",
+    [WMFHTMLTagIDU] = "u",
+    [WMFHTMLTagIDUL] = "ul",
+};
+
+/// The longest name in WMFHTMLTagNames
+static const size_t WMFHTMLTagNameMaximumLength = 6;
+
+WMFHTMLTagID WMFHTMLTagIDForName(const uint16_t *characters, WMFHTMLSpan name) {
+    if (name.length == 0 || name.length > WMFHTMLTagNameMaximumLength) {
+        return WMFHTMLTagIDUnknown;
+    }
+    if (WMFTextSpanEqualsASCIIStringIgnoringCase(characters, name, "br/")) {
+        return WMFHTMLTagIDBR;
+    }
+    // Checking the first letter skips most of the full comparisons
+    uint16_t first = characters[name.location] | 0x20;
+    for (int tagID = WMFHTMLTagIDUnknown + 1; tagID < WMFHTMLTagIDCount; tagID++) {
+        const char *tagName = WMFHTMLTagNames[tagID];
+        if (tagName[0] == first && WMFTextSpanEqualsASCIIStringIgnoringCase(characters, name, tagName)) {
+            return (WMFHTMLTagID)tagID;
+        }
+    }
+    return WMFHTMLTagIDUnknown;
+}
+
+#pragma mark - Scanning
+
+bool WMFHTMLNextTag(const uint16_t *characters, size_t length, size_t location, WMFHTMLTag *tag) {
+    size_t start = WMFTextIndexOfCharacter(characters, length, location, '<');
+    if (start == length) {
+        return false;
+    }
+    // Everything up to the first '>' belongs to the tag. Without one, no later '<' can start a tag either.
+    size_t end = WMFTextIndexOfCharacter(characters, length, start + 1, '>');
+    if (end == length) {
+        return false;
+    }
+    size_t nameStart = start + 1;
+    size_t nameEnd = nameStart;
+    while (nameEnd < end && WMFHTMLIsTagNameCharacter(characters[nameEnd])) {
+        nameEnd++;
+    }
+    size_t attributesStart = nameEnd;
+    if (attributesStart < end && WMFTextIsWhitespace(characters[attributesStart])) {
+        attributesStart++;
+    }
+    tag->isEndTag = nameEnd > nameStart && characters[nameStart] == '/';
+    if (tag->isEndTag) {
+        nameStart++;
+    }
+    tag->range = (WMFHTMLSpan){start, end + 1 - start};
+    tag->name = (WMFHTMLSpan){nameStart, nameEnd - nameStart};
+    tag->attributes = (WMFHTMLSpan){attributesStart, end - attributesStart};
+    tag->tagID = WMFHTMLTagIDForName(characters, tag->name);
+    return true;
+}
+
+bool WMFHTMLNextEntity(const uint16_t *characters, size_t length, size_t location, WMFHTMLSpan *entity) {
+    size_t start = WMFTextIndexOfCharacter(characters, length, location, '&');
+    while (start < length) {
+        size_t end = start + 1;
+        while (end < length && characters[end] != ';' && !WMFTextIsWhitespace(characters[end])) {
+            end++;
+        }
+        if (end == length) {
+            return false;
+        }
+        if (characters[end] == ';' && end > start + 1) {
+            *entity = (WMFHTMLSpan){start, end + 1 - start};
+            return true;
+        }
+        // Any '&' before `end` would run into the same terminator, so resume after it
+        start = WMFTextIndexOfCharacter(characters, length, end + 1, '&');
+    }
+    return false;
+}
+
+#pragma mark - Entities
+
+#include "WMFHTMLEntityTable.h"
+
+// Keep in sync with entity_hash in scripts/generate_html_entity_table
+static inline uint32_t WMFHTMLEntityHash(const uint16_t *characters, size_t length, uint32_t seed) {
+    uint32_t hash = 0x811C9DC5u ^ seed;
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ characters[i]) * 0x01000193u;
+    }
+    return hash ^ (hash >> 15);
+}
+
+static size_t WMFHTMLDecodeNamedEntity(const uint16_t *characters, size_t length, uint16_t *output) {
+    if (length > WMFHTMLEntityNameMaximumLength) {
+        return 0;
+    }
+    uint32_t seed = WMFHTMLEntitySeeds[WMFHTMLEntityHash(characters, length, 0) % WMFHTMLEntityBucketCount];
+    const WMFHTMLEntityTableEntry *entry = &WMFHTMLEntityTable[WMFHTMLEntityHash(characters, length, seed) % WMFHTMLEntityCount];
+    if (entry->nameLength != length) {
+        return 0;
+    }
+    // Every name is in the table's slot for it, so any other name in that slot means this one isn't an entity
+    const char *name = WMFHTMLEntityNames + entry->nameOffset;
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] != (uint8_t)name[i]) {
+            return 0;
+        }
+    }
+    output[0] = entry->value[0];
+    output[1] = entry->value[1];
+    return entry->valueLength;
+}
+
+/// Replacements for C1 control characters, which numeric references treat as Windows-1252.
+static const uint16_t WMFHTMLWindows1252Replacements[32] = {
+    0x20AC, 0x0081, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008D, 0x017D, 0x008F,
+    0x0090, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x009D, 0x017E, 0x0178};
+
+static size_t WMFHTMLDecodeNumericEntity(const uint16_t *characters, size_t length, uint16_t *output) {
+    // `characters` follows the '#'
+    bool isHexadecimal = length > 0 && (characters[0] | 0x20) == 'x';
+    size_t i = isHexadecimal ? 1 : 0;
+    if (i == length) {
+        return 0;
+    }
+    uint32_t codePoint = 0;
+    for (; i < length; i++) {
+        uint16_t c = characters[i];
+        uint32_t digit;
+        if (c >= '0' && c <= '9') {
+            digit = c - '0';
+        } else if (isHexadecimal && (c | 0x20) >= 'a' && (c | 0x20) <= 'f') {
+            digit = (c | 0x20) - 'a' + 10;
+        } else {
+            return 0;
+        }
+        // Saturate rather than overflow - anything past the last code point decodes to U+FFFD anyway
+        if (codePoint <= 0x10FFFF) {
+            codePoint = codePoint * (isHexadecimal ? 16 : 10) + digit;
+        }
+    }
+    if (codePoint == 0 || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+        output[0] = 0xFFFD;
+        return 1;
+    }
+    if (codePoint >= 0x80 && codePoint <= 0x9F) {
+        output[0] = WMFHTMLWindows1252Replacements[codePoint - 0x80];
+        return 1;
+    }
+    if (codePoint > 0xFFFF) {
+        codePoint -= 0x10000;
+        output[0] = (uint16_t)(0xD800 + (codePoint >> 10));
+        output[1] = (uint16_t)(0xDC00 + (codePoint & 0x3FF));
+        return 2;
+    }
+    output[0] = (uint16_t)codePoint;
+    return 1;
+}
+
+size_t WMFHTMLDecodeEntity(const uint16_t *characters, WMFHTMLSpan name, uint16_t *output) {
+    const uint16_t *c = characters + name.location;
+    if (name.length > 0 && c[0] == '#') {
+        return WMFHTMLDecodeNumericEntity(c + 1, name.length - 1, output);
+    }
+    return WMFHTMLDecodeNamedEntity(c, name.length, output);
+}
+
+size_t WMFHTMLDecodeEntities(const uint16_t *characters, size_t length, uint16_t *output) {
+    size_t location = 0;
+    size_t outputLength = 0;
+    WMFHTMLSpan entity;
+    while (WMFHTMLNextEntity(characters, length, location, &entity)) {
+        size_t literalLength = entity.location - location;
+        // memmove since decoding in place shifts characters towards the start of the buffer
+        memmove(output + outputLength, characters + location, literalLength * sizeof(uint16_t));
+        outputLength += literalLength;
+        WMFHTMLSpan name = {entity.location + 1, entity.length - 2};
+        size_t replacementLength = WMFHTMLDecodeEntity(characters, name, output + outputLength);
+        if (replacementLength == 0) {
+            // Unknown entities are kept as they are
+            memmove(output + outputLength, characters + entity.location, entity.length * sizeof(uint16_t));
+            replacementLength = entity.length;
+        }
+        outputLength += replacementLength;
+        location = entity.location + entity.length;
+    }
+    memmove(output + outputLength, characters + location, (length - location) * sizeof(uint16_t));
+    return outputLength + length - location;
+}
+
+#pragma mark - Tag Removal
+
+static inline bool WMFHTMLTagIsRemovedWithContents(const WMFHTMLTag *tag) {
+    return tag->tagID == WMFHTMLTagIDScript || tag->tagID == WMFHTMLTagIDStyle;
+}
+
+/**
+ * Decodes the entities in @c characters from @c location to @c end into @c output, writing at most @c capacity characters.
+ *
+ * Unlike @c WMFHTMLDecodeEntities this reads from the input directly, so the text between tags never has to be
+ * copied first, and it stops as soon as @c output is full.
+ */
+static size_t WMFHTMLDecodeEntitiesInRange(const uint16_t *characters, size_t location, size_t end, uint16_t *output, size_t capacity) {
+    size_t outputLength = 0;
+    WMFHTMLSpan entity;
+    while (outputLength < capacity && WMFHTMLNextEntity(characters, end, location, &entity)) {
+        size_t literalLength = entity.location - location;
+        if (literalLength > capacity - outputLength) {
+            literalLength = capacity - outputLength;
+        }
+        memcpy(output + outputLength, characters + location, literalLength * sizeof(uint16_t));
+        outputLength += literalLength;
+        location = entity.location + entity.length;
+        uint16_t replacement[WMFHTMLEntityReplacementMaximumLength];
+        const uint16_t *replacementCharacters = replacement;
+        size_t replacementLength = WMFHTMLDecodeEntity(characters, (WMFHTMLSpan){entity.location + 1, entity.length - 2}, replacement);
+        if (replacementLength == 0) {
+            // Unknown entities are kept as they are
+            replacementCharacters = characters + entity.location;
+            replacementLength = entity.length;
+        }
+        if (replacementLength > capacity - outputLength) {
+            replacementLength = capacity - outputLength;
+        }
+        memcpy(output + outputLength, replacementCharacters, replacementLength * sizeof(uint16_t));
+        outputLength += replacementLength;
+    }
+    size_t literalLength = location < end ? end - location : 0;
+    if (literalLength > capacity - outputLength) {
+        literalLength = capacity - outputLength;
+    }
+    memcpy(output + outputLength, characters + location, literalLength * sizeof(uint16_t));
+    return outputLength + literalLength;
+}
+
+size_t WMFHTMLRemoveTags(const uint16_t *characters, size_t length, uint16_t *output, WMFHTMLTagHandler handler, void *context) {
+    return WMFHTMLRemoveTagsWithMaximumLength(characters, length, SIZE_MAX, output, handler, context);
+}
+
+size_t WMFHTMLRemoveTagsWithMaximumLength(const uint16_t *characters, size_t length, size_t maximumLength, uint16_t *output, WMFHTMLTagHandler handler, void *context) {
+    size_t outputLength = 0;
+    size_t textStart = 0;           // input location of the first character not yet written to output
+    size_t removalStart = SIZE_MAX; // input location of an open script or style tag
+    size_t location = 0;
+    WMFHTMLTag tag;
+    // Stops looking for tags as soon as the output is full
+    while (outputLength < maximumLength && WMFHTMLNextTag(characters, length, location, &tag)) {
+        size_t tagEnd = WMFTextSpanEnd(tag.range);
+        location = tagEnd;
+        if (WMFHTMLTagIsRemovedWithContents(&tag)) {
+            if (!tag.isEndTag) {
+                // A nested start tag leaves the previous one and what follows it as text
+                removalStart = tag.range.location;
+            } else if (removalStart != SIZE_MAX) {
+                outputLength += WMFHTMLDecodeEntitiesInRange(characters, textStart, removalStart, output + outputLength, maximumLength - outputLength);
+                textStart = tagEnd;
+                removalStart = SIZE_MAX;
+            }
+            // An unmatched end tag is left as text
+            continue;
+        }
+        if (removalStart != SIZE_MAX) {
+            continue;
+        }
+        // Text is decoded a run at a time so that entities never span tags
+        outputLength += WMFHTMLDecodeEntitiesInRange(characters, textStart, tag.range.location, output + outputLength, maximumLength - outputLength);
+        textStart = tagEnd;
+        if (outputLength == maximumLength) {
+            break;
+        }
+        if (tag.tagID == WMFHTMLTagIDBR) {
+            output[outputLength++] = '\n';
+        }
+        if (handler) {
+            handler(characters, &tag, outputLength, context);
+        }
+    }
+    // Anything after an unclosed script or style tag is kept
+    return outputLength + WMFHTMLDecodeEntitiesInRange(characters, textStart, length, output + outputLength, maximumLength - outputLength);
+}
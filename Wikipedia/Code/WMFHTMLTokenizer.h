@@ -0,0 +1,153 @@
+#ifndef WMFHTMLTokenizer_h
+#define WMFHTMLTokenizer_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "WMFTextScanning.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///
+/// @name Spans
+///
+
+/**
+ * A range of UTF-16 code units in a buffer. Tokenizer results never own or copy characters.
+ */
+typedef WMFTextSpan WMFHTMLSpan;
+
+/**
+ * The tags that are handled specially somewhere, so they can be told apart without comparing names.
+ */
+typedef enum {
+    WMFHTMLTagIDUnknown,
+    WMFHTMLTagIDA,
+    WMFHTMLTagIDB,
+    WMFHTMLTagIDBR,
+    WMFHTMLTagIDDel,
+    WMFHTMLTagIDI,
+    WMFHTMLTagIDLI,
+    WMFHTMLTagIDOL,
+    WMFHTMLTagIDS,
+    WMFHTMLTagIDScript,
+    WMFHTMLTagIDStyle,
+    WMFHTMLTagIDSub,
+    WMFHTMLTagIDSup,
+    WMFHTMLTagIDU,
+    WMFHTMLTagIDUL,
+    WMFHTMLTagIDCount
+} WMFHTMLTagID;
+
+/**
+ * A tag found by @c WMFHTMLNextTag.
+ *
+ * @c range covers everything from @c < to @c >. @c name excludes the leading @c / of end tags
+ * and is not lowercased. @c attributes is everything after the name (and one optional whitespace
+ * character) up to, but not including, the closing @c >.
+ */
+typedef struct {
+    WMFHTMLSpan range;
+    WMFHTMLSpan name;
+    WMFHTMLSpan attributes;
+    WMFHTMLTagID tagID;
+    bool isEndTag;
+} WMFHTMLTag;
+
+///
+/// @name Scanning
+///
+
+/**
+ * Finds the first tag at or after @c location.
+ *
+ * Matches the same tags as @c +[NSRegularExpression wmf_HTMLTagRegularExpression] in a single forward pass.
+ *
+ * @return @c true if a tag was found and written to @c tag, @c false otherwise.
+ */
+extern bool WMFHTMLNextTag(const uint16_t *characters, size_t length, size_t location, WMFHTMLTag *tag);
+
+/**
+ * @return The ID of the tag named by @c name, ignoring ASCII case, or @c WMFHTMLTagIDUnknown. @c br/ is the same as @c br.
+ */
+extern WMFHTMLTagID WMFHTMLTagIDForName(const uint16_t *characters, WMFHTMLSpan name);
+
+/**
+ * Finds the first entity reference (@c &name;) at or after @c location.
+ *
+ * Matches the same entities as @c +[NSRegularExpression wmf_HTMLEntityRegularExpression]. The returned span
+ * includes the leading @c & and the trailing @c ;.
+ *
+ * @return @c true if an entity was found and written to @c entity, @c false otherwise.
+ */
+extern bool WMFHTMLNextEntity(const uint16_t *characters, size_t length, size_t location, WMFHTMLSpan *entity);
+
+///
+/// @name Transforming
+///
+
+/// The most characters @c WMFHTMLDecodeEntity writes for a single entity.
+enum {
+    WMFHTMLEntityReplacementMaximumLength = 2
+};
+
+/**
+ * Writes the replacement for the entity named by @c name, which excludes the leading @c & and trailing @c ;, to @c output.
+ *
+ * Names are looked up case sensitively in the HTML5 named character references, except that @c nbsp decodes to a
+ * regular space. Numeric references (@c #8722 and @c #x2212) are decoded following the HTML5 rules, including
+ * replacing invalid code points with U+FFFD.
+ *
+ * @c output needs room for @c WMFHTMLEntityReplacementMaximumLength characters. A replacement is never longer than the entity reference it replaces.
+ *
+ * @return The number of characters written to @c output, which is @c 0 for unknown entities.
+ */
+extern size_t WMFHTMLDecodeEntity(const uint16_t *characters, WMFHTMLSpan name, uint16_t *output);
+
+/**
+ * Decodes the entity references in @c characters into @c output.
+ *
+ * Unknown entities are kept as they are. @c output needs room for @c length characters and may be the same buffer
+ * as @c characters - decoding never writes ahead of what it has read.
+ *
+ * @return The number of characters written to @c output.
+ */
+extern size_t WMFHTMLDecodeEntities(const uint16_t *characters, size_t length, uint16_t *output);
+
+/**
+ * Called by @c WMFHTMLRemoveTags for every tag that is removed from the output, other than @c script and
+ * @c style tags and anything inside of them.
+ *
+ * @param outputLength The number of characters written to the output so far, including the tag's replacement.
+ */
+typedef void (*WMFHTMLTagHandler)(const uint16_t *characters, const WMFHTMLTag *tag, size_t outputLength, void *context);
+
+/**
+ * Removes tags from @c characters and decodes entities in the text between them, writing the result to @c output.
+ *
+ * @c script and @c style elements are removed along with their contents and @c br tags are replaced with newlines.
+ * @c output needs room for @c length characters. It never aliases @c characters.
+ *
+ * @return The number of characters written to @c output.
+ */
+extern size_t WMFHTMLRemoveTags(const uint16_t *characters, size_t length, uint16_t *output, WMFHTMLTagHandler handler, void *context);
+
+/**
+ * Same as @c WMFHTMLRemoveTags, but stops once @c maximumLength characters have been written.
+ *
+ * The result is the first @c maximumLength characters of what @c WMFHTMLRemoveTags would return. Nothing past the tag
+ * that fills the output is read, so the cost depends on @c maximumLength rather than @c length unless a @c script or
+ * @c style element is left open. @c output needs room for @c length or @c maximumLength characters, whichever is shorter.
+ * @c handler is only called for tags before the output is full.
+ *
+ * @return The number of characters written to @c output.
+ */
+extern size_t WMFHTMLRemoveTagsWithMaximumLength(const uint16_t *characters, size_t length, size_t maximumLength, uint16_t *output, WMFHTMLTagHandler handler, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
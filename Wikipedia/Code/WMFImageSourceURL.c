@@ -0,0 +1,179 @@
+#include "WMFImageSourceURL.h"
+
+#pragma mark - Image source URLs
+
+static inline bool WMFImageSourceURLIsDigit(uint16_t c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline size_t WMFImageSourceURLEndOfDigits(const uint16_t *characters, size_t location, size_t end) {
+    while (location < end && WMFImageSourceURLIsDigit(characters[location])) {
+        location++;
+    }
+    return location;
+}
+
+static inline bool WMFImageSourceURLHasPrefixAt(const uint16_t *characters, size_t location, size_t end, const char *prefix) {
+    return WMFTextSpanHasASCIIPrefix(characters, WMFTextSpanMake(location, end - location), prefix);
+}
+
+/// Matches @c ^(lossy-|lossless-)?(page\d+-)?\d+px- against the start of the file name, where @c px is the first
+/// @c px- in it. None of the optional parts can contain a @c px-, so backtracking never changes the outcome.
+static void WMFImageSourceURLParseThumbnailPrefix(const uint16_t *characters, size_t px, WMFImageSourceURLParts *parts) {
+    size_t location = parts->fileName.location;
+    WMFImageSourceURLQuality quality = WMFImageSourceURLQualityDefault;
+    if (WMFImageSourceURLHasPrefixAt(characters, location, px, "lossy-")) {
+        quality = WMFImageSourceURLQualityLossy;
+        location += 6;
+    } else if (WMFImageSourceURLHasPrefixAt(characters, location, px, "lossless-")) {
+        quality = WMFImageSourceURLQualityLossless;
+        location += 9;
+    }
+    if (WMFImageSourceURLHasPrefixAt(characters, location, px, "page")) {
+        size_t pageEnd = WMFImageSourceURLEndOfDigits(characters, location + 4, px);
+        if (pageEnd > location + 4 && pageEnd < px && characters[pageEnd] == '-') {
+            parts->hasPage = true;
+            parts->page = WMFTextSpanMake(location + 4, pageEnd - location - 4);
+            location = pageEnd + 1;
+        }
+    }
+    size_t widthEnd = WMFImageSourceURLEndOfDigits(characters, location, px);
+    if (widthEnd == location || widthEnd != px) {
+        parts->hasPage = false;
+        return;
+    }
+    parts->hasThumbnailPrefix = true;
+    parts->quality = quality;
+    parts->width = WMFTextSpanMake(location, widthEnd - location);
+}
+
+void WMFImageSourceURLParse(const uint16_t *characters, WMFTextSpan span, WMFImageSourceURLParts *parts) {
+    size_t start = span.location;
+    size_t end = WMFTextSpanEnd(span);
+    *parts = (WMFImageSourceURLParts){0};
+
+    // Jumping from slash to slash finds the /thumb/ and /wikipedia/ markers and where the file name is, all in one pass
+    size_t lastSlash = end;
+    size_t previousSlash = end;
+    size_t componentStart = start;
+    size_t fileNameStart = end;
+    size_t fileNameEnd = end;
+    size_t siteStart = end;
+    bool isLookingForSiteEnd = false;
+    for (size_t i = WMFTextIndexOfCharacter(characters, end, start, '/'); i < end; i = WMFTextIndexOfCharacter(characters, end, i + 1, '/')) {
+        if (i > componentStart) {
+            fileNameStart = componentStart;
+            fileNameEnd = i;
+        }
+        componentStart = i + 1;
+        previousSlash = lastSlash;
+        lastSlash = i;
+        if (isLookingForSiteEnd && i >= siteStart) {
+            isLookingForSiteEnd = false;
+            parts->hasSite = i > siteStart;
+            parts->site = WMFTextSpanMake(siteStart, i - siteStart);
+        }
+        // Only a few components start with either letter, so the marker comparisons are skipped for the rest
+        uint16_t next = i + 1 < end ? characters[i + 1] : 0;
+        if (next == 't' && !parts->isThumbnail && WMFImageSourceURLHasPrefixAt(characters, i, end, "/thumb/")) {
+            parts->isThumbnail = true;
+        }
+        if (next == 'w' && siteStart == end && WMFImageSourceURLHasPrefixAt(characters, i, end, "/wikipedia/")) {
+            siteStart = i + 11;
+            isLookingForSiteEnd = true;
+        }
+    }
+    if (end > componentStart) {
+        fileNameStart = componentStart;
+        fileNameEnd = end;
+    }
+    parts->isASCII = WMFTextIsASCII(characters + start, end - start);
+    parts->fileName = WMFTextSpanMake(fileNameStart, fileNameEnd - fileNameStart);
+
+    parts->hasName = lastSlash != end;
+    if (parts->isThumbnail) {
+        // The second to last path component, counting from the very last slash even when it's a trailing one
+        size_t nameStart = previousSlash == end ? start : previousSlash + 1;
+        parts->name = WMFTextSpanMake(nameStart, parts->hasName ? lastSlash - nameStart : 0);
+    } else {
+        parts->name = parts->fileName;
+    }
+    size_t nameEnd = WMFTextSpanEnd(parts->name);
+    parts->extension = WMFTextSpanMake(nameEnd, 0);
+    for (size_t i = nameEnd; i > parts->name.location + 1; i--) {
+        if (characters[i - 1] == '.') {
+            parts->extension = WMFTextSpanMake(i, nameEnd - i);
+            break;
+        }
+    }
+
+    size_t px = WMFTextIndexOfASCIIString(characters, fileNameEnd, fileNameStart, "px-");
+    parts->width = WMFTextSpanMake(fileNameStart, 0);
+    parts->page = WMFTextSpanMake(fileNameStart, 0);
+    if (px == fileNameEnd) {
+        return;
+    }
+    if (parts->isThumbnail) {
+        size_t numberStart = fileNameStart;
+        for (size_t i = px; i > fileNameStart; i--) {
+            if (characters[i - 1] == '-') {
+                numberStart = i;
+                break;
+            }
+        }
+        parts->sizePrefix = WMFTextSpanIntegerValue(characters, WMFTextSpanMake(numberStart, px - numberStart));
+        parts->hasSizePrefix = parts->sizePrefix != 0;
+    }
+    WMFImageSourceURLParseThumbnailPrefix(characters, px, parts);
+}
+
+#pragma mark - Source sets
+
+static inline bool WMFImageSourceSetIsWhitespace(uint16_t c) {
+    // ASCII white space, as the HTML standard defines it
+    return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+}
+
+size_t WMFImageSourceSetParse(const uint16_t *characters, size_t length, WMFImageSourceSetCandidate *candidates, size_t capacity) {
+    size_t count = 0;
+    size_t i = 0;
+    while (true) {
+        while (i < length && (WMFImageSourceSetIsWhitespace(characters[i]) || characters[i] == ',')) {
+            i++;
+        }
+        if (i == length) {
+            return count;
+        }
+        size_t URLStart = i;
+        // Everything above a space is part of the URL, which is nearly every character
+        while (i < length && (characters[i] > ' ' || !WMFImageSourceSetIsWhitespace(characters[i]))) {
+            i++;
+        }
+        size_t URLEnd = i;
+        size_t descriptorStart = URLEnd;
+        size_t descriptorEnd = URLEnd;
+        if (characters[URLEnd - 1] == ',') {
+            // A URL that runs into the next candidate's comma has no descriptor
+            while (URLEnd > URLStart && characters[URLEnd - 1] == ',') {
+                URLEnd--;
+            }
+        } else {
+            while (i < length && WMFImageSourceSetIsWhitespace(characters[i])) {
+                i++;
+            }
+            descriptorStart = i;
+            i = WMFTextIndexOfCharacter(characters, length, i, ',');
+            descriptorEnd = i;
+            while (descriptorEnd > descriptorStart && WMFImageSourceSetIsWhitespace(characters[descriptorEnd - 1])) {
+                descriptorEnd--;
+            }
+        }
+        if (count < capacity) {
+            WMFImageSourceSetCandidate *candidate = &candidates[count];
+            candidate->URL = WMFTextSpanMake(URLStart, URLEnd - URLStart);
+            candidate->descriptor = WMFTextSpanMake(descriptorStart, descriptorEnd - descriptorStart);
+            WMFImageSourceURLParse(characters, candidate->URL, &candidate->parts);
+        }
+        count++;
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef WMFImageSourceURL_h
+#define WMFImageSourceURL_h
+
+#include "WMFTextScanning.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///
+/// @name Image source URLs
+///
+
+typedef enum {
+    WMFImageSourceURLQualityDefault = 0,
+    /// A @c lossy- thumbnail, which is how TIFFs are scaled to JPEGs
+    WMFImageSourceURLQualityLossy,
+    /// A @c lossless- thumbnail
+    WMFImageSourceURLQualityLossless,
+} WMFImageSourceURLQuality;
+
+/**
+ * The parts of an image's source URL like
+ * @c //upload.wikimedia.org/wikipedia/commons/thumb/d/d0/Ford.tif/lossy-page1-220px-Ford.tif.jpg, as spans of its
+ * characters. Everything stays percent encoded.
+ */
+typedef struct {
+    /**
+     * Whether or not every character is ASCII. Other URLs are parsed the same way, but @c NSString and
+     * @c NSRegularExpression compare them with canonical equivalence and Unicode digits, which this doesn't.
+     */
+    bool isASCII;
+    /// Whether or not there's a @c /thumb/ anywhere in the URL
+    bool isThumbnail;
+    /// The wiki the file was uploaded to, like @c commons, from the path component after the first @c /wikipedia/
+    bool hasSite;
+    WMFTextSpan site;
+    /// The last path component, like @c -lastPathComponent: trailing slashes aren't part of it. Empty when the URL is
+    /// empty or only slashes.
+    WMFTextSpan fileName;
+    /**
+     * The name of the file the image is of, like @c Ford.tif. That's the second to last path component of a thumbnail
+     * and @c fileName otherwise. There's no name when the URL has no slashes.
+     */
+    bool hasName;
+    WMFTextSpan name;
+    /// After the last dot in @c name, when there's one after its first character
+    WMFTextSpan extension;
+    /**
+     * The width a thumbnail was scaled to, like @c 220, read from the number before the first @c px- in @c fileName.
+     * Only thumbnails have one and a width of @c 0 doesn't count.
+     */
+    bool hasSizePrefix;
+    long long sizePrefix;
+    /// Whether or not @c fileName starts with a whole thumbnail prefix, like @c lossy-page1-220px-
+    bool hasThumbnailPrefix;
+    WMFImageSourceURLQuality quality;
+    /// The digits after @c page in the thumbnail prefix, when there are any
+    bool hasPage;
+    WMFTextSpan page;
+    /// The digits before @c px- in the thumbnail prefix
+    WMFTextSpan width;
+} WMFImageSourceURLParts;
+
+/**
+ * Finds every part of the image source URL in @c span in one pass over its characters, without allocating.
+ *
+ * For ASCII URLs the results match what @c WMFParseImageNameFromSourceURL, @c WMFParseSizePrefixFromSourceURL and
+ * @c WMFChangeImageSourceURLSizePrefix have always worked out with @c NSString path methods and a regular expression.
+ */
+extern void WMFImageSourceURLParse(const uint16_t *characters, WMFTextSpan span, WMFImageSourceURLParts *parts);
+
+///
+/// @name Source sets
+///
+
+/**
+ * One image candidate in an @c srcset attribute, like @c //upload.wikimedia.org/.../440px-Ford.tif.jpg @c 2x
+ */
+typedef struct {
+    WMFTextSpan URL;
+    /// Like @c 2x or @c 640w, empty when there isn't one
+    WMFTextSpan descriptor;
+    WMFImageSourceURLParts parts;
+} WMFImageSourceSetCandidate;
+
+/**
+ * Splits an @c srcset attribute value into its candidates and parses each candidate's URL, in one pass over the
+ * whole value. Candidates are separated by commas and a URL is separated from its descriptor by white space, the way
+ * the HTML standard splits them.
+ *
+ * At most @c capacity candidates are written to @c candidates.
+ *
+ * @return The number of candidates in the value, which may be more than @c capacity.
+ */
+extern size_t WMFImageSourceSetParse(const uint16_t *characters, size_t length, WMFImageSourceSetCandidate *candidates, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -4,7 +4,7 @@
  * Parse the file page title from an image's source URL and then unescape and normalize it. The returned string will be unescaped and precomposed using canonical mapping. See tests for examples.
  * @param sourceURL The source URL for an image, i.e. the "src" attribute of the @c \<img\> element.
  * @note This will remove any extra path extensions in @c sourceURL (e.g. ".../10px-foo.svg.png" to "foo.svg").
- * @warning This method does regex parsing, be sure to cache the result if possible.
+ * @warning Unescaping and normalizing make copies of the name, be sure to cache the result if possible.
  */
 FOUNDATION_EXPORT NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable));
 
@@ -15,13 +15,19 @@ FOUNDATION_EXPORT NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NS
  * Parse the file page title from an image's source URL.  See tests for examples.
  * @param sourceURL The source URL for an image, i.e. the "src" attribute of the @c \<img\> element.
  * @note This will remove any extra path extensions in @c sourceURL (e.g. ".../10px-foo.svg.png" to "foo.svg").
- * @warning This method does regex parsing, be sure to cache the result if possible.
  */
 FOUNDATION_EXPORT NSString *WMFParseImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable));
 
 /// Convenience wrapper for @c WMFParseImageNameFromSourceURL(NSString*)
 FOUNDATION_EXPORT NSString *WMFParseImageNameFromSourceURL(NSURL *sourceURL) __attribute__((overloadable));
 
+/**
+ * Parse the file page title from every image candidate's source URL in an @c srcset attribute, with one pass over the whole attribute.
+ * @param sourceSet The value of an @c \<img\> element's @c srcset attribute, e.g. "//upload.wikimedia.org/.../220px-foo.jpg 1x, //upload.wikimedia.org/.../440px-foo.jpg 2x".
+ * @return The same names @c WMFParseImageNameFromSourceURL returns for each candidate's URL, in order. Candidates without a name are left out.
+ */
+FOUNDATION_EXPORT NSArray<NSString *> *WMFParseImageNamesFromSourceSet(NSString *sourceSet);
+
 FOUNDATION_EXPORT NSInteger WMFParseSizePrefixFromSourceURL(NSString *sourceURL) __attribute__((overloadable));
 
 /// Convenience wrapper for @c WMFParseSizePrefixFromSourceURL(NSString*)
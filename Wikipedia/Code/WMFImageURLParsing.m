@@ -1,12 +1,13 @@
 #import <WMF/WMFImageURLParsing.h>
 #import <WMF/WMFLogging.h>
 #import <WMF/WMF-Swift.h>
+#import <WMF/WMFTextBuffer.h>
+#import <WMF/WMFImageSourceURL.h>
 
 static NSRegularExpression *WMFImageURLParsingRegex(void) {
     static NSRegularExpression *imageNameFromURLRegex = nil;
     static dispatch_once_t onceToken;
     dispatch_once(&onceToken, ^{
-        // TODO: try to read serialized regex from disk to prevent needless pattern compilation on next app run
         NSError *patternCompilationError;
         imageNameFromURLRegex = [NSRegularExpression regularExpressionWithPattern:@"^(lossy-|lossless-)?(page\\d+-)?\\d+px-(.*)"
                                                                           options:0
@@ -16,46 +17,24 @@ static NSRegularExpression *WMFImageURLParsingRegex(void) {
     return imageNameFromURLRegex;
 }
 
-BOOL WMFIsThumbURLString(NSString *URLString) {
-    return ([URLString rangeOfString:@"/thumb/"].location != NSNotFound);
-}
-
-NSString *WMFParseImageNameFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
-    return WMFParseImageNameFromSourceURL(sourceURL.absoluteString);
+static BOOL WMFIsThumbURLBuffer(const WMFTextBuffer *buffer) {
+    return WMFTextIndexOfASCIIString(buffer->characters, buffer->length, 0, "/thumb/") != buffer->length;
 }
 
-NSString *WMFParseImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
-    if (!sourceURL) {
-        return nil;
-    }
-    NSArray *pathComponents = [sourceURL componentsSeparatedByString:@"/"];
-    if (pathComponents.count < 2) {
-        DDLogError(@"Unable to parse source URL with too few path components: %@", pathComponents);
-        return nil;
-    }
-
-    if (!WMFIsThumbURLString(sourceURL)) {
-        return [sourceURL lastPathComponent];
-    } else {
-        return pathComponents[pathComponents.count - 2];
-    }
-}
-
-NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
-    NSString *imageName = WMFParseImageNameFromSourceURL(sourceURL);
-    NSString *normalizedImageName = [imageName wmf_unescapedNormalizedPageTitle];
-    return normalizedImageName;
+BOOL WMFIsThumbURLString(NSString *URLString) {
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, URLString);
+    BOOL isThumbURL = WMFIsThumbURLBuffer(&buffer);
+    WMFTextBufferRelease(&buffer);
+    return isThumbURL;
 }
 
-NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
-    return WMFParseUnescapedNormalizedImageNameFromSourceURL(sourceURL.absoluteString);
-}
+#pragma mark - Foundation
 
-NSInteger WMFParseSizePrefixFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
-    return WMFParseSizePrefixFromSourceURL(sourceURL.absoluteString);
-}
+// How URLs have always been parsed, which is still how ones with non-ASCII characters are. NSString compares those
+// with canonical equivalence, and \d in the regular expression matches any Unicode digit.
 
-NSInteger WMFParseSizePrefixFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
+static NSInteger WMFFoundationParseSizePrefixFromSourceURL(NSString *sourceURL) {
     if (!sourceURL) {
         return NSNotFound;
     }
@@ -87,14 +66,28 @@ NSInteger WMFParseSizePrefixFromSourceURL(NSString *sourceURL) __attribute__((ov
     }
 }
 
-NSString *WMFOriginalImageURLStringFromURLString(NSString *URLString) {
-    if ([URLString containsString:@"/thumb/"]) {
-        URLString = [[URLString stringByDeletingLastPathComponent] stringByReplacingOccurrencesOfString:@"/thumb/" withString:@"/"];
+static NSString *WMFImageSourceURLAddingSizePrefix(NSString *sourceURL, NSString *site, NSInteger newSizePrefix) {
+    NSString *lastPathComponent = [sourceURL lastPathComponent];
+    NSString *sizeVariantLastPathComponent = [NSString stringWithFormat:@"%lupx-%@", (unsigned long)newSizePrefix, lastPathComponent];
+
+    NSString *lowerCasePathExtension = [[sourceURL pathExtension] lowercaseString];
+    if ([lowerCasePathExtension isEqualToString:@"pdf"]) {
+        sizeVariantLastPathComponent = [NSString stringWithFormat:@"page1-%@.jpg", sizeVariantLastPathComponent];
+    } else if ([lowerCasePathExtension isEqualToString:@"tif"] || [lowerCasePathExtension isEqualToString:@"tiff"]) {
+        sizeVariantLastPathComponent = [NSString stringWithFormat:@"lossy-page1-%@.jpg", sizeVariantLastPathComponent];
+    } else if ([lowerCasePathExtension isEqualToString:@"svg"]) {
+        sizeVariantLastPathComponent = [NSString stringWithFormat:@"%@.png", sizeVariantLastPathComponent];
     }
-    return URLString;
+
+    NSString *urlWithSizeVariantLastPathComponent = [[sourceURL stringByAppendingString:@"/"] stringByAppendingString:sizeVariantLastPathComponent];
+
+    NSString *wikipediaString = @"/wikipedia/";
+    NSString *urlWithThumbPath = [urlWithSizeVariantLastPathComponent stringByReplacingOccurrencesOfString:[NSString stringWithFormat:@"%@%@/", wikipediaString, site] withString:[NSString stringWithFormat:@"%@%@/thumb/", wikipediaString, site]];
+
+    return urlWithThumbPath;
 }
 
-NSString *WMFChangeImageSourceURLSizePrefix(NSString *sourceURL, NSInteger newSizePrefix) __attribute__((overloadable)) {
+static NSString *WMFFoundationChangeImageSourceURLSizePrefix(NSString *sourceURL, NSInteger newSizePrefix) {
     if (newSizePrefix < 1) {
         newSizePrefix = 1;
     }
@@ -119,23 +112,8 @@ NSString *WMFChangeImageSourceURLSizePrefix(NSString *sourceURL, NSInteger newSi
 
     NSString *lastPathComponent = [sourceURL lastPathComponent];
 
-    if (WMFParseSizePrefixFromSourceURL(sourceURL) == NSNotFound) {
-        NSString *sizeVariantLastPathComponent = [NSString stringWithFormat:@"%lupx-%@", (unsigned long)newSizePrefix, lastPathComponent];
-
-        NSString *lowerCasePathExtension = [[sourceURL pathExtension] lowercaseString];
-        if ([lowerCasePathExtension isEqualToString:@"pdf"]) {
-            sizeVariantLastPathComponent = [NSString stringWithFormat:@"page1-%@.jpg", sizeVariantLastPathComponent];
-        } else if ([lowerCasePathExtension isEqualToString:@"tif"] || [lowerCasePathExtension isEqualToString:@"tiff"]) {
-            sizeVariantLastPathComponent = [NSString stringWithFormat:@"lossy-page1-%@.jpg", sizeVariantLastPathComponent];
-        } else if ([lowerCasePathExtension isEqualToString:@"svg"]) {
-            sizeVariantLastPathComponent = [NSString stringWithFormat:@"%@.png", sizeVariantLastPathComponent];
-        }
-
-        NSString *urlWithSizeVariantLastPathComponent = [[sourceURL stringByAppendingString:@"/"] stringByAppendingString:sizeVariantLastPathComponent];
-
-        NSString *urlWithThumbPath = [urlWithSizeVariantLastPathComponent stringByReplacingOccurrencesOfString:[NSString stringWithFormat:@"%@%@/", wikipediaString, site] withString:[NSString stringWithFormat:@"%@%@/thumb/", wikipediaString, site]];
-
-        return urlWithThumbPath;
+    if (WMFFoundationParseSizePrefixFromSourceURL(sourceURL) == NSNotFound) {
+        return WMFImageSourceURLAddingSizePrefix(sourceURL, site, newSizePrefix);
     } else {
         NSRange rangeOfLastPathComponent =
             NSMakeRange(
@@ -150,3 +128,135 @@ NSString *WMFChangeImageSourceURLSizePrefix(NSString *sourceURL, NSInteger newSi
                                                            withTemplate:[NSString stringWithFormat:@"$1$2%lupx-$3", (unsigned long)newSizePrefix]];
     }
 }
+
+#pragma mark - Image source URLs
+
+/// Parses @c sourceURL into @c parts, and leaves its characters in @c buffer for taking substrings of them. Release @c buffer after.
+static void WMFImageSourceURLPartsFromString(NSString *sourceURL, WMFTextBuffer *buffer, WMFImageSourceURLParts *parts) {
+    WMFTextBufferInit(buffer, sourceURL);
+    WMFImageSourceURLParse(buffer->characters, WMFTextSpanMake(0, buffer->length), parts);
+}
+
+/// The image name in @c parts, which were parsed from the source URL at @c span in @c buffer, or @c nil if it doesn't have one.
+static NSString *WMFImageNameFromSourceURLParts(const WMFTextBuffer *buffer, WMFTextSpan span, const WMFImageSourceURLParts *parts) {
+    if (!parts->hasName) {
+        return nil;
+    }
+    if (!parts->isThumbnail && parts->fileName.length == 0) {
+        // Nothing but slashes
+        return [WMFTextBufferSubstring(buffer, span) lastPathComponent];
+    }
+    return WMFTextBufferSubstring(buffer, parts->name);
+}
+
+NSString *WMFParseImageNameFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
+    return WMFParseImageNameFromSourceURL(sourceURL.absoluteString);
+}
+
+NSString *WMFParseImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
+    if (!sourceURL) {
+        return nil;
+    }
+    WMFTextBuffer buffer;
+    WMFImageSourceURLParts parts;
+    WMFImageSourceURLPartsFromString(sourceURL, &buffer, &parts);
+    NSString *imageName = WMFImageNameFromSourceURLParts(&buffer, WMFTextSpanMake(0, buffer.length), &parts);
+    WMFTextBufferRelease(&buffer);
+    if (!imageName) {
+        DDLogError(@"Unable to parse source URL with too few path components: %@", sourceURL);
+    }
+    return imageName;
+}
+
+NSArray<NSString *> *WMFParseImageNamesFromSourceSet(NSString *sourceSet) {
+    if (!sourceSet) {
+        return @[];
+    }
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, sourceSet);
+    // Most source sets have a 1x, 1.5x and 2x candidate
+    WMFImageSourceSetCandidate inlineCandidates[4];
+    WMFImageSourceSetCandidate *candidates = inlineCandidates;
+    size_t count = WMFImageSourceSetParse(buffer.characters, buffer.length, candidates, 4);
+    if (count > 4) {
+        candidates = malloc(count * sizeof(WMFImageSourceSetCandidate));
+        WMFImageSourceSetParse(buffer.characters, buffer.length, candidates, count);
+    }
+    NSMutableArray<NSString *> *imageNames = [NSMutableArray arrayWithCapacity:count];
+    for (size_t i = 0; i < count; i++) {
+        NSString *imageName = WMFImageNameFromSourceURLParts(&buffer, candidates[i].URL, &candidates[i].parts);
+        if (imageName) {
+            [imageNames addObject:imageName];
+        }
+    }
+    if (candidates != inlineCandidates) {
+        free(candidates);
+    }
+    WMFTextBufferRelease(&buffer);
+    return imageNames;
+}
+
+NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
+    NSString *imageName = WMFParseImageNameFromSourceURL(sourceURL);
+    NSString *normalizedImageName = [imageName wmf_unescapedNormalizedPageTitle];
+    return normalizedImageName;
+}
+
+NSString *WMFParseUnescapedNormalizedImageNameFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
+    return WMFParseUnescapedNormalizedImageNameFromSourceURL(sourceURL.absoluteString);
+}
+
+NSInteger WMFParseSizePrefixFromSourceURL(NSURL *sourceURL) __attribute__((overloadable)) {
+    return WMFParseSizePrefixFromSourceURL(sourceURL.absoluteString);
+}
+
+NSInteger WMFParseSizePrefixFromSourceURL(NSString *sourceURL) __attribute__((overloadable)) {
+    if (!sourceURL) {
+        return NSNotFound;
+    }
+    WMFTextBuffer buffer;
+    WMFImageSourceURLParts parts;
+    WMFImageSourceURLPartsFromString(sourceURL, &buffer, &parts);
+    WMFTextBufferRelease(&buffer);
+    if (!parts.isASCII) {
+        return WMFFoundationParseSizePrefixFromSourceURL(sourceURL);
+    }
+    return parts.hasSizePrefix ? (NSInteger)parts.sizePrefix : NSNotFound;
+}
+
+NSString *WMFOriginalImageURLStringFromURLString(NSString *URLString) {
+    if ([URLString containsString:@"/thumb/"]) {
+        URLString = [[URLString stringByDeletingLastPathComponent] stringByReplacingOccurrencesOfString:@"/thumb/" withString:@"/"];
+    }
+    return URLString;
+}
+
+NSString *WMFChangeImageSourceURLSizePrefix(NSString *sourceURL, NSInteger newSizePrefix) __attribute__((overloadable)) {
+    if (sourceURL.length == 0) {
+        return sourceURL;
+    }
+    WMFTextBuffer buffer;
+    WMFImageSourceURLParts parts;
+    WMFImageSourceURLPartsFromString(sourceURL, &buffer, &parts);
+    NSString *site = parts.isASCII && parts.hasSite && !parts.hasSizePrefix ? WMFTextBufferSubstring(&buffer, parts.site) : nil;
+    WMFTextBufferRelease(&buffer);
+
+    if (!parts.isASCII) {
+        return WMFFoundationChangeImageSourceURLSizePrefix(sourceURL, newSizePrefix);
+    }
+    if (newSizePrefix < 1) {
+        newSizePrefix = 1;
+    }
+    if (!parts.hasSite) {
+        return sourceURL;
+    }
+    if (!parts.hasSizePrefix) {
+        return WMFImageSourceURLAddingSizePrefix(sourceURL, site, newSizePrefix);
+    }
+    if (!parts.hasThumbnailPrefix) {
+        return sourceURL;
+    }
+    // Everything but the width in the thumbnail prefix stays the same
+    NSRange widthRange = NSMakeRange(parts.width.location, parts.width.length);
+    return [sourceURL stringByReplacingCharactersInRange:widthRange withString:[NSString stringWithFormat:@"%lu", (unsigned long)newSizePrefix]];
+}
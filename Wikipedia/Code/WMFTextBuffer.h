@@ -0,0 +1,44 @@
+#import <Foundation/Foundation.h>
+#import <WMF/WMFTextScanning.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Strings up to this many characters are copied to the stack when their storage can't be borrowed.
+#define WMFTextBufferInlineCapacity 256
+
+/**
+ * The UTF-16 characters of a string, for use with the @c WMFTextScanning primitives.
+ *
+ * The string's own storage is borrowed when @c CFStringGetCharactersPtr allows it. Otherwise the characters are copied
+ * into @c inlineStorage, or into a heap allocation for longer strings. Either way, @c characters is only valid while the
+ * string is alive and until @c WMFTextBufferRelease is called:
+ *
+ *     WMFTextBuffer buffer;
+ *     WMFTextBufferInit(&buffer, string);
+ *     size_t location = WMFTextIndexOfCharacter(buffer.characters, buffer.length, 0, '/');
+ *     WMFTextBufferRelease(&buffer);
+ */
+typedef struct {
+    const unichar *characters;
+    NSUInteger length;
+    unichar *_Nullable heapStorage;
+    unichar inlineStorage[WMFTextBufferInlineCapacity];
+} WMFTextBuffer;
+
+FOUNDATION_EXPORT void WMFTextBufferInit(WMFTextBuffer *buffer, NSString *string);
+
+FOUNDATION_EXPORT void WMFTextBufferRelease(WMFTextBuffer *buffer);
+
+/**
+ * Hands the heap copy of the characters over to the caller, who becomes responsible for freeing it.
+ *
+ * Lets transformations that can work in place reuse the copy as their output instead of allocating another buffer.
+ *
+ * @return The heap copy, or @c NULL if the characters were borrowed or copied to the stack.
+ */
+FOUNDATION_EXPORT unichar *_Nullable WMFTextBufferTakeHeapStorage(WMFTextBuffer *buffer);
+
+/// @return A new string with the characters in @c span.
+FOUNDATION_EXPORT NSString *WMFTextBufferSubstring(const WMFTextBuffer *buffer, WMFTextSpan span);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,34 @@
+#import <WMF/WMFTextBuffer.h>
+
+void WMFTextBufferInit(WMFTextBuffer *buffer, NSString *string) {
+    NSUInteger length = string.length;
+    buffer->length = length;
+    buffer->heapStorage = NULL;
+    const unichar *characters = CFStringGetCharactersPtr((__bridge CFStringRef)string);
+    if (characters) {
+        buffer->characters = characters;
+        return;
+    }
+    unichar *storage = buffer->inlineStorage;
+    if (length > WMFTextBufferInlineCapacity) {
+        storage = malloc(length * sizeof(unichar));
+        buffer->heapStorage = storage;
+    }
+    [string getCharacters:storage range:NSMakeRange(0, length)];
+    buffer->characters = storage;
+}
+
+void WMFTextBufferRelease(WMFTextBuffer *buffer) {
+    free(buffer->heapStorage);
+    buffer->heapStorage = NULL;
+}
+
+unichar *WMFTextBufferTakeHeapStorage(WMFTextBuffer *buffer) {
+    unichar *storage = buffer->heapStorage;
+    buffer->heapStorage = NULL;
+    return storage;
+}
+
+NSString *WMFTextBufferSubstring(const WMFTextBuffer *buffer, WMFTextSpan span) {
+    return [[NSString alloc] initWithCharacters:buffer->characters + span.location length:span.length];
+}
@@ -0,0 +1,375 @@
+#include "WMFTextCleanup.h"
+#include "WMFHTMLTokenizer.h"
+#include <stdlib.h>
+#include <string.h>
+
+/// Characters a step is holding back until it knows what to do with them.
+typedef struct {
+    uint16_t *characters;
+    size_t length;
+} WMFTextCleanupPending;
+
+enum {
+    WMFTextCleanupInlineParenthesesCapacity = 32
+};
+
+/// A stack of open parentheses. Each one is recorded as its location in the text being built, shifted left by one,
+/// with the low bit set once the group contains a parenthesis that will be kept - which means the group has to be kept too.
+typedef struct {
+    size_t *locations;
+    size_t count;
+    size_t capacity;
+    size_t inlineLocations[WMFTextCleanupInlineParenthesesCapacity];
+} WMFTextCleanupParentheses;
+
+static inline void WMFTextCleanupParenthesesInit(WMFTextCleanupParentheses *parentheses) {
+    parentheses->locations = parentheses->inlineLocations;
+    parentheses->count = 0;
+    parentheses->capacity = WMFTextCleanupInlineParenthesesCapacity;
+}
+
+static inline void WMFTextCleanupParenthesesFree(WMFTextCleanupParentheses *parentheses) {
+    if (parentheses->locations != parentheses->inlineLocations) {
+        free(parentheses->locations);
+    }
+}
+
+/// @param remainingLength The number of characters left to read, which bounds how many more parentheses can be opened.
+static inline void WMFTextCleanupParenthesesOpen(WMFTextCleanupParentheses *parentheses, size_t location, size_t remainingLength) {
+    if (parentheses->count == parentheses->capacity) {
+        size_t capacity = parentheses->count + remainingLength;
+        if (capacity < 2 * parentheses->capacity) {
+            capacity = 2 * parentheses->capacity;
+        }
+        if (parentheses->locations == parentheses->inlineLocations) {
+            parentheses->locations = malloc(capacity * sizeof(size_t));
+            memcpy(parentheses->locations, parentheses->inlineLocations, parentheses->count * sizeof(size_t));
+        } else {
+            parentheses->locations = realloc(parentheses->locations, capacity * sizeof(size_t));
+        }
+        parentheses->capacity = capacity;
+    }
+    parentheses->locations[parentheses->count++] = location << 1;
+}
+
+/// @return Whether or not the group opened by the matching parenthesis should be removed, in which case the text
+/// should be truncated to @c *location. Otherwise the closing parenthesis should be kept.
+static inline bool WMFTextCleanupParenthesesClose(WMFTextCleanupParentheses *parentheses, size_t length, size_t *location) {
+    size_t open = parentheses->locations[--parentheses->count];
+    *location = open >> 1;
+    bool containsParentheses = open & 1;
+    // [(][^()]+[)] needs at least one character between the parentheses
+    if (!containsParentheses && length > *location + 1) {
+        return true;
+    }
+    if (parentheses->count > 0) {
+        parentheses->locations[parentheses->count - 1] |= 1;
+    }
+    return false;
+}
+
+typedef struct {
+    const WMFTextCleanupStep *steps;
+    size_t stepCount;
+    size_t remainingInputLength;
+
+    uint16_t *output;
+    size_t outputLength;
+
+    // Parenthesized content is held until every open parenthesis is closed
+    WMFTextCleanupPending parenthesized;
+    WMFTextCleanupParentheses openParentheses;
+
+    WMFTextCleanupPending bracketed;
+
+    size_t remainingLength;
+    bool isLengthLimitReached;
+
+    WMFTextCleanupPending entity;
+
+    bool isCollapsingWhitespace;
+    bool isCollapsingNewlines;
+    bool isCollapsingSpaces;
+
+    WMFTextCleanupPending whitespaceBeforePunctuation;
+
+    bool isTrimmingLeadingWhitespace;
+    WMFTextCleanupPending trailingWhitespaceOrColons;
+} WMFTextCleanupState;
+
+static inline bool WMFTextCleanupIsPunctuation(uint16_t c) {
+    return c == '.' || c == 0x3002 || c == 0xFF0E || c == 0xFF61 || c == ',' || c == 0x3001 || c == ';' || c == '-' || c == 0x2014;
+}
+
+static void WMFTextCleanupPush(WMFTextCleanupState *state, size_t step, uint16_t c);
+
+static inline void WMFTextCleanupPushPending(WMFTextCleanupState *state, size_t step, WMFTextCleanupPending *pending) {
+    for (size_t i = 0; i < pending->length; i++) {
+        WMFTextCleanupPush(state, step, pending->characters[i]);
+    }
+    pending->length = 0;
+}
+
+static inline void WMFTextCleanupPerformRemoveParenthesizedContent(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    WMFTextCleanupPending *pending = &state->parenthesized;
+    WMFTextCleanupParentheses *openParentheses = &state->openParentheses;
+    if (c == '(') {
+        WMFTextCleanupParenthesesOpen(openParentheses, pending->length, state->remainingInputLength);
+    } else if (c == ')' && openParentheses->count > 0) {
+        size_t location;
+        if (WMFTextCleanupParenthesesClose(openParentheses, pending->length, &location)) {
+            pending->length = location;
+        } else {
+            pending->characters[pending->length++] = c;
+        }
+        if (openParentheses->count == 0) {
+            WMFTextCleanupPushPending(state, step + 1, pending);
+        }
+        return;
+    } else if (openParentheses->count == 0) {
+        WMFTextCleanupPush(state, step + 1, c);
+        return;
+    }
+    pending->characters[pending->length++] = c;
+}
+
+static inline void WMFTextCleanupPerformRemoveBracketedContent(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    WMFTextCleanupPending *pending = &state->bracketed;
+    if (pending->length == 0) {
+        if (c == '[') {
+            pending->characters[pending->length++] = c;
+        } else {
+            WMFTextCleanupPush(state, step + 1, c);
+        }
+    } else if (c != ']') {
+        pending->characters[pending->length++] = c;
+    } else if (pending->length > 1) {
+        pending->length = 0;
+    } else {
+        // "[]" doesn't match
+        pending->length = 0;
+        WMFTextCleanupPush(state, step + 1, '[');
+        WMFTextCleanupPush(state, step + 1, c);
+    }
+}
+
+static inline void WMFTextCleanupPerformLimitLength(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    if (state->remainingLength == 0) {
+        state->isLengthLimitReached = true;
+        return;
+    }
+    state->remainingLength--;
+    if (state->remainingLength == 0) {
+        state->isLengthLimitReached = true;
+    }
+    WMFTextCleanupPush(state, step + 1, c);
+}
+
+static inline void WMFTextCleanupPerformDecodeEntities(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    WMFTextCleanupPending *pending = &state->entity;
+    if (pending->length == 0) {
+        if (c == '&') {
+            pending->characters[pending->length++] = c;
+        } else {
+            WMFTextCleanupPush(state, step + 1, c);
+        }
+    } else if (c == ';' && pending->length > 1) {
+        uint16_t replacement[WMFHTMLEntityReplacementMaximumLength];
+        WMFHTMLSpan name = {1, pending->length - 1};
+        size_t replacementLength = WMFHTMLDecodeEntity(pending->characters, name, replacement);
+        if (replacementLength == 0) {
+            // Unknown entities are kept as they are
+            WMFTextCleanupPushPending(state, step + 1, pending);
+            WMFTextCleanupPush(state, step + 1, c);
+            return;
+        }
+        pending->length = 0;
+        for (size_t i = 0; i < replacementLength; i++) {
+            WMFTextCleanupPush(state, step + 1, replacement[i]);
+        }
+    } else if (c == ';' || WMFTextIsWhitespace(c)) {
+        WMFTextCleanupPushPending(state, step + 1, pending);
+        WMFTextCleanupPush(state, step + 1, c);
+    } else {
+        pending->characters[pending->length++] = c;
+    }
+}
+
+static inline void WMFTextCleanupPerformCollapse(bool *isCollapsing, bool isCollapsible, WMFTextCleanupState *state, size_t step, uint16_t c) {
+    if (!isCollapsible) {
+        *isCollapsing = false;
+        WMFTextCleanupPush(state, step + 1, c);
+    } else if (!*isCollapsing) {
+        *isCollapsing = true;
+        WMFTextCleanupPush(state, step + 1, c);
+    }
+}
+
+static inline void WMFTextCleanupPerformRemoveWhitespaceBeforePunctuation(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    WMFTextCleanupPending *pending = &state->whitespaceBeforePunctuation;
+    if (WMFTextIsWhitespace(c)) {
+        pending->characters[pending->length++] = c;
+        return;
+    }
+    if (WMFTextCleanupIsPunctuation(c)) {
+        pending->length = 0;
+    } else {
+        WMFTextCleanupPushPending(state, step + 1, pending);
+    }
+    WMFTextCleanupPush(state, step + 1, c);
+}
+
+static inline void WMFTextCleanupPerformTrim(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    bool isWhitespace = WMFTextIsWhitespace(c);
+    if (state->isTrimmingLeadingWhitespace) {
+        if (isWhitespace) {
+            return;
+        }
+        state->isTrimmingLeadingWhitespace = false;
+    }
+    WMFTextCleanupPending *pending = &state->trailingWhitespaceOrColons;
+    if (isWhitespace || c == ':') {
+        pending->characters[pending->length++] = c;
+        return;
+    }
+    WMFTextCleanupPushPending(state, step + 1, pending);
+    WMFTextCleanupPush(state, step + 1, c);
+}
+
+static void WMFTextCleanupPush(WMFTextCleanupState *state, size_t step, uint16_t c) {
+    if (step == state->stepCount) {
+        state->output[state->outputLength++] = c;
+        return;
+    }
+    switch (state->steps[step]) {
+        case WMFTextCleanupStepRemoveParenthesizedContent:
+            WMFTextCleanupPerformRemoveParenthesizedContent(state, step, c);
+            break;
+        case WMFTextCleanupStepRemoveBracketedContent:
+            WMFTextCleanupPerformRemoveBracketedContent(state, step, c);
+            break;
+        case WMFTextCleanupStepLimitLength:
+            WMFTextCleanupPerformLimitLength(state, step, c);
+            break;
+        case WMFTextCleanupStepDecodeEntities:
+            WMFTextCleanupPerformDecodeEntities(state, step, c);
+            break;
+        case WMFTextCleanupStepCollapseWhitespace: {
+            bool isWhitespace = WMFTextIsWhitespace(c);
+            WMFTextCleanupPerformCollapse(&state->isCollapsingWhitespace, isWhitespace, state, step, isWhitespace ? ' ' : c);
+        } break;
+        case WMFTextCleanupStepCollapseNewlines:
+            WMFTextCleanupPerformCollapse(&state->isCollapsingNewlines, c == '\n', state, step, c);
+            break;
+        case WMFTextCleanupStepCollapseSpaces:
+            WMFTextCleanupPerformCollapse(&state->isCollapsingSpaces, c == ' ', state, step, c);
+            break;
+        case WMFTextCleanupStepRemoveWhitespaceBeforePunctuation:
+            WMFTextCleanupPerformRemoveWhitespaceBeforePunctuation(state, step, c);
+            break;
+        case WMFTextCleanupStepTrim:
+            WMFTextCleanupPerformTrim(state, step, c);
+            break;
+    }
+}
+
+/// Releases everything held back by `step` and the steps after it, in order, as the end of the input has been reached.
+static void WMFTextCleanupFinish(WMFTextCleanupState *state, size_t step) {
+    for (; step < state->stepCount; step++) {
+        switch (state->steps[step]) {
+            case WMFTextCleanupStepRemoveParenthesizedContent:
+                state->openParentheses.count = 0;
+                WMFTextCleanupPushPending(state, step + 1, &state->parenthesized);
+                break;
+            case WMFTextCleanupStepRemoveBracketedContent:
+                WMFTextCleanupPushPending(state, step + 1, &state->bracketed);
+                break;
+            case WMFTextCleanupStepDecodeEntities:
+                WMFTextCleanupPushPending(state, step + 1, &state->entity);
+                break;
+            case WMFTextCleanupStepRemoveWhitespaceBeforePunctuation:
+                WMFTextCleanupPushPending(state, step + 1, &state->whitespaceBeforePunctuation);
+                break;
+            case WMFTextCleanupStepTrim:
+                state->trailingWhitespaceOrColons.length = 0;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+size_t WMFTextCleanup(const uint16_t *characters, size_t length, const WMFTextCleanupStep *steps, size_t stepCount, size_t maximumLength, uint16_t *output) {
+    WMFTextCleanupState state = {0};
+    state.steps = steps;
+    state.stepCount = stepCount;
+    state.output = output;
+    state.remainingLength = maximumLength;
+    state.isTrimmingLeadingWhitespace = true;
+
+    // Steps that hold characters back share one allocation. None of them can hold more than the whole input.
+    size_t pendingCount = 0;
+    size_t lengthLimitStep = SIZE_MAX;
+    for (size_t step = 0; step < stepCount; step++) {
+        switch (steps[step]) {
+            case WMFTextCleanupStepLimitLength:
+                lengthLimitStep = step;
+                break;
+            case WMFTextCleanupStepRemoveParenthesizedContent:
+            case WMFTextCleanupStepRemoveBracketedContent:
+            case WMFTextCleanupStepDecodeEntities:
+            case WMFTextCleanupStepRemoveWhitespaceBeforePunctuation:
+            case WMFTextCleanupStepTrim:
+                pendingCount++;
+                break;
+            default:
+                break;
+        }
+    }
+    uint16_t *allocation = malloc(pendingCount * length * sizeof(uint16_t) + 1);
+    uint16_t *pendingCharacters = allocation;
+    WMFTextCleanupParenthesesInit(&state.openParentheses);
+    WMFTextCleanupPending *pendings[] = {&state.parenthesized, &state.bracketed, &state.entity, &state.whitespaceBeforePunctuation, &state.trailingWhitespaceOrColons};
+    WMFTextCleanupStep pendingSteps[] = {WMFTextCleanupStepRemoveParenthesizedContent, WMFTextCleanupStepRemoveBracketedContent, WMFTextCleanupStepDecodeEntities, WMFTextCleanupStepRemoveWhitespaceBeforePunctuation, WMFTextCleanupStepTrim};
+    for (size_t i = 0; i < sizeof(pendingSteps) / sizeof(pendingSteps[0]); i++) {
+        for (size_t step = 0; step < stepCount; step++) {
+            if (steps[step] == pendingSteps[i]) {
+                pendings[i]->characters = pendingCharacters;
+                pendingCharacters += length;
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < length && !state.isLengthLimitReached; i++) {
+        state.remainingInputLength = length - i;
+        WMFTextCleanupPush(&state, 0, characters[i]);
+    }
+    // Whatever is held back before the length limit would have come after it
+    WMFTextCleanupFinish(&state, state.isLengthLimitReached ? lengthLimitStep + 1 : 0);
+
+    WMFTextCleanupParenthesesFree(&state.openParentheses);
+    free(allocation);
+    return state.outputLength;
+}
+
+size_t WMFTextCleanupRemoveParenthesizedContent(const uint16_t *characters, size_t length, uint16_t *output) {
+    WMFTextCleanupParentheses openParentheses;
+    WMFTextCleanupParenthesesInit(&openParentheses);
+    size_t outputLength = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint16_t c = characters[i];
+        if (c == '(') {
+            WMFTextCleanupParenthesesOpen(&openParentheses, outputLength, length - i);
+        } else if (c == ')' && openParentheses.count > 0) {
+            size_t location;
+            if (WMFTextCleanupParenthesesClose(&openParentheses, outputLength, &location)) {
+                outputLength = location;
+                continue;
+            }
+        }
+        output[outputLength++] = c;
+    }
+    WMFTextCleanupParenthesesFree(&openParentheses);
+    return outputLength;
+}
@@ -0,0 +1,67 @@
+#ifndef WMFTextCleanup_h
+#define WMFTextCleanup_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A single transformation in a text cleanup pipeline.
+ *
+ * Each step behaves exactly like the regular expression replacement it is named after in
+ * @c NSString+WMFHTMLParsing, but they are run together, one character at a time, so the input is
+ * only read once and nothing is copied between steps.
+ */
+typedef enum {
+    /// Recursively removes @c [(][^()]+[)] until nothing else matches. Unbalanced parentheses are left alone.
+    WMFTextCleanupStepRemoveParenthesizedContent,
+    /// Removes @c \\[[^]]+]
+    WMFTextCleanupStepRemoveBracketedContent,
+    /// Stops the pipeline once @c maximumLength characters have passed through this step.
+    WMFTextCleanupStepLimitLength,
+    /// Decodes @c &([^\\s;]+); the same way as @c WMFHTMLDecodeEntities
+    WMFTextCleanupStepDecodeEntities,
+    /// Replaces @c \\s+ with a single space
+    WMFTextCleanupStepCollapseWhitespace,
+    /// Replaces @c \\n{2,} with a single newline
+    WMFTextCleanupStepCollapseNewlines,
+    /// Replaces @c ' '{2,} with a single space
+    WMFTextCleanupStepCollapseSpaces,
+    /// Replaces @c \\s+([\\.。．｡,、;\\-\\u2014]) with the punctuation
+    WMFTextCleanupStepRemoveWhitespaceBeforePunctuation,
+    /// Removes @c ^[\\s\\n]+|[\\s\\n:]+$
+    WMFTextCleanupStepTrim,
+} WMFTextCleanupStep;
+
+/**
+ * Runs @c characters through @c steps in order and writes the result to @c output.
+ *
+ * Each step may appear at most once. @c output needs room for @c length characters, or @c maximumLength if that is
+ * shorter and @c steps include @c WMFTextCleanupStepLimitLength - no step makes the text longer.
+ *
+ * @param maximumLength The limit used by @c WMFTextCleanupStepLimitLength. Ignored if @c steps doesn't include it.
+ *
+ * @return The number of characters written to @c output.
+ */
+extern size_t WMFTextCleanup(const uint16_t *characters, size_t length, const WMFTextCleanupStep *steps, size_t stepCount, size_t maximumLength, uint16_t *output);
+
+/**
+ * Performs only @c WMFTextCleanupStepRemoveParenthesizedContent, in time proportional to @c length no matter how deeply
+ * parentheses are nested.
+ *
+ * Open groups are held in @c output itself, which needs room for @c length characters, so nothing is allocated unless
+ * parentheses are nested deeply. @c output may be the same buffer as @c characters.
+ *
+ * @return The number of characters written to @c output.
+ */
+extern size_t WMFTextCleanupRemoveParenthesizedContent(const uint16_t *characters, size_t length, uint16_t *output);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,378 @@
+#include "WMFTextScanning.h"
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define WMF_TEXT_SCANNING_VECTORS 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define WMF_TEXT_SCANNING_VECTORS 1
+#else
+#define WMF_TEXT_SCANNING_VECTORS 0
+#endif
+
+#pragma mark - Vectors
+
+#if WMF_TEXT_SCANNING_VECTORS
+
+// Eight characters per vector. Comparisons produce a lane of all ones for every match, and WMFTextVectorMask packs
+// those lanes into an integer with WMFTextVectorMaskBitsPerLane bits per lane, lowest location first.
+
+enum {
+    WMFTextVectorLength = 8
+};
+
+#if defined(__SSE2__)
+
+typedef __m128i WMFTextVector;
+
+enum {
+    WMFTextVectorMaskBitsPerLane = 2
+};
+
+static inline WMFTextVector WMFTextVectorSplat(uint16_t character) {
+    return _mm_set1_epi16((short)character);
+}
+
+static inline WMFTextVector WMFTextVectorLoad(const uint16_t *characters) {
+    return _mm_loadu_si128((const __m128i *)characters);
+}
+
+static inline WMFTextVector WMFTextVectorEquals(WMFTextVector a, WMFTextVector b) {
+    return _mm_cmpeq_epi16(a, b);
+}
+
+static inline WMFTextVector WMFTextVectorOr(WMFTextVector a, WMFTextVector b) {
+    return _mm_or_si128(a, b);
+}
+
+static inline uint64_t WMFTextVectorMask(WMFTextVector matches) {
+    return (uint64_t)_mm_movemask_epi8(matches);
+}
+
+static inline bool WMFTextVectorIsASCII(WMFTextVector characters) {
+    WMFTextVector high = _mm_and_si128(characters, _mm_set1_epi16((short)0xFF80));
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF;
+}
+
+#else
+
+typedef uint16x8_t WMFTextVector;
+
+enum {
+    WMFTextVectorMaskBitsPerLane = 8
+};
+
+static inline WMFTextVector WMFTextVectorSplat(uint16_t character) {
+    return vdupq_n_u16(character);
+}
+
+static inline WMFTextVector WMFTextVectorLoad(const uint16_t *characters) {
+    return vld1q_u16(characters);
+}
+
+static inline WMFTextVector WMFTextVectorEquals(WMFTextVector a, WMFTextVector b) {
+    return vceqq_u16(a, b);
+}
+
+static inline WMFTextVector WMFTextVectorOr(WMFTextVector a, WMFTextVector b) {
+    return vorrq_u16(a, b);
+}
+
+static inline uint64_t WMFTextVectorMask(WMFTextVector matches) {
+    // Narrowing keeps one byte per lane, which is cheaper than NEON's lack of a movemask
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(matches, 4)), 0);
+}
+
+static inline bool WMFTextVectorIsASCII(WMFTextVector characters) {
+    return vmaxvq_u16(characters) < 0x80;
+}
+
+#endif
+
+static inline size_t WMFTextVectorFirstLane(uint64_t mask) {
+    return (size_t)__builtin_ctzll(mask) / WMFTextVectorMaskBitsPerLane;
+}
+
+static inline size_t WMFTextVectorLastLane(uint64_t mask) {
+    return (size_t)(63 - __builtin_clzll(mask)) / WMFTextVectorMaskBitsPerLane;
+}
+
+#else
+
+// Without vectors, four characters at a time. A lane of `word ^ pattern` is zero where the character matches, and
+// (x - 0x0001) & ~x & 0x8000 flags every zero lane without missing any.
+
+static const uint64_t WMFTextWordOnes = 0x0001000100010001ULL;
+static const uint64_t WMFTextWordHighBits = 0x8000800080008000ULL;
+
+static inline uint64_t WMFTextWordZeroLanes(uint64_t word) {
+    return (word - WMFTextWordOnes) & ~word & WMFTextWordHighBits;
+}
+
+#endif
+
+#pragma mark - Finding
+
+size_t WMFTextIndexOfCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character) {
+    size_t i = location;
+#if WMF_TEXT_SCANNING_VECTORS
+    WMFTextVector pattern = WMFTextVectorSplat(character);
+    for (; i + WMFTextVectorLength <= length; i += WMFTextVectorLength) {
+        uint64_t mask = WMFTextVectorMask(WMFTextVectorEquals(WMFTextVectorLoad(characters + i), pattern));
+        if (mask != 0) {
+            return i + WMFTextVectorFirstLane(mask);
+        }
+    }
+#else
+    const uint64_t pattern = WMFTextWordOnes * character;
+    for (; i + 4 <= length; i += 4) {
+        uint64_t word;
+        memcpy(&word, characters + i, sizeof(word));
+        uint64_t lanes = WMFTextWordZeroLanes(word ^ pattern);
+        if (lanes != 0) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            // The lowest flagged lane is always a real match, and it's the first character
+            return i + (size_t)__builtin_ctzll(lanes) / 16;
+#else
+            break;
+#endif
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        if (characters[i] == character) {
+            return i;
+        }
+    }
+    return length;
+}
+
+size_t WMFTextIndexOfEitherCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character, uint16_t otherCharacter) {
+    size_t i = location;
+#if WMF_TEXT_SCANNING_VECTORS
+    WMFTextVector pattern = WMFTextVectorSplat(character);
+    WMFTextVector otherPattern = WMFTextVectorSplat(otherCharacter);
+    for (; i + WMFTextVectorLength <= length; i += WMFTextVectorLength) {
+        WMFTextVector block = WMFTextVectorLoad(characters + i);
+        uint64_t mask = WMFTextVectorMask(WMFTextVectorOr(WMFTextVectorEquals(block, pattern), WMFTextVectorEquals(block, otherPattern)));
+        if (mask != 0) {
+            return i + WMFTextVectorFirstLane(mask);
+        }
+    }
+#endif
+    // Without vectors, checking two patterns a word at a time measures slower than this loop, so it's all there is
+    for (; i < length; i++) {
+        if (characters[i] == character || characters[i] == otherCharacter) {
+            return i;
+        }
+    }
+    return length;
+}
+
+size_t WMFTextLastIndexOfCharacter(const uint16_t *characters, size_t length, size_t end, uint16_t character) {
+    size_t i = end < length ? end : length;
+#if WMF_TEXT_SCANNING_VECTORS
+    WMFTextVector pattern = WMFTextVectorSplat(character);
+    for (; i >= WMFTextVectorLength; i -= WMFTextVectorLength) {
+        uint64_t mask = WMFTextVectorMask(WMFTextVectorEquals(WMFTextVectorLoad(characters + i - WMFTextVectorLength), pattern));
+        if (mask != 0) {
+            return i - WMFTextVectorLength + WMFTextVectorLastLane(mask);
+        }
+    }
+#else
+    const uint64_t pattern = WMFTextWordOnes * character;
+    for (; i >= 4; i -= 4) {
+        uint64_t word;
+        memcpy(&word, characters + i - 4, sizeof(word));
+        if (WMFTextWordZeroLanes(word ^ pattern) != 0) {
+            break;
+        }
+    }
+#endif
+    while (i > 0) {
+        i--;
+        if (characters[i] == character) {
+            return i;
+        }
+    }
+    return length;
+}
+
+size_t WMFTextIndexOfCharacters(const uint16_t *characters, size_t length, size_t location, const uint16_t *needle, size_t needleLength) {
+    if (needleLength == 0 || needleLength > length) {
+        return length;
+    }
+    size_t lastStart = length - needleLength;
+    size_t i = WMFTextIndexOfCharacter(characters, lastStart + 1, location, needle[0]);
+    while (i <= lastStart) {
+        if (memcmp(characters + i + 1, needle + 1, (needleLength - 1) * sizeof(uint16_t)) == 0) {
+            return i;
+        }
+        i = WMFTextIndexOfCharacter(characters, lastStart + 1, i + 1, needle[0]);
+    }
+    return length;
+}
+
+static inline bool WMFTextEqualsASCII(const uint16_t *characters, const char *ASCIIString, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] != (uint8_t)ASCIIString[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t WMFTextIndexOfASCIIString(const uint16_t *characters, size_t length, size_t location, const char *needle) {
+    size_t needleLength = strlen(needle);
+    if (needleLength == 0 || needleLength > length) {
+        return length;
+    }
+    size_t lastStart = length - needleLength;
+    uint16_t first = (uint8_t)needle[0];
+    size_t i = WMFTextIndexOfCharacter(characters, lastStart + 1, location, first);
+    while (i <= lastStart) {
+        if (WMFTextEqualsASCII(characters + i + 1, needle + 1, needleLength - 1)) {
+            return i;
+        }
+        i = WMFTextIndexOfCharacter(characters, lastStart + 1, i + 1, first);
+    }
+    return length;
+}
+
+#pragma mark - Splitting
+
+bool WMFTextNextComponent(const uint16_t *characters, size_t length, uint16_t separator, size_t *location, WMFTextSpan *component) {
+    size_t start = *location;
+    if (start > length) {
+        return false;
+    }
+#if WMF_TEXT_SCANNING_VECTORS
+    size_t end = WMFTextIndexOfCharacter(characters, length, start, separator);
+#else
+    // Components are usually a few characters long, too short for searching a word at a time to pay off
+    size_t end = start;
+    while (end < length && characters[end] != separator) {
+        end++;
+    }
+#endif
+    *component = (WMFTextSpan){start, end - start};
+    *location = end + 1;
+    return true;
+}
+
+WMFTextSpan WMFTextSpanTrimmingWhitespace(const uint16_t *characters, WMFTextSpan span) {
+    size_t start = span.location;
+    size_t end = WMFTextSpanEnd(span);
+    while (start < end && WMFTextIsWhitespace(characters[start])) {
+        start++;
+    }
+    while (end > start && WMFTextIsWhitespace(characters[end - 1])) {
+        end--;
+    }
+    return (WMFTextSpan){start, end - start};
+}
+
+#pragma mark - Comparing
+
+bool WMFTextIsWhitespace(uint16_t c) {
+    // Unicode White_Space, which is what ICU uses for \s
+    if (c <= 0x20) {
+        return c == 0x20 || (c >= 0x09 && c <= 0x0D);
+    }
+    if (c < 0x85) {
+        return false;
+    }
+    return c == 0x85 || c == 0xA0 || c == 0x1680 || (c >= 0x2000 && c <= 0x200A) || c == 0x2028 || c == 0x2029 || c == 0x202F || c == 0x205F || c == 0x3000;
+}
+
+bool WMFTextIsASCII(const uint16_t *characters, size_t length) {
+    size_t i = 0;
+#if WMF_TEXT_SCANNING_VECTORS
+    for (; i + WMFTextVectorLength <= length; i += WMFTextVectorLength) {
+        if (!WMFTextVectorIsASCII(WMFTextVectorLoad(characters + i))) {
+            return false;
+        }
+    }
+#else
+    uint64_t combined = 0;
+    for (; i + 4 <= length; i += 4) {
+        uint64_t word;
+        memcpy(&word, characters + i, sizeof(word));
+        combined |= word;
+    }
+    if ((combined & 0xFF80FF80FF80FF80ULL) != 0) {
+        return false;
+    }
+#endif
+    for (; i < length; i++) {
+        if (characters[i] >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WMFTextSpanEqualsCharacters(const uint16_t *characters, WMFTextSpan span, const uint16_t *other, size_t otherLength) {
+    return span.length == otherLength && memcmp(characters + span.location, other, otherLength * sizeof(uint16_t)) == 0;
+}
+
+bool WMFTextSpanEqualsASCIIString(const uint16_t *characters, WMFTextSpan span, const char *ASCIIString) {
+    return strlen(ASCIIString) == span.length && WMFTextEqualsASCII(characters + span.location, ASCIIString, span.length);
+}
+
+bool WMFTextSpanEqualsASCIIStringIgnoringCase(const uint16_t *characters, WMFTextSpan span, const char *lowercaseASCIIString) {
+    const uint16_t *c = characters + span.location;
+    for (size_t i = 0; i < span.length; i++) {
+        uint16_t expected = (uint8_t)lowercaseASCIIString[i];
+        if (expected == 0) {
+            return false;
+        }
+        uint16_t actual = c[i];
+        if (actual >= 'A' && actual <= 'Z') {
+            actual |= 0x20;
+        }
+        if (actual != expected) {
+            return false;
+        }
+    }
+    return lowercaseASCIIString[span.length] == 0;
+}
+
+bool WMFTextSpanHasASCIIPrefix(const uint16_t *characters, WMFTextSpan span, const char *ASCIIPrefix) {
+    size_t prefixLength = strlen(ASCIIPrefix);
+    return prefixLength <= span.length && WMFTextEqualsASCII(characters + span.location, ASCIIPrefix, prefixLength);
+}
+
+int WMFTextCompareSpans(const uint16_t *characters, WMFTextSpan span, const uint16_t *otherCharacters, WMFTextSpan otherSpan) {
+    const uint16_t *a = characters + span.location;
+    const uint16_t *b = otherCharacters + otherSpan.location;
+    size_t length = span.length < otherSpan.length ? span.length : otherSpan.length;
+    for (size_t i = 0; i < length; i++) {
+        if (a[i] != b[i]) {
+            return a[i] < b[i] ? -1 : 1;
+        }
+    }
+    if (span.length == otherSpan.length) {
+        return 0;
+    }
+    return span.length < otherSpan.length ? -1 : 1;
+}
+
+long long WMFTextSpanIntegerValue(const uint16_t *characters, WMFTextSpan span) {
+    const uint16_t *c = characters + span.location;
+    size_t i = 0;
+    while (i < span.length && WMFTextIsWhitespace(c[i])) {
+        i++;
+    }
+    bool isNegative = false;
+    if (i < span.length && (c[i] == '-' || c[i] == '+')) {
+        isNegative = c[i] == '-';
+        i++;
+    }
+    unsigned long long value = 0;
+    for (; i < span.length && c[i] >= '0' && c[i] <= '9'; i++) {
+        value = value * 10 + (c[i] - '0');
+    }
+    return isNegative ? -(long long)value : (long long)value;
+}
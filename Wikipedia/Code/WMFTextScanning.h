@@ -0,0 +1,147 @@
+#ifndef WMFTextScanning_h
+#define WMFTextScanning_h
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///
+/// @name Spans
+///
+
+/**
+ * A range of UTF-16 code units in a buffer. Scanning results never own or copy characters.
+ */
+typedef struct {
+    size_t location;
+    size_t length;
+} WMFTextSpan;
+
+static inline WMFTextSpan WMFTextSpanMake(size_t location, size_t length) {
+    return (WMFTextSpan){location, length};
+}
+
+static inline size_t WMFTextSpanEnd(WMFTextSpan span) {
+    return span.location + span.length;
+}
+
+///
+/// @name Finding
+///
+/// Searches return the length of the searched characters when there's no match, so a result can be used as the end of
+/// a span without checking it first.
+///
+
+/**
+ * @return The location of the first @c character at or after @c location, or @c length if there isn't one.
+ *
+ * Compares eight characters at a time with SSE2 or NEON when they're available and four at a time otherwise, so
+ * skipping over text that doesn't contain @c character is cheap.
+ */
+extern size_t WMFTextIndexOfCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character);
+
+/**
+ * @return The location of the first @c character or @c otherCharacter at or after @c location, or @c length if there isn't one.
+ */
+extern size_t WMFTextIndexOfEitherCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character, uint16_t otherCharacter);
+
+/**
+ * @return The location of the last @c character before @c end, or @c length if there isn't one.
+ */
+extern size_t WMFTextLastIndexOfCharacter(const uint16_t *characters, size_t length, size_t end, uint16_t character);
+
+/**
+ * @return The location of the first occurrence of @c needle at or after @c location, or @c length if there isn't one.
+ *
+ * An empty @c needle is never found, matching @c -[NSString rangeOfString:].
+ */
+extern size_t WMFTextIndexOfCharacters(const uint16_t *characters, size_t length, size_t location, const uint16_t *needle, size_t needleLength);
+
+/**
+ * Same as @c WMFTextIndexOfCharacters for a NUL terminated ASCII @c needle.
+ */
+extern size_t WMFTextIndexOfASCIIString(const uint16_t *characters, size_t length, size_t location, const char *needle);
+
+///
+/// @name Splitting
+///
+
+/**
+ * Finds the next component separated by @c separator, starting at @c *location.
+ *
+ * Yields the same components as @c -[NSString componentsSeparatedByString:], including empty ones, without creating
+ * any strings:
+ *
+ *     size_t location = 0;
+ *     WMFTextSpan component;
+ *     while (WMFTextNextComponent(characters, length, '/', &location, &component)) { ... }
+ *
+ * @c *location should start at @c 0 and is advanced past the separator. It's left past @c length after the last component.
+ *
+ * @return @c true if a component was written to @c component, @c false once every component has been returned.
+ */
+extern bool WMFTextNextComponent(const uint16_t *characters, size_t length, uint16_t separator, size_t *location, WMFTextSpan *component);
+
+/**
+ * @return @c span without any leading or trailing white space, as defined by @c WMFTextIsWhitespace.
+ */
+extern WMFTextSpan WMFTextSpanTrimmingWhitespace(const uint16_t *characters, WMFTextSpan span);
+
+///
+/// @name Comparing
+///
+
+/**
+ * @return Whether or not @c character is white space, matching the @c \\s class of @c NSRegularExpression.
+ */
+extern bool WMFTextIsWhitespace(uint16_t character);
+
+/**
+ * @return Whether or not every character is below U+0080. Checks eight characters at a time where possible.
+ */
+extern bool WMFTextIsASCII(const uint16_t *characters, size_t length);
+
+/**
+ * @return Whether or not the characters in @c span are equal to @c otherLength characters in @c other.
+ */
+extern bool WMFTextSpanEqualsCharacters(const uint16_t *characters, WMFTextSpan span, const uint16_t *other, size_t otherLength);
+
+/**
+ * @return Whether or not the characters in @c span are equal to the NUL terminated @c ASCIIString.
+ */
+extern bool WMFTextSpanEqualsASCIIString(const uint16_t *characters, WMFTextSpan span, const char *ASCIIString);
+
+/**
+ * @return Whether or not the characters in @c span are equal to @c lowercaseASCIIString, ignoring ASCII case.
+ */
+extern bool WMFTextSpanEqualsASCIIStringIgnoringCase(const uint16_t *characters, WMFTextSpan span, const char *lowercaseASCIIString);
+
+/**
+ * @return Whether or not the characters in @c span start with the NUL terminated @c ASCIIPrefix.
+ */
+extern bool WMFTextSpanHasASCIIPrefix(const uint16_t *characters, WMFTextSpan span, const char *ASCIIPrefix);
+
+/**
+ * Compares code unit by code unit, the same as @c -[NSString compare:options:] with @c NSLiteralSearch.
+ *
+ * @return A negative number, zero or a positive number when @c span sorts before, the same as or after @c otherSpan.
+ */
+extern int WMFTextCompareSpans(const uint16_t *characters, WMFTextSpan span, const uint16_t *otherCharacters, WMFTextSpan otherSpan);
+
+/**
+ * Reads an optionally signed decimal integer from the start of @c span, stopping at the first character that isn't a
+ * digit. Leading white space is skipped, like @c -[NSString integerValue].
+ *
+ * @return The value, or @c 0 if @c span doesn't start with a number.
+ */
+extern long long WMFTextSpanIntegerValue(const uint16_t *characters, WMFTextSpan span);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
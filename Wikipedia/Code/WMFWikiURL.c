@@ -0,0 +1,248 @@
+#include "WMFWikiURL.h"
+
+#pragma mark - Hosts
+
+WMFWikiURLHost WMFWikiURLHostMake(const uint16_t *characters, WMFTextSpan host) {
+    // Same results as splitting on "." with -componentsSeparatedByString:, which is what NSURL+WMFLinkParsing did
+    // before this, without creating the components
+    size_t end = WMFTextSpanEnd(host);
+    size_t firstDot = WMFTextIndexOfCharacter(characters, end, host.location, '.');
+    size_t secondDot = firstDot == end ? end : WMFTextIndexOfCharacter(characters, end, firstDot + 1, '.');
+    if (secondDot == end) {
+        return (WMFWikiURLHost){false, WMFTextSpanMake(host.location, 0), host, false};
+    }
+    WMFTextSpan first = WMFTextSpanMake(host.location, firstDot - host.location);
+    WMFTextSpan second = WMFTextSpanMake(firstDot + 1, secondDot - firstDot - 1);
+    bool isFirstMobile = WMFTextSpanEqualsASCIIString(characters, first, "m");
+    bool isSecondMobile = WMFTextSpanEqualsASCIIString(characters, second, "m");
+    size_t domainStart = isSecondMobile ? secondDot + 1 : firstDot + 1;
+    WMFWikiURLHost result;
+    result.hasLanguageCode = !isFirstMobile;
+    result.languageCode = isFirstMobile ? WMFTextSpanMake(host.location, 0) : first;
+    result.domain = WMFTextSpanMake(domainStart, end - domainStart);
+    result.isMobile = isFirstMobile || isSecondMobile;
+    return result;
+}
+
+#pragma mark - URLs
+
+static inline bool WMFWikiURLIsAlpha(uint16_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+static inline bool WMFWikiURLIsDigit(uint16_t c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline bool WMFWikiURLIsSchemeCharacter(uint16_t c) {
+    return WMFWikiURLIsAlpha(c) || WMFWikiURLIsDigit(c) || c == '+' || c == '-' || c == '.';
+}
+
+static inline bool WMFWikiURLIsHostCharacter(uint16_t c) {
+    // Unreserved characters only. Sub-delimiters are legal in hosts but Foundation's handling of them isn't worth
+    // matching here.
+    return WMFWikiURLIsAlpha(c) || WMFWikiURLIsDigit(c) || c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+bool WMFWikiURLParse(const uint16_t *characters, size_t length, WMFWikiURLParts *parts) {
+    size_t i = 0;
+    if (length == 0 || !WMFWikiURLIsAlpha(characters[0])) {
+        return false;
+    }
+    while (i < length && WMFWikiURLIsSchemeCharacter(characters[i])) {
+        i++;
+    }
+    if (i + 3 > length || characters[i] != ':' || characters[i + 1] != '/' || characters[i + 2] != '/') {
+        return false;
+    }
+    parts->scheme = WMFTextSpanMake(0, i);
+    i += 3;
+
+    size_t hostStart = i;
+    while (i < length && WMFWikiURLIsHostCharacter(characters[i])) {
+        i++;
+    }
+    if (i == hostStart) {
+        return false;
+    }
+    parts->host = WMFTextSpanMake(hostStart, i - hostStart);
+
+    size_t portStart = i;
+    if (i < length && characters[i] == ':') {
+        // Only ports that NSURLComponents writes back out the same way: no leading zeros and nothing out of range
+        i++;
+        size_t digitsStart = i;
+        unsigned int port = 0;
+        while (i < length && WMFWikiURLIsDigit(characters[i]) && i - digitsStart < 5) {
+            port = port * 10 + (characters[i] - '0');
+            i++;
+        }
+        if (i == digitsStart || characters[digitsStart] == '0' || port > 65535) {
+            return false;
+        }
+    }
+    parts->port = WMFTextSpanMake(portStart, i - portStart);
+    if (i < length && characters[i] != '/' && characters[i] != '?' && characters[i] != '#') {
+        // User info, IP literals, percent encoded hosts and anything else unusual
+        return false;
+    }
+
+    size_t pathStart = i;
+    size_t pathEnd = WMFTextIndexOfEitherCharacter(characters, length, i, '?', '#');
+    parts->path = WMFTextSpanMake(pathStart, pathEnd - pathStart);
+    parts->hasTitle = false;
+    parts->title = WMFTextSpanMake(pathEnd, 0);
+    if (parts->path.length > 6 && WMFTextSpanEqualsASCIIStringIgnoringCase(characters, WMFTextSpanMake(pathStart, 6), "/wiki/")) {
+        parts->hasTitle = true;
+        parts->title = WMFTextSpanMake(pathStart + 6, parts->path.length - 6);
+    }
+
+    i = pathEnd;
+    parts->hasQuery = i < length && characters[i] == '?';
+    if (parts->hasQuery) {
+        size_t queryEnd = WMFTextIndexOfCharacter(characters, length, i + 1, '#');
+        parts->query = WMFTextSpanMake(i + 1, queryEnd - i - 1);
+        i = queryEnd;
+    } else {
+        parts->query = WMFTextSpanMake(i, 0);
+    }
+    parts->hasFragment = i < length;
+    parts->fragment = parts->hasFragment ? WMFTextSpanMake(i + 1, length - i - 1) : WMFTextSpanMake(length, 0);
+
+    parts->wikiHost = WMFWikiURLHostMake(characters, parts->host);
+    return true;
+}
+
+#pragma mark - Titles
+
+static inline int WMFWikiURLHexValue(uint16_t c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+size_t WMFWikiURLDecodeTitle(const uint16_t *characters, WMFTextSpan span, bool isNormalizing, uint16_t *output) {
+    const uint16_t *c = characters + span.location;
+    const uint16_t replaced = isNormalizing ? '_' : ' ';
+    const uint16_t replacement = isNormalizing ? ' ' : '_';
+    size_t count = 0;
+    // The code point being decoded from UTF-8, how many continuation bytes it still needs and the range the next
+    // continuation byte has to be in, which rules out overlong forms, surrogates and anything past U+10FFFF
+    uint32_t codePoint = 0;
+    int remaining = 0;
+    uint8_t lowest = 0x80;
+    uint8_t highest = 0xBF;
+    for (size_t i = 0; i < span.length; i++) {
+        uint16_t character = c[i];
+        if (character != '%') {
+            if (remaining > 0) {
+                return SIZE_MAX;
+            }
+            output[count++] = character == replaced ? replacement : character;
+            continue;
+        }
+        if (i + 2 >= span.length) {
+            return SIZE_MAX;
+        }
+        int high = WMFWikiURLHexValue(c[i + 1]);
+        int low = WMFWikiURLHexValue(c[i + 2]);
+        if (high < 0 || low < 0) {
+            return SIZE_MAX;
+        }
+        i += 2;
+        uint8_t byte = (uint8_t)(high << 4 | low);
+        if (remaining > 0) {
+            if (byte < lowest || byte > highest) {
+                return SIZE_MAX;
+            }
+            codePoint = codePoint << 6 | (byte & 0x3F);
+            lowest = 0x80;
+            highest = 0xBF;
+            if (--remaining > 0) {
+                continue;
+            }
+            if (codePoint >= 0x10000) {
+                codePoint -= 0x10000;
+                output[count++] = (uint16_t)(0xD800 + (codePoint >> 10));
+                output[count++] = (uint16_t)(0xDC00 + (codePoint & 0x3FF));
+            } else {
+                output[count++] = (uint16_t)codePoint;
+            }
+            continue;
+        }
+        if (byte < 0x80) {
+            output[count++] = byte == replaced ? replacement : byte;
+        } else if (byte >= 0xC2 && byte <= 0xDF) {
+            codePoint = byte & 0x1F;
+            remaining = 1;
+        } else if (byte >= 0xE0 && byte <= 0xEF) {
+            codePoint = byte & 0x0F;
+            remaining = 2;
+            lowest = byte == 0xE0 ? 0xA0 : 0x80;
+            highest = byte == 0xED ? 0x9F : 0xBF;
+        } else if (byte >= 0xF0 && byte <= 0xF4) {
+            codePoint = byte & 0x07;
+            remaining = 3;
+            lowest = byte == 0xF0 ? 0x90 : 0x80;
+            highest = byte == 0xF4 ? 0x8F : 0xBF;
+        } else {
+            return SIZE_MAX;
+        }
+    }
+    return remaining > 0 ? SIZE_MAX : count;
+}
+
+static inline bool WMFWikiURLIsEncodeURIComponentAllowed(uint16_t c) {
+    // Matches +[NSCharacterSet wmf_encodeURIComponentAllowedCharacterSet]
+    return WMFWikiURLIsAlpha(c) || WMFWikiURLIsDigit(c) || c == '-' || c == '_' || c == '.' || c == '!' || c == '~' || c == '*' || c == '\'' || c == '(' || c == ')';
+}
+
+static inline size_t WMFWikiURLAppendEscapedByte(uint16_t *output, size_t count, uint8_t byte) {
+    static const char hexDigits[] = "0123456789ABCDEF";
+    output[count] = '%';
+    output[count + 1] = (uint8_t)hexDigits[byte >> 4];
+    output[count + 2] = (uint8_t)hexDigits[byte & 0x0F];
+    return count + 3;
+}
+
+size_t WMFWikiURLEncodeTitle(const uint16_t *characters, size_t length, uint16_t *output) {
+    size_t count = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint32_t c = characters[i];
+        if (c == ' ') {
+            output[count++] = '_';
+        } else if (c < 0x80) {
+            if (WMFWikiURLIsEncodeURIComponentAllowed((uint16_t)c)) {
+                output[count++] = (uint16_t)c;
+            } else {
+                count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)c);
+            }
+        } else if (c < 0x800) {
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0xC0 | c >> 6));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | (c & 0x3F)));
+        } else if (c >= 0xD800 && c <= 0xDFFF) {
+            if (c > 0xDBFF || i + 1 >= length || characters[i + 1] < 0xDC00 || characters[i + 1] > 0xDFFF) {
+                return SIZE_MAX;
+            }
+            c = 0x10000 + ((c - 0xD800) << 10) + (characters[++i] - 0xDC00);
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0xF0 | c >> 18));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | ((c >> 12) & 0x3F)));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | ((c >> 6) & 0x3F)));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | (c & 0x3F)));
+        } else {
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0xE0 | c >> 12));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | ((c >> 6) & 0x3F)));
+            count = WMFWikiURLAppendEscapedByte(output, count, (uint8_t)(0x80 | (c & 0x3F)));
+        }
+    }
+    return count;
+}
+
+bool WMFWikiURLIsLineTerminator(uint16_t c) {
+    return (c >= 0x0A && c <= 0x0D) || c == 0x85 || c == 0x2028 || c == 0x2029;
+}
@@ -0,0 +1,109 @@
+#ifndef WMFWikiURL_h
+#define WMFWikiURL_h
+
+#include "WMFTextScanning.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///
+/// @name Hosts
+///
+
+/**
+ * The parts of a wiki host like @c en.m.wikipedia.org, split the way @c NSURL+WMFLinkParsing always has: a host with
+ * fewer than three labels has no language code and is its own domain. Otherwise the first label is the language code
+ * unless it's @c m, and the host is mobile when its first or second label is @c m.
+ */
+typedef struct {
+    bool hasLanguageCode;
+    /// For example @c en
+    WMFTextSpan languageCode;
+    /// The host after the language code and @c m labels, for example @c wikipedia.org
+    WMFTextSpan domain;
+    bool isMobile;
+} WMFWikiURLHost;
+
+/**
+ * Splits any host, including ones the URL parser doesn't accept, without creating any strings.
+ */
+extern WMFWikiURLHost WMFWikiURLHostMake(const uint16_t *characters, WMFTextSpan host);
+
+///
+/// @name URLs
+///
+
+/**
+ * The parts of an absolute URL, as spans of its characters. Everything stays percent encoded.
+ */
+typedef struct {
+    /// For example @c https
+    WMFTextSpan scheme;
+    WMFTextSpan host;
+    WMFWikiURLHost wikiHost;
+    /// From the end of the host to the start of the path: the port with its colon, if there is one
+    WMFTextSpan port;
+    /// Starts with @c / unless it's empty
+    WMFTextSpan path;
+    /// The path after @c /wiki/, when the path starts with it and there's something after it
+    bool hasTitle;
+    WMFTextSpan title;
+    /// After the @c ?, which is at @c query.location - 1
+    bool hasQuery;
+    WMFTextSpan query;
+    /// After the @c #, which is at @c fragment.location - 1
+    bool hasFragment;
+    WMFTextSpan fragment;
+} WMFWikiURLParts;
+
+/**
+ * Finds every part of a URL in one pass over its characters, without allocating.
+ *
+ * Only URLs whose parts are exactly what @c NSURL and @c NSURLComponents report are accepted: a scheme followed by
+ * @c // and a non-empty ASCII host with an optional port. Anything else, like user info, IP literals, percent encoded
+ * hosts or relative references, is left to them.
+ *
+ * @return Whether or not the URL was parsed into @c parts.
+ */
+extern bool WMFWikiURLParse(const uint16_t *characters, size_t length, WMFWikiURLParts *parts);
+
+///
+/// @name Titles
+///
+
+/// The most characters @c WMFWikiURLEncodeTitle can write for each character of a title
+#define WMFWikiURLEncodedTitleCharactersPerCharacter 9
+
+/**
+ * Percent decodes the title in @c span into @c output, which needs room for @c span.length characters, like
+ * @c -stringByRemovingPercentEncoding. Underscores become spaces when @c isNormalizing is @c true, like
+ * @c wmf_normalizedPageTitle, and spaces become underscores otherwise, like @c wmf_denormalizedPageTitle.
+ *
+ * The title isn't precomposed, so callers with non-ASCII results still need to do that.
+ *
+ * @return The number of characters written, or @c SIZE_MAX if the escapes aren't valid UTF-8.
+ */
+extern size_t WMFWikiURLDecodeTitle(const uint16_t *characters, WMFTextSpan span, bool isNormalizing, uint16_t *output);
+
+/**
+ * Replaces spaces with underscores and percent encodes everything that @c encodeURIComponent() in JavaScript does,
+ * which is how titles go in paths. @c output needs room for @c length times
+ * @c WMFWikiURLEncodedTitleCharactersPerCharacter characters.
+ *
+ * The title should already be precomposed.
+ *
+ * @return The number of characters written, or @c SIZE_MAX if the title has an unpaired surrogate.
+ */
+extern size_t WMFWikiURLEncodeTitle(const uint16_t *characters, size_t length, uint16_t *output);
+
+/**
+ * @return Whether or not @c character is a line terminator, which the @c . in page path regular expressions doesn't match.
+ */
+extern bool WMFWikiURLIsLineTerminator(uint16_t character);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
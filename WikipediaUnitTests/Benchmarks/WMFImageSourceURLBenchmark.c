@@ -0,0 +1,591 @@
+// Benchmarks for WMFImageSourceURL, the scanner behind WMFImageURLParsing.
+//
+// Plain C with no Foundation, so it runs anywhere there's a C compiler, including Linux CI machines:
+//
+//     scripts/benchmark_image_source_url_parsing
+//
+// Every URL in a generated corpus is first taken apart by a straightforward reference that works the way
+// WMFImageURLParsing used to: copying out path components, searching them with the C string functions and matching
+// the thumbnail prefix with the same regular expression, compiled with regcomp(). Any difference fails the run before
+// anything is timed, so a fast but wrong scanner can't report a result.
+
+#include "WMFTextScanning.h"
+#include "WMFImageSourceURL.h"
+#include <regex.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#pragma mark - Timing
+
+static double WMFBenchmarkNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/// Prevents the compiler from optimizing away results.
+static volatile size_t WMFBenchmarkSink;
+
+static int WMFBenchmarkFailures;
+
+/// The new size every thumbnail is changed to
+static const long long WMFBenchmarkNewSizePrefix = 640;
+
+#pragma mark - Corpus
+
+typedef struct {
+    char *ASCII;
+    uint16_t *characters;
+    size_t length;
+} WMFBenchmarkURL;
+
+static void WMFBenchmarkAppend(char *URL, const char *ASCIIString) {
+    strcat(URL, ASCIIString);
+}
+
+static WMFBenchmarkURL WMFBenchmarkURLMake(const char *ASCII) {
+    size_t length = strlen(ASCII);
+    WMFBenchmarkURL URL = {malloc(length + 1), malloc((length + 1) * sizeof(uint16_t)), length};
+    memcpy(URL.ASCII, ASCII, length + 1);
+    for (size_t i = 0; i < length; i++) {
+        URL.characters[i] = (uint8_t)ASCII[i];
+    }
+    return URL;
+}
+
+/// Source URLs shaped like the ones in articles, galleries and summaries, with the odd ones from the unit tests and
+/// some that are only there to get every branch of the old parsing mixed in.
+static WMFBenchmarkURL *WMFBenchmarkCreateCorpus(size_t count) {
+    static const char *const odd[] = {
+        "", "/", "//", " ", "a", "/a", "https://upload.wikimedia.org/wikipedia/", "//upload.wikimedia.org/wikipedia//",
+        "//upload.wikimedia.org/wikipedia/commons/thumb/4/41/200px-Potato.jpg/",
+        "//upload.wikimedia.org/wikipedia/commons/thumb/200px-/4/41/200px-Potato.jpg/", "/thumb/", "thumb/220px-a",
+        "//upload.wikimedia.org/wikipedia/commons/thumb/a/a5/Dog.jpg/220px-Dog.jpg//", "/wikipedia/en/thumb/"};
+    static const char *const hosts[] = {"https://upload.wikimedia.org", "//upload.wikimedia.org", "http://upload.wikimedia.org", "", "https://commons.wikimedia.org/w"};
+    static const char *const sites[] = {"/wikipedia/commons", "/wikipedia/en", "/wikipedia/de", "/wikipedia/", "/wikipedia", "/wikimedia/commons"};
+    static const char *const directories[] = {"/a/a5/", "/4/41/", "/0/0b/", "/d/d0/"};
+    static const char *const names[] = {
+        "Buteo_magnirostris.jpg", "A_Fish_and_a_Gift.pdf", "Gerald_Ford_-_NARA_-_530680.tif", "Funk.TIFF",
+        "Access_to_drinking_water_in_third_world.svg", "300px-Geothermgradients.png", "Claude_Monet%2C_1870.jpg",
+        "Blacksmith%27s_tools_-_geograph.org.uk_-_1483374.jpg", ".hidden", "NoExtension", "a-200px-b.png", "Oat10.jpeg"};
+    static const char *const thumbnailPrefixes[] = {
+        "220px-", "lossy-page1-220px-", "lossless-page2-220px-", "page1-240px-", "1280px-", "lossy-220px-", "",
+        "0px-", "foo-200px-", "+5px-", "page12px-", "12345678px-", "px-", "-px-", " 20px-", "pagepx-", "page1-px-",
+        "lossy-page-220px-", "Lossy-page1-220px-", "lossy-page1-220px", "page1-2-240px-", "007px-"};
+    static const char *const extensions[] = {"", "", ".jpg", ".png"};
+    static const char *const trailing[] = {"", "", "", "/", "//"};
+    const size_t oddCount = sizeof(odd) / sizeof(odd[0]);
+    const size_t hostCount = sizeof(hosts) / sizeof(hosts[0]);
+    const size_t siteCount = sizeof(sites) / sizeof(sites[0]);
+    const size_t directoryCount = sizeof(directories) / sizeof(directories[0]);
+    const size_t nameCount = sizeof(names) / sizeof(names[0]);
+    const size_t thumbnailPrefixCount = sizeof(thumbnailPrefixes) / sizeof(thumbnailPrefixes[0]);
+    const size_t extensionCount = sizeof(extensions) / sizeof(extensions[0]);
+    const size_t trailingCount = sizeof(trailing) / sizeof(trailing[0]);
+    WMFBenchmarkURL *URLs = malloc(count * sizeof(WMFBenchmarkURL));
+    unsigned int state = 1;
+    char URL[512];
+    for (size_t i = 0; i < count; i++) {
+        URL[0] = 0;
+        state = state * 1103515245 + 12345;
+        unsigned int kind = (state >> 8) & 15;
+        state = state * 1103515245 + 12345;
+        // Mostly ordinary thumbnails and originals, like the real traffic
+        bool isOrdinary = kind > 2;
+        if (kind == 0) {
+            WMFBenchmarkAppend(URL, odd[(state >> 16) % oddCount]);
+            URLs[i] = WMFBenchmarkURLMake(URL);
+            continue;
+        }
+        WMFBenchmarkAppend(URL, hosts[isOrdinary ? (state >> 16) % 2 : (state >> 16) % hostCount]);
+        state = state * 1103515245 + 12345;
+        WMFBenchmarkAppend(URL, sites[isOrdinary ? (state >> 16) % 3 : (state >> 16) % siteCount]);
+        bool isThumbnail = kind > 5 || (kind & 1);
+        if (isThumbnail) {
+            WMFBenchmarkAppend(URL, "/thumb");
+        }
+        state = state * 1103515245 + 12345;
+        WMFBenchmarkAppend(URL, directories[(state >> 16) % directoryCount]);
+        state = state * 1103515245 + 12345;
+        const char *name = names[(state >> 16) % (isOrdinary ? 8 : nameCount)];
+        WMFBenchmarkAppend(URL, name);
+        if (isThumbnail) {
+            WMFBenchmarkAppend(URL, "/");
+            state = state * 1103515245 + 12345;
+            WMFBenchmarkAppend(URL, thumbnailPrefixes[(state >> 16) % (isOrdinary ? 6 : thumbnailPrefixCount)]);
+            WMFBenchmarkAppend(URL, name);
+            state = state * 1103515245 + 12345;
+            WMFBenchmarkAppend(URL, extensions[(state >> 16) % extensionCount]);
+        }
+        state = state * 1103515245 + 12345;
+        WMFBenchmarkAppend(URL, trailing[isOrdinary ? 0 : (state >> 16) % trailingCount]);
+        URLs[i] = WMFBenchmarkURLMake(URL);
+    }
+    return URLs;
+}
+
+static void WMFBenchmarkFreeCorpus(WMFBenchmarkURL *URLs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        free(URLs[i].ASCII);
+        free(URLs[i].characters);
+    }
+    free(URLs);
+}
+
+#pragma mark - Reference
+
+// What WMFImageURLParsing did with NSString: -lastPathComponent, -rangeOfString:, -integerValue and
+// NSRegularExpression, each step making its own copy.
+
+static regex_t WMFReferenceThumbnailPrefixRegex;
+
+static char *WMFReferenceCopy(const char *characters, size_t length) {
+    char *copy = malloc(length + 1);
+    memcpy(copy, characters, length);
+    copy[length] = 0;
+    return copy;
+}
+
+static char *WMFReferenceLastPathComponent(const char *path) {
+    size_t length = strlen(path);
+    while (length > 0 && path[length - 1] == '/') {
+        length--;
+    }
+    if (length == 0) {
+        return WMFReferenceCopy(path, path[0] == '/' ? 1 : 0);
+    }
+    size_t start = length;
+    while (start > 0 && path[start - 1] != '/') {
+        start--;
+    }
+    return WMFReferenceCopy(path + start, length - start);
+}
+
+/// @return The name, which the caller frees, or @c NULL if there isn't one.
+static char *WMFReferenceImageName(const char *URL) {
+    const char *lastSlash = strrchr(URL, '/');
+    if (!lastSlash) {
+        return NULL;
+    }
+    if (!strstr(URL, "/thumb/")) {
+        return WMFReferenceLastPathComponent(URL);
+    }
+    const char *start = lastSlash;
+    while (start > URL && start[-1] != '/') {
+        start--;
+    }
+    return WMFReferenceCopy(start, (size_t)(lastSlash - start));
+}
+
+static long long WMFReferenceIntegerValue(const char *string) {
+    while (*string == ' ' || (*string >= '\t' && *string <= '\r')) {
+        string++;
+    }
+    bool isNegative = *string == '-';
+    if (*string == '-' || *string == '+') {
+        string++;
+    }
+    unsigned long long value = 0;
+    while (*string >= '0' && *string <= '9') {
+        value = value * 10 + (unsigned long long)(*string++ - '0');
+    }
+    return isNegative ? -(long long)value : (long long)value;
+}
+
+/// @return The size prefix, or @c 0 if there isn't one.
+static long long WMFReferenceSizePrefix(const char *URL) {
+    if (!strstr(URL, "/thumb/")) {
+        return 0;
+    }
+    char *fileName = WMFReferenceLastPathComponent(URL);
+    long long sizePrefix = 0;
+    char *px = strstr(fileName, "px-");
+    if (fileName[0] != 0 && px) {
+        char *stringBeforePx = WMFReferenceCopy(fileName, (size_t)(px - fileName));
+        char *lastDash = strrchr(stringBeforePx, '-');
+        sizePrefix = WMFReferenceIntegerValue(lastDash ? lastDash + 1 : stringBeforePx);
+        free(stringBeforePx);
+    }
+    free(fileName);
+    return sizePrefix;
+}
+
+/// @return The site, which the caller frees, or @c NULL if there isn't one.
+static char *WMFReferenceSite(const char *URL) {
+    const char *wikipedia = strstr(URL, "/wikipedia/");
+    if (!wikipedia) {
+        return NULL;
+    }
+    char *URLAfterWikipedia = WMFReferenceCopy(wikipedia + 11, strlen(wikipedia + 11));
+    char *slash = strchr(URLAfterWikipedia, '/');
+    char *site = slash && slash > URLAfterWikipedia ? WMFReferenceCopy(URLAfterWikipedia, (size_t)(slash - URLAfterWikipedia)) : NULL;
+    free(URLAfterWikipedia);
+    return site;
+}
+
+/// The size prefix change for URLs that already have one, with the regular expression.
+static char *WMFReferenceChangeSizePrefix(const char *URL, long long newSizePrefix) {
+    char *fileName = WMFReferenceLastPathComponent(URL);
+    size_t fileNameLength = strlen(fileName);
+    size_t location = strlen(URL) - fileNameLength;
+    while (strncmp(URL + location, fileName, fileNameLength) != 0) {
+        location--;
+    }
+    regmatch_t matches[4];
+    char *result;
+    if (regexec(&WMFReferenceThumbnailPrefixRegex, fileName, 4, matches, 0) != 0) {
+        result = WMFReferenceCopy(URL, strlen(URL));
+    } else {
+        size_t length = strlen(URL) + 32;
+        result = malloc(length);
+        int written = snprintf(result, length, "%.*s", (int)location, URL);
+        for (int group = 1; group <= 2; group++) {
+            if (matches[group].rm_so >= 0) {
+                written += snprintf(result + written, length - (size_t)written, "%.*s", (int)(matches[group].rm_eo - matches[group].rm_so), fileName + matches[group].rm_so);
+            }
+        }
+        written += snprintf(result + written, length - (size_t)written, "%lldpx-%s", newSizePrefix, fileName + matches[3].rm_so);
+        snprintf(result + written, length - (size_t)written, "%s", URL + location + fileNameLength);
+    }
+    free(fileName);
+    return result;
+}
+
+#pragma mark - Checks
+
+static char *WMFBenchmarkChangeSizePrefix(const WMFBenchmarkURL *URL, const WMFImageSourceURLParts *parts, long long newSizePrefix) {
+    size_t length = URL->length + 32;
+    char *result = malloc(length);
+    if (!parts->hasThumbnailPrefix) {
+        snprintf(result, length, "%s", URL->ASCII);
+    } else {
+        snprintf(result, length, "%.*s%lld%s", (int)parts->width.location, URL->ASCII, newSizePrefix, URL->ASCII + WMFTextSpanEnd(parts->width));
+    }
+    return result;
+}
+
+static bool WMFBenchmarkSpanEqualsString(const WMFBenchmarkURL *URL, WMFTextSpan span, const char *string) {
+    return string && strlen(string) == span.length && strncmp(URL->ASCII + span.location, string, span.length) == 0;
+}
+
+static bool WMFBenchmarkPartsMatch(const WMFBenchmarkURL *URL) {
+    WMFImageSourceURLParts parts;
+    WMFImageSourceURLParse(URL->characters, WMFTextSpanMake(0, URL->length), &parts);
+    bool isMatch = parts.isASCII && parts.isThumbnail == (strstr(URL->ASCII, "/thumb/") != NULL);
+
+    char *name = WMFReferenceImageName(URL->ASCII);
+    isMatch = isMatch && parts.hasName == (name != NULL);
+    // WMFParseImageNameFromSourceURL asks -lastPathComponent about URLs that are only slashes
+    bool isNameLeftToFoundation = !parts.isThumbnail && parts.fileName.length == 0;
+    if (name && !isNameLeftToFoundation) {
+        isMatch = isMatch && WMFBenchmarkSpanEqualsString(URL, parts.name, name);
+    }
+    char *fileName = WMFReferenceLastPathComponent(URL->ASCII);
+    if (parts.fileName.length > 0) {
+        isMatch = isMatch && WMFBenchmarkSpanEqualsString(URL, parts.fileName, fileName);
+    }
+
+    long long sizePrefix = WMFReferenceSizePrefix(URL->ASCII);
+    isMatch = isMatch && parts.hasSizePrefix == (sizePrefix != 0) && (!parts.hasSizePrefix || parts.sizePrefix == sizePrefix);
+
+    char *site = WMFReferenceSite(URL->ASCII);
+    isMatch = isMatch && parts.hasSite == (site != NULL) && (!site || WMFBenchmarkSpanEqualsString(URL, parts.site, site));
+
+    regmatch_t matches[4];
+    isMatch = isMatch && parts.hasThumbnailPrefix == (regexec(&WMFReferenceThumbnailPrefixRegex, fileName, 4, matches, 0) == 0);
+    if (site && parts.hasSizePrefix) {
+        char *expected = WMFReferenceChangeSizePrefix(URL->ASCII, WMFBenchmarkNewSizePrefix);
+        char *changed = WMFBenchmarkChangeSizePrefix(URL, &parts, WMFBenchmarkNewSizePrefix);
+        isMatch = isMatch && strcmp(expected, changed) == 0;
+        free(expected);
+        free(changed);
+    }
+    free(name);
+    free(fileName);
+    free(site);
+    return isMatch;
+}
+
+static bool WMFBenchmarkCanBeInSourceSet(const WMFBenchmarkURL *URL) {
+    // Source set URLs can't have white space or commas in them, and ones without a name aren't returned
+    return URL->length > 0 && strpbrk(URL->ASCII, " ,") == NULL && strchr(URL->ASCII, '/') != NULL && strspn(URL->ASCII, "/") < URL->length;
+}
+
+/// Joins up to three URLs into a source set, with a different layout of separators and descriptors each time.
+static size_t WMFBenchmarkMakeSourceSet(const WMFBenchmarkURL *URLs, size_t count, size_t index, char *sourceSet, const char **descriptors, size_t *candidateIndexes) {
+    static const char *const separators[] = {", ", ",", " , ", ",,\n", ", "};
+    static const char *const descriptorOptions[] = {"1x", "1.5x", "2x", "640w", "", " 2x "};
+    size_t candidateCount = 0;
+    sourceSet[0] = 0;
+    if (index % 7 == 0) {
+        strcat(sourceSet, "  ");
+    }
+    for (size_t i = index; i < count && candidateCount < 3; i++) {
+        if (!WMFBenchmarkCanBeInSourceSet(&URLs[i])) {
+            continue;
+        }
+        if (candidateCount > 0) {
+            // A comma straight after a URL is part of it, unless it's the last thing before white space
+            const char *separator = separators[(index + candidateCount) % 5];
+            strcat(sourceSet, descriptors[candidateCount - 1][0] == 0 && strcmp(separator, ",") == 0 ? ",\t" : separator);
+        }
+        strcat(sourceSet, URLs[i].ASCII);
+        const char *descriptor = descriptorOptions[(index + candidateCount) % 6];
+        if (descriptor[0] != 0) {
+            strcat(sourceSet, " ");
+            strcat(sourceSet, descriptor);
+        }
+        descriptors[candidateCount] = descriptor;
+        candidateIndexes[candidateCount++] = i;
+    }
+    if (index % 5 == 0) {
+        strcat(sourceSet, ",");
+    }
+    return candidateCount;
+}
+
+static size_t WMFBenchmarkCheckSourceSets(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t mismatches = 0;
+    char sourceSet[2048];
+    uint16_t characters[2048];
+    for (size_t index = 0; index < count && index < 20000; index++) {
+        const char *descriptors[3];
+        size_t candidateIndexes[3];
+        size_t expectedCount = WMFBenchmarkMakeSourceSet(URLs, count, index, sourceSet, descriptors, candidateIndexes);
+        size_t length = strlen(sourceSet);
+        for (size_t i = 0; i < length; i++) {
+            characters[i] = (uint8_t)sourceSet[i];
+        }
+        WMFImageSourceSetCandidate candidates[3];
+        size_t candidateCount = WMFImageSourceSetParse(characters, length, candidates, 3);
+        bool isMatch = candidateCount == expectedCount;
+        for (size_t i = 0; isMatch && i < candidateCount; i++) {
+            const WMFBenchmarkURL *URL = &URLs[candidateIndexes[i]];
+            WMFImageSourceURLParts parts;
+            WMFImageSourceURLParse(URL->characters, WMFTextSpanMake(0, URL->length), &parts);
+            char expectedDescriptor[16];
+            // " 2x " is written with padding that isn't part of the descriptor
+            snprintf(expectedDescriptor, sizeof(expectedDescriptor), "%s", descriptors[i][0] == ' ' ? "2x" : descriptors[i]);
+            isMatch = candidates[i].URL.length == URL->length && strncmp(sourceSet + candidates[i].URL.location, URL->ASCII, URL->length) == 0 && candidates[i].descriptor.length == strlen(expectedDescriptor) && strncmp(sourceSet + candidates[i].descriptor.location, expectedDescriptor, candidates[i].descriptor.length) == 0 && candidates[i].parts.name.length == parts.name.length && candidates[i].parts.name.location == candidates[i].URL.location + parts.name.location && candidates[i].parts.sizePrefix == parts.sizePrefix;
+        }
+        if (!isMatch) {
+            if (mismatches < 10) {
+                printf("source set mismatch: %s\n", sourceSet);
+            }
+            mismatches++;
+        }
+    }
+    return mismatches;
+}
+
+#pragma mark - Benchmarks
+
+typedef size_t (*WMFBenchmarkBody)(const WMFBenchmarkURL *URLs, size_t count);
+
+/// What an image gallery does for each image: the name for the file page, the size prefix to pick a scale, and a
+/// new URL for the size it's shown at.
+static size_t WMFBenchmarkParse(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        WMFImageSourceURLParts parts;
+        WMFImageSourceURLParse(URLs[i].characters, WMFTextSpanMake(0, URLs[i].length), &parts);
+        if (parts.hasName && (parts.isThumbnail || parts.fileName.length > 0)) {
+            total += parts.name.length;
+        }
+        total += parts.hasSizePrefix ? (size_t)parts.sizePrefix : 0;
+        total += parts.hasSite ? parts.site.length : 0;
+        if (parts.hasSite && parts.hasSizePrefix) {
+            char *changed = WMFBenchmarkChangeSizePrefix(&URLs[i], &parts, WMFBenchmarkNewSizePrefix);
+            total += strlen(changed);
+            free(changed);
+        }
+    }
+    return total;
+}
+
+static size_t WMFBenchmarkParseReference(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        const char *URL = URLs[i].ASCII;
+        char *name = WMFReferenceImageName(URL);
+        if (name && (strstr(URL, "/thumb/") || strspn(URL, "/") < URLs[i].length)) {
+            total += strlen(name);
+        }
+        free(name);
+        long long sizePrefix = WMFReferenceSizePrefix(URL);
+        total += (size_t)sizePrefix;
+        char *site = WMFReferenceSite(URL);
+        if (site) {
+            total += strlen(site);
+            if (sizePrefix != 0) {
+                char *changed = WMFReferenceChangeSizePrefix(URL, WMFBenchmarkNewSizePrefix);
+                total += strlen(changed);
+                free(changed);
+            }
+        }
+        free(site);
+    }
+    return total;
+}
+
+typedef struct {
+    char *sourceSets;
+    size_t *offsets;
+    uint16_t *characters;
+    size_t count;
+} WMFBenchmarkSourceSets;
+
+static WMFBenchmarkSourceSets WMFBenchmarkSourceSetCorpus;
+
+/// The name and width of every candidate in a source set, all at once, which is what picking a candidate for the
+/// screen's scale needs.
+static size_t WMFBenchmarkParseSourceSets(const WMFBenchmarkURL *URLs, size_t count) {
+    // The source sets are made from the URLs up front
+    (void)URLs;
+    (void)count;
+    size_t total = 0;
+    WMFImageSourceSetCandidate candidates[4];
+    for (size_t i = 0; i < WMFBenchmarkSourceSetCorpus.count; i++) {
+        size_t start = WMFBenchmarkSourceSetCorpus.offsets[i];
+        size_t length = WMFBenchmarkSourceSetCorpus.offsets[i + 1] - start;
+        size_t candidateCount = WMFImageSourceSetParse(WMFBenchmarkSourceSetCorpus.characters + start, length, candidates, 4);
+        for (size_t j = 0; j < candidateCount; j++) {
+            total += candidates[j].parts.name.length;
+            total += candidates[j].parts.hasSizePrefix ? (size_t)candidates[j].parts.sizePrefix : 0;
+        }
+    }
+    return total;
+}
+
+/// Splitting the source set into separate URLs first, and parsing each of them on its own.
+static size_t WMFBenchmarkParseSourceSetsReference(const WMFBenchmarkURL *URLs, size_t count) {
+    // The source sets are made from the URLs up front
+    (void)URLs;
+    (void)count;
+    size_t total = 0;
+    for (size_t i = 0; i < WMFBenchmarkSourceSetCorpus.count; i++) {
+        size_t start = WMFBenchmarkSourceSetCorpus.offsets[i];
+        char *sourceSet = WMFReferenceCopy(WMFBenchmarkSourceSetCorpus.sourceSets + start, WMFBenchmarkSourceSetCorpus.offsets[i + 1] - start);
+        char *candidate = strtok(sourceSet, ",");
+        while (candidate) {
+            candidate += strspn(candidate, " \t\n\f\r");
+            size_t URLLength = strcspn(candidate, " \t\n\f\r");
+            if (URLLength > 0) {
+                char *URL = WMFReferenceCopy(candidate, URLLength);
+                char *name = WMFReferenceImageName(URL);
+                total += name ? strlen(name) : 0;
+                total += (size_t)WMFReferenceSizePrefix(URL);
+                free(name);
+                free(URL);
+            }
+            candidate = strtok(NULL, ",");
+        }
+        free(sourceSet);
+    }
+    return total;
+}
+
+static void WMFBenchmarkCreateSourceSetCorpus(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t capacity = count * 64 + 1024;
+    WMFBenchmarkSourceSets *sets = &WMFBenchmarkSourceSetCorpus;
+    sets->sourceSets = malloc(capacity);
+    sets->offsets = malloc((count / 3 + 2) * sizeof(size_t));
+    sets->count = 0;
+    size_t length = 0;
+    char sourceSet[2048];
+    sets->offsets[0] = 0;
+    for (size_t index = 0; index + 3 <= count; index += 3) {
+        const char *descriptors[3];
+        size_t candidateIndexes[3];
+        WMFBenchmarkMakeSourceSet(URLs, count, index, sourceSet, descriptors, candidateIndexes);
+        size_t sourceSetLength = strlen(sourceSet);
+        if (length + sourceSetLength > capacity) {
+            capacity = (length + sourceSetLength) * 2;
+            sets->sourceSets = realloc(sets->sourceSets, capacity);
+        }
+        memcpy(sets->sourceSets + length, sourceSet, sourceSetLength);
+        length += sourceSetLength;
+        sets->offsets[++sets->count] = length;
+    }
+    sets->characters = malloc((length + 1) * sizeof(uint16_t));
+    for (size_t i = 0; i < length; i++) {
+        sets->characters[i] = (uint8_t)sets->sourceSets[i];
+    }
+}
+
+/// @return Nanoseconds per URL for the fastest of several runs of @c body.
+static double WMFBenchmarkMeasure(WMFBenchmarkBody body, const WMFBenchmarkURL *URLs, size_t count, int iterations) {
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        double start = WMFBenchmarkNow();
+        for (int i = 0; i < iterations; i++) {
+            WMFBenchmarkSink += body(URLs, count);
+        }
+        double elapsed = (WMFBenchmarkNow() - start) / iterations;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best * 1e9 / (double)count;
+}
+
+static void WMFBenchmarkReport(const char *name, WMFBenchmarkBody body, WMFBenchmarkBody baseline, const WMFBenchmarkURL *URLs, size_t count, int iterations) {
+    size_t result = body(URLs, count);
+    size_t expected = baseline(URLs, count);
+    if (result != expected) {
+        printf("%-34s FAILED: %zu != %zu\n", name, result, expected);
+        WMFBenchmarkFailures++;
+        return;
+    }
+    double nanoseconds = WMFBenchmarkMeasure(body, URLs, count, iterations);
+    double baselineNanoseconds = WMFBenchmarkMeasure(baseline, URLs, count, iterations);
+    printf("%-34s %8.1f ns/URL %8.1f ns/URL (reference) %6.1fx\n", name, nanoseconds, baselineNanoseconds, baselineNanoseconds / nanoseconds);
+}
+
+int main(int argc, const char *argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 100000;
+    int iterations = argc > 2 ? atoi(argv[2]) : 5;
+    if (count == 0 || iterations <= 0) {
+        fprintf(stderr, "usage: %s [URL count] [iterations]\n", argv[0]);
+        return 1;
+    }
+    if (regcomp(&WMFReferenceThumbnailPrefixRegex, "^(lossy-|lossless-)?(page[0-9]+-)?[0-9]+px-(.*)", REG_EXTENDED) != 0) {
+        fprintf(stderr, "couldn't compile the thumbnail prefix pattern\n");
+        return 1;
+    }
+
+    WMFBenchmarkURL *URLs = WMFBenchmarkCreateCorpus(count);
+    size_t mismatches = 0;
+    size_t thumbnails = 0;
+    size_t resized = 0;
+    for (size_t i = 0; i < count; i++) {
+        WMFImageSourceURLParts parts;
+        WMFImageSourceURLParse(URLs[i].characters, WMFTextSpanMake(0, URLs[i].length), &parts);
+        thumbnails += parts.isThumbnail;
+        resized += parts.hasSite && parts.hasThumbnailPrefix && parts.hasSizePrefix;
+        if (!WMFBenchmarkPartsMatch(&URLs[i])) {
+            if (mismatches < 10) {
+                printf("mismatch: %s\n", URLs[i].ASCII);
+            }
+            mismatches++;
+        }
+    }
+    size_t sourceSetMismatches = WMFBenchmarkCheckSourceSets(URLs, count);
+    WMFBenchmarkFailures += (int)(mismatches + sourceSetMismatches);
+    printf("%zu URLs, %zu thumbnails, %zu resized, %zu mismatches, %zu source set mismatches\n\n", count, thumbnails, resized, mismatches, sourceSetMismatches);
+
+    if (WMFBenchmarkFailures == 0) {
+        WMFBenchmarkCreateSourceSetCorpus(URLs, count);
+        WMFBenchmarkReport("name, size prefix, resize", WMFBenchmarkParse, WMFBenchmarkParseReference, URLs, count, iterations);
+        WMFBenchmarkReport("names and sizes from source sets", WMFBenchmarkParseSourceSets, WMFBenchmarkParseSourceSetsReference, URLs, count, iterations);
+        free(WMFBenchmarkSourceSetCorpus.sourceSets);
+        free(WMFBenchmarkSourceSetCorpus.offsets);
+        free(WMFBenchmarkSourceSetCorpus.characters);
+    }
+
+    regfree(&WMFReferenceThumbnailPrefixRegex);
+    WMFBenchmarkFreeCorpus(URLs, count);
+    return WMFBenchmarkFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,350 @@
+// Per-primitive benchmarks for WMFTextScanning and the HTML tokenizer built on it.
+//
+// Plain C with no Foundation, so it runs anywhere there's a C compiler, including Linux CI machines:
+//
+//     scripts/benchmark_text_scanning
+//
+// Every primitive is timed next to the obvious one-character-at-a-time loop it replaces, called the same way, and
+// checked against it before timing so a fast but wrong implementation can't report a result. The scalar loops are
+// kept out of line like the primitives, so neither side gets inlined into the caller's loop. Any primitive that
+// comes out more than 10% slower than its scalar loop is listed at the end and should go back to being that loop.
+
+#include "WMFTextScanning.h"
+#include "WMFHTMLTokenizer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#pragma mark - Timing
+
+static double WMFBenchmarkNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/// Prevents the compiler from optimizing away results.
+static volatile size_t WMFBenchmarkSink;
+
+typedef size_t (*WMFBenchmarkBody)(const uint16_t *characters, size_t length);
+
+/// @return Nanoseconds per character for the fastest of several runs of @c body.
+static double WMFBenchmarkMeasure(WMFBenchmarkBody body, const uint16_t *characters, size_t length, int iterations) {
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        double start = WMFBenchmarkNow();
+        for (int i = 0; i < iterations; i++) {
+            WMFBenchmarkSink += body(characters, length);
+        }
+        double elapsed = (WMFBenchmarkNow() - start) / iterations;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best * 1e9 / (double)length;
+}
+
+static int WMFBenchmarkFailures;
+
+/// Primitives that measured slower than the scalar loop they replace
+static int WMFBenchmarkSlowerCount;
+
+static void WMFBenchmarkReport(const char *name, WMFBenchmarkBody body, WMFBenchmarkBody baseline, const uint16_t *characters, size_t length, int iterations) {
+    size_t result = body(characters, length);
+    size_t expected = baseline(characters, length);
+    if (result != expected) {
+        printf("%-34s FAILED: %zu != %zu\n", name, result, expected);
+        WMFBenchmarkFailures++;
+        return;
+    }
+    double nanoseconds = WMFBenchmarkMeasure(body, characters, length, iterations);
+    double baselineNanoseconds = WMFBenchmarkMeasure(baseline, characters, length, iterations);
+    // Run to run noise on a shared machine is around 10%, so only a bigger gap means the primitive is really slower
+    bool isSlower = nanoseconds > baselineNanoseconds * 1.1;
+    WMFBenchmarkSlowerCount += isSlower;
+    printf("%-34s %8.3f ns/char %8.3f ns/char (scalar) %6.1fx%s\n", name, nanoseconds, baselineNanoseconds, baselineNanoseconds / nanoseconds, isSlower ? "  SLOWER" : "");
+}
+
+#pragma mark - Corpus
+
+/// Article-like HTML, mostly ASCII prose with tags, entities and the occasional non-ASCII word.
+static uint16_t *WMFBenchmarkCreateCorpus(size_t length, bool isASCII) {
+    static const char *const words[] = {"the", "<b>article</b>", "of", "&amp;", "wikipedia", "<a href=\"./Link\">link</a>", "encyclopedia", "&#8212;", "(born", "1970)", "is", "a"};
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+    uint16_t *characters = malloc(length * sizeof(uint16_t));
+    size_t i = 0;
+    unsigned int state = 1;
+    while (i < length) {
+        state = state * 1103515245 + 12345;
+        const char *word = words[(state >> 16) % wordCount];
+        for (size_t j = 0; word[j] != 0 && i < length; j++) {
+            characters[i++] = (uint8_t)word[j];
+        }
+        if (i < length) {
+            characters[i++] = (!isASCII && ((state >> 8) & 0xFF) == 0) ? 0x00E9 : ' ';
+        }
+    }
+    return characters;
+}
+
+#pragma mark - Scalar primitives
+
+// What the primitives replace, one character at a time. What they search for is read from volatile globals, so the
+// compiler can't specialize them for it either.
+
+static volatile uint16_t WMFBenchmarkTagStart = '<';
+static volatile uint16_t WMFBenchmarkEntityStart = '&';
+static volatile uint16_t WMFBenchmarkSeparator = ' ';
+static const char *volatile WMFBenchmarkTagName = "b";
+
+__attribute__((noinline)) static size_t WMFBenchmarkScalarIndexOfCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character) {
+    for (size_t i = location; i < length; i++) {
+        if (characters[i] == character) {
+            return i;
+        }
+    }
+    return length;
+}
+
+__attribute__((noinline)) static size_t WMFBenchmarkScalarIndexOfEitherCharacter(const uint16_t *characters, size_t length, size_t location, uint16_t character, uint16_t otherCharacter) {
+    for (size_t i = location; i < length; i++) {
+        if (characters[i] == character || characters[i] == otherCharacter) {
+            return i;
+        }
+    }
+    return length;
+}
+
+__attribute__((noinline)) static bool WMFBenchmarkScalarEqualsIgnoringCase(const uint16_t *characters, WMFTextSpan span, const char *lowercaseASCIIString) {
+    if (strlen(lowercaseASCIIString) != span.length) {
+        return false;
+    }
+    for (size_t i = 0; i < span.length; i++) {
+        uint16_t c = characters[span.location + i];
+        if ((c >= 'A' && c <= 'Z' ? c + 0x20 : c) != (uint8_t)lowercaseASCIIString[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#pragma mark - Primitives
+
+static size_t WMFBenchmarkCountCharacter(const uint16_t *characters, size_t length) {
+    size_t count = 0;
+    uint16_t tagStart = WMFBenchmarkTagStart;
+    for (size_t i = WMFTextIndexOfCharacter(characters, length, 0, tagStart); i < length; i = WMFTextIndexOfCharacter(characters, length, i + 1, tagStart)) {
+        count++;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkCountCharacterScalar(const uint16_t *characters, size_t length) {
+    size_t count = 0;
+    uint16_t tagStart = WMFBenchmarkTagStart;
+    for (size_t i = WMFBenchmarkScalarIndexOfCharacter(characters, length, 0, tagStart); i < length; i = WMFBenchmarkScalarIndexOfCharacter(characters, length, i + 1, tagStart)) {
+        count++;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkFindRareCharacter(const uint16_t *characters, size_t length) {
+    return WMFTextIndexOfCharacter(characters, length, 0, '~');
+}
+
+static size_t WMFBenchmarkFindRareCharacterScalar(const uint16_t *characters, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] == '~') {
+            return i;
+        }
+    }
+    return length;
+}
+
+static size_t WMFBenchmarkCountEitherCharacter(const uint16_t *characters, size_t length) {
+    size_t count = 0;
+    uint16_t tagStart = WMFBenchmarkTagStart;
+    uint16_t entityStart = WMFBenchmarkEntityStart;
+    for (size_t i = WMFTextIndexOfEitherCharacter(characters, length, 0, tagStart, entityStart); i < length; i = WMFTextIndexOfEitherCharacter(characters, length, i + 1, tagStart, entityStart)) {
+        count++;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkCountEitherCharacterScalar(const uint16_t *characters, size_t length) {
+    size_t count = 0;
+    uint16_t tagStart = WMFBenchmarkTagStart;
+    uint16_t entityStart = WMFBenchmarkEntityStart;
+    for (size_t i = WMFBenchmarkScalarIndexOfEitherCharacter(characters, length, 0, tagStart, entityStart); i < length; i = WMFBenchmarkScalarIndexOfEitherCharacter(characters, length, i + 1, tagStart, entityStart)) {
+        count++;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkFindLastRareCharacter(const uint16_t *characters, size_t length) {
+    return WMFTextLastIndexOfCharacter(characters, length, length, '~');
+}
+
+static size_t WMFBenchmarkFindLastRareCharacterScalar(const uint16_t *characters, size_t length) {
+    for (size_t i = length; i > 0; i--) {
+        if (characters[i - 1] == '~') {
+            return i - 1;
+        }
+    }
+    return length;
+}
+
+static size_t WMFBenchmarkCountASCIIString(const uint16_t *characters, size_t length) {
+    size_t count = 0;
+    for (size_t i = WMFTextIndexOfASCIIString(characters, length, 0, "wikipedia"); i < length; i = WMFTextIndexOfASCIIString(characters, length, i + 1, "wikipedia")) {
+        count++;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkCountASCIIStringScalar(const uint16_t *characters, size_t length) {
+    static const char needle[] = "wikipedia";
+    const size_t needleLength = sizeof(needle) - 1;
+    size_t count = 0;
+    for (size_t i = 0; i + needleLength <= length; i++) {
+        size_t j = 0;
+        while (j < needleLength && characters[i + j] == (uint8_t)needle[j]) {
+            j++;
+        }
+        count += j == needleLength;
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkSplit(const uint16_t *characters, size_t length) {
+    size_t location = 0;
+    size_t total = 0;
+    WMFTextSpan component;
+    uint16_t separator = WMFBenchmarkSeparator;
+    while (WMFTextNextComponent(characters, length, separator, &location, &component)) {
+        total += component.length + 1;
+    }
+    return total;
+}
+
+static size_t WMFBenchmarkSplitScalar(const uint16_t *characters, size_t length) {
+    size_t total = 0;
+    uint16_t separator = WMFBenchmarkSeparator;
+    for (size_t start = 0; start <= length;) {
+        size_t end = WMFBenchmarkScalarIndexOfCharacter(characters, length, start, separator);
+        total += end - start + 1;
+        start = end + 1;
+    }
+    return total;
+}
+
+static size_t WMFBenchmarkIsASCII(const uint16_t *characters, size_t length) {
+    return WMFTextIsASCII(characters, length);
+}
+
+static size_t WMFBenchmarkIsASCIIScalar(const uint16_t *characters, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] >= 0x80) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// The names of every tag in the corpus, found once up front so only the comparisons are timed
+static WMFTextSpan *WMFBenchmarkTagNames;
+static size_t WMFBenchmarkTagNameCount;
+
+static void WMFBenchmarkFindTagNames(const uint16_t *characters, size_t length) {
+    WMFBenchmarkTagNames = malloc((length / 2 + 1) * sizeof(WMFTextSpan));
+    size_t location = 0;
+    WMFHTMLTag tag;
+    while (WMFHTMLNextTag(characters, length, location, &tag)) {
+        WMFBenchmarkTagNames[WMFBenchmarkTagNameCount++] = tag.name;
+        location = WMFTextSpanEnd(tag.range);
+    }
+}
+
+static size_t WMFBenchmarkCompareTagNames(const uint16_t *characters, size_t length) {
+    // The tag names were found up front
+    (void)length;
+    size_t count = 0;
+    const char *tagName = WMFBenchmarkTagName;
+    for (size_t i = 0; i < WMFBenchmarkTagNameCount; i++) {
+        count += WMFTextSpanEqualsASCIIStringIgnoringCase(characters, WMFBenchmarkTagNames[i], tagName);
+    }
+    return count;
+}
+
+static size_t WMFBenchmarkCompareTagNamesScalar(const uint16_t *characters, size_t length) {
+    // The tag names were found up front
+    (void)length;
+    size_t count = 0;
+    const char *tagName = WMFBenchmarkTagName;
+    for (size_t i = 0; i < WMFBenchmarkTagNameCount; i++) {
+        count += WMFBenchmarkScalarEqualsIgnoringCase(characters, WMFBenchmarkTagNames[i], tagName);
+    }
+    return count;
+}
+
+#pragma mark - Tokenizer
+
+static uint16_t *WMFBenchmarkOutput;
+
+static size_t WMFBenchmarkRemoveTags(const uint16_t *characters, size_t length) {
+    return WMFHTMLRemoveTags(characters, length, WMFBenchmarkOutput, NULL, NULL);
+}
+
+static size_t WMFBenchmarkRemoveTagsWithMaximumLength(const uint16_t *characters, size_t length) {
+    return WMFHTMLRemoveTagsWithMaximumLength(characters, length, 525, WMFBenchmarkOutput, NULL, NULL);
+}
+
+static size_t WMFBenchmarkDecodeEntities(const uint16_t *characters, size_t length) {
+    return WMFHTMLDecodeEntities(characters, length, WMFBenchmarkOutput);
+}
+
+static size_t WMFBenchmarkCopy(const uint16_t *characters, size_t length) {
+    memcpy(WMFBenchmarkOutput, characters, length * sizeof(uint16_t));
+    return WMFBenchmarkOutput[length / 2];
+}
+
+static void WMFBenchmarkReportThroughput(const char *name, WMFBenchmarkBody body, const uint16_t *characters, size_t length, int iterations) {
+    double nanoseconds = WMFBenchmarkMeasure(body, characters, length, iterations);
+    printf("%-34s %8.3f ns/char %8.1f MB/s\n", name, nanoseconds, 2e3 / nanoseconds);
+}
+
+int main(int argc, const char *argv[]) {
+    size_t length = argc > 1 ? (size_t)strtoul(argv[1], NULL, 10) : 1 << 20;
+    int iterations = argc > 2 ? atoi(argv[2]) : 20;
+    uint16_t *characters = WMFBenchmarkCreateCorpus(length, false);
+    uint16_t *ASCIICharacters = WMFBenchmarkCreateCorpus(length, true);
+    WMFBenchmarkOutput = malloc(length * sizeof(uint16_t));
+
+    WMFBenchmarkFindTagNames(characters, length);
+
+    printf("%zu characters, best of 5 runs of %d iterations\n\n", length, iterations);
+    WMFBenchmarkReport("WMFTextIndexOfCharacter (dense)", WMFBenchmarkCountCharacter, WMFBenchmarkCountCharacterScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextIndexOfCharacter (absent)", WMFBenchmarkFindRareCharacter, WMFBenchmarkFindRareCharacterScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextIndexOfEitherCharacter", WMFBenchmarkCountEitherCharacter, WMFBenchmarkCountEitherCharacterScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextLastIndexOfCharacter", WMFBenchmarkFindLastRareCharacter, WMFBenchmarkFindLastRareCharacterScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextIndexOfASCIIString", WMFBenchmarkCountASCIIString, WMFBenchmarkCountASCIIStringScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextNextComponent", WMFBenchmarkSplit, WMFBenchmarkSplitScalar, characters, length, iterations);
+    WMFBenchmarkReport("WMFTextIsASCII", WMFBenchmarkIsASCII, WMFBenchmarkIsASCIIScalar, ASCIICharacters, length, iterations);
+    WMFBenchmarkReport("WMFTextSpanEqualsASCII...Case", WMFBenchmarkCompareTagNames, WMFBenchmarkCompareTagNamesScalar, characters, length, iterations);
+    if (WMFBenchmarkSlowerCount > 0) {
+        printf("\n%d primitives are slower than the scalar loops they replace\n", WMFBenchmarkSlowerCount);
+    }
+
+    printf("\n");
+    WMFBenchmarkReportThroughput("memcpy", WMFBenchmarkCopy, characters, length, iterations);
+    WMFBenchmarkReportThroughput("WMFHTMLRemoveTags", WMFBenchmarkRemoveTags, characters, length, iterations);
+    WMFBenchmarkReportThroughput("WMFHTMLRemoveTags (525 max)", WMFBenchmarkRemoveTagsWithMaximumLength, characters, length, iterations);
+    WMFBenchmarkReportThroughput("WMFHTMLDecodeEntities", WMFBenchmarkDecodeEntities, characters, length, iterations);
+
+    free(WMFBenchmarkTagNames);
+    free(WMFBenchmarkOutput);
+    free(ASCIICharacters);
+    free(characters);
+    return WMFBenchmarkFailures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,689 @@
+// Benchmarks for WMFWikiURL, the parser behind NSURL+WMFLinkParsing.
+//
+// Plain C with no Foundation, so it runs anywhere there's a C compiler, including Linux CI machines:
+//
+//     scripts/benchmark_wiki_url_parsing
+//
+// Every URL in a generated corpus is first taken apart by a straightforward reference that works the way the category
+// used to: splitting strings into freshly allocated components, decoding into byte buffers and transcoding afterwards.
+// Any difference fails the run before anything is timed, so a fast but wrong parser can't report a result.
+
+#include "WMFTextScanning.h"
+#include "WMFWikiURL.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#pragma mark - Timing
+
+static double WMFBenchmarkNow(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+/// Prevents the compiler from optimizing away results.
+static volatile size_t WMFBenchmarkSink;
+
+static int WMFBenchmarkFailures;
+
+#pragma mark - Corpus
+
+typedef struct {
+    uint16_t *characters;
+    size_t length;
+} WMFBenchmarkURL;
+
+static size_t WMFBenchmarkAppendASCII(uint16_t *characters, size_t length, const char *ASCIIString) {
+    while (*ASCIIString != 0) {
+        characters[length++] = (uint8_t)*ASCIIString++;
+    }
+    return length;
+}
+
+/// Feed and article link shaped URLs, with some that the parser has to turn down mixed in.
+static WMFBenchmarkURL *WMFBenchmarkCreateCorpus(size_t count) {
+    static const char *const prefixes[] = {"https://", "http://", "https://", "HTTPS://", "ftp://"};
+    static const char *const hosts[] = {
+        "en.wikipedia.org", "en.m.wikipedia.org", "de.wikipedia.org", "zh-yue.m.wikipedia.org", "m.wikipedia.org",
+        "commons.wikimedia.org", "www.mediawiki.org", "wikipedia.org", "localhost:8080", "simple.wikipedia.org",
+        "EN.Wikipedia.ORG", ".m.wikipedia.org", "en..wikipedia.org", "a.b", "en.m.m.wikipedia.org",
+        // Turned down by the parser
+        "user@en.wikipedia.org", "[::1]:8080", "en.wikipedia.org:080", "%65n.wikipedia.org", "", "en.wikipedia.org:"};
+    static const char *const paths[] = {
+        "/wiki/Dog", "/wiki/Talk:India", "/wiki/A_B_C", "/wiki/%E6%97%A5%E6%9C%AC", "/wiki/Caf%C3%A9_au_lait",
+        "/wiki/%F0%9F%90%B6", "/w/api.php", "/", "", "/wiki/", "/WIKI/Cat", "/wiki/AC%2FDC", "/wiki/Foo/",
+        "/wiki/A%20B", "/wiki/a;b", "/api/rest_v1/page", "/wiki/Line%0Abreak", "/wiki/%E2%80%A8", "/wiki/Special:Random/",
+        "/%77iki/Dog",
+        // Escapes that aren't valid UTF-8: truncated, surrogates, overlong and past U+10FFFF
+        "/wiki/%ZZ", "/wiki/%C3", "/wiki/%ED%A0%80", "/wiki/%C0%AF", "/wiki/%E0%80%AF", "/wiki/%F0%8F%BF%BF", "/wiki/%F4%90%80%80"};
+    static const char *const suffixes[] = {"", "", "#History", "?action=edit", "?a=b#c", "#", "?", "?q=%20#x?y"};
+    const size_t prefixCount = sizeof(prefixes) / sizeof(prefixes[0]);
+    const size_t hostCount = sizeof(hosts) / sizeof(hosts[0]);
+    const size_t pathCount = sizeof(paths) / sizeof(paths[0]);
+    const size_t suffixCount = sizeof(suffixes) / sizeof(suffixes[0]);
+    WMFBenchmarkURL *URLs = malloc(count * sizeof(WMFBenchmarkURL));
+    unsigned int state = 1;
+    for (size_t i = 0; i < count; i++) {
+        uint16_t *characters = malloc(256 * sizeof(uint16_t));
+        size_t length = 0;
+        state = state * 1103515245 + 12345;
+        // Mostly ordinary https URLs, like the real traffic
+        bool isOrdinary = ((state >> 8) & 3) != 0;
+        state = state * 1103515245 + 12345;
+        length = WMFBenchmarkAppendASCII(characters, length, prefixes[isOrdinary ? 0 : (state >> 16) % prefixCount]);
+        state = state * 1103515245 + 12345;
+        length = WMFBenchmarkAppendASCII(characters, length, hosts[(state >> 16) % (isOrdinary ? 5 : hostCount)]);
+        state = state * 1103515245 + 12345;
+        length = WMFBenchmarkAppendASCII(characters, length, paths[(state >> 16) % (isOrdinary ? 6 : pathCount)]);
+        state = state * 1103515245 + 12345;
+        length = WMFBenchmarkAppendASCII(characters, length, suffixes[(state >> 16) % suffixCount]);
+        URLs[i] = (WMFBenchmarkURL){characters, length};
+    }
+    return URLs;
+}
+
+static void WMFBenchmarkFreeCorpus(WMFBenchmarkURL *URLs, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        free(URLs[i].characters);
+    }
+    free(URLs);
+}
+
+#pragma mark - Reference
+
+// The obvious implementations, kept deliberately close to what NSURLComponents and -componentsSeparatedByString:
+// did for the category: every component is its own allocation.
+
+typedef struct {
+    uint16_t *characters;
+    size_t length;
+} WMFReferenceString;
+
+static WMFReferenceString WMFReferenceStringMake(const uint16_t *characters, size_t length) {
+    WMFReferenceString string = {malloc((length + 1) * sizeof(uint16_t)), length};
+    memcpy(string.characters, characters, length * sizeof(uint16_t));
+    return string;
+}
+
+static bool WMFReferenceStringEqualsSpan(WMFReferenceString string, const uint16_t *characters, WMFTextSpan span) {
+    return string.length == span.length && memcmp(string.characters, characters + span.location, span.length * sizeof(uint16_t)) == 0;
+}
+
+static bool WMFReferenceStringEqualsASCII(WMFReferenceString string, const char *ASCIIString) {
+    if (string.length != strlen(ASCIIString)) {
+        return false;
+    }
+    for (size_t i = 0; i < string.length; i++) {
+        if (string.characters[i] != (uint8_t)ASCIIString[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+typedef struct {
+    bool hasLanguageCode;
+    WMFReferenceString languageCode;
+    WMFReferenceString domain;
+    bool isMobile;
+} WMFReferenceHost;
+
+static WMFReferenceHost WMFReferenceHostMake(const uint16_t *characters, size_t length) {
+    // Split on ".", one allocation per component
+    size_t componentCount = 1;
+    for (size_t i = 0; i < length; i++) {
+        componentCount += characters[i] == '.';
+    }
+    WMFReferenceString *components = malloc(componentCount * sizeof(WMFReferenceString));
+    size_t start = 0;
+    size_t index = 0;
+    for (size_t i = 0; i <= length; i++) {
+        if (i == length || characters[i] == '.') {
+            components[index++] = WMFReferenceStringMake(characters + start, i - start);
+            start = i + 1;
+        }
+    }
+    WMFReferenceHost host = {false, {NULL, 0}, {NULL, 0}, false};
+    if (componentCount < 3) {
+        host.domain = WMFReferenceStringMake(characters, length);
+    } else {
+        host.isMobile = WMFReferenceStringEqualsASCII(components[0], "m") || WMFReferenceStringEqualsASCII(components[1], "m");
+        host.hasLanguageCode = !WMFReferenceStringEqualsASCII(components[0], "m");
+        if (host.hasLanguageCode) {
+            host.languageCode = WMFReferenceStringMake(components[0].characters, components[0].length);
+        }
+        // Join the rest back together with "."
+        size_t first = WMFReferenceStringEqualsASCII(components[1], "m") ? 2 : 1;
+        size_t domainLength = 0;
+        for (size_t i = first; i < componentCount; i++) {
+            domainLength += components[i].length + (i > first);
+        }
+        host.domain = (WMFReferenceString){malloc((domainLength + 1) * sizeof(uint16_t)), 0};
+        for (size_t i = first; i < componentCount; i++) {
+            if (i > first) {
+                host.domain.characters[host.domain.length++] = '.';
+            }
+            memcpy(host.domain.characters + host.domain.length, components[i].characters, components[i].length * sizeof(uint16_t));
+            host.domain.length += components[i].length;
+        }
+    }
+    for (size_t i = 0; i < componentCount; i++) {
+        free(components[i].characters);
+    }
+    free(components);
+    return host;
+}
+
+static void WMFReferenceHostFree(WMFReferenceHost *host) {
+    free(host->languageCode.characters);
+    free(host->domain.characters);
+}
+
+typedef struct {
+    bool isParsed;
+    WMFReferenceString scheme;
+    WMFReferenceString host;
+    WMFReferenceString port;
+    WMFReferenceString path;
+    bool hasTitle;
+    WMFReferenceString title;
+    bool hasQuery;
+    WMFReferenceString query;
+    bool hasFragment;
+    WMFReferenceString fragment;
+    WMFReferenceHost wikiHost;
+} WMFReferenceURL;
+
+static bool WMFReferenceIsIn(uint16_t c, const char *set) {
+    return c != 0 && c < 0x80 && strchr(set, c) != NULL;
+}
+
+static const char *const WMFReferenceAlpha = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+static const char *const WMFReferenceDigits = "0123456789";
+
+static WMFReferenceURL WMFReferenceURLMake(const uint16_t *characters, size_t length) {
+    WMFReferenceURL URL;
+    memset(&URL, 0, sizeof(URL));
+    // Split off the fragment, then the query, then the scheme and the authority
+    size_t fragmentStart = length;
+    for (size_t i = 0; i < length; i++) {
+        if (characters[i] == '#') {
+            fragmentStart = i;
+            break;
+        }
+    }
+    size_t queryStart = fragmentStart;
+    for (size_t i = 0; i < fragmentStart; i++) {
+        if (characters[i] == '?') {
+            queryStart = i;
+            break;
+        }
+    }
+    size_t schemeEnd = queryStart;
+    for (size_t i = 0; i + 2 < queryStart; i++) {
+        if (characters[i] == ':' && characters[i + 1] == '/' && characters[i + 2] == '/') {
+            schemeEnd = i;
+            break;
+        }
+    }
+    if (schemeEnd == queryStart || schemeEnd == 0 || !WMFReferenceIsIn(characters[0], WMFReferenceAlpha)) {
+        return URL;
+    }
+    for (size_t i = 0; i < schemeEnd; i++) {
+        if (!WMFReferenceIsIn(characters[i], WMFReferenceAlpha) && !WMFReferenceIsIn(characters[i], WMFReferenceDigits) && !WMFReferenceIsIn(characters[i], "+-.")) {
+            return URL;
+        }
+    }
+    size_t authorityStart = schemeEnd + 3;
+    size_t pathStart = queryStart;
+    for (size_t i = authorityStart; i < queryStart; i++) {
+        if (characters[i] == '/') {
+            pathStart = i;
+            break;
+        }
+    }
+    size_t hostEnd = pathStart;
+    for (size_t i = authorityStart; i < pathStart; i++) {
+        if (characters[i] == ':') {
+            hostEnd = i;
+            break;
+        }
+    }
+    if (hostEnd == authorityStart) {
+        return URL;
+    }
+    for (size_t i = authorityStart; i < hostEnd; i++) {
+        if (!WMFReferenceIsIn(characters[i], WMFReferenceAlpha) && !WMFReferenceIsIn(characters[i], WMFReferenceDigits) && !WMFReferenceIsIn(characters[i], "-._~")) {
+            return URL;
+        }
+    }
+    if (hostEnd < pathStart) {
+        size_t digits = pathStart - hostEnd - 1;
+        if (digits == 0 || digits > 5 || characters[hostEnd + 1] == '0') {
+            return URL;
+        }
+        long port = 0;
+        for (size_t i = hostEnd + 1; i < pathStart; i++) {
+            if (!WMFReferenceIsIn(characters[i], WMFReferenceDigits)) {
+                return URL;
+            }
+            port = port * 10 + (characters[i] - '0');
+        }
+        if (port > 65535) {
+            return URL;
+        }
+    }
+    URL.isParsed = true;
+    URL.scheme = WMFReferenceStringMake(characters, schemeEnd);
+    URL.host = WMFReferenceStringMake(characters + authorityStart, hostEnd - authorityStart);
+    URL.port = WMFReferenceStringMake(characters + hostEnd, pathStart - hostEnd);
+    URL.path = WMFReferenceStringMake(characters + pathStart, queryStart - pathStart);
+    static const uint16_t wikiPrefix[] = {'/', 'w', 'i', 'k', 'i', '/'};
+    URL.hasTitle = URL.path.length > 6;
+    for (size_t i = 0; i < 6 && URL.hasTitle; i++) {
+        uint16_t c = URL.path.characters[i];
+        URL.hasTitle = (c >= 'A' && c <= 'Z' ? c | 0x20 : c) == wikiPrefix[i];
+    }
+    if (URL.hasTitle) {
+        URL.title = WMFReferenceStringMake(URL.path.characters + 6, URL.path.length - 6);
+    }
+    URL.hasQuery = queryStart < fragmentStart;
+    if (URL.hasQuery) {
+        URL.query = WMFReferenceStringMake(characters + queryStart + 1, fragmentStart - queryStart - 1);
+    }
+    URL.hasFragment = fragmentStart < length;
+    if (URL.hasFragment) {
+        URL.fragment = WMFReferenceStringMake(characters + fragmentStart + 1, length - fragmentStart - 1);
+    }
+    URL.wikiHost = WMFReferenceHostMake(URL.host.characters, URL.host.length);
+    return URL;
+}
+
+static void WMFReferenceURLFree(WMFReferenceURL *URL) {
+    if (!URL->isParsed) {
+        return;
+    }
+    free(URL->scheme.characters);
+    free(URL->host.characters);
+    free(URL->port.characters);
+    free(URL->path.characters);
+    free(URL->title.characters);
+    free(URL->query.characters);
+    free(URL->fragment.characters);
+    WMFReferenceHostFree(&URL->wikiHost);
+}
+
+/// Percent decodes to bytes, then decodes the bytes as UTF-8. @c SIZE_MAX for anything invalid.
+static size_t WMFReferenceDecodeTitle(WMFReferenceString title, bool isNormalizing, uint16_t *output) {
+    uint8_t *bytes = malloc(title.length * 3 + 1);
+    size_t byteCount = 0;
+    for (size_t i = 0; i < title.length; i++) {
+        uint16_t c = title.characters[i];
+        if (c == '%') {
+            if (i + 2 >= title.length) {
+                free(bytes);
+                return SIZE_MAX;
+            }
+            char hex[3] = {(char)title.characters[i + 1], (char)title.characters[i + 2], 0};
+            char *end = NULL;
+            if (!WMFReferenceIsIn(title.characters[i + 1], "0123456789abcdefABCDEF") || !WMFReferenceIsIn(title.characters[i + 2], "0123456789abcdefABCDEF")) {
+                free(bytes);
+                return SIZE_MAX;
+            }
+            bytes[byteCount++] = (uint8_t)strtol(hex, &end, 16);
+            i += 2;
+        } else if (c < 0x80) {
+            bytes[byteCount++] = (uint8_t)c;
+        } else if (c < 0x800) {
+            bytes[byteCount++] = (uint8_t)(0xC0 | c >> 6);
+            bytes[byteCount++] = (uint8_t)(0x80 | (c & 0x3F));
+        } else {
+            bytes[byteCount++] = (uint8_t)(0xE0 | c >> 12);
+            bytes[byteCount++] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+            bytes[byteCount++] = (uint8_t)(0x80 | (c & 0x3F));
+        }
+    }
+    size_t count = 0;
+    for (size_t i = 0; i < byteCount;) {
+        uint8_t byte = bytes[i];
+        uint32_t codePoint;
+        size_t sequenceLength;
+        if (byte < 0x80) {
+            codePoint = byte;
+            sequenceLength = 1;
+        } else if ((byte & 0xE0) == 0xC0) {
+            codePoint = byte & 0x1F;
+            sequenceLength = 2;
+        } else if ((byte & 0xF0) == 0xE0) {
+            codePoint = byte & 0x0F;
+            sequenceLength = 3;
+        } else if ((byte & 0xF8) == 0xF0) {
+            codePoint = byte & 0x07;
+            sequenceLength = 4;
+        } else {
+            free(bytes);
+            return SIZE_MAX;
+        }
+        if (i + sequenceLength > byteCount) {
+            free(bytes);
+            return SIZE_MAX;
+        }
+        for (size_t j = 1; j < sequenceLength; j++) {
+            if ((bytes[i + j] & 0xC0) != 0x80) {
+                free(bytes);
+                return SIZE_MAX;
+            }
+            codePoint = codePoint << 6 | (bytes[i + j] & 0x3F);
+        }
+        static const uint32_t smallest[] = {0, 0, 0x80, 0x800, 0x10000};
+        if (codePoint < smallest[sequenceLength] || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+            free(bytes);
+            return SIZE_MAX;
+        }
+        if (codePoint >= 0x10000) {
+            output[count++] = (uint16_t)(0xD800 + ((codePoint - 0x10000) >> 10));
+            output[count++] = (uint16_t)(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+        } else if (isNormalizing && codePoint == '_') {
+            output[count++] = ' ';
+        } else if (!isNormalizing && codePoint == ' ') {
+            output[count++] = '_';
+        } else {
+            output[count++] = (uint16_t)codePoint;
+        }
+        i += sequenceLength;
+    }
+    free(bytes);
+    return count;
+}
+
+/// Transcodes to UTF-8, then percent encodes the bytes. @c SIZE_MAX for unpaired surrogates.
+static size_t WMFReferenceEncodeTitle(const uint16_t *characters, size_t length, uint16_t *output) {
+    uint8_t *bytes = malloc(length * 4 + 1);
+    size_t byteCount = 0;
+    for (size_t i = 0; i < length; i++) {
+        uint32_t c = characters[i] == ' ' ? '_' : characters[i];
+        if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && characters[i + 1] >= 0xDC00 && characters[i + 1] <= 0xDFFF) {
+            c = 0x10000 + ((c - 0xD800) << 10) + (characters[++i] - 0xDC00);
+        } else if (c >= 0xD800 && c <= 0xDFFF) {
+            free(bytes);
+            return SIZE_MAX;
+        }
+        if (c < 0x80) {
+            bytes[byteCount++] = (uint8_t)c;
+        } else if (c < 0x800) {
+            bytes[byteCount++] = (uint8_t)(0xC0 | c >> 6);
+            bytes[byteCount++] = (uint8_t)(0x80 | (c & 0x3F));
+        } else if (c < 0x10000) {
+            bytes[byteCount++] = (uint8_t)(0xE0 | c >> 12);
+            bytes[byteCount++] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+            bytes[byteCount++] = (uint8_t)(0x80 | (c & 0x3F));
+        } else {
+            bytes[byteCount++] = (uint8_t)(0xF0 | c >> 18);
+            bytes[byteCount++] = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+            bytes[byteCount++] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+            bytes[byteCount++] = (uint8_t)(0x80 | (c & 0x3F));
+        }
+    }
+    size_t count = 0;
+    for (size_t i = 0; i < byteCount; i++) {
+        uint8_t byte = bytes[i];
+        if (byte < 0x80 && (WMFReferenceIsIn(byte, WMFReferenceAlpha) || WMFReferenceIsIn(byte, WMFReferenceDigits) || WMFReferenceIsIn(byte, "-_.!~*'()"))) {
+            output[count++] = byte;
+        } else {
+            char escape[4];
+            snprintf(escape, sizeof(escape), "%%%02X", byte);
+            count = WMFBenchmarkAppendASCII(output, count, escape);
+        }
+    }
+    free(bytes);
+    return count;
+}
+
+#pragma mark - Parity
+
+static bool WMFBenchmarkDecodedTitlesMatch(const uint16_t *characters, WMFTextSpan title, WMFReferenceString referenceTitle, bool isNormalizing) {
+    uint16_t *decoded = malloc((title.length + 1) * sizeof(uint16_t));
+    uint16_t *referenceDecoded = malloc((title.length + 1) * sizeof(uint16_t));
+    size_t length = WMFWikiURLDecodeTitle(characters, title, isNormalizing, decoded);
+    size_t referenceLength = WMFReferenceDecodeTitle(referenceTitle, isNormalizing, referenceDecoded);
+    bool isMatch = length == referenceLength && (length == SIZE_MAX || memcmp(decoded, referenceDecoded, length * sizeof(uint16_t)) == 0);
+    if (isMatch && length != SIZE_MAX && isNormalizing) {
+        // Round trips back to the same title, apart from the case of any escapes
+        uint16_t *encoded = malloc((length * WMFWikiURLEncodedTitleCharactersPerCharacter + 1) * sizeof(uint16_t));
+        uint16_t *referenceEncoded = malloc((length * WMFWikiURLEncodedTitleCharactersPerCharacter + 1) * sizeof(uint16_t));
+        size_t encodedLength = WMFWikiURLEncodeTitle(decoded, length, encoded);
+        size_t referenceEncodedLength = WMFReferenceEncodeTitle(decoded, length, referenceEncoded);
+        isMatch = encodedLength == referenceEncodedLength && (encodedLength == SIZE_MAX || memcmp(encoded, referenceEncoded, encodedLength * sizeof(uint16_t)) == 0);
+        free(encoded);
+        free(referenceEncoded);
+    }
+    free(decoded);
+    free(referenceDecoded);
+    return isMatch;
+}
+
+static bool WMFBenchmarkPartsMatch(const WMFBenchmarkURL *URL) {
+    const uint16_t *c = URL->characters;
+    WMFWikiURLParts parts;
+    bool isParsed = WMFWikiURLParse(c, URL->length, &parts);
+    WMFReferenceURL reference = WMFReferenceURLMake(c, URL->length);
+    bool isMatch = isParsed == reference.isParsed;
+    if (isMatch && isParsed) {
+        isMatch = WMFReferenceStringEqualsSpan(reference.scheme, c, parts.scheme) &&
+                  WMFReferenceStringEqualsSpan(reference.host, c, parts.host) &&
+                  WMFReferenceStringEqualsSpan(reference.port, c, parts.port) &&
+                  WMFReferenceStringEqualsSpan(reference.path, c, parts.path) &&
+                  reference.hasTitle == parts.hasTitle && (!parts.hasTitle || WMFReferenceStringEqualsSpan(reference.title, c, parts.title)) &&
+                  reference.hasQuery == parts.hasQuery && (!parts.hasQuery || WMFReferenceStringEqualsSpan(reference.query, c, parts.query)) &&
+                  reference.hasFragment == parts.hasFragment && (!parts.hasFragment || WMFReferenceStringEqualsSpan(reference.fragment, c, parts.fragment)) &&
+                  reference.wikiHost.isMobile == parts.wikiHost.isMobile &&
+                  reference.wikiHost.hasLanguageCode == parts.wikiHost.hasLanguageCode &&
+                  (!parts.wikiHost.hasLanguageCode || WMFReferenceStringEqualsSpan(reference.wikiHost.languageCode, c, parts.wikiHost.languageCode)) &&
+                  WMFReferenceStringEqualsSpan(reference.wikiHost.domain, c, parts.wikiHost.domain);
+        if (isMatch && parts.hasTitle) {
+            isMatch = WMFBenchmarkDecodedTitlesMatch(c, parts.title, reference.title, true) && WMFBenchmarkDecodedTitlesMatch(c, parts.title, reference.title, false);
+        }
+    }
+    WMFReferenceURLFree(&reference);
+    return isMatch;
+}
+
+/// Hosts outside of URLs, which go through WMFWikiURLHostMake on their own for -wmf_domain and friends.
+static int WMFBenchmarkCheckHosts(void) {
+    static const char *const hosts[] = {"", ".", "..", "m", "m.", ".m", "a.b", "a.b.c", "m.m.m", "m.b.c", "a.m.c", "a.m", "a..c", "...", "en.m.wikipedia.org", "zh-yue.wikipedia.org", "m.wikipedia.org", "a.b.m.d"};
+    int failures = 0;
+    for (size_t i = 0; i < sizeof(hosts) / sizeof(hosts[0]); i++) {
+        uint16_t characters[32];
+        size_t length = WMFBenchmarkAppendASCII(characters, 0, hosts[i]);
+        WMFWikiURLHost host = WMFWikiURLHostMake(characters, WMFTextSpanMake(0, length));
+        WMFReferenceHost reference = WMFReferenceHostMake(characters, length);
+        bool isMatch = host.isMobile == reference.isMobile && host.hasLanguageCode == reference.hasLanguageCode &&
+                       (!host.hasLanguageCode || WMFReferenceStringEqualsSpan(reference.languageCode, characters, host.languageCode)) &&
+                       WMFReferenceStringEqualsSpan(reference.domain, characters, host.domain);
+        if (!isMatch) {
+            printf("host mismatch: \"%s\"\n", hosts[i]);
+            failures++;
+        }
+        WMFReferenceHostFree(&reference);
+    }
+    return failures;
+}
+
+/// Titles with every kind of character, encoded both ways.
+static int WMFBenchmarkCheckEncoding(size_t count) {
+    static const uint16_t alphabet[] = {'a', 'Z', '0', ' ', '_', '-', '.', '!', '~', '*', '\'', '(', ')', '/', '?', '#', '%', '&', '+', ':', 0x7F, 0x00E9, 0x07FF, 0x0800, 0x65E5, 0xFFFD, 0xD83D, 0xDC36, 0xDBFF, 0xDFFF};
+    const size_t alphabetCount = sizeof(alphabet) / sizeof(alphabet[0]);
+    int failures = 0;
+    unsigned int state = 7;
+    uint16_t title[16];
+    uint16_t encoded[16 * WMFWikiURLEncodedTitleCharactersPerCharacter];
+    uint16_t referenceEncoded[16 * WMFWikiURLEncodedTitleCharactersPerCharacter];
+    for (size_t i = 0; i < count; i++) {
+        state = state * 1103515245 + 12345;
+        size_t length = (state >> 16) % 16;
+        for (size_t j = 0; j < length; j++) {
+            state = state * 1103515245 + 12345;
+            title[j] = alphabet[(state >> 16) % alphabetCount];
+        }
+        size_t encodedLength = WMFWikiURLEncodeTitle(title, length, encoded);
+        size_t referenceLength = WMFReferenceEncodeTitle(title, length, referenceEncoded);
+        if (encodedLength != referenceLength || (encodedLength != SIZE_MAX && memcmp(encoded, referenceEncoded, encodedLength * sizeof(uint16_t)) != 0)) {
+            failures++;
+        }
+        if (encodedLength == SIZE_MAX) {
+            continue;
+        }
+        // Decoding what was encoded gives the title back, with underscores for spaces
+        uint16_t decoded[16 * WMFWikiURLEncodedTitleCharactersPerCharacter];
+        size_t decodedLength = WMFWikiURLDecodeTitle(encoded, WMFTextSpanMake(0, encodedLength), false, decoded);
+        bool isRoundTrip = decodedLength == length;
+        for (size_t j = 0; j < length && isRoundTrip; j++) {
+            isRoundTrip = decoded[j] == (title[j] == ' ' ? '_' : title[j]);
+        }
+        failures += !isRoundTrip;
+    }
+    if (failures > 0) {
+        printf("title encoding mismatches: %d\n", failures);
+    }
+    return failures;
+}
+
+#pragma mark - Benchmarks
+
+typedef size_t (*WMFBenchmarkBody)(const WMFBenchmarkURL *URLs, size_t count);
+
+/// What the category does for -wmf_title, -wmf_languageCode, -wmf_isMobile and -wmf_siteURL: every part, and the title decoded.
+static size_t WMFBenchmarkParse(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    uint16_t title[256];
+    for (size_t i = 0; i < count; i++) {
+        WMFWikiURLParts parts;
+        if (!WMFWikiURLParse(URLs[i].characters, URLs[i].length, &parts)) {
+            continue;
+        }
+        total += parts.wikiHost.domain.length + parts.wikiHost.languageCode.length + parts.wikiHost.isMobile + parts.query.length + parts.fragment.length;
+        if (parts.hasTitle) {
+            total += WMFWikiURLDecodeTitle(URLs[i].characters, parts.title, true, title);
+        }
+    }
+    return total;
+}
+
+static size_t WMFBenchmarkParseReference(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    uint16_t title[256];
+    for (size_t i = 0; i < count; i++) {
+        WMFReferenceURL URL = WMFReferenceURLMake(URLs[i].characters, URLs[i].length);
+        if (URL.isParsed) {
+            total += URL.wikiHost.domain.length + URL.wikiHost.languageCode.length + URL.wikiHost.isMobile + URL.query.length + URL.fragment.length;
+            if (URL.hasTitle) {
+                total += WMFReferenceDecodeTitle(URL.title, true, title);
+            }
+        }
+        WMFReferenceURLFree(&URL);
+    }
+    return total;
+}
+
+/// Decoding a title and encoding it again for a new path, like -wmf_URLWithTitle: with a title from another URL.
+static size_t WMFBenchmarkRoundTrip(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    uint16_t title[256];
+    uint16_t encoded[256 * WMFWikiURLEncodedTitleCharactersPerCharacter];
+    for (size_t i = 0; i < count; i++) {
+        WMFWikiURLParts parts;
+        if (!WMFWikiURLParse(URLs[i].characters, URLs[i].length, &parts) || !parts.hasTitle) {
+            continue;
+        }
+        size_t length = WMFWikiURLDecodeTitle(URLs[i].characters, parts.title, true, title);
+        if (length != SIZE_MAX) {
+            total += WMFWikiURLEncodeTitle(title, length, encoded);
+        }
+    }
+    return total;
+}
+
+static size_t WMFBenchmarkRoundTripReference(const WMFBenchmarkURL *URLs, size_t count) {
+    size_t total = 0;
+    uint16_t title[256];
+    uint16_t encoded[256 * WMFWikiURLEncodedTitleCharactersPerCharacter];
+    for (size_t i = 0; i < count; i++) {
+        WMFReferenceURL URL = WMFReferenceURLMake(URLs[i].characters, URLs[i].length);
+        if (URL.isParsed && URL.hasTitle) {
+            size_t length = WMFReferenceDecodeTitle(URL.title, true, title);
+            if (length != SIZE_MAX) {
+                total += WMFReferenceEncodeTitle(title, length, encoded);
+            }
+        }
+        WMFReferenceURLFree(&URL);
+    }
+    return total;
+}
+
+/// @return Nanoseconds per URL for the fastest of several runs of @c body.
+static double WMFBenchmarkMeasure(WMFBenchmarkBody body, const WMFBenchmarkURL *URLs, size_t count, int iterations) {
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        double start = WMFBenchmarkNow();
+        for (int i = 0; i < iterations; i++) {
+            WMFBenchmarkSink += body(URLs, count);
+        }
+        double elapsed = (WMFBenchmarkNow() - start) / iterations;
+        if (run == 0 || elapsed < best) {
+            best = elapsed;
+        }
+    }
+    return best * 1e9 / (double)count;
+}
+
+static void WMFBenchmarkReport(const char *name, WMFBenchmarkBody body, WMFBenchmarkBody baseline, const WMFBenchmarkURL *URLs, size_t count, int iterations) {
+    size_t result = body(URLs, count);
+    size_t expected = baseline(URLs, count);
+    if (result != expected) {
+        printf("%-34s FAILED: %zu != %zu\n", name, result, expected);
+        WMFBenchmarkFailures++;
+        return;
+    }
+    double nanoseconds = WMFBenchmarkMeasure(body, URLs, count, iterations);
+    double baselineNanoseconds = WMFBenchmarkMeasure(baseline, URLs, count, iterations);
+    printf("%-34s %8.1f ns/URL %8.1f ns/URL (reference) %6.1fx\n", name, nanoseconds, baselineNanoseconds, baselineNanoseconds / nanoseconds);
+}
+
+int main(int argc, const char *argv[]) {
+    size_t count = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 100000;
+    int iterations = argc > 2 ? atoi(argv[2]) : 5;
+    if (count == 0 || iterations <= 0) {
+        fprintf(stderr, "usage: %s [URL count] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    WMFBenchmarkURL *URLs = WMFBenchmarkCreateCorpus(count);
+    size_t mismatches = 0;
+    size_t parsed = 0;
+    for (size_t i = 0; i < count; i++) {
+        WMFWikiURLParts parts;
+        parsed += WMFWikiURLParse(URLs[i].characters, URLs[i].length, &parts);
+        if (!WMFBenchmarkPartsMatch(&URLs[i])) {
+            if (mismatches < 10) {
+                printf("mismatch: ");
+                for (size_t j = 0; j < URLs[i].length; j++) {
+                    putchar(URLs[i].characters[j] < 0x80 ? (char)URLs[i].characters[j] : '?');
+                }
+                putchar('\n');
+            }
+            mismatches++;
+        }
+    }
+    WMFBenchmarkFailures += (int)mismatches + WMFBenchmarkCheckHosts() + WMFBenchmarkCheckEncoding(count);
+    printf("%zu URLs, %zu parsed, %zu left to Foundation, %zu mismatches\n\n", count, parsed, count - parsed, mismatches);
+
+    if (WMFBenchmarkFailures == 0) {
+        WMFBenchmarkReport("parse, split host, decode title", WMFBenchmarkParse, WMFBenchmarkParseReference, URLs, count, iterations);
+        WMFBenchmarkReport("decode and re-encode title", WMFBenchmarkRoundTrip, WMFBenchmarkRoundTripReference, URLs, count, iterations);
+    }
+
+    WMFBenchmarkFreeCorpus(URLs, count);
+    return WMFBenchmarkFailures == 0 ? 0 : 1;
+}
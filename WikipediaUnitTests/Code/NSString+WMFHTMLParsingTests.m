@@ -1,6 +1,9 @@
 #import <XCTest/XCTest.h>
 #import "NSString+WMFHTMLParsing.h"
 #import "WMFTestFixtureUtilities.h"
+#import "NSRegularExpression+HTML.h"
+#import "WMFHTMLRenderCache.h"
+#import "WMFNumberOfExtractCharacters.h"
 
 @interface NSString_WMFHTMLParsingTests : XCTestCase
 
@@ -24,6 +27,24 @@
                           @"Hello");
 }
 
+- (void)testParenthesesRemovalLeavesEmptyAndUnbalancedParentheses {
+    NSString *string = @"f() and (x) g(";
+    XCTAssertEqualObjects([string wmf_stringByRecursivelyRemovingParenthesizedContent],
+                          @"f() and  g(");
+}
+
+- (void)testDeeplyNestedParenthesesRemoval {
+    NSMutableString *string = [NSMutableString stringWithString:@"x"];
+    for (NSInteger i = 0; i < 10000; i++) {
+        [string appendString:@"(a"];
+    }
+    for (NSInteger i = 0; i < 9999; i++) {
+        [string appendString:@")"];
+    }
+    XCTAssertEqualObjects([string wmf_stringByRecursivelyRemovingParenthesizedContent],
+                          @"x(a");
+}
+
 - (void)testBracketedContentRemoval {
     NSString *string = @"J[aeio]ump";
     XCTAssertEqualObjects([string wmf_stringByRemovingBracketedContent],
@@ -75,6 +96,26 @@
                           @" This should not have so much space! ");
 }
 
+- (void)testSummaryFromText {
+    NSString *string = @"Mercury (planet) is the smallest planet [1] in the  Solar System , and the closest to the Sun&nbsp;.\n";
+    XCTAssertEqualObjects([string wmf_summaryFromText], @"Mercury is the smallest planet in the Solar System, and the closest to the Sun.");
+}
+
+- (void)testSummaryFromTextWithNestedParentheses {
+    NSString *string = @"Helium (from Greek: ἥλιος (hḗlios), 'sun') is a chemical element with the symbol He and atomic number 2.";
+    XCTAssertEqualObjects([string wmf_summaryFromText], @"Helium is a chemical element with the symbol He and atomic number 2.");
+}
+
+- (void)testSummaryFromTextIsLimitedToNumberOfExtractCharacters {
+    NSString *string = [[@"" stringByPaddingToLength:WMFNumberOfExtractCharacters + 10 withString:@"a" startingAtIndex:0] stringByAppendingString:@" (b)"];
+    XCTAssertEqualObjects([string wmf_summaryFromText], [string substringToIndex:WMFNumberOfExtractCharacters]);
+}
+
+- (void)testShareSnippetFromText {
+    NSString *string = @"Mercury &amp; Venus\n\n\n[1]  orbit , the Sun:";
+    XCTAssertEqualObjects([string wmf_shareSnippetFromText], @"Mercury & Venus\n orbit, the Sun");
+}
+
 - (void)testNewsNotificationHTMLRemoving {
     NSString *plaintext = @"Nothing happened";
     NSString *newsHTML = @"<!--May 19-->Nothing happened";
@@ -104,4 +145,273 @@
     
 }
 
+- (void)testAttributedStringFromHTMLNestedStyles {
+    UIFont *standard = [UIFont systemFontOfSize:12];
+    UIFont *bold = [UIFont boldSystemFontOfSize:12];
+    UIFont *italic = [UIFont italicSystemFontOfSize:12];
+    UIFont *boldItalic = [UIFont systemFontOfSize:13];
+    NSMutableAttributedString *attributedString = [@"<b>a<i>b</i></b>c<u>d</u>" wmf_attributedStringFromHTMLWithFont:standard boldFont:bold italicFont:italic boldItalicFont:boldItalic color:nil linkColor:nil handlingLinks:NO handlingLists:NO handlingSuperSubscripts:YES tagMapping:nil additionalTagAttributes:nil];
+    NSMutableAttributedString *attributedStringToCompare = [[NSMutableAttributedString alloc] initWithString:@"abcd"];
+    [attributedStringToCompare addAttributes:@{NSFontAttributeName: bold} range:NSMakeRange(0, 1)];
+    [attributedStringToCompare addAttributes:@{NSFontAttributeName: boldItalic} range:NSMakeRange(1, 1)];
+    [attributedStringToCompare addAttributes:@{NSFontAttributeName: standard} range:NSMakeRange(2, 1)];
+    [attributedStringToCompare addAttributes:@{NSFontAttributeName: standard, NSUnderlineStyleAttributeName: @1} range:NSMakeRange(3, 1)];
+    XCTAssertEqualObjects(attributedString, attributedStringToCompare);
+}
+
+- (void)testAttributedStringFromHTMLLists {
+    UIFont *standard = [UIFont systemFontOfSize:12];
+    UIFont *bold = [UIFont boldSystemFontOfSize:12];
+    NSString *html = @"<ul><li><b>a</b></li><li>b<ol><li>c</li><li>d</li></ol></li></ul>e";
+    NSMutableAttributedString *attributedString = [html wmf_attributedStringFromHTMLWithFont:standard boldFont:bold italicFont:nil boldItalicFont:nil color:nil linkColor:nil handlingLinks:NO handlingLists:YES handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    XCTAssertEqualObjects(attributedString.string, @"\n   • a\n   • b\n      1. c\n      2. d\ne");
+    XCTAssertEqualObjects([attributedString attribute:NSFontAttributeName atIndex:6 effectiveRange:NULL], bold);
+    XCTAssertEqualObjects([attributedString attribute:NSFontAttributeName atIndex:5 effectiveRange:NULL], standard);
+    XCTAssertEqualObjects([attributedString attribute:NSFontAttributeName atIndex:7 effectiveRange:NULL], standard);
+}
+
+- (void)testAttributedStringFromHTMLListsIgnoresCaseAndUnmatchedEndTags {
+    UIFont *font = [UIFont systemFontOfSize:12];
+    NSString *html = @"</li></OL><UL><Li>a</LI><li>b</ol></li></Ul>c";
+    NSMutableAttributedString *attributedString = [html wmf_attributedStringFromHTMLWithFont:font boldFont:nil italicFont:nil boldItalicFont:nil color:nil linkColor:nil handlingLinks:NO handlingLists:YES handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    XCTAssertEqualObjects(attributedString.string, @"\n   • a\n   • b\nc");
+}
+
+- (void)testAttributedStringFromHTMLIsCached {
+    WMFHTMLRenderCache *cache = [WMFHTMLRenderCache sharedCache];
+    [cache removeAllAttributedStrings];
+    [cache resetStatistics];
+    XCTAssertEqual(cache.bytesHeld, 0);
+    UIFont *font = [UIFont systemFontOfSize:12];
+    NSString *html = @"<i>Canis familiaris</i>";
+    NSMutableAttributedString *first = [html wmf_attributedStringFromHTMLWithFont:font boldFont:nil italicFont:nil boldItalicFont:nil color:UIColor.blackColor linkColor:nil handlingLinks:NO handlingLists:NO handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    [first appendAttributedString:[[NSAttributedString alloc] initWithString:@"!"]];
+    NSMutableAttributedString *second = [html wmf_attributedStringFromHTMLWithFont:font boldFont:nil italicFont:nil boldItalicFont:nil color:UIColor.blackColor linkColor:nil handlingLinks:NO handlingLists:NO handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    XCTAssertEqualObjects(second.string, @"Canis familiaris");
+    XCTAssertEqual(cache.missCount, 1);
+    XCTAssertEqual(cache.hitCount, 1);
+    XCTAssertGreaterThan(cache.bytesHeld, 0);
+
+    // A different color is a different entry
+    [html wmf_attributedStringFromHTMLWithFont:font boldFont:nil italicFont:nil boldItalicFont:nil color:UIColor.whiteColor linkColor:nil handlingLinks:NO handlingLists:NO handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    XCTAssertEqual(cache.missCount, 2);
+
+    [cache removeAllAttributedStrings];
+    XCTAssertEqual(cache.bytesHeld, 0);
+}
+
+- (void)testRenderCacheCountsReplacedEntriesOnce {
+    WMFHTMLRenderCache *cache = [WMFHTMLRenderCache sharedCache];
+    [cache removeAllAttributedStrings];
+    NSString *html = @"<b>Canis</b> <i>familiaris</i> <a href=\"./Dog\">dog</a>";
+    WMFHTMLRenderCacheKey *key = [[WMFHTMLRenderCacheKey alloc] initWithHTML:html font:nil boldFont:nil italicFont:nil boldItalicFont:nil color:nil linkColor:nil handlingLinks:NO handlingLists:NO handlingSuperSubscripts:NO tagMapping:nil additionalTagAttributes:nil];
+    NSAttributedString *attributedString = [[NSAttributedString alloc] initWithString:@"Canis familiaris dog"];
+    [cache setAttributedString:attributedString forKey:key];
+    NSUInteger bytesHeld = cache.bytesHeld;
+    // The key's HTML is counted along with the attributed string
+    XCTAssertGreaterThanOrEqual(bytesHeld, (html.length + attributedString.length) * sizeof(unichar));
+
+    dispatch_apply(100, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+        [cache setAttributedString:attributedString forKey:key];
+    });
+    XCTAssertEqual(cache.bytesHeld, bytesHeld);
+
+    [cache removeAllAttributedStrings];
+    XCTAssertEqual(cache.bytesHeld, 0);
+}
+
+- (void)testAttributedStringFromHTMLWithLongListPerformance {
+    NSMutableString *html = [NSMutableString stringWithString:@"<ol>"];
+    for (NSInteger i = 0; i < 2000; i++) {
+        [html appendFormat:@"<li><b>Item</b> <i>%ld</i> <a href=\"./Item_%ld\">link</a></li>", (long)i, (long)i];
+    }
+    [html appendString:@"</ol>"];
+    UIFont *font = [UIFont systemFontOfSize:12];
+    [self measureBlock:^{
+        [[WMFHTMLRenderCache sharedCache] removeAllAttributedStrings];
+        [html wmf_attributedStringFromHTMLWithFont:font boldFont:nil italicFont:nil boldItalicFont:nil color:nil linkColor:nil handlingLinks:YES handlingLists:YES handlingSuperSubscripts:YES tagMapping:nil additionalTagAttributes:nil];
+    }];
+}
+
+- (void)testRemovingHTMLRemovesScriptAndStyleContents {
+    NSString *html = @"a<script>var b = 1 < 2;</script>c<STYLE>p { color: red; }</STYLE>d";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"acd");
+}
+
+- (void)testRemovingHTMLKeepsUnclosedScriptContents {
+    NSString *html = @"<b>a</b><script>b<i>c</i>";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"a<script>b<i>c</i>");
+}
+
+- (void)testRemovingHTMLReplacesLineBreaks {
+    NSString *html = @"a<br>b<br/>c<BR />d";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"a\nb\nc\nd");
+}
+
+- (void)testRemovingHTMLKeepsUnterminatedTags {
+    NSString *html = @"<b>a</b> < b";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"a < b");
+}
+
+- (void)testRemovingHTMLDoesNotDecodeEntitiesSpanningTags {
+    NSString *html = @"&am<b>p;&amp;</b>";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"&amp;&");
+}
+
+- (void)testRemovingHTMLWithMaximumLengthIsAPrefixOfRemovingHTML {
+    NSArray<NSString *> *htmls = @[@"",
+                                   @"plain text",
+                                   @"a<script>var b = 1 < 2;</script>c<STYLE>p { color: red; }</STYLE>d",
+                                   @"<b>a</b><script>b<i>c</i>",
+                                   @"a<br>b<br/>c<BR />d",
+                                   @"&am<b>p;&amp;</b> &#x1F600; &bogus;"];
+    for (NSString *html in htmls) {
+        NSString *full = [html wmf_stringByRemovingHTML];
+        for (NSUInteger maximumLength = 0; maximumLength <= full.length + 1; maximumLength++) {
+            NSString *expected = [full substringToIndex:MIN(maximumLength, full.length)];
+            XCTAssertEqualObjects([html wmf_stringByRemovingHTMLWithMaximumLength:maximumLength], expected, @"%@ limited to %lu", html, (unsigned long)maximumLength);
+        }
+    }
+}
+
+- (void)testRemovingHTMLWithMaximumLengthPerformance {
+    NSString *paragraph = @"<p>The <b>quick</b> brown fox <a href=\"./Fox\">jumps</a> over the lazy dog&nbsp;&mdash; again.<br></p>";
+    NSString *html = [@"" stringByPaddingToLength:paragraph.length * 20000 withString:paragraph startingAtIndex:0];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000; i++) {
+            XCTAssertEqual([html wmf_stringByRemovingHTMLWithMaximumLength:WMFNumberOfExtractCharacters].length, WMFNumberOfExtractCharacters);
+        }
+    }];
+}
+
+- (void)testRemovingHTMLDecodesNamedEntities {
+    NSString *html = @"&eacute;t&eacute; &Eacute;mile &hellip; &larr;&rarr; &frac12; &nLt; &AMP;";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"été Émile … ←→ ½ ≪⃒ &");
+}
+
+- (void)testRemovingHTMLDecodesNumericEntities {
+    NSString *html = @"&#8722;&#x2212;&#X2212; &#x1F600; &#0; &#x110000; &#xD800; &#150;";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], @"−−− 😀 � � � –");
+}
+
+- (void)testRemovingHTMLKeepsUnknownEntities {
+    NSString *html = @"AT&T;&#x; &#12a; &Nbsp;";
+    XCTAssertEqualObjects([html wmf_stringByRemovingHTML], html);
+}
+
+- (void)testRemovingHTMLPerformanceWithoutEntities {
+    NSString *text = [@"" stringByPaddingToLength:100000 withString:@"Mercury is the smallest planet in the Solar System. " startingAtIndex:0];
+    [self measureBlock:^{
+        for (NSInteger i = 0; i < 10; i++) {
+            [text wmf_stringByRemovingHTML];
+        }
+    }];
+}
+
+- (void)testRemovingHTMLPerformance {
+    NSString *html = [[self wmf_bundle] wmf_stringFromContentsOfFile:@"DogMobileHTML" ofType:@"html"];
+    [self measureBlock:^{
+        for (NSInteger i = 0; i < 10; i++) {
+            [html wmf_stringByRemovingHTML];
+        }
+    }];
+}
+
+- (void)testRegularExpressionTagEnumerationPerformance {
+    // Baseline for testRemovingHTMLPerformance - the cost of only finding tags with the regex tokenizer it replaced
+    NSString *html = [[self wmf_bundle] wmf_stringFromContentsOfFile:@"DogMobileHTML" ofType:@"html"];
+    NSRegularExpression *tagRegex = [NSRegularExpression wmf_HTMLTagRegularExpression];
+    [self measureBlock:^{
+        for (NSInteger i = 0; i < 10; i++) {
+            [tagRegex enumerateMatchesInString:html
+                                       options:0
+                                         range:NSMakeRange(0, html.length)
+                                    usingBlock:^(NSTextCheckingResult *_Nullable result, NSMatchingFlags flags, BOOL *_Nonnull stop) {
+                                        [tagRegex replacementStringForResult:result inString:html offset:0 template:@"$1"];
+                                        [tagRegex replacementStringForResult:result inString:html offset:0 template:@"$2"];
+                                    }];
+        }
+    }];
+}
+
+- (void)testSummaryFromTextPerformance {
+    NSArray<NSString *> *extracts = @[
+        @"Mercury (planet) is the smallest planet in the Solar System and the closest to the Sun.[1] Its orbit around the Sun takes 87.97 Earth days, the shortest of all the Sun's planets.",
+        @"Der Merkur ist mit einem Durchmesser von knapp 4900 Kilometern der kleinste, sonnennächste und schnellste Planet im Sonnensystem (Umlaufzeit: 88 Tage).",
+        @"水星（すいせい、英: Mercury）は、太陽系にある惑星の1つで、太陽から最も近い公転軌道を周回している[1]。",
+        @"Мерку́рий — наименьшая планета Солнечной системы и самая близкая к Солнцу (см. &quot;орбита&quot;) .",
+        @"عطارد (رمزه: ☿) هو أصغر كواكب المجموعة الشمسية وأقربها إلى الشمس&nbsp;، ويتمّ دورته حولها كل 88 يوماً.",
+        @"水星是太阳系八大行星中最小和最靠近太阳的行星[2]，公转周期为87.97天 (地球日) 。"
+    ];
+    [self measureBlock:^{
+        for (NSInteger i = 0; i < 1000; i++) {
+            for (NSString *extract in extracts) {
+                [extract wmf_summaryFromText];
+                [extract wmf_shareSnippetFromText];
+            }
+        }
+    }];
+}
+
+- (NSArray<NSString *> *)extractsForBatchSummaries {
+    NSArray<NSString *> *extracts = @[
+        @"Mercury (planet) is the smallest planet in the Solar System and the closest to the Sun.[1] Its orbit around the Sun takes 87.97 Earth days, the shortest of all the Sun's planets.",
+        @"Мерку́рий — наименьшая планета Солнечной системы и самая близкая к Солнцу (см. &quot;орбита&quot;) .",
+        @"水星是太阳系八大行星中最小和最靠近太阳的行星[2]，公转周期为87.97天 (地球日) 。"
+    ];
+    NSMutableArray<NSString *> *texts = [NSMutableArray arrayWithCapacity:3000];
+    for (NSInteger i = 0; i < 1000; i++) {
+        for (NSString *extract in extracts) {
+            [texts addObject:[extract stringByAppendingFormat:@" %ld", (long)i]];
+        }
+    }
+    return texts;
+}
+
+- (void)testBatchSummariesMatchSummaries {
+    NSArray<NSString *> *texts = [self extractsForBatchSummaries];
+    NSArray<NSString *> *summaries = [NSString wmf_summariesFromTexts:texts];
+    XCTAssertEqual(summaries.count, texts.count);
+    [texts enumerateObjectsUsingBlock:^(NSString *_Nonnull text, NSUInteger idx, BOOL *_Nonnull stop) {
+        XCTAssertEqualObjects(summaries[idx], [text wmf_summaryFromText]);
+    }];
+    XCTAssertEqualObjects([NSString wmf_summariesFromTexts:@[]], @[]);
+}
+
+- (void)measureBatchSummariesWithMaximumThreadCount:(NSUInteger)maximumThreadCount {
+    NSArray<NSString *> *texts = [self extractsForBatchSummaries];
+    [self measureBlock:^{
+        [NSString wmf_summariesFromTexts:texts maximumThreadCount:maximumThreadCount];
+    }];
+}
+
+- (void)testBatchSummariesPerformanceOnOneThread {
+    [self measureBatchSummariesWithMaximumThreadCount:1];
+}
+
+- (void)testBatchSummariesPerformanceOnTwoThreads {
+    [self measureBatchSummariesWithMaximumThreadCount:2];
+}
+
+- (void)testBatchSummariesPerformanceOnFourThreads {
+    [self measureBatchSummariesWithMaximumThreadCount:4];
+}
+
+- (void)testBatchSummariesPerformanceOnEightThreads {
+    [self measureBatchSummariesWithMaximumThreadCount:8];
+}
+
+- (void)testParenthesesRemovalPerformanceWithPathologicalNesting {
+    NSMutableString *string = [NSMutableString string];
+    for (NSInteger i = 0; i < 20000; i++) {
+        [string appendString:@"(a"];
+    }
+    for (NSInteger i = 0; i < 20000; i++) {
+        [string appendString:i % 2 == 0 ? @"b)" : @")()"];
+    }
+    [self measureBlock:^{
+        [string wmf_stringByRecursivelyRemovingParenthesizedContent];
+    }];
+}
+
 @end
@@ -6,6 +6,93 @@
 
 @end
 
+#pragma mark - NSURLComponents reference
+
+// The category used to take every URL apart with NSURLComponents and -componentsSeparatedByString:. These are those
+// implementations, kept to check that the parser gives the same results.
+
+static NSString *WMFReferenceLanguageCode(NSURL *URL) {
+    NSArray *hostComponents = [URL.host componentsSeparatedByString:@"."];
+    if (hostComponents.count < 3) {
+        return nil;
+    }
+    return [hostComponents[0] isEqualToString:@"m"] ? nil : hostComponents[0];
+}
+
+static NSString *WMFReferenceDomain(NSURL *URL) {
+    NSArray *hostComponents = [URL.host componentsSeparatedByString:@"."];
+    if (hostComponents.count < 3) {
+        return URL.host;
+    }
+    NSInteger firstIndex = [hostComponents[1] isEqualToString:@"m"] ? 2 : 1;
+    return [[hostComponents subarrayWithRange:NSMakeRange(firstIndex, hostComponents.count - firstIndex)] componentsJoinedByString:@"."];
+}
+
+static BOOL WMFReferenceIsMobile(NSURL *URL) {
+    NSArray *hostComponents = [URL.host componentsSeparatedByString:@"."];
+    return hostComponents.count >= 3 && ([hostComponents[0] isEqualToString:@"m"] || [hostComponents[1] isEqualToString:@"m"]);
+}
+
+static NSString *WMFReferenceTitle(NSURL *URL) {
+    if (![URL wmf_isWikiResource]) {
+        return nil;
+    }
+    return [[NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO] wmf_title];
+}
+
+static NSString *WMFReferenceTitleWithUnderscores(NSURL *URL) {
+    if (![URL wmf_isWikiResource]) {
+        return nil;
+    }
+    return [[NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO] wmf_titleWithUnderscores];
+}
+
+static NSURL *WMFReferenceSiteURL(NSURL *URL) {
+    NSURLComponents *components = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    components.path = nil;
+    components.fragment = nil;
+    return components.URL;
+}
+
+static NSURL *WMFReferenceURLWithPath(NSURL *URL, NSString *path, BOOL isMobile) {
+    NSURLComponents *components = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    components.path = [path precomposedStringWithCanonicalMapping];
+    if (isMobile != WMFReferenceIsMobile(URL)) {
+        components.host = [NSURLComponents wmf_hostWithDomain:WMFReferenceDomain(URL) languageCode:WMFReferenceLanguageCode(URL) isMobile:isMobile];
+    }
+    return components.URL;
+}
+
+static NSURL *WMFReferenceURLWithTitle(NSURL *URL, NSString *title) {
+    NSURLComponents *components = [NSURLComponents componentsWithURL:URL resolvingAgainstBaseURL:NO];
+    components.wmf_title = title;
+    return components.URL;
+}
+
+/// Every combination of some ordinary and some unusual URL parts.
+static NSArray<NSURL *> *WMFParsingCorpus(void) {
+    NSArray *prefixes = @[@"https://", @"http://", @"HTTPS://"];
+    NSArray *hosts = @[@"en.wikipedia.org", @"en.m.wikipedia.org", @"zh-yue.m.wikipedia.org", @"m.wikipedia.org", @"wikipedia.org", @"localhost:8080", @"EN.Wikipedia.ORG", @"en..wikipedia.org", @"en.m.m.wikipedia.org", @"user@en.wikipedia.org", @"[::1]:8080", @"en.wikipedia.org:080"];
+    NSArray *paths = @[@"/wiki/Dog", @"/wiki/Talk:India", @"/wiki/A_B_C", @"/wiki/%E6%97%A5%E6%9C%AC", @"/wiki/Cafe%CC%81", @"/wiki/%F0%9F%90%B6", @"/w/api.php", @"/", @"", @"/wiki/", @"/WIKI/Cat", @"/wiki/AC%2FDC", @"/wiki/Foo/", @"/wiki/A%20B", @"/wiki/a;b", @"/wiki/Line%0Abreak", @"/wiki/%E2%80%A8", @"/%77iki/Dog", @"/wiki/%C3%28"];
+    NSArray *suffixes = @[@"", @"#History", @"?action=edit", @"?a=b#c", @"#", @"?"];
+    NSMutableArray *URLs = [NSMutableArray array];
+    for (NSString *prefix in prefixes) {
+        for (NSString *host in hosts) {
+            for (NSString *path in paths) {
+                for (NSString *suffix in suffixes) {
+                    NSURL *URL = [NSURL URLWithString:[NSString stringWithFormat:@"%@%@%@%@", prefix, host, path, suffix]];
+                    if (URL) {
+                        [URLs addObject:URL];
+                    }
+                }
+            }
+        }
+    }
+    [URLs addObject:[NSURL URLWithString:@"/wiki/Dog" relativeToURL:[NSURL URLWithString:@"https://en.wikipedia.org"]]];
+    [URLs addObject:[NSURL URLWithString:@"/wiki/Dog"]];
+    return URLs;
+}
+
 @implementation NSURL_WMFLinkParsingTests
 
 - (void)testCitationURL {
@@ -68,6 +155,52 @@
     XCTAssertTrue([talkPageDatabaseKey isEqualToString:urlString]);
 }
 
+- (void)testParsedHostsMatchURLComponents {
+    for (NSURL *URL in WMFParsingCorpus()) {
+        XCTAssertEqualObjects(URL.wmf_languageCode, WMFReferenceLanguageCode(URL), @"%@", URL);
+        XCTAssertEqualObjects(URL.wmf_domain, WMFReferenceDomain(URL), @"%@", URL);
+        XCTAssertEqual(URL.wmf_isMobile, WMFReferenceIsMobile(URL), @"%@", URL);
+    }
+}
+
+- (void)testParsedTitlesMatchURLComponents {
+    for (NSURL *URL in WMFParsingCorpus()) {
+        XCTAssertEqualObjects(URL.wmf_title, WMFReferenceTitle(URL), @"%@", URL);
+        XCTAssertEqualObjects(URL.wmf_titleWithUnderscores, WMFReferenceTitleWithUnderscores(URL), @"%@", URL);
+    }
+}
+
+- (void)testParsedSiteAndAPIURLsMatchURLComponents {
+    for (NSURL *URL in WMFParsingCorpus()) {
+        XCTAssertEqualObjects(URL.wmf_siteURL.absoluteString, WMFReferenceSiteURL(URL).absoluteString, @"%@", URL);
+        for (NSNumber *isMobile in @[@YES, @NO]) {
+            NSURL *expected = WMFReferenceURLWithPath(WMFReferenceSiteURL(URL), WMFAPIPath, isMobile.boolValue);
+            NSURL *APIURL = isMobile.boolValue ? [NSURL wmf_mobileAPIURLForURL:URL] : [NSURL wmf_desktopAPIURLForURL:URL];
+            XCTAssertEqualObjects(APIURL.absoluteString, expected.absoluteString, @"%@", URL);
+            expected = WMFReferenceURLWithPath(URL, @"/api/rest_v1/page/summary/Caf\u00e9", isMobile.boolValue);
+            XCTAssertEqualObjects([URL wmf_URLWithPath:@"/api/rest_v1/page/summary/Caf\u00e9" isMobile:isMobile.boolValue].absoluteString, expected.absoluteString, @"%@", URL);
+        }
+    }
+}
+
+- (void)testURLsWithTitlesMatchURLComponents {
+    NSArray *titles = @[@"Dog", @"Talk:India", @"A B_C", @"\u65e5\u672c", @"Cafe\u0301", @"\U0001F436", @"AC/DC", @"100%", @"What?", @"#1", @".", @"..", @".hidden", @"", @"a&b=c+d"];
+    for (NSURL *URL in WMFParsingCorpus()) {
+        for (NSString *title in titles) {
+            XCTAssertEqualObjects([URL wmf_URLWithTitle:title].absoluteString, WMFReferenceURLWithTitle(URL, title).absoluteString, @"%@ %@", URL, title);
+        }
+    }
+}
+
+- (void)testParsedURLsKeepLanguageVariantCode {
+    NSURL *URL = [NSURL URLWithString:@"https://zh.m.wikipedia.org/wiki/%E4%B8%AD%E5%9C%8B#History"];
+    URL.wmf_languageVariantCode = @"zh-hant";
+    XCTAssertEqualObjects(URL.wmf_siteURL.wmf_languageVariantCode, @"zh-hant");
+    XCTAssertEqualObjects([NSURL wmf_desktopAPIURLForURL:URL].wmf_languageVariantCode, @"zh-hant");
+    XCTAssertEqualObjects([URL wmf_URLWithTitle:@"\u53f0\u7063"].wmf_languageVariantCode, @"zh-hant");
+    XCTAssertEqualObjects([NSURL wmf_desktopAPIURLForURL:URL].absoluteString, @"https://zh.wikipedia.org/w/api.php");
+}
+
 - (void)testLanguageVariantCodeProperty {
     NSURL *url = [[NSURL alloc] initWithString: @"https://zh.wikipedia.org"];
     XCTAssertNil(url.wmf_languageVariantCode);
@@ -85,4 +218,124 @@
     XCTAssertEqualObjects(url.wmf_languageVariantCode, languageVariantCode);
 }
 
+#pragma mark - In-memory keys
+
+static NSArray<NSString *> *WMFInMemoryKeyDatabaseKeys(NSUInteger count) {
+    NSMutableArray<NSString *> *databaseKeys = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        // Built fresh so that equal keys are never the same string instance
+        [databaseKeys addObject:[NSString stringWithFormat:@"https://zh.wikipedia.org/wiki/Article_%lu", (unsigned long)i]];
+    }
+    return databaseKeys;
+}
+
+- (void)testInMemoryKeysAreInterned {
+    NSString *databaseKey = @"https://zh.wikipedia.org/wiki/\u4e2d\u570b";
+    WMFInMemoryURLKey *key = [[WMFInMemoryURLKey alloc] initWithDatabaseKey:databaseKey languageVariantCode:@"zh-hant"];
+    XCTAssertEqual(key, [[WMFInMemoryURLKey alloc] initWithDatabaseKey:[databaseKey mutableCopy] languageVariantCode:[@"zh-hant" mutableCopy]]);
+    XCTAssertEqual(key, [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@"zh-hant"]);
+    XCTAssertEqual(key, [key copy]);
+    XCTAssertEqualObjects(key.databaseKey, databaseKey);
+    XCTAssertEqualObjects(key.languageVariantCode, @"zh-hant");
+
+    WMFInMemoryURLKey *otherVariantKey = [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@"zh-hans"];
+    WMFInMemoryURLKey *noVariantKey = [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:nil];
+    WMFInMemoryURLKey *emptyVariantKey = [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@""];
+    NSSet *keys = [NSSet setWithObjects:key, otherVariantKey, noVariantKey, emptyVariantKey, nil];
+    XCTAssertEqual(keys.count, 4);
+    XCTAssertFalse([key isEqualToInMemoryURLKey:otherVariantKey]);
+    XCTAssertNil(noVariantKey.languageVariantCode);
+    XCTAssertEqualObjects(emptyVariantKey.languageVariantCode, @"");
+}
+
+- (void)testInMemoryKeysFromURLsAreInterned {
+    NSURL *URL = [NSURL URLWithString:@"https://zh.m.wikipedia.org/wiki/%E4%B8%AD%E5%9C%8B#History"];
+    URL.wmf_languageVariantCode = @"zh-hant";
+    WMFInMemoryURLKey *key = URL.wmf_inMemoryKey;
+    XCTAssertEqual(key, [[WMFInMemoryURLKey alloc] initWithURL:URL]);
+    XCTAssertEqual(key, [WMFInMemoryURLKey internedKeyWithDatabaseKey:URL.wmf_databaseKey languageVariantCode:@"zh-hant"]);
+    XCTAssertEqual(key, key.URL.wmf_inMemoryKey);
+
+    URL.wmf_languageVariantCode = nil;
+    XCTAssertNotEqual(key, URL.wmf_inMemoryKey);
+    XCTAssertEqualObjects(URL.wmf_inMemoryKey.databaseKey, key.databaseKey);
+}
+
+- (void)testInMemoryKeysAreReleasedWhenUnused {
+    __weak WMFInMemoryURLKey *weakKey = nil;
+    @autoreleasepool {
+        WMFInMemoryURLKey *key = [WMFInMemoryURLKey internedKeyWithDatabaseKey:@"https://en.wikipedia.org/wiki/Transient" languageVariantCode:nil];
+        weakKey = key;
+        XCTAssertNotNil(weakKey);
+    }
+    XCTAssertNil(weakKey);
+    WMFInMemoryURLKey *key = [WMFInMemoryURLKey internedKeyWithDatabaseKey:@"https://en.wikipedia.org/wiki/Transient" languageVariantCode:nil];
+    XCTAssertEqualObjects(key.databaseKey, @"https://en.wikipedia.org/wiki/Transient");
+    XCTAssertEqual(key, [WMFInMemoryURLKey internedKeyWithDatabaseKey:@"https://en.wikipedia.org/wiki/Transient" languageVariantCode:nil]);
+}
+
+- (void)testInMemoryKeysAreInternedAcrossThreads {
+    NSArray<NSString *> *databaseKeys = WMFInMemoryKeyDatabaseKeys(100);
+    NSMutableArray<WMFInMemoryURLKey *> *expectedKeys = [NSMutableArray arrayWithCapacity:databaseKeys.count];
+    for (NSString *databaseKey in databaseKeys) {
+        [expectedKeys addObject:[WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@"zh-hant"]];
+    }
+    __block NSUInteger mismatches = 0;
+    dispatch_apply(16, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t iteration) {
+        NSUInteger iterationMismatches = 0;
+        for (NSUInteger i = 0; i < databaseKeys.count; i++) {
+            @autoreleasepool {
+                // Keys that are only used on one thread come and go while the others are looked up
+                [WMFInMemoryURLKey internedKeyWithDatabaseKey:[NSString stringWithFormat:@"%@_%zu", databaseKeys[i], iteration] languageVariantCode:nil];
+                if ([WMFInMemoryURLKey internedKeyWithDatabaseKey:[databaseKeys[i] copy] languageVariantCode:@"zh-hant"] != expectedKeys[i]) {
+                    iterationMismatches++;
+                }
+            }
+        }
+        @synchronized(expectedKeys) {
+            mismatches += iterationMismatches;
+        }
+    });
+    XCTAssertEqual(mismatches, 0);
+}
+
+- (void)testInMemoryKeyArticleCacheLookupPerformance {
+    // The article cache in MWKDataStore is looked up with a key made from a database key string and a variant on
+    // every fetch. Measures the time and memory of doing that for 1,000 articles 100 times over.
+    NSArray<NSString *> *databaseKeys = WMFInMemoryKeyDatabaseKeys(1000);
+    NSCache<WMFInMemoryURLKey *, NSString *> *cache = [[NSCache alloc] init];
+    for (NSString *databaseKey in databaseKeys) {
+        [cache setObject:databaseKey forKey:[WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@"zh-hant"]];
+    }
+    NSArray<NSString *> *lookupKeys = WMFInMemoryKeyDatabaseKeys(1000);
+    [self measureWithMetrics:@[[[XCTClockMetric alloc] init], [[XCTMemoryMetric alloc] init]]
+                       block:^{
+                           NSUInteger hits = 0;
+                           for (NSUInteger i = 0; i < 100; i++) {
+                               for (NSString *databaseKey in lookupKeys) {
+                                   WMFInMemoryURLKey *key = [WMFInMemoryURLKey internedKeyWithDatabaseKey:databaseKey languageVariantCode:@"zh-hant"];
+                                   hits += [cache objectForKey:key] != nil ? 1 : 0;
+                               }
+                           }
+                           XCTAssertEqual(hits, 100 * lookupKeys.count);
+                       }];
+}
+
+- (void)testInMemoryKeyFromURLPerformance {
+    NSMutableArray<NSURL *> *URLs = [NSMutableArray array];
+    for (NSString *databaseKey in WMFInMemoryKeyDatabaseKeys(1000)) {
+        [URLs addObject:[NSURL URLWithString:databaseKey]];
+    }
+    [self measureWithMetrics:@[[[XCTClockMetric alloc] init], [[XCTMemoryMetric alloc] init]]
+                       block:^{
+                           NSMutableSet<WMFInMemoryURLKey *> *keys = [NSMutableSet setWithCapacity:URLs.count];
+                           for (NSUInteger i = 0; i < 100; i++) {
+                               for (NSURL *URL in URLs) {
+                                   [keys addObject:URL.wmf_inMemoryKey];
+                               }
+                           }
+                           XCTAssertEqual(keys.count, URLs.count);
+                       }];
+}
+
 @end
@@ -155,6 +155,30 @@ class ReadingListsTests: XCTestCase {
             XCTAssert(false, "Should be able to add articles to \(readingListName) reading list: \(error)")
         }
     }
+    
+    func testArticleCachedValuesFollowChanges() {
+        guard let article = dataStore.fetchOrCreateArticle(with: URL(string: "//en.wikipedia.org/wiki/Foo")!) else {
+            XCTFail("Should be able to create an article")
+            return
+        }
+        
+        // The in-memory key is made again when the key or variant is set
+        let key = article.inMemoryKey
+        XCTAssertEqual(article.inMemoryKey, key)
+        article.variant = "zh-hant"
+        XCTAssertEqual(article.inMemoryKey?.languageVariantCode, "zh-hant")
+        article.key = "https://en.wikipedia.org/wiki/Bar"
+        XCTAssertEqual(article.inMemoryKey?.databaseKey, "https://en.wikipedia.org/wiki/Bar")
+        
+        // Sorted reading lists follow lists the article is added to through the lists themselves
+        XCTAssertEqual(article.sortedNonDefaultReadingLists, [])
+        do {
+            let readingList = try dataStore.readingListsController.createReadingList(named: "foo", description: "Foo", with: [article])
+            XCTAssertEqual(article.sortedNonDefaultReadingLists, [readingList])
+        } catch let error {
+            XCTAssert(false, "Should be able to add the article to a reading list: \(error)")
+        }
+    }
 }
 
 extension Array where Element: Hashable {
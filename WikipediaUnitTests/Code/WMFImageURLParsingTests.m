@@ -1,10 +1,105 @@
 #import <XCTest/XCTest.h>
 #import "WMFImageURLParsing.h"
+#import "WMFImageSourceURL.h"
+#import "WMFTextBuffer.h"
 
 @interface WMFImageURLParsingTests : XCTestCase
 
 @end
 
+#pragma mark - Foundation reference
+
+// WMFImageURLParsing used to take source URLs apart with NSString path methods and a regular expression. These are
+// those implementations, kept to check that the scanner gives the same results.
+
+static NSString *WMFReferenceImageName(NSString *sourceURL) {
+    NSRange lastSlash = [sourceURL rangeOfString:@"/" options:NSBackwardsSearch];
+    if (lastSlash.location == NSNotFound) {
+        return nil;
+    }
+    if (![sourceURL containsString:@"/thumb/"]) {
+        return [sourceURL lastPathComponent];
+    }
+    NSRange previousSlash = [sourceURL rangeOfString:@"/" options:NSBackwardsSearch range:NSMakeRange(0, lastSlash.location)];
+    NSUInteger start = previousSlash.location == NSNotFound ? 0 : previousSlash.location + 1;
+    return [sourceURL substringWithRange:NSMakeRange(start, lastSlash.location - start)];
+}
+
+static NSInteger WMFReferenceSizePrefix(NSString *sourceURL) {
+    if (![sourceURL containsString:@"/thumb/"]) {
+        return NSNotFound;
+    }
+    NSString *fileName = [sourceURL lastPathComponent];
+    if (fileName.length == 0) {
+        return NSNotFound;
+    }
+    NSRange pxRange = [fileName rangeOfString:@"px-"];
+    if (pxRange.location == NSNotFound) {
+        return NSNotFound;
+    }
+    NSString *stringBeforePx = [fileName substringToIndex:pxRange.location];
+    NSRange lastDashRange = [stringBeforePx rangeOfString:@"-" options:NSBackwardsSearch];
+    NSInteger result = lastDashRange.location == NSNotFound ? stringBeforePx.integerValue : [stringBeforePx substringFromIndex:lastDashRange.location + 1].integerValue;
+    return result == 0 ? NSNotFound : result;
+}
+
+static NSString *WMFReferenceChangeSizePrefix(NSString *sourceURL, NSInteger newSizePrefix) {
+    if (newSizePrefix < 1) {
+        newSizePrefix = 1;
+    }
+    NSString *wikipediaString = @"/wikipedia/";
+    NSRange wikipediaStringRange = [sourceURL rangeOfString:wikipediaString];
+    if (sourceURL.length == 0 || wikipediaStringRange.location == NSNotFound) {
+        return sourceURL;
+    }
+    NSString *urlAfterWikipedia = [sourceURL substringFromIndex:NSMaxRange(wikipediaStringRange)];
+    NSRange rangeOfSlashAfterWikipedia = [urlAfterWikipedia rangeOfString:@"/"];
+    if (rangeOfSlashAfterWikipedia.location == NSNotFound) {
+        return sourceURL;
+    }
+    NSString *site = [urlAfterWikipedia substringToIndex:rangeOfSlashAfterWikipedia.location];
+    if (site.length == 0) {
+        return sourceURL;
+    }
+    NSString *lastPathComponent = [sourceURL lastPathComponent];
+    if (WMFReferenceSizePrefix(sourceURL) == NSNotFound) {
+        NSString *sizeVariantLastPathComponent = [NSString stringWithFormat:@"%lupx-%@", (unsigned long)newSizePrefix, lastPathComponent];
+        NSString *lowerCasePathExtension = [[sourceURL pathExtension] lowercaseString];
+        if ([lowerCasePathExtension isEqualToString:@"pdf"]) {
+            sizeVariantLastPathComponent = [NSString stringWithFormat:@"page1-%@.jpg", sizeVariantLastPathComponent];
+        } else if ([lowerCasePathExtension isEqualToString:@"tif"] || [lowerCasePathExtension isEqualToString:@"tiff"]) {
+            sizeVariantLastPathComponent = [NSString stringWithFormat:@"lossy-page1-%@.jpg", sizeVariantLastPathComponent];
+        } else if ([lowerCasePathExtension isEqualToString:@"svg"]) {
+            sizeVariantLastPathComponent = [NSString stringWithFormat:@"%@.png", sizeVariantLastPathComponent];
+        }
+        NSString *urlWithSizeVariantLastPathComponent = [[sourceURL stringByAppendingString:@"/"] stringByAppendingString:sizeVariantLastPathComponent];
+        return [urlWithSizeVariantLastPathComponent stringByReplacingOccurrencesOfString:[NSString stringWithFormat:@"%@%@/", wikipediaString, site] withString:[NSString stringWithFormat:@"%@%@/thumb/", wikipediaString, site]];
+    }
+    NSRegularExpression *regex = [NSRegularExpression regularExpressionWithPattern:@"^(lossy-|lossless-)?(page\\d+-)?\\d+px-(.*)" options:0 error:nil];
+    NSRange rangeOfLastPathComponent = NSMakeRange([sourceURL rangeOfString:lastPathComponent options:NSBackwardsSearch].location, lastPathComponent.length);
+    return [regex stringByReplacingMatchesInString:sourceURL options:NSMatchingAnchored range:rangeOfLastPathComponent withTemplate:[NSString stringWithFormat:@"$1$2%lupx-$3", (unsigned long)newSizePrefix]];
+}
+
+/// Source URLs like the ones in article HTML, with every thumbnail prefix the servers make and some they don't.
+static NSArray<NSString *> *WMFImageSourceURLCorpus(void) {
+    NSArray *prefixes = @[@"https://upload.wikimedia.org/wikipedia/commons", @"//upload.wikimedia.org/wikipedia/en", @"//upload.wikimedia.org/wikipedia/", @"//upload.wikimedia.org/wikipedia", @"/wikimedia/commons"];
+    NSArray *names = @[@"Buteo_magnirostris.jpg", @"A_Fish_and_a_Gift.pdf", @"Gerald_Ford_-_NARA_-_530680.tif", @"Funk.TIFF", @"Access_to_drinking_water_in_third_world.svg", @"300px-Geothermgradients.png", @"Claude_Monet%2C_1870.jpg", @"NoExtension", @".hidden", @"Caf\u00e9.jpg", @"Cafe\u0301.jpg"];
+    NSArray *thumbnailPrefixes = @[@"220px-", @"lossy-page1-220px-", @"lossless-page2-220px-", @"page1-240px-", @"lossy-220px-", @"", @"0px-", @"foo-200px-", @"+5px-", @"page12px-", @"px-", @"-px-", @" 20px-", @"page1-px-", @"Lossy-page1-220px-", @"page1-2-240px-", @"007px-", @"\u0662\u0662\u0660px-", @"page\u0661-220px-"];
+    NSArray *suffixes = @[@"", @".jpg", @"/"];
+    NSMutableArray *sourceURLs = [NSMutableArray arrayWithArray:@[@"", @"/", @"//", @"a", @"/a", @"thumb/220px-a", @"/thumb/", @"//upload.wikimedia.org/wikipedia/commons/thumb/4/41/200px-Potato.jpg/", @"//upload.wikimedia.org/wikipedia/commons/thumb/a/a5/Dog.jpg/220px-Dog.jpg//"]];
+    for (NSString *prefix in prefixes) {
+        for (NSString *name in names) {
+            [sourceURLs addObject:[NSString stringWithFormat:@"%@/4/41/%@", prefix, name]];
+            for (NSString *thumbnailPrefix in thumbnailPrefixes) {
+                for (NSString *suffix in suffixes) {
+                    [sourceURLs addObject:[NSString stringWithFormat:@"%@/thumb/4/41/%@/%@%@%@", prefix, name, thumbnailPrefix, name, suffix]];
+                }
+            }
+        }
+    }
+    return sourceURLs;
+}
+
 @implementation WMFImageURLParsingTests
 
 - (NSCharacterSet *)allowedCharacters {
@@ -249,4 +344,114 @@
     XCTAssert([WMFChangeImageSourceURLSizePrefix(@"https://upload.wikimedia.org/wikipedia/commons/5/55/Charles_Vanderhoop%2C_Jr.%2C_Gay_Head_Light_Assistant_Keeper%2C_with_visiting_island_school_children.TIFF", 800) isEqualToString:@"https://upload.wikimedia.org/wikipedia/commons/thumb/5/55/Charles_Vanderhoop%2C_Jr.%2C_Gay_Head_Light_Assistant_Keeper%2C_with_visiting_island_school_children.TIFF/lossy-page1-800px-Charles_Vanderhoop%2C_Jr.%2C_Gay_Head_Light_Assistant_Keeper%2C_with_visiting_island_school_children.TIFF.jpg"]);
 }
 
+#pragma mark - Scanner parity
+
+- (void)testParsedNamesMatchFoundation {
+    for (NSString *sourceURL in WMFImageSourceURLCorpus()) {
+        XCTAssertEqualObjects(WMFParseImageNameFromSourceURL(sourceURL), WMFReferenceImageName(sourceURL), @"%@", sourceURL);
+    }
+}
+
+- (void)testParsedSizePrefixesMatchFoundation {
+    for (NSString *sourceURL in WMFImageSourceURLCorpus()) {
+        XCTAssertEqual(WMFParseSizePrefixFromSourceURL(sourceURL), WMFReferenceSizePrefix(sourceURL), @"%@", sourceURL);
+    }
+}
+
+- (void)testChangedSizePrefixesMatchFoundation {
+    for (NSString *sourceURL in WMFImageSourceURLCorpus()) {
+        for (NSNumber *newSizePrefix in @[@480, @1, @0, @-5]) {
+            XCTAssertEqualObjects(WMFChangeImageSourceURLSizePrefix(sourceURL, newSizePrefix.integerValue), WMFReferenceChangeSizePrefix(sourceURL, newSizePrefix.integerValue), @"%@", sourceURL);
+        }
+    }
+}
+
+- (void)testParsedQualifiers {
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, @"//upload.wikimedia.org/wikipedia/commons/thumb/d/d0/Gerald_Ford_-_NARA_-_530680.tif/lossless-page2-220px-Gerald_Ford_-_NARA_-_530680.tif.png");
+    WMFImageSourceURLParts parts;
+    WMFImageSourceURLParse(buffer.characters, WMFTextSpanMake(0, buffer.length), &parts);
+    XCTAssertTrue(parts.isThumbnail);
+    XCTAssertTrue(parts.hasThumbnailPrefix);
+    XCTAssertEqual(parts.quality, WMFImageSourceURLQualityLossless);
+    XCTAssertTrue(parts.hasPage);
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.page), @"2");
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.width), @"220");
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.site), @"commons");
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.name), @"Gerald_Ford_-_NARA_-_530680.tif");
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.extension), @"tif");
+    WMFTextBufferRelease(&buffer);
+
+    WMFTextBufferInit(&buffer, @"//upload.wikimedia.org/wikipedia/commons/4/41/.hidden");
+    WMFImageSourceURLParse(buffer.characters, WMFTextSpanMake(0, buffer.length), &parts);
+    XCTAssertFalse(parts.isThumbnail);
+    XCTAssertFalse(parts.hasThumbnailPrefix);
+    XCTAssertEqual(parts.quality, WMFImageSourceURLQualityDefault);
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, parts.name), @".hidden");
+    XCTAssertEqual(parts.extension.length, 0);
+    WMFTextBufferRelease(&buffer);
+}
+
+- (void)testSourceSetNames {
+    NSString *sourceSet = @"//upload.wikimedia.org/wikipedia/commons/thumb/d/d0/Ford.tif/lossy-page1-330px-Ford.tif.jpg 1.5x, //upload.wikimedia.org/wikipedia/commons/thumb/4/41/Dog.jpg/440px-Dog.jpg 2x,//upload.wikimedia.org/wikipedia/commons/4/41/Cat.jpg,, no-slashes 3x";
+    XCTAssertEqualObjects(WMFParseImageNamesFromSourceSet(sourceSet), (@[@"Ford.tif", @"Dog.jpg", @"Cat.jpg"]));
+    XCTAssertEqualObjects(WMFParseImageNamesFromSourceSet(@" , "), @[]);
+}
+
+- (void)testSourceSetNamesMatchSourceURLNames {
+    NSArray<NSString *> *sourceURLs = WMFImageSourceURLCorpus();
+    NSArray *descriptors = @[@" 1x", @" 1.5x", @"", @"  2x ", @" 640w"];
+    NSUInteger count = 0;
+    NSMutableArray *sourceSet = [NSMutableArray array];
+    NSMutableArray *expectedNames = [NSMutableArray array];
+    for (NSString *sourceURL in sourceURLs) {
+        // Source set URLs can't have white space or commas in them
+        NSString *name = WMFParseImageNameFromSourceURL(sourceURL);
+        if (!name || [sourceURL rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@" ,"]].location != NSNotFound) {
+            continue;
+        }
+        [sourceSet addObject:[sourceURL stringByAppendingString:descriptors[count % descriptors.count]]];
+        [expectedNames addObject:name];
+        count++;
+    }
+    XCTAssertEqualObjects(WMFParseImageNamesFromSourceSet([sourceSet componentsJoinedByString:@", "]), expectedNames);
+}
+
+- (void)testSourceSetCandidatesMatchSourceURLParsing {
+    NSMutableCharacterSet *separators = [NSMutableCharacterSet whitespaceAndNewlineCharacterSet];
+    [separators addCharactersInString:@","];
+    for (NSString *sourceURL in WMFImageSourceURLCorpus()) {
+        // Source set URLs can't have white space or commas in them
+        if (sourceURL.length == 0 || [sourceURL rangeOfCharacterFromSet:separators].location != NSNotFound) {
+            continue;
+        }
+        NSString *name = WMFParseImageNameFromSourceURL(sourceURL);
+        XCTAssertEqualObjects(WMFParseImageNamesFromSourceSet([NSString stringWithFormat:@" %@ 2x,", sourceURL]), name ? @[name] : @[], @"%@", sourceURL);
+
+        WMFTextBuffer buffer;
+        WMFTextBufferInit(&buffer, [NSString stringWithFormat:@"%@ 1x, %@", sourceURL, sourceURL]);
+        WMFImageSourceSetCandidate candidates[2];
+        XCTAssertEqual(WMFImageSourceSetParse(buffer.characters, buffer.length, candidates, 2), 2, @"%@", sourceURL);
+        for (size_t i = 0; i < 2; i++) {
+            XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, candidates[i].URL), sourceURL);
+            if (candidates[i].parts.isASCII) {
+                NSInteger sizePrefix = candidates[i].parts.hasSizePrefix ? (NSInteger)candidates[i].parts.sizePrefix : NSNotFound;
+                XCTAssertEqual(sizePrefix, WMFParseSizePrefixFromSourceURL(sourceURL), @"%@", sourceURL);
+            }
+        }
+        WMFTextBufferRelease(&buffer);
+    }
+}
+
+- (void)testSourceURLParsingPerformance {
+    NSArray<NSString *> *sourceURLs = WMFImageSourceURLCorpus();
+    [self measureBlock:^{
+        for (NSString *sourceURL in sourceURLs) {
+            WMFParseImageNameFromSourceURL(sourceURL);
+            WMFParseSizePrefixFromSourceURL(sourceURL);
+            WMFChangeImageSourceURLSizePrefix(sourceURL, 480);
+        }
+    }];
+}
+
 @end
@@ -48,6 +48,19 @@
 }
 
 
+- (void)testFeedArticlePreviewSummarizesExtractOnce {
+    NSDictionary *resultJSON = [[self wmf_bundle] wmf_jsonFromContentsOfFile:@"FeedDayResponse-en"];
+    NSError *mantleError = nil;
+    WMFFeedDayResponse *responseObject = [MTLJSONAdapter modelOfClass:[WMFFeedDayResponse class] fromJSONDictionary:resultJSON languageVariantCode:nil error:&mantleError];
+    XCTAssertNil(mantleError);
+    WMFFeedArticlePreview *preview = responseObject.featuredArticle;
+    XCTAssertNotNil(preview.extract);
+    NSString *snippet = preview.snippet;
+    XCTAssertGreaterThan(snippet.length, 0);
+    XCTAssertNil(preview.extract);
+    XCTAssertEqual(preview.snippet, snippet);
+}
+
 #pragma mark - Language Variant Propagation Testing
 
 // Note, this also implicitly tests the subelement types WMFFeedArticlePreview, WMFFeedTopReadResponse, WMFFeedTopReadArticlePreview, WMFFeedImage, WMFFeedNewsStory
@@ -0,0 +1,130 @@
+#import <XCTest/XCTest.h>
+#import "WMFTextBuffer.h"
+
+@interface WMFTextScanningTests : XCTestCase
+
+@end
+
+@implementation WMFTextScanningTests
+
+- (void)testIndexOfCharacterMatchesRangeOfString {
+    NSArray<NSString *> *strings = @[@"", @"/", @"a/b", @"abcdefghijklmnop/", @"abcdefgh/ijklmnop/qrst", @"éééééééééééééééé/é", @"no slashes here at all"];
+    for (NSString *string in strings) {
+        WMFTextBuffer buffer;
+        WMFTextBufferInit(&buffer, string);
+        for (NSUInteger location = 0; location <= string.length; location++) {
+            NSRange range = [string rangeOfString:@"/" options:NSLiteralSearch range:NSMakeRange(location, string.length - location)];
+            size_t expected = range.location == NSNotFound ? string.length : range.location;
+            XCTAssertEqual(WMFTextIndexOfCharacter(buffer.characters, buffer.length, location, '/'), expected, @"%@ from %lu", string, (unsigned long)location);
+        }
+        NSRange lastRange = [string rangeOfString:@"/" options:NSBackwardsSearch];
+        XCTAssertEqual(WMFTextLastIndexOfCharacter(buffer.characters, buffer.length, buffer.length, '/'), lastRange.location == NSNotFound ? string.length : lastRange.location, @"%@", string);
+        WMFTextBufferRelease(&buffer);
+    }
+}
+
+- (void)testIndexOfEitherCharacter {
+    NSString *string = @"Text before any markup, then &amp; and <b>";
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    XCTAssertEqual(WMFTextIndexOfEitherCharacter(buffer.characters, buffer.length, 0, '<', '&'), [string rangeOfString:@"&"].location);
+    XCTAssertEqual(WMFTextIndexOfEitherCharacter(buffer.characters, buffer.length, [string rangeOfString:@"&"].location + 1, '<', '&'), [string rangeOfString:@"<"].location);
+    XCTAssertEqual(WMFTextIndexOfEitherCharacter(buffer.characters, buffer.length, 0, '{', '}'), string.length);
+    WMFTextBufferRelease(&buffer);
+}
+
+- (void)testIndexOfString {
+    NSString *string = @"//upload.wikimedia.org/wikipedia/commons/thumb/4/41/Potato.jpg/200px-Potato.jpg";
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, 0, "/thumb/"), [string rangeOfString:@"/thumb/"].location);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, 0, "/wikipedia/"), [string rangeOfString:@"/wikipedia/"].location);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, 0, "/thumbs/"), string.length);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, 0, ""), string.length);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, 0, "Potato.jpg"), [string rangeOfString:@"Potato.jpg"].location);
+    XCTAssertEqual(WMFTextIndexOfASCIIString(buffer.characters, buffer.length, [string rangeOfString:@"Potato.jpg"].location + 1, "Potato.jpg"), [string rangeOfString:@"Potato.jpg" options:NSBackwardsSearch].location);
+    WMFTextBufferRelease(&buffer);
+}
+
+- (void)testNextComponentMatchesComponentsSeparatedByString {
+    NSArray<NSString *> *strings = @[@"", @"/", @"//", @"a", @"/a/", @"a//b", @"https://upload.wikimedia.org/wikipedia/commons/a/a5/Buteo_magnirostris.jpg"];
+    for (NSString *string in strings) {
+        WMFTextBuffer buffer;
+        WMFTextBufferInit(&buffer, string);
+        NSMutableArray<NSString *> *components = [NSMutableArray array];
+        size_t location = 0;
+        WMFTextSpan component;
+        while (WMFTextNextComponent(buffer.characters, buffer.length, '/', &location, &component)) {
+            [components addObject:WMFTextBufferSubstring(&buffer, component)];
+        }
+        XCTAssertEqualObjects(components, [string componentsSeparatedByString:@"/"]);
+        WMFTextBufferRelease(&buffer);
+    }
+}
+
+- (void)testSpanComparison {
+    NSString *string = @"  <BR/> Potato 640px- ";
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    WMFTextSpan trimmed = WMFTextSpanTrimmingWhitespace(buffer.characters, WMFTextSpanMake(0, buffer.length));
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, trimmed), @"<BR/> Potato 640px-");
+    XCTAssertTrue(WMFTextSpanEqualsASCIIStringIgnoringCase(buffer.characters, WMFTextSpanMake(3, 3), "br/"));
+    XCTAssertFalse(WMFTextSpanEqualsASCIIString(buffer.characters, WMFTextSpanMake(3, 3), "br/"));
+    XCTAssertTrue(WMFTextSpanEqualsASCIIString(buffer.characters, WMFTextSpanMake(8, 6), "Potato"));
+    XCTAssertFalse(WMFTextSpanEqualsASCIIString(buffer.characters, WMFTextSpanMake(8, 6), "Potatoes"));
+    XCTAssertTrue(WMFTextSpanHasASCIIPrefix(buffer.characters, WMFTextSpanMake(8, 6), "Pot"));
+    XCTAssertFalse(WMFTextSpanHasASCIIPrefix(buffer.characters, WMFTextSpanMake(8, 2), "Pot"));
+    XCTAssertEqual(WMFTextSpanIntegerValue(buffer.characters, WMFTextSpanMake(15, 5)), 640);
+    XCTAssertEqual(WMFTextSpanIntegerValue(buffer.characters, WMFTextSpanMake(8, 6)), 0);
+    XCTAssertLessThan(WMFTextCompareSpans(buffer.characters, WMFTextSpanMake(8, 3), buffer.characters, WMFTextSpanMake(8, 6)), 0);
+    XCTAssertEqual(WMFTextCompareSpans(buffer.characters, WMFTextSpanMake(8, 6), buffer.characters, WMFTextSpanMake(8, 6)), 0);
+    XCTAssertGreaterThan(WMFTextCompareSpans(buffer.characters, WMFTextSpanMake(8, 6), buffer.characters, WMFTextSpanMake(3, 2)), 0);
+    WMFTextBufferRelease(&buffer);
+}
+
+- (void)testIsASCII {
+    XCTAssertTrue(WMFTextIsASCII(NULL, 0));
+    for (NSUInteger length = 1; length < 40; length++) {
+        NSString *ASCIIString = [@"" stringByPaddingToLength:length withString:@"abc" startingAtIndex:0];
+        WMFTextBuffer buffer;
+        WMFTextBufferInit(&buffer, ASCIIString);
+        XCTAssertTrue(WMFTextIsASCII(buffer.characters, buffer.length));
+        WMFTextBufferRelease(&buffer);
+        NSString *nonASCIIString = [ASCIIString stringByAppendingString:@"é"];
+        WMFTextBufferInit(&buffer, nonASCIIString);
+        XCTAssertFalse(WMFTextIsASCII(buffer.characters, buffer.length));
+        WMFTextBufferRelease(&buffer);
+    }
+}
+
+- (void)testBufferCopiesLongStringsThatCantBeBorrowed {
+    // Mutable strings never expose their storage, so these are always copied
+    NSMutableString *shortString = [@"short" mutableCopy];
+    NSMutableString *longString = [[@"" stringByPaddingToLength:WMFTextBufferInlineCapacity * 4 withString:@"long " startingAtIndex:0] mutableCopy];
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, shortString);
+    XCTAssertTrue(buffer.heapStorage == NULL);
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, WMFTextSpanMake(0, buffer.length)), shortString);
+    WMFTextBufferRelease(&buffer);
+    WMFTextBufferInit(&buffer, longString);
+    XCTAssertTrue(buffer.heapStorage != NULL);
+    XCTAssertEqualObjects(WMFTextBufferSubstring(&buffer, WMFTextSpanMake(0, buffer.length)), longString);
+    unichar *storage = WMFTextBufferTakeHeapStorage(&buffer);
+    XCTAssertTrue(storage == buffer.characters);
+    WMFTextBufferRelease(&buffer);
+    free(storage);
+}
+
+- (void)testIndexOfCharacterPerformance {
+    NSString *string = [[@"" stringByPaddingToLength:1 << 20 withString:@"An article of text without the character. " startingAtIndex:0] stringByAppendingString:@"~"];
+    WMFTextBuffer buffer;
+    WMFTextBufferInit(&buffer, string);
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 100; i++) {
+            XCTAssertEqual(WMFTextIndexOfCharacter(buffer.characters, buffer.length, 0, '~'), buffer.length - 1);
+        }
+    }];
+    WMFTextBufferRelease(&buffer);
+}
+
+@end